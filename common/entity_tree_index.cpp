@@ -0,0 +1,153 @@
+#include "entity_tree_index.hpp"
+
+#include <cstdlib>
+
+namespace pldm
+{
+namespace utils
+{
+
+EntityTreeIndex::EntityTreeIndex(pldm_entity_association_tree* tree) :
+    entityTree(tree)
+{
+    rebuild();
+}
+
+pldm_entity_node* EntityTreeIndex::addEntity(
+    pldm_entity* entity, uint16_t entityInstanceNum, pldm_entity_node* parent,
+    uint8_t associationType, bool isRemote, bool isUpdateContainerId,
+    uint16_t containerId)
+{
+    auto node = pldm_entity_association_tree_add_entity(
+        entityTree, entity, entityInstanceNum, parent, associationType,
+        isRemote, isUpdateContainerId, containerId);
+    if (node)
+    {
+        insert(node);
+    }
+    return node;
+}
+
+pldm_entity_node* EntityTreeIndex::findWithLocality(pldm_entity* entity,
+                                                    bool isRemote)
+{
+    if (!entity)
+    {
+        return nullptr;
+    }
+    if (!complete)
+    {
+        return pldm_entity_association_tree_find_with_locality(
+            entityTree, entity, isRemote);
+    }
+
+    auto key = isRemote ? makeKey(Lookup::Remote, entity->entity_type,
+                                  entity->entity_instance_num,
+                                  entity->entity_container_id)
+                        : makeKey(Lookup::Local, entity->entity_type,
+                                  entity->entity_instance_num, 0);
+    auto it = nodes.find(key);
+    if (it == nodes.end())
+    {
+        return nullptr;
+    }
+    if (!it->second)
+    {
+        return pldm_entity_association_tree_find_with_locality(
+            entityTree, entity, isRemote);
+    }
+
+    entity->entity_container_id =
+        pldm_entity_extract(it->second).entity_container_id;
+    return it->second;
+}
+
+pldm_entity_node* EntityTreeIndex::findEntityRef(const pldm_entity& entity)
+{
+    auto it = nodes.find(makeKey(Lookup::Exact, entity.entity_type,
+                                 entity.entity_instance_num,
+                                 entity.entity_container_id));
+    if (complete && it == nodes.end())
+    {
+        return nullptr;
+    }
+    if (!complete || !it->second)
+    {
+        pldm_entity_node* node = nullptr;
+        pldm_find_entity_ref_in_tree(entityTree, entity, &node);
+        return node;
+    }
+    return it->second;
+}
+
+void EntityTreeIndex::rebuild()
+{
+    nodes.clear();
+    complete = true;
+    if (!entityTree || pldm_is_empty_entity_assoc_tree(entityTree))
+    {
+        return;
+    }
+
+    pldm_entity* entities = nullptr;
+    size_t numEntities = 0;
+    pldm_entity_association_tree_visit(entityTree, &entities, &numEntities);
+
+    std::unordered_map<Key, size_t> exactCount;
+    for (size_t i = 0; i < numEntities; ++i)
+    {
+        ++exactCount[makeKey(Lookup::Exact, entities[i].entity_type,
+                             entities[i].entity_instance_num,
+                             entities[i].entity_container_id)];
+    }
+
+    for (size_t i = 0; i < numEntities; ++i)
+    {
+        const auto& entity = entities[i];
+        if (exactCount.at(makeKey(Lookup::Exact, entity.entity_type,
+                                  entity.entity_instance_num,
+                                  entity.entity_container_id)) > 1)
+        {
+            // Identical entities can't be told apart by
+            // pldm_find_entity_ref_in_tree(), so not every node is reachable
+            // and lookups have to fall back to walking the tree.
+            complete = false;
+            continue;
+        }
+
+        pldm_entity_node* node = nullptr;
+        pldm_find_entity_ref_in_tree(entityTree, entity, &node);
+        if (node)
+        {
+            insert(node);
+        }
+    }
+    free(entities);
+}
+
+void EntityTreeIndex::insert(pldm_entity_node* node)
+{
+    auto entity = pldm_entity_extract(node);
+    insertKey(makeKey(Lookup::Local, entity.entity_type,
+                      entity.entity_instance_num, 0),
+              node);
+    insertKey(makeKey(Lookup::Remote, entity.entity_type,
+                      entity.entity_instance_num,
+                      pldm_entity_node_get_remote_container_id(node)),
+              node);
+    insertKey(makeKey(Lookup::Exact, entity.entity_type,
+                      entity.entity_instance_num, entity.entity_container_id),
+              node);
+}
+
+void EntityTreeIndex::insertKey(Key key, pldm_entity_node* node)
+{
+    auto [it, inserted] = nodes.try_emplace(key, node);
+    if (!inserted && it->second != node)
+    {
+        it->second = nullptr;
+    }
+}
+
+} // namespace utils
+} // namespace pldm
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <libpldm/pdr.h>
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace pldm
+{
+namespace utils
+{
+
+/** @class EntityTreeIndex
+ *
+ *  @brief Hash index over the nodes of a PLDM entity association tree
+ *
+ *  libpldm resolves entities by walking the whole tree, so merging N entity
+ *  association PDRs costs O(N * tree). This index mirrors the three lookups
+ *  used by pldmd (local, remote and exact container ID) in hash maps keyed by
+ *  entity type, instance number, container ID and locality. Nodes have to be
+ *  added to the tree through the index (or the index rebuilt) to keep it
+ *  consistent. A key matching more than one node is marked ambiguous and is
+ *  resolved by walking the tree, so results always match libpldm.
+ */
+class EntityTreeIndex
+{
+  public:
+    EntityTreeIndex() = delete;
+    EntityTreeIndex(const EntityTreeIndex&) = delete;
+    EntityTreeIndex(EntityTreeIndex&&) = delete;
+    EntityTreeIndex& operator=(const EntityTreeIndex&) = delete;
+    EntityTreeIndex& operator=(EntityTreeIndex&&) = delete;
+    ~EntityTreeIndex() = default;
+
+    /** @brief Constructor, indexes the nodes already present in the tree
+     *
+     *  @param[in] tree - entity association tree to index
+     */
+    explicit EntityTreeIndex(pldm_entity_association_tree* tree);
+
+    /** @brief Get the indexed entity association tree
+     *
+     *  @return pointer to the entity association tree
+     */
+    pldm_entity_association_tree* tree() const
+    {
+        return entityTree;
+    }
+
+    /** @brief Add an entity to the tree and index the new node, see
+     *         pldm_entity_association_tree_add_entity() for the parameters
+     *
+     *  @return pointer to the added node or nullptr on failure
+     */
+    pldm_entity_node* addEntity(
+        pldm_entity* entity, uint16_t entityInstanceNum,
+        pldm_entity_node* parent, uint8_t associationType, bool isRemote,
+        bool isUpdateContainerId, uint16_t containerId);
+
+    /** @brief Equivalent of pldm_entity_association_tree_find_with_locality()
+     *
+     *  @param[in,out] entity - entity to look up, the container ID is updated
+     *                          from the node found
+     *  @param[in] isRemote - match on the remote container ID
+     *
+     *  @return pointer to the node or nullptr if not found
+     */
+    pldm_entity_node* findWithLocality(pldm_entity* entity, bool isRemote);
+
+    /** @brief Equivalent of pldm_find_entity_ref_in_tree()
+     *
+     *  @param[in] entity - entity to look up, matched on type, instance number
+     *                      and container ID
+     *
+     *  @return pointer to the node or nullptr if not found
+     */
+    pldm_entity_node* findEntityRef(const pldm_entity& entity);
+
+    /** @brief Re-index the tree, must be called after the tree is modified
+     *         without going through the index (e.g. destroy/copy root)
+     */
+    void rebuild();
+
+    /** @brief Number of keys currently held by the index
+     */
+    size_t size() const
+    {
+        return nodes.size();
+    }
+
+  private:
+    /** @brief Kind of lookup a key is built for */
+    enum class Lookup : uint8_t
+    {
+        Local,  //!< type and instance number
+        Remote, //!< type, instance number and remote container ID
+        Exact,  //!< type, instance number and container ID
+    };
+
+    using Key = uint64_t;
+
+    static Key makeKey(Lookup lookup, uint16_t type, uint16_t instance,
+                       uint16_t containerId)
+    {
+        return (static_cast<Key>(lookup) << 48) |
+               (static_cast<Key>(type) << 32) |
+               (static_cast<Key>(instance) << 16) | containerId;
+    }
+
+    /** @brief Index a node under all of its lookup keys */
+    void insert(pldm_entity_node* node);
+
+    /** @brief Record a key for a node, marking the key ambiguous when it is
+     *         already held by a different node
+     */
+    void insertKey(Key key, pldm_entity_node* node);
+
+    pldm_entity_association_tree* entityTree;
+
+    /** @brief key to node map, a nullptr node marks an ambiguous key */
+    std::unordered_map<Key, pldm_entity_node*> nodes;
+
+    /** @brief whether every node of the tree is indexed, lookups walk the
+     *         tree when it is not
+     */
+    bool complete = true;
+};
+
+} // namespace utils
+} // namespace pldm
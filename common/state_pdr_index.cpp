@@ -0,0 +1,228 @@
+#include "state_pdr_index.hpp"
+
+#include <libpldm/platform.h>
+
+#include <cstddef>
+#include <limits>
+
+namespace pldm
+{
+namespace utils
+{
+
+std::vector<std::vector<uint8_t>> StatePdrIndex::findStateEffecterPDR(
+    uint16_t entityType, uint16_t stateSetId)
+{
+    return find(makeKey(PLDM_STATE_EFFECTER_PDR, entityType, stateSetId));
+}
+
+std::vector<std::vector<uint8_t>> StatePdrIndex::findStateSensorPDR(
+    uint16_t entityType, uint16_t stateSetId)
+{
+    return find(makeKey(PLDM_STATE_SENSOR_PDR, entityType, stateSetId));
+}
+
+size_t StatePdrIndex::size()
+{
+    refresh();
+    return records.size();
+}
+
+std::vector<std::vector<uint8_t>> StatePdrIndex::find(Key key)
+{
+    refresh();
+
+    std::vector<std::vector<uint8_t>> pdrs;
+    auto it = index.find(key);
+    if (it == index.end())
+    {
+        return pdrs;
+    }
+
+    pdrs.reserve(it->second.size());
+    for (auto position : it->second)
+    {
+        pdrs.emplace_back(records[position].data);
+    }
+    return pdrs;
+}
+
+void StatePdrIndex::refresh()
+{
+    if (valid)
+    {
+        return;
+    }
+
+    records.clear();
+    index.clear();
+    indexRecords(PLDM_STATE_EFFECTER_PDR);
+    indexRecords(PLDM_STATE_SENSOR_PDR);
+
+    valid = true;
+}
+
+void StatePdrIndex::add(const uint8_t* data, uint32_t size, bool isRemote,
+                        uint16_t terminusHandle)
+{
+    // A stale index picks the PDR up when it is rebuilt
+    if (valid)
+    {
+        indexRecord(data, size, isRemote, terminusHandle);
+    }
+}
+
+void StatePdrIndex::removeRemote()
+{
+    removeIf([](const Record& record) { return record.isRemote; });
+}
+
+void StatePdrIndex::removeByTerminusHandle(uint16_t terminusHandle)
+{
+    removeIf([terminusHandle](const Record& record) {
+        return record.terminusHandle == terminusHandle;
+    });
+}
+
+template <typename Pred>
+void StatePdrIndex::removeIf(Pred pred)
+{
+    if (!valid)
+    {
+        return;
+    }
+
+    // Compact the records and map the old positions to the new ones
+    constexpr auto removed = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> positions(records.size(), removed);
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < records.size(); ++i)
+    {
+        if (pred(records[i]))
+        {
+            continue;
+        }
+        positions[i] = count;
+        if (i != count)
+        {
+            records[count] = std::move(records[i]);
+        }
+        count++;
+    }
+    if (count == records.size())
+    {
+        return;
+    }
+    records.resize(count);
+
+    for (auto it = index.begin(); it != index.end();)
+    {
+        auto& keyPositions = it->second;
+        std::erase_if(keyPositions, [&positions](uint32_t position) {
+            return positions[position] == removed;
+        });
+        if (keyPositions.empty())
+        {
+            it = index.erase(it);
+            continue;
+        }
+        for (auto& position : keyPositions)
+        {
+            position = positions[position];
+        }
+        ++it;
+    }
+}
+
+void StatePdrIndex::indexRecords(uint8_t pdrType)
+{
+    uint8_t* outData = nullptr;
+    uint32_t size{};
+    const pldm_pdr_record* record{};
+
+    while ((record = pldm_pdr_find_record_by_type(repo, pdrType, record,
+                                                   &outData, &size)))
+    {
+        // State sensor and effecter PDRs start with their terminus handle
+        uint16_t terminusHandle{};
+        if (size >= sizeof(pldm_pdr_hdr) + sizeof(terminusHandle))
+        {
+            terminusHandle = outData[sizeof(pldm_pdr_hdr)] |
+                             (outData[sizeof(pldm_pdr_hdr) + 1] << 8);
+        }
+        indexRecord(outData, size, pldm_pdr_record_is_remote(record),
+                    terminusHandle);
+    }
+}
+
+void StatePdrIndex::indexRecord(const uint8_t* data, uint32_t size,
+                                bool isRemote, uint16_t terminusHandle)
+{
+    if (size < sizeof(pldm_pdr_hdr))
+    {
+        return;
+    }
+    auto pdrType = reinterpret_cast<const pldm_pdr_hdr*>(data)->type;
+
+    uint16_t entityType{};
+    uint8_t compositeCount{};
+    size_t offset{};
+    if (pdrType == PLDM_STATE_EFFECTER_PDR)
+    {
+        offset = offsetof(pldm_state_effecter_pdr, possible_states);
+        if (size < offset)
+        {
+            return;
+        }
+        auto pdr = reinterpret_cast<const pldm_state_effecter_pdr*>(data);
+        entityType = pdr->entity_type;
+        compositeCount = pdr->composite_effecter_count;
+    }
+    else if (pdrType == PLDM_STATE_SENSOR_PDR)
+    {
+        offset = offsetof(pldm_state_sensor_pdr, possible_states);
+        if (size < offset)
+        {
+            return;
+        }
+        auto pdr = reinterpret_cast<const pldm_state_sensor_pdr*>(data);
+        entityType = pdr->entity_type;
+        compositeCount = pdr->composite_sensor_count;
+    }
+    else
+    {
+        return;
+    }
+
+    // Each composite sensor or effecter is a 16 bit state set ID, the size of
+    // the possible states bitfield and the bitfield
+    constexpr size_t possibleStatesHdrSize = sizeof(uint16_t) + sizeof(uint8_t);
+    auto position = static_cast<uint32_t>(records.size());
+    bool indexed = false;
+    for (uint8_t i = 0;
+         i < compositeCount && offset + possibleStatesHdrSize <= size; ++i)
+    {
+        uint16_t stateSetId = data[offset] | (data[offset + 1] << 8);
+        uint8_t possibleStatesSize = data[offset + sizeof(uint16_t)];
+        offset += possibleStatesHdrSize + possibleStatesSize;
+
+        auto& positions = index[makeKey(pdrType, entityType, stateSetId)];
+        // A PDR matches once even if several of its composite sensors or
+        // effecters use the state set
+        if (!positions.empty() && positions.back() == position)
+        {
+            continue;
+        }
+        positions.emplace_back(position);
+        indexed = true;
+    }
+
+    if (indexed)
+    {
+        records.emplace_back(std::vector<uint8_t>(data, data + size), isRemote,
+                             terminusHandle);
+    }
+}
+
+} // namespace utils
+} // namespace pldm
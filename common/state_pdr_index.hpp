@@ -0,0 +1,155 @@
+#pragma once
+
+#include <libpldm/pdr.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace pldm
+{
+namespace utils
+{
+
+/** @class StatePdrIndex
+ *
+ *  @brief Index of the state sensor and state effecter PDRs of a PDR repo
+ *
+ *  findStateSensorPDR()/findStateEffecterPDR() walk every PDR of the type and
+ *  decode each composite sensor or effecter on every call. This index keeps
+ *  a copy of the state sensor and effecter PDRs grouped by PDR type, entity
+ *  type and state set ID so a lookup costs O(matches). The index is built
+ *  from the repo on the first lookup, then maintained by the code adding
+ *  PDRs to and removing them from the repo through add(), removeRemote() and
+ *  removeByTerminusHandle(). invalidate() has the index rebuilt from the
+ *  repo on the next lookup.
+ */
+class StatePdrIndex
+{
+  public:
+    StatePdrIndex() = delete;
+    StatePdrIndex(const StatePdrIndex&) = delete;
+    StatePdrIndex(StatePdrIndex&&) = delete;
+    StatePdrIndex& operator=(const StatePdrIndex&) = delete;
+    StatePdrIndex& operator=(StatePdrIndex&&) = delete;
+    ~StatePdrIndex() = default;
+
+    /** @brief Constructor
+     *
+     *  @param[in] repo - PDR repo to index
+     */
+    explicit StatePdrIndex(const pldm_pdr* repo) : repo(repo) {}
+
+    /** @brief Equivalent of pldm::utils::findStateEffecterPDR()
+     *
+     *  @param[in] entityType - entity type of the effecter
+     *  @param[in] stateSetId - state set ID of one of the composite effecters
+     *
+     *  @return the matching State Effecter PDRs in repo order
+     */
+    std::vector<std::vector<uint8_t>> findStateEffecterPDR(
+        uint16_t entityType, uint16_t stateSetId);
+
+    /** @brief Equivalent of pldm::utils::findStateSensorPDR()
+     *
+     *  @param[in] entityType - entity type of the sensor
+     *  @param[in] stateSetId - state set ID of one of the composite sensors
+     *
+     *  @return the matching State Sensor PDRs in repo order
+     */
+    std::vector<std::vector<uint8_t>> findStateSensorPDR(uint16_t entityType,
+                                                         uint16_t stateSetId);
+
+    /** @brief Index a PDR added to the repo by pldm_pdr_add(), PDRs other
+     *         than state sensor and effecter PDRs are ignored
+     *
+     *  @param[in] data - the PDR
+     *  @param[in] size - size of the PDR
+     *  @param[in] isRemote - whether the PDR was added as a remote PDR
+     *  @param[in] terminusHandle - terminus handle the PDR was added with
+     */
+    void add(const uint8_t* data, uint32_t size, bool isRemote,
+             uint16_t terminusHandle);
+
+    /** @brief Drop the PDRs removed by pldm_pdr_remove_remote_pdrs() */
+    void removeRemote();
+
+    /** @brief Drop the PDRs removed by
+     *         pldm_pdr_remove_pdrs_by_terminus_handle()
+     *
+     *  @param[in] terminusHandle - terminus handle of the removed PDRs
+     */
+    void removeByTerminusHandle(uint16_t terminusHandle);
+
+    /** @brief Mark the index stale, it is rebuilt from the repo on the next
+     *         lookup. Must be called after state PDRs are added to the repo
+     *         in bulk or modified in the repo.
+     */
+    void invalidate()
+    {
+        valid = false;
+    }
+
+    /** @brief Number of indexed state sensor and effecter PDRs */
+    size_t size();
+
+  private:
+    using Key = uint64_t;
+
+    static Key makeKey(uint8_t pdrType, uint16_t entityType,
+                       uint16_t stateSetId)
+    {
+        return (static_cast<Key>(pdrType) << 32) |
+               (static_cast<Key>(entityType) << 16) | stateSetId;
+    }
+
+    /** @brief Rebuild the index if it is stale */
+    void refresh();
+
+    /** @brief Index the State Sensor or State Effecter PDRs of the repo
+     *
+     *  @param[in] pdrType - PLDM_STATE_SENSOR_PDR or PLDM_STATE_EFFECTER_PDR
+     */
+    void indexRecords(uint8_t pdrType);
+
+    /** @brief Index a State Sensor or State Effecter PDR, other PDRs are
+     *         ignored
+     */
+    void indexRecord(const uint8_t* data, uint32_t size, bool isRemote,
+                     uint16_t terminusHandle);
+
+    /** @brief Drop the indexed PDRs matching a predicate, keeping the order
+     *         of the others
+     */
+    template <typename Pred>
+    void removeIf(Pred pred);
+
+    /** @brief Look up the PDRs of a key */
+    std::vector<std::vector<uint8_t>> find(Key key);
+
+    const pldm_pdr* repo;
+
+    /** @brief Whether the index reflects the repo */
+    bool valid = false;
+
+    /** @struct Record
+     *
+     *  An indexed PDR and the attributes its removal is keyed on
+     */
+    struct Record
+    {
+        std::vector<uint8_t> data; //!< copy of the PDR
+        bool isRemote;             //!< added as a remote PDR
+        uint16_t terminusHandle;   //!< terminus handle it was added with
+    };
+
+    /** @brief The indexed PDRs, in repo order */
+    std::vector<Record> records;
+
+    /** @brief Key to positions in records */
+    std::unordered_map<Key, std::vector<uint32_t>> index;
+};
+
+} // namespace utils
+} // namespace pldm
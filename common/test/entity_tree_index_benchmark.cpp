@@ -0,0 +1,54 @@
+#include "common/entity_tree_index.hpp"
+#include "common/test/entity_tree_index_test.hpp"
+
+#include <libpldm/entity.h>
+#include <libpldm/pdr.h>
+
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::utils;
+
+TEST(EntityTreeIndex, benchmark5kEntities)
+{
+    EntityTree tree(pldm_entity_association_tree_init(),
+                    pldm_entity_association_tree_destroy);
+    EntityTreeIndex index(tree.get());
+    auto nodes = buildTree(index);
+
+    std::vector<pldm_entity> entities;
+    entities.reserve(nodes.size());
+    for (auto node : nodes)
+    {
+        auto entity = pldm_entity_extract(node);
+        entity.entity_container_id =
+            pldm_entity_node_get_remote_container_id(node);
+        entities.emplace_back(entity);
+    }
+
+    using namespace std::chrono;
+    size_t walkFound = 0;
+    auto start = steady_clock::now();
+    for (auto entity : entities)
+    {
+        walkFound += pldm_entity_association_tree_find_with_locality(
+                         tree.get(), &entity, true) != nullptr;
+    }
+    auto walk = duration_cast<microseconds>(steady_clock::now() - start);
+
+    size_t indexFound = 0;
+    start = steady_clock::now();
+    for (auto entity : entities)
+    {
+        indexFound += index.findWithLocality(&entity, true) != nullptr;
+    }
+    auto indexed = duration_cast<microseconds>(steady_clock::now() - start);
+
+    EXPECT_EQ(walkFound, entities.size());
+    EXPECT_EQ(indexFound, entities.size());
+    RecordProperty("entities", static_cast<int>(entities.size()));
+    RecordProperty("treeWalkUs", static_cast<int>(walk.count()));
+    RecordProperty("indexUs", static_cast<int>(indexed.count()));
+}
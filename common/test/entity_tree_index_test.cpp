@@ -0,0 +1,138 @@
+#include "common/entity_tree_index.hpp"
+#include "common/test/entity_tree_index_test.hpp"
+
+#include <libpldm/entity.h>
+#include <libpldm/pdr.h>
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::utils;
+
+TEST(EntityTreeIndex, emptyTree)
+{
+    EntityTree tree(pldm_entity_association_tree_init(),
+                    pldm_entity_association_tree_destroy);
+    EntityTreeIndex index(tree.get());
+
+    pldm_entity entity{PLDM_ENTITY_SYSTEM_CHASSIS, 1, 0};
+    EXPECT_EQ(index.size(), 0);
+    EXPECT_EQ(index.findWithLocality(&entity, false), nullptr);
+    EXPECT_EQ(index.findWithLocality(&entity, true), nullptr);
+    EXPECT_EQ(index.findEntityRef(entity), nullptr);
+}
+
+TEST(EntityTreeIndex, lookupsMatchTreeWalk)
+{
+    EntityTree tree(pldm_entity_association_tree_init(),
+                    pldm_entity_association_tree_destroy);
+    EntityTreeIndex index(tree.get());
+    auto nodes = buildTree(index);
+    ASSERT_EQ(nodes.size(), 1 + numBoards + numBoards * childrenPerBoard);
+
+    for (auto node : nodes)
+    {
+        ASSERT_NE(node, nullptr);
+        auto entity = pldm_entity_extract(node);
+
+        pldm_entity local = entity;
+        local.entity_container_id = 0;
+        pldm_entity walked = local;
+        EXPECT_EQ(index.findWithLocality(&local, false),
+                  pldm_entity_association_tree_find_with_locality(
+                      tree.get(), &walked, false));
+        EXPECT_EQ(local.entity_container_id, walked.entity_container_id);
+
+        pldm_entity remote = entity;
+        remote.entity_container_id =
+            pldm_entity_node_get_remote_container_id(node);
+        pldm_entity walkedRemote = remote;
+        EXPECT_EQ(index.findWithLocality(&remote, true),
+                  pldm_entity_association_tree_find_with_locality(
+                      tree.get(), &walkedRemote, true));
+        EXPECT_EQ(remote.entity_container_id,
+                  walkedRemote.entity_container_id);
+
+        pldm_entity_node* ref = nullptr;
+        pldm_find_entity_ref_in_tree(tree.get(), entity, &ref);
+        EXPECT_EQ(index.findEntityRef(entity), ref);
+    }
+
+    pldm_entity missing{PLDM_ENTITY_PROC, 0xFFFE, 0};
+    EXPECT_EQ(index.findWithLocality(&missing, false), nullptr);
+}
+
+TEST(EntityTreeIndex, rebuildAfterCopyAndDelete)
+{
+    EntityTree tree(pldm_entity_association_tree_init(),
+                    pldm_entity_association_tree_destroy);
+    EntityTree copy(pldm_entity_association_tree_init(),
+                    pldm_entity_association_tree_destroy);
+    EntityTreeIndex index(tree.get());
+    buildTree(index);
+    auto size = index.size();
+
+    // Rebuilding from scratch yields the same keys
+    EntityTreeIndex rebuilt(tree.get());
+    EXPECT_EQ(rebuilt.size(), size);
+
+    pldm_entity proc{PLDM_ENTITY_PROC, 1, 0};
+    ASSERT_NE(index.findWithLocality(&proc, false), nullptr);
+    pldm_entity_association_tree_delete_node(tree.get(), &proc);
+    index.rebuild();
+    pldm_entity deleted{PLDM_ENTITY_PROC, 1, 0};
+    EXPECT_EQ(index.findWithLocality(&deleted, false), nullptr);
+    EXPECT_EQ(pldm_entity_association_tree_find_with_locality(
+                  tree.get(), &deleted, false),
+              nullptr);
+
+    // Replacing the tree content invalidates every node until rebuilt
+    pldm_entity_association_tree_copy_root(tree.get(), copy.get());
+    pldm_entity_association_tree_destroy_root(tree.get());
+    index.rebuild();
+    EXPECT_EQ(index.size(), 0);
+    pldm_entity_association_tree_copy_root(copy.get(), tree.get());
+    index.rebuild();
+
+    pldm_entity board{PLDM_ENTITY_SYS_BOARD, 3, 0};
+    pldm_entity walked = board;
+    EXPECT_EQ(index.findWithLocality(&board, false),
+              pldm_entity_association_tree_find_with_locality(tree.get(),
+                                                              &walked, false));
+    EXPECT_NE(index.findWithLocality(&board, false), nullptr);
+}
+
+TEST(EntityTreeIndex, ambiguousKeysFallBackToTreeWalk)
+{
+    EntityTree tree(pldm_entity_association_tree_init(),
+                    pldm_entity_association_tree_destroy);
+    EntityTreeIndex index(tree.get());
+
+    pldm_entity chassis{PLDM_ENTITY_SYSTEM_CHASSIS, 1, 0};
+    auto root = index.addEntity(&chassis, 1, nullptr,
+                                PLDM_ENTITY_ASSOCIAION_PHYSICAL, false, true,
+                                0xFFFF);
+    pldm_entity boardA{PLDM_ENTITY_SYS_BOARD, 1, 1};
+    auto a = index.addEntity(&boardA, 1, root, PLDM_ENTITY_ASSOCIAION_PHYSICAL,
+                             false, true, 0xFFFF);
+    pldm_entity boardB{PLDM_ENTITY_SYS_BOARD, 2, 1};
+    auto b = index.addEntity(&boardB, 2, root, PLDM_ENTITY_ASSOCIAION_PHYSICAL,
+                             false, true, 0xFFFF);
+
+    // The same processor under two different boards
+    pldm_entity proc{PLDM_ENTITY_PROC, 1, 2};
+    index.addEntity(&proc, 1, a, PLDM_ENTITY_ASSOCIAION_PHYSICAL, false, true,
+                    0xFFFF);
+    proc = {PLDM_ENTITY_PROC, 1, 3};
+    index.addEntity(&proc, 1, b, PLDM_ENTITY_ASSOCIAION_PHYSICAL, false, true,
+                    0xFFFF);
+
+    pldm_entity lookup{PLDM_ENTITY_PROC, 1, 0};
+    pldm_entity walked = lookup;
+    EXPECT_EQ(index.findWithLocality(&lookup, false),
+              pldm_entity_association_tree_find_with_locality(tree.get(),
+                                                              &walked, false));
+    EXPECT_EQ(lookup.entity_container_id, walked.entity_container_id);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "common/entity_tree_index.hpp"
+
+#include <libpldm/entity.h>
+#include <libpldm/pdr.h>
+
+#include <memory>
+#include <vector>
+
+using EntityTree =
+    std::unique_ptr<pldm_entity_association_tree,
+                    decltype(&pldm_entity_association_tree_destroy)>;
+
+constexpr uint16_t numBoards = 50;
+constexpr uint16_t childrenPerBoard = 99;
+
+/** @brief Build a synthetic tree of 1 chassis, 50 boards and 99 remote
+ *         children per board, i.e. 5001 entities
+ */
+inline std::vector<pldm_entity_node*> buildTree(
+    pldm::utils::EntityTreeIndex& index)
+{
+    std::vector<pldm_entity_node*> nodes;
+    pldm_entity chassis{PLDM_ENTITY_SYSTEM_CHASSIS, 1, 0};
+    auto root = index.addEntity(&chassis, 1, nullptr,
+                                PLDM_ENTITY_ASSOCIAION_PHYSICAL, false, true,
+                                0xFFFF);
+    nodes.emplace_back(root);
+
+    for (uint16_t b = 0; b < numBoards; ++b)
+    {
+        pldm_entity board{PLDM_ENTITY_SYS_BOARD, b, 1};
+        auto boardNode = index.addEntity(&board, b, root,
+                                         PLDM_ENTITY_ASSOCIAION_PHYSICAL, false,
+                                         true, 0xFFFF);
+        nodes.emplace_back(boardNode);
+
+        for (uint16_t c = 0; c < childrenPerBoard; ++c)
+        {
+            uint16_t type =
+                (c % 2) ? PLDM_ENTITY_PROC : PLDM_ENTITY_MEMORY_MODULE;
+            auto instance = static_cast<uint16_t>(b * childrenPerBoard + c);
+            pldm_entity child{type, instance,
+                              static_cast<uint16_t>(0x8000 + b)};
+            nodes.emplace_back(index.addEntity(
+                &child, instance, boardNode, PLDM_ENTITY_ASSOCIAION_PHYSICAL,
+                true, true, 0xFFFF));
+        }
+    }
+
+    return nodes;
+}
@@ -0,0 +1,59 @@
+#include "common/state_pdr_index.hpp"
+#include "common/test/state_pdr_index_test.hpp"
+#include "common/utils.hpp"
+
+#include <libpldm/pdr.h>
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::utils;
+
+TEST(StatePdrIndex, benchmark10kPdrs)
+{
+    PdrRepo repo(pldm_pdr_init(), pldm_pdr_destroy);
+    StatePdrIndex index(repo.get());
+    fillRepo(repo.get(), 5000);
+
+    using namespace std::chrono;
+    size_t walkFound = 0;
+    auto start = steady_clock::now();
+    for (auto entityType : entityTypes)
+    {
+        for (auto stateSetId : stateSetIds)
+        {
+            walkFound += findStateSensorPDR(0, entityType, stateSetId,
+                                            repo.get())
+                             .size();
+            walkFound += findStateEffecterPDR(0, entityType, stateSetId,
+                                              repo.get())
+                             .size();
+        }
+    }
+    auto walk = duration_cast<microseconds>(steady_clock::now() - start);
+
+    start = steady_clock::now();
+    index.size();
+    auto build = duration_cast<microseconds>(steady_clock::now() - start);
+
+    size_t indexFound = 0;
+    start = steady_clock::now();
+    for (auto entityType : entityTypes)
+    {
+        for (auto stateSetId : stateSetIds)
+        {
+            indexFound +=
+                index.findStateSensorPDR(entityType, stateSetId).size();
+            indexFound +=
+                index.findStateEffecterPDR(entityType, stateSetId).size();
+        }
+    }
+    auto indexed = duration_cast<microseconds>(steady_clock::now() - start);
+
+    EXPECT_EQ(walkFound, indexFound);
+    RecordProperty("records", static_cast<int>(index.size()));
+    RecordProperty("repoWalkUs", static_cast<int>(walk.count()));
+    RecordProperty("indexBuildUs", static_cast<int>(build.count()));
+    RecordProperty("indexUs", static_cast<int>(indexed.count()));
+}
@@ -0,0 +1,145 @@
+#include "common/state_pdr_index.hpp"
+#include "common/test/state_pdr_index_test.hpp"
+#include "common/utils.hpp"
+
+#include <libpldm/entity.h>
+#include <libpldm/pdr.h>
+#include <libpldm/platform.h>
+#include <libpldm/state_set.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::utils;
+
+TEST(StatePdrIndex, emptyRepo)
+{
+    PdrRepo repo(pldm_pdr_init(), pldm_pdr_destroy);
+    StatePdrIndex index(repo.get());
+
+    EXPECT_EQ(index.size(), 0);
+    EXPECT_TRUE(index.findStateSensorPDR(PLDM_ENTITY_PROC,
+                                         PLDM_STATE_SET_HEALTH_STATE)
+                    .empty());
+    EXPECT_TRUE(index.findStateEffecterPDR(PLDM_ENTITY_PROC,
+                                           PLDM_STATE_SET_HEALTH_STATE)
+                    .empty());
+}
+
+TEST(StatePdrIndex, lookupsMatchRepoWalk)
+{
+    PdrRepo repo(pldm_pdr_init(), pldm_pdr_destroy);
+    StatePdrIndex index(repo.get());
+    fillRepo(repo.get(), 40);
+
+    // A composite sensor using the same state set twice matches once
+    addPdr(repo.get(),
+           makeStateSensorPdr(100, PLDM_ENTITY_PROC,
+                              {PLDM_STATE_SET_HEALTH_STATE,
+                               PLDM_STATE_SET_HEALTH_STATE}),
+           false);
+    EXPECT_EQ(index.size(), 81);
+
+    for (auto entityType : entityTypes)
+    {
+        for (auto stateSetId : stateSetIds)
+        {
+            EXPECT_EQ(index.findStateSensorPDR(entityType, stateSetId),
+                      findStateSensorPDR(0, entityType, stateSetId,
+                                         repo.get()));
+            EXPECT_EQ(index.findStateEffecterPDR(entityType, stateSetId),
+                      findStateEffecterPDR(0, entityType, stateSetId,
+                                           repo.get()));
+        }
+    }
+    EXPECT_TRUE(index.findStateSensorPDR(PLDM_ENTITY_MEMORY_MODULE,
+                                         PLDM_STATE_SET_HEALTH_STATE)
+                    .empty());
+}
+
+TEST(StatePdrIndex, maintainedOnAddAndRemove)
+{
+    PdrRepo repo(pldm_pdr_init(), pldm_pdr_destroy);
+    StatePdrIndex index(repo.get());
+    uint32_t nextHandle = 1;
+
+    // Add a PDR to the repo and the index, like the PDR exchange with a host
+    auto add = [&](std::vector<uint8_t> pdr, bool isRemote,
+                   uint16_t terminusHandle) {
+        uint32_t handle = nextHandle++;
+        for (size_t i = 0; i < sizeof(handle); ++i)
+        {
+            pdr[i] = handle >> (8 * i);
+        }
+        pdr[sizeof(pldm_pdr_hdr)] = terminusHandle & 0xFF;
+        pdr[sizeof(pldm_pdr_hdr) + 1] = terminusHandle >> 8;
+        ASSERT_EQ(0, pldm_pdr_add(repo.get(), pdr.data(), pdr.size(),
+                                  isRemote, terminusHandle, &handle));
+        index.add(pdr.data(), pdr.size(), isRemote, terminusHandle);
+    };
+    auto expectRepoWalk = [&]() {
+        for (auto entityType : entityTypes)
+        {
+            for (auto stateSetId : stateSetIds)
+            {
+                EXPECT_EQ(index.findStateSensorPDR(entityType, stateSetId),
+                          findStateSensorPDR(0, entityType, stateSetId,
+                                             repo.get()));
+                EXPECT_EQ(index.findStateEffecterPDR(entityType, stateSetId),
+                          findStateEffecterPDR(0, entityType, stateSetId,
+                                               repo.get()));
+            }
+        }
+    };
+
+    // The PDRs added before the first lookup are indexed from the repo
+    add(makeStateSensorPdr(1, PLDM_ENTITY_PROC, {PLDM_STATE_SET_HEALTH_STATE}),
+        false, 1);
+    add(makeStateEffecterPdr(1, PLDM_ENTITY_PROC,
+                             {PLDM_STATE_SET_HEALTH_STATE}),
+        false, 1);
+    EXPECT_EQ(index.size(), 2);
+
+    // The PDRs added afterwards are indexed one by one, the other PDR types
+    // are ignored
+    add(makeStateSensorPdr(2, PLDM_ENTITY_PROC, {PLDM_STATE_SET_HEALTH_STATE}),
+        true, 2);
+    add(makeStateEffecterPdr(2, PLDM_ENTITY_SYS_BOARD,
+                             {PLDM_STATE_SET_AVAILABILITY,
+                              PLDM_STATE_SET_HEALTH_STATE}),
+        true, 2);
+    add(makeStateSensorPdr(3, PLDM_ENTITY_PROC, {PLDM_STATE_SET_HEALTH_STATE}),
+        true, 3);
+    auto other = makeStateSensorPdr(4, PLDM_ENTITY_PROC,
+                                    {PLDM_STATE_SET_HEALTH_STATE});
+    other[5] = PLDM_NUMERIC_SENSOR_PDR;
+    add(other, true, 3);
+    EXPECT_EQ(index.size(), 5);
+    expectRepoWalk();
+
+    // The PDRs of a terminus are removed
+    pldm_pdr_remove_pdrs_by_terminus_handle(repo.get(), 2);
+    index.removeByTerminusHandle(2);
+    EXPECT_EQ(index.size(), 3);
+    expectRepoWalk();
+
+    // A PDR replaced by one of the same size is picked up
+    add(makeStateSensorPdr(2, PLDM_ENTITY_PROC, {PLDM_STATE_SET_AVAILABILITY}),
+        true, 2);
+    EXPECT_EQ(index.size(), 4);
+    expectRepoWalk();
+
+    // The remote PDRs are removed
+    pldm_pdr_remove_remote_pdrs(repo.get());
+    index.removeRemote();
+    EXPECT_EQ(index.size(), 2);
+    expectRepoWalk();
+
+    // A rebuild from the repo finds the same PDRs
+    index.invalidate();
+    EXPECT_EQ(index.size(), 2);
+    expectRepoWalk();
+}
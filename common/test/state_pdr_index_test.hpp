@@ -0,0 +1,118 @@
+#pragma once
+
+#include <libpldm/entity.h>
+#include <libpldm/pdr.h>
+#include <libpldm/platform.h>
+#include <libpldm/state_set.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using PdrRepo = std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)>;
+
+/** @brief Append the composite sensors or effecters of a state PDR, each with
+ *         a one byte possible states bitfield
+ */
+inline void addPossibleStates(std::vector<uint8_t>& pdr,
+                              const std::vector<uint16_t>& stateSetIds)
+{
+    for (auto stateSetId : stateSetIds)
+    {
+        pdr.emplace_back(stateSetId & 0xFF);
+        pdr.emplace_back(stateSetId >> 8);
+        pdr.emplace_back(1); // possibleStatesSize
+        pdr.emplace_back(0x6);
+    }
+    auto length = static_cast<uint16_t>(pdr.size() - sizeof(pldm_pdr_hdr));
+    pdr[8] = length & 0xFF;
+    pdr[9] = length >> 8;
+}
+
+/** @brief Build a State Sensor PDR */
+inline std::vector<uint8_t> makeStateSensorPdr(
+    uint16_t sensorId, uint16_t entityType,
+    const std::vector<uint16_t>& stateSetIds)
+{
+    std::vector<uint8_t> pdr{
+        0, 0, 0, 0,            // record handle, assigned by the repo
+        1,                     // PDRHeaderVersion
+        PLDM_STATE_SENSOR_PDR, // PDRType
+        0, 0,                  // recordChangeNumber
+        0, 0,                  // dataLength
+        0, 0,                  // PLDMTerminusHandle
+        static_cast<uint8_t>(sensorId & 0xFF),
+        static_cast<uint8_t>(sensorId >> 8),
+        static_cast<uint8_t>(entityType & 0xFF),
+        static_cast<uint8_t>(entityType >> 8),
+        1, 0,         // entityInstanceNumber
+        0, 0,         // containerID
+        PLDM_NO_INIT, // sensorInit
+        false,        // sensorAuxiliaryNamesPDR
+        static_cast<uint8_t>(stateSetIds.size()), // compositeSensorCount
+    };
+    addPossibleStates(pdr, stateSetIds);
+    return pdr;
+}
+
+/** @brief Build a State Effecter PDR */
+inline std::vector<uint8_t> makeStateEffecterPdr(
+    uint16_t effecterId, uint16_t entityType,
+    const std::vector<uint16_t>& stateSetIds)
+{
+    std::vector<uint8_t> pdr{
+        0, 0, 0, 0,              // record handle, assigned by the repo
+        1,                       // PDRHeaderVersion
+        PLDM_STATE_EFFECTER_PDR, // PDRType
+        0, 0,                    // recordChangeNumber
+        0, 0,                    // dataLength
+        0, 0,                    // PLDMTerminusHandle
+        static_cast<uint8_t>(effecterId & 0xFF),
+        static_cast<uint8_t>(effecterId >> 8),
+        static_cast<uint8_t>(entityType & 0xFF),
+        static_cast<uint8_t>(entityType >> 8),
+        1, 0,         // entityInstanceNumber
+        0, 0,         // containerID
+        0, 0,         // effecterSemanticID
+        PLDM_NO_INIT, // effecterInit
+        false,        // hasDescriptionPDR
+        static_cast<uint8_t>(stateSetIds.size()), // compositeEffecterCount
+    };
+    addPossibleStates(pdr, stateSetIds);
+    return pdr;
+}
+
+inline void addPdr(pldm_pdr* repo, const std::vector<uint8_t>& pdr,
+                   bool isRemote)
+{
+    uint32_t handle = 0;
+    ASSERT_EQ(0, pldm_pdr_add(repo, pdr.data(), pdr.size(), isRemote, 0,
+                              &handle));
+}
+
+constexpr std::array<uint16_t, 4> entityTypes{
+    PLDM_ENTITY_PROC, PLDM_ENTITY_SYSTEM_CHASSIS, PLDM_ENTITY_POWER_SUPPLY,
+    PLDM_ENTITY_SYS_BOARD};
+constexpr std::array<uint16_t, 4> stateSetIds{
+    PLDM_STATE_SET_OPERATIONAL_RUNNING_STATUS, PLDM_STATE_SET_HEALTH_STATE,
+    PLDM_STATE_SET_AVAILABILITY, PLDM_STATE_SET_SW_TERMINATION_STATUS};
+
+/** @brief Fill a repo with state PDRs of every entity type, most of them
+ *         composite over two state sets
+ */
+inline void fillRepo(pldm_pdr* repo, uint16_t count)
+{
+    for (uint16_t id = 0; id < count; ++id)
+    {
+        auto entityType = entityTypes[id % entityTypes.size()];
+        std::vector<uint16_t> sets{stateSetIds[id % stateSetIds.size()]};
+        if (id % 3)
+        {
+            sets.emplace_back(stateSetIds[(id + 1) % stateSetIds.size()]);
+        }
+        addPdr(repo, makeStateSensorPdr(id, entityType, sets), id % 2);
+        addPdr(repo, makeStateEffecterPdr(id, entityType, sets), id % 2);
+    }
+}
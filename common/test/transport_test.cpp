@@ -0,0 +1,171 @@
+#include "common/transport.hpp"
+
+#include <libpldm/base.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <system_error>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+
+class LoopbackTransportTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/pldm_loopback.XXXXXX";
+        dir = fs::path(mkdtemp(tmpdir));
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(dir);
+    }
+
+    fs::path dir;
+};
+
+TEST_F(LoopbackTransportTest, sendRecvMsg)
+{
+    PldmTransport local(std::make_unique<LoopbackTransport>(dir, 8));
+    LoopbackTransport remote(dir, 9);
+
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + 1> request{};
+    auto requestHdr = new (request.data()) pldm_msg_hdr;
+    requestHdr->request = 1;
+    requestHdr->instance_id = 3;
+    requestHdr->type = PLDM_BASE;
+    requestHdr->command = 0x02;
+    request.back() = 0xa5;
+
+    std::thread responder([&remote, &request]() {
+        pollfd pfd{remote.getEventSource(), POLLIN, 0};
+        ASSERT_EQ(poll(&pfd, 1, 5000), 1);
+
+        pldm_tid_t tid = 0;
+        void* msg = nullptr;
+        size_t len = 0;
+        ASSERT_EQ(remote.recvMsg(tid, msg, len), PLDM_REQUESTER_SUCCESS);
+        EXPECT_EQ(tid, 8);
+        ASSERT_EQ(len, request.size());
+        EXPECT_EQ(memcmp(msg, request.data(), len), 0);
+        free(msg);
+
+        // An unrelated message is dropped by the requester
+        auto response = request;
+        auto responseHdr = new (response.data()) pldm_msg_hdr;
+        responseHdr->request = 0;
+        responseHdr->instance_id = 4;
+        EXPECT_EQ(remote.sendMsg(8, response.data(), response.size()),
+                  PLDM_REQUESTER_SUCCESS);
+
+        responseHdr->instance_id = 3;
+        response.back() = 0x5a;
+        EXPECT_EQ(remote.sendMsg(8, response.data(), response.size()),
+                  PLDM_REQUESTER_SUCCESS);
+    });
+
+    void* rx = nullptr;
+    size_t rxLen = 0;
+    EXPECT_EQ(local.sendRecvMsg(9, request.data(), request.size(), rx, rxLen),
+              PLDM_REQUESTER_SUCCESS);
+    responder.join();
+
+    ASSERT_EQ(rxLen, request.size());
+    auto responseHdr = static_cast<const pldm_msg_hdr*>(rx);
+    EXPECT_EQ(responseHdr->request, 0);
+    EXPECT_EQ(responseHdr->instance_id, 3);
+    EXPECT_EQ(static_cast<const uint8_t*>(rx)[rxLen - 1], 0x5a);
+    free(rx);
+}
+
+TEST_F(LoopbackTransportTest, endpoints)
+{
+    LoopbackTransport local(dir, 8);
+    EXPECT_TRUE(local.getEndpoints().empty());
+
+    std::array<uint8_t, sizeof(pldm_msg_hdr)> msg{};
+    EXPECT_EQ(local.sendMsg(20, msg.data(), msg.size()),
+              PLDM_REQUESTER_SEND_FAIL);
+    EXPECT_EQ(local.sendMsg(20, msg.data(), 1), PLDM_REQUESTER_NOT_PLDM_MSG);
+
+    {
+        LoopbackTransport first(dir, 20);
+        LoopbackTransport second(dir, 10);
+        EXPECT_EQ(local.getEndpoints(),
+                  (std::vector<pldm_tid_t>{10, 20}));
+        EXPECT_EQ(local.sendMsg(20, msg.data(), msg.size()),
+                  PLDM_REQUESTER_SUCCESS);
+    }
+
+    // The sockets are removed with the endpoints
+    EXPECT_TRUE(local.getEndpoints().empty());
+}
+
+TEST_F(LoopbackTransportTest, boundEndpoint)
+{
+    LoopbackTransport local(dir, 8);
+    std::array<uint8_t, sizeof(pldm_msg_hdr)> msg{};
+
+    {
+        LoopbackTransport running(dir, 20);
+
+        // The socket of a running endpoint is not taken over
+        try
+        {
+            LoopbackTransport duplicate(dir, 20);
+            ADD_FAILURE() << "The EID of a running endpoint is bound again";
+        }
+        catch (const std::system_error& e)
+        {
+            EXPECT_EQ(e.code().value(), EADDRINUSE);
+        }
+        EXPECT_EQ(local.getEndpoints(), std::vector<pldm_tid_t>{20});
+        EXPECT_EQ(local.sendMsg(20, msg.data(), msg.size()),
+                  PLDM_REQUESTER_SUCCESS);
+    }
+
+    // The socket left by an endpoint which exited is replaced
+    auto path = dir / "20";
+    int fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    ASSERT_GE(fd, 0);
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strcpy(addr.sun_path, path.c_str());
+    ASSERT_EQ(bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    close(fd);
+    ASSERT_TRUE(fs::exists(path));
+
+    LoopbackTransport restarted(dir, 20);
+    EXPECT_EQ(local.sendMsg(20, msg.data(), msg.size()),
+              PLDM_REQUESTER_SUCCESS);
+}
+
+TEST_F(LoopbackTransportTest, replacedSocketKept)
+{
+    auto path = dir / "20";
+    std::optional<LoopbackTransport> previous;
+    previous.emplace(dir, 20);
+
+    // Another endpoint replaced the socket of the previous one, which then
+    // exits
+    fs::remove(path);
+    LoopbackTransport current(dir, 20);
+    previous.reset();
+
+    EXPECT_TRUE(fs::exists(path));
+    LoopbackTransport local(dir, 8);
+    std::array<uint8_t, sizeof(pldm_msg_hdr)> msg{};
+    EXPECT_EQ(local.sendMsg(20, msg.data(), msg.size()),
+              PLDM_REQUESTER_SUCCESS);
+}
@@ -3,9 +3,19 @@
 #include <libpldm/transport.h>
 #include <libpldm/transport/af-mctp.h>
 #include <libpldm/transport/mctp-demux.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <ranges>
+#include <string>
 #include <system_error>
 
 struct pldm_transport* transport_impl_init(TransportImpl& impl, pollfd& pollfd);
@@ -14,6 +24,12 @@ void transport_impl_destroy(TransportImpl& impl);
 static constexpr uint8_t MCTP_EID_VALID_MIN = 8;
 static constexpr uint8_t MCTP_EID_VALID_MAX = 255;
 
+/* Largest datagram, source EID and PLDM message, of the loopback transport */
+static constexpr size_t LOOPBACK_MAX_MSG_SIZE = 65536;
+
+/* sendRecvMsg() gives up after the instance ID expiration interval */
+static constexpr auto LOOPBACK_RESPONSE_TIMEOUT = std::chrono::seconds(5);
+
 /*
  * Currently the OpenBMC ecosystem assumes TID == EID. Pre-populate the TID
  * mappings over the EID space excluding the Null (0), Reserved (1 to 7),
@@ -120,7 +136,39 @@ void transport_impl_destroy(TransportImpl& impl)
 #endif
 }
 
-PldmTransport::PldmTransport()
+static bool loopbackAddress(const std::filesystem::path& dir, pldm_tid_t eid,
+                            sockaddr_un& addr, socklen_t& addrLen)
+{
+    auto path = (dir / std::to_string(eid)).string();
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        return false;
+    }
+
+    addr = {};
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    addrLen = offsetof(sockaddr_un, sun_path) + path.size() + 1;
+    return true;
+}
+
+/** @brief Whether an endpoint is bound to the socket of a loopback address,
+ *         a socket left behind by an endpoint which exited refuses the
+ *         connections
+ */
+static bool loopbackAddressInUse(const sockaddr_un& addr, socklen_t addrLen)
+{
+    int fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+    auto rc = connect(fd, reinterpret_cast<const sockaddr*>(&addr), addrLen);
+    close(fd);
+    return !rc;
+}
+
+MctpTransport::MctpTransport()
 {
     transport = transport_impl_init(impl, pfd);
     if (!transport)
@@ -129,30 +177,280 @@ PldmTransport::PldmTransport()
     }
 }
 
-PldmTransport::~PldmTransport()
+MctpTransport::~MctpTransport()
 {
     transport_impl_destroy(impl);
 }
 
-int PldmTransport::getEventSource() const
+int MctpTransport::getEventSource() const
 {
     return pfd.fd;
 }
 
-pldm_requester_rc_t PldmTransport::sendMsg(pldm_tid_t tid, const void* tx,
+pldm_requester_rc_t MctpTransport::sendMsg(pldm_tid_t tid, const void* tx,
                                            size_t len)
 {
     return pldm_transport_send_msg(transport, tid, tx, len);
 }
 
-pldm_requester_rc_t PldmTransport::recvMsg(pldm_tid_t& tid, void*& rx,
+pldm_requester_rc_t MctpTransport::recvMsg(pldm_tid_t& tid, void*& rx,
                                            size_t& len)
 {
     return pldm_transport_recv_msg(transport, &tid, (void**)&rx, &len);
 }
 
-pldm_requester_rc_t PldmTransport::sendRecvMsg(
+pldm_requester_rc_t MctpTransport::sendRecvMsg(
     pldm_tid_t tid, const void* tx, size_t txLen, void*& rx, size_t& rxLen)
 {
     return pldm_transport_send_recv_msg(transport, tid, tx, txLen, &rx, &rxLen);
 }
+
+LoopbackTransport::LoopbackTransport(const std::filesystem::path& dir,
+                                     pldm_tid_t eid) : dir(dir), eid(eid)
+{
+    sockaddr_un addr{};
+    socklen_t addrLen = 0;
+    if (dir.empty() || !loopbackAddress(dir, eid, addr, addrLen))
+    {
+        throw std::system_error(ENAMETOOLONG, std::generic_category());
+    }
+
+    pfd.fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (pfd.fd < 0)
+    {
+        throw std::system_error(errno, std::generic_category());
+    }
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    /* A socket left by a previous instance of the endpoint is replaced, the
+     * socket of a running one is not */
+    struct stat st{};
+    if (!lstat(addr.sun_path, &st) && S_ISSOCK(st.st_mode))
+    {
+        if (loopbackAddressInUse(addr, addrLen))
+        {
+            close(pfd.fd);
+            throw std::system_error(EADDRINUSE, std::generic_category());
+        }
+        unlink(addr.sun_path);
+    }
+
+    if (bind(pfd.fd, reinterpret_cast<sockaddr*>(&addr), addrLen) ||
+        lstat(addr.sun_path, &st))
+    {
+        auto err = errno;
+        close(pfd.fd);
+        throw std::system_error(err, std::generic_category());
+    }
+    dev = st.st_dev;
+    ino = st.st_ino;
+}
+
+LoopbackTransport::~LoopbackTransport()
+{
+    /* The socket is only removed if it is still the one this endpoint
+     * bound, another instance may have replaced it since */
+    sockaddr_un addr{};
+    socklen_t addrLen = 0;
+    struct stat st{};
+    if (loopbackAddress(dir, eid, addr, addrLen) &&
+        !lstat(addr.sun_path, &st) && st.st_dev == dev && st.st_ino == ino)
+    {
+        unlink(addr.sun_path);
+    }
+    close(pfd.fd);
+}
+
+int LoopbackTransport::getEventSource() const
+{
+    return pfd.fd;
+}
+
+pldm_requester_rc_t LoopbackTransport::sendMsg(pldm_tid_t tid, const void* tx,
+                                               size_t len)
+{
+    if (len < sizeof(pldm_msg_hdr) || len >= LOOPBACK_MAX_MSG_SIZE)
+    {
+        return PLDM_REQUESTER_NOT_PLDM_MSG;
+    }
+
+    sockaddr_un addr{};
+    socklen_t addrLen = 0;
+    if (!loopbackAddress(dir, tid, addr, addrLen))
+    {
+        return PLDM_REQUESTER_SEND_FAIL;
+    }
+
+    uint8_t srcEid = eid;
+    iovec iov[2] = {{&srcEid, sizeof(srcEid)}, {const_cast<void*>(tx), len}};
+    msghdr msg{};
+    msg.msg_name = &addr;
+    msg.msg_namelen = addrLen;
+    msg.msg_iov = iov;
+    msg.msg_iovlen = 2;
+
+    /* The message is dropped when the queue of the destination is full, as
+     * on a congested link */
+    if (sendmsg(pfd.fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL) < 0)
+    {
+        return PLDM_REQUESTER_SEND_FAIL;
+    }
+    return PLDM_REQUESTER_SUCCESS;
+}
+
+pldm_requester_rc_t LoopbackTransport::recvMsg(pldm_tid_t& tid, void*& rx,
+                                               size_t& len)
+{
+    rx = nullptr;
+    auto size = recv(pfd.fd, nullptr, 0, MSG_PEEK | MSG_TRUNC | MSG_DONTWAIT);
+    if (size < 0)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+        {
+            return PLDM_REQUESTER_INVALID_RECV_LEN;
+        }
+        return PLDM_REQUESTER_RECV_FAIL;
+    }
+
+    auto buf = static_cast<uint8_t*>(malloc(std::max<size_t>(size, 1)));
+    if (!buf)
+    {
+        return PLDM_REQUESTER_RECV_FAIL;
+    }
+
+    auto count = recv(pfd.fd, buf, std::max<size_t>(size, 1), MSG_DONTWAIT);
+    if (count < static_cast<ssize_t>(1 + sizeof(pldm_msg_hdr)))
+    {
+        free(buf);
+        return PLDM_REQUESTER_INVALID_RECV_LEN;
+    }
+
+    /* Strip the source EID */
+    tid = buf[0];
+    len = count - 1;
+    std::memmove(buf, buf + 1, len);
+    rx = buf;
+    return PLDM_REQUESTER_SUCCESS;
+}
+
+pldm_requester_rc_t LoopbackTransport::sendRecvMsg(
+    pldm_tid_t tid, const void* tx, size_t txLen, void*& rx, size_t& rxLen)
+{
+    auto rc = sendMsg(tid, tx, txLen);
+    if (rc != PLDM_REQUESTER_SUCCESS)
+    {
+        return rc;
+    }
+
+    auto reqHdr = static_cast<const pldm_msg_hdr*>(tx);
+    auto deadline = std::chrono::steady_clock::now() + LOOPBACK_RESPONSE_TIMEOUT;
+    while (true)
+    {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0)
+        {
+            return PLDM_REQUESTER_RECV_FAIL;
+        }
+
+        pollfd p = pfd;
+        auto ready = poll(&p, 1, remaining.count());
+        if (ready < 0 && errno != EINTR)
+        {
+            return PLDM_REQUESTER_POLL_FAIL;
+        }
+        if (ready <= 0)
+        {
+            continue;
+        }
+
+        pldm_tid_t srcTid = 0;
+        void* msg = nullptr;
+        size_t msgLen = 0;
+        rc = recvMsg(srcTid, msg, msgLen);
+        if (rc == PLDM_REQUESTER_INVALID_RECV_LEN)
+        {
+            continue;
+        }
+        if (rc != PLDM_REQUESTER_SUCCESS)
+        {
+            return rc;
+        }
+
+        /* Drop the messages other than the response to the request */
+        auto hdr = static_cast<const pldm_msg_hdr*>(msg);
+        if (srcTid == tid && !hdr->request &&
+            hdr->instance_id == reqHdr->instance_id &&
+            hdr->type == reqHdr->type && hdr->command == reqHdr->command)
+        {
+            rx = msg;
+            rxLen = msgLen;
+            return PLDM_REQUESTER_SUCCESS;
+        }
+        free(msg);
+    }
+}
+
+std::vector<pldm_tid_t> LoopbackTransport::getEndpoints() const
+{
+    std::vector<pldm_tid_t> eids;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec))
+    {
+        if (!entry.is_socket(ec))
+        {
+            continue;
+        }
+
+        auto name = entry.path().filename().string();
+        unsigned int endpoint = 0;
+        auto [ptr, err] =
+            std::from_chars(name.data(), name.data() + name.size(), endpoint);
+        if (err != std::errc() || ptr != name.data() + name.size() ||
+            endpoint < MCTP_EID_VALID_MIN || endpoint >= MCTP_EID_VALID_MAX ||
+            endpoint == eid)
+        {
+            continue;
+        }
+        eids.emplace_back(endpoint);
+    }
+    std::ranges::sort(eids);
+    return eids;
+}
+
+PldmTransport::PldmTransport() :
+    backend(std::make_unique<MctpTransport>())
+{}
+
+PldmTransport::PldmTransport(std::unique_ptr<TransportBackend> backend) :
+    backend(std::move(backend))
+{}
+
+int PldmTransport::getEventSource() const
+{
+    return backend->getEventSource();
+}
+
+pldm_requester_rc_t PldmTransport::sendMsg(pldm_tid_t tid, const void* tx,
+                                           size_t len)
+{
+    return backend->sendMsg(tid, tx, len);
+}
+
+pldm_requester_rc_t PldmTransport::recvMsg(pldm_tid_t& tid, void*& rx,
+                                           size_t& len)
+{
+    return backend->recvMsg(tid, rx, len);
+}
+
+pldm_requester_rc_t PldmTransport::sendRecvMsg(
+    pldm_tid_t tid, const void* tx, size_t txLen, void*& rx, size_t& rxLen)
+{
+    return backend->sendRecvMsg(tid, tx, txLen, rx, rxLen);
+}
+
+std::vector<pldm_tid_t> PldmTransport::getEndpoints() const
+{
+    return backend->getEndpoints();
+}
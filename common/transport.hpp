@@ -3,8 +3,12 @@
 #include <libpldm/base.h>
 #include <libpldm/pldm.h>
 #include <poll.h>
+#include <sys/types.h>
 
 #include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <vector>
 
 struct pldm_transport_mctp_demux;
 struct pldm_transport_af_mctp;
@@ -15,16 +19,14 @@ union TransportImpl
     struct pldm_transport_af_mctp* af_mctp;
 };
 
-/* RAII for pldm_transport */
-class PldmTransport
+/** @class TransportBackend
+ *
+ * The interface of the transports carrying the PLDM messages of PldmTransport
+ */
+class TransportBackend
 {
   public:
-    PldmTransport();
-    PldmTransport(const PldmTransport& other) = delete;
-    PldmTransport(const PldmTransport&& other) = delete;
-    PldmTransport& operator=(const PldmTransport& other) = delete;
-    PldmTransport& operator=(const PldmTransport&& other) = delete;
-    ~PldmTransport();
+    virtual ~TransportBackend() = default;
 
     /** @brief Provides a file descriptor that can be polled for readiness.
      *
@@ -33,7 +35,7 @@ class PldmTransport
      *
      * @return The relevant file descriptor.
      */
-    int getEventSource() const;
+    virtual int getEventSource() const = 0;
 
     /** @brief Asynchronously send a PLDM message to the specified terminus
      *
@@ -46,7 +48,8 @@ class PldmTransport
      * @return PLDM_REQUESTER_SUCCESS on success, otherwise an appropriate
      *         PLDM_REQUESTER_* error code.
      */
-    pldm_requester_rc_t sendMsg(pldm_tid_t tid, const void* tx, size_t len);
+    virtual pldm_requester_rc_t sendMsg(pldm_tid_t tid, const void* tx,
+                                        size_t len) = 0;
 
     /** @brief Asynchronously receive a PLDM message addressed to the local
      * terminus
@@ -60,7 +63,8 @@ class PldmTransport
      * @return PLDM_REQUESTER_SUCCESS on success, otherwise an appropriate
      *         PLDM_REQUESTER_* error code.
      */
-    pldm_requester_rc_t recvMsg(pldm_tid_t& tid, void*& rx, size_t& len);
+    virtual pldm_requester_rc_t recvMsg(pldm_tid_t& tid, void*& rx,
+                                        size_t& len) = 0;
 
     /** @brief Synchronously exchange a request and response with the specified
      * terminus.
@@ -85,8 +89,44 @@ class PldmTransport
      * @return PLDM_REQUESTER_SUCCESS on success, otherwise an appropriate
      *         PLDM_REQUESTER_* error code.
      */
+    virtual pldm_requester_rc_t sendRecvMsg(pldm_tid_t tid, const void* tx,
+                                            size_t txLen, void*& rx,
+                                            size_t& rxLen) = 0;
+
+    /** @brief List the endpoints the transport finds by itself, other than
+     * the local endpoint
+     *
+     * @return The EIDs of the endpoints, empty when the endpoints are
+     *         discovered otherwise, as the MCTP endpoints are on D-Bus
+     */
+    virtual std::vector<pldm_tid_t> getEndpoints() const
+    {
+        return {};
+    }
+};
+
+/** @class MctpTransport
+ *
+ * The libpldm MCTP transport selected at build time
+ */
+class MctpTransport final : public TransportBackend
+{
+  public:
+    MctpTransport();
+    MctpTransport(const MctpTransport& other) = delete;
+    MctpTransport(const MctpTransport&& other) = delete;
+    MctpTransport& operator=(const MctpTransport& other) = delete;
+    MctpTransport& operator=(const MctpTransport&& other) = delete;
+    ~MctpTransport() override;
+
+    int getEventSource() const override;
+    pldm_requester_rc_t sendMsg(pldm_tid_t tid, const void* tx,
+                                size_t len) override;
+    pldm_requester_rc_t recvMsg(pldm_tid_t& tid, void*& rx,
+                                size_t& len) override;
     pldm_requester_rc_t sendRecvMsg(pldm_tid_t tid, const void* tx,
-                                    size_t txLen, void*& rx, size_t& rxLen);
+                                    size_t txLen, void*& rx,
+                                    size_t& rxLen) override;
 
   private:
     /** @brief A pollfd object for holding a file descriptor from the libpldm
@@ -102,5 +142,101 @@ class PldmTransport
     /** @brief The abstract libpldm transport object for sending and receiving
      *         PLDM messages.
      */
-    struct pldm_transport* transport;
+    struct pldm_transport* transport = nullptr;
+};
+
+/** @class LoopbackTransport
+ *
+ * The userspace loopback transport carries the PLDM messages between the
+ * processes of the same host, so that pldmd can be run against simulated
+ * termini. Each endpoint binds a datagram socket named after its EID in a
+ * directory, a message is sent to the socket of the destination EID prefixed
+ * with the EID of the source. As for MCTP, TID == EID.
+ *
+ * The socket left behind by an endpoint which exited is replaced, an endpoint
+ * still bound to the EID fails the construction with EADDRINUSE.
+ */
+class LoopbackTransport final : public TransportBackend
+{
+  public:
+    /** @brief Bind the socket of the local endpoint
+     *
+     * @param[in] dir - The directory of the endpoint sockets
+     * @param[in] eid - The EID of the local endpoint
+     */
+    LoopbackTransport(const std::filesystem::path& dir, pldm_tid_t eid);
+
+    LoopbackTransport(const LoopbackTransport& other) = delete;
+    LoopbackTransport(const LoopbackTransport&& other) = delete;
+    LoopbackTransport& operator=(const LoopbackTransport& other) = delete;
+    LoopbackTransport& operator=(const LoopbackTransport&& other) = delete;
+    ~LoopbackTransport() override;
+
+    int getEventSource() const override;
+    pldm_requester_rc_t sendMsg(pldm_tid_t tid, const void* tx,
+                                size_t len) override;
+    pldm_requester_rc_t recvMsg(pldm_tid_t& tid, void*& rx,
+                                size_t& len) override;
+    pldm_requester_rc_t sendRecvMsg(pldm_tid_t tid, const void* tx,
+                                    size_t txLen, void*& rx,
+                                    size_t& rxLen) override;
+
+    /** @brief List the endpoints bound in the directory */
+    std::vector<pldm_tid_t> getEndpoints() const override;
+
+  private:
+    /** @brief The socket of the local endpoint */
+    pollfd pfd;
+
+    /** @brief The directory of the endpoint sockets */
+    std::filesystem::path dir;
+
+    /** @brief The EID of the local endpoint */
+    pldm_tid_t eid;
+
+    /** @brief The device and inode of the socket bound by the local
+     *         endpoint
+     */
+    dev_t dev = 0;
+    ino_t ino = 0;
+};
+
+/* RAII for pldm_transport */
+class PldmTransport
+{
+  public:
+    /** @brief Open the MCTP transport selected at build time */
+    PldmTransport();
+
+    /** @brief Carry the messages on a transport backend
+     *
+     * @param[in] backend - The transport backend
+     */
+    explicit PldmTransport(std::unique_ptr<TransportBackend> backend);
+
+    PldmTransport(const PldmTransport& other) = delete;
+    PldmTransport(const PldmTransport&& other) = delete;
+    PldmTransport& operator=(const PldmTransport& other) = delete;
+    PldmTransport& operator=(const PldmTransport&& other) = delete;
+    ~PldmTransport() = default;
+
+    /** @brief See TransportBackend::getEventSource() */
+    int getEventSource() const;
+
+    /** @brief See TransportBackend::sendMsg() */
+    pldm_requester_rc_t sendMsg(pldm_tid_t tid, const void* tx, size_t len);
+
+    /** @brief See TransportBackend::recvMsg() */
+    pldm_requester_rc_t recvMsg(pldm_tid_t& tid, void*& rx, size_t& len);
+
+    /** @brief See TransportBackend::sendRecvMsg() */
+    pldm_requester_rc_t sendRecvMsg(pldm_tid_t tid, const void* tx,
+                                    size_t txLen, void*& rx, size_t& rxLen);
+
+    /** @brief See TransportBackend::getEndpoints() */
+    std::vector<pldm_tid_t> getEndpoints() const;
+
+  private:
+    /** @brief The transport carrying the messages */
+    std::unique_ptr<TransportBackend> backend;
 };
@@ -163,6 +163,17 @@ enum class ComponentImageInfoPos : size_t
 
 } // namespace fw_update
 
+/** @struct DebounceCounters
+ *
+ *  Number of PLDM messages sent and suppressed by merging D-Bus property
+ *  changes within the debounce window
+ */
+struct DebounceCounters
+{
+    uint64_t sent = 0;       //!< PLDM messages sent
+    uint64_t suppressed = 0; //!< changes merged into a pending message
+};
+
 namespace pdr
 {
 
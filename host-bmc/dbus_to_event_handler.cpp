@@ -4,6 +4,9 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <functional>
+#include <utility>
+
 PHOSPHOR_LOG2_USING;
 
 namespace pldm
@@ -20,8 +23,11 @@ const std::vector<uint8_t> pdrTypes{PLDM_STATE_SENSOR_PDR};
 
 DbusToPLDMEvent::DbusToPLDMEvent(
     int /* mctp_fd */, uint8_t mctp_eid, pldm::InstanceIdDb& instanceIdDb,
-    pldm::requester::Handler<pldm::requester::Request>* handler) :
-    mctp_eid(mctp_eid), instanceIdDb(instanceIdDb), handler(handler)
+    pldm::requester::Handler<pldm::requester::Request>* handler,
+    sdeventplus::Event& event) :
+    mctp_eid(mctp_eid), instanceIdDb(instanceIdDb), handler(handler),
+    debounceTimer(event.get(),
+                  std::bind(&DbusToPLDMEvent::flushSensorEvents, this))
 {}
 
 void DbusToPLDMEvent::sendEventMsg(uint8_t eventType,
@@ -91,30 +97,18 @@ void DbusToPLDMEvent::sendStateSensorEvent(SensorId sensorId,
         return;
     }
 
-    size_t sensorEventSize = PLDM_SENSOR_EVENT_DATA_MIN_LENGTH + 1;
     const auto& [dbusMappings, dbusValMaps] = dbusMaps.at(sensorId);
     for (size_t offset = 0; offset < dbusMappings.size(); ++offset)
     {
-        std::vector<uint8_t> sensorEventDataVec{};
-        sensorEventDataVec.resize(sensorEventSize);
-        auto eventData = new (sensorEventDataVec.data()) pldm_sensor_event_data;
-        eventData->sensor_id = sensorId;
-        eventData->sensor_event_class_type = PLDM_STATE_SENSOR_STATE;
-        eventData->event_class[0] = static_cast<uint8_t>(offset);
-        eventData->event_class[1] = PLDM_SENSOR_UNKNOWN;
-        eventData->event_class[2] = PLDM_SENSOR_UNKNOWN;
-
         const auto& dbusMapping = dbusMappings[offset];
         const auto& dbusValueMapping = dbusValMaps[offset];
         auto stateSensorMatch = std::make_unique<sdbusplus::bus::match_t>(
             pldm::utils::DBusHandler::getBus(),
             propertiesChanged(dbusMapping.objectPath.c_str(),
                               dbusMapping.interface.c_str()),
-            [this, sensorEventDataVec, dbusValueMapping, dbusMapping, sensorId,
-             offset](auto& msg) mutable {
+            [this, dbusValueMapping, dbusMapping, sensorId, offset](auto& msg) {
                 DbusChangedProps props{};
                 std::string intf;
-                uint8_t previousState = PLDM_SENSOR_UNKNOWN;
                 msg.read(intf, props);
                 if (!props.contains(dbusMapping.propertyName))
                 {
@@ -149,23 +143,8 @@ void DbusToPLDMEvent::sendStateSensorEvent(SensorId sensorId,
 
                     if (findValue)
                     {
-                        auto eventData = new (sensorEventDataVec.data())
-                            pldm_sensor_event_data;
-                        eventData->event_class[1] = itr.first;
-                        if (sensorCacheMap.contains(sensorId) &&
-                            sensorCacheMap[sensorId][offset] !=
-                                PLDM_SENSOR_UNKNOWN)
-                        {
-                            previousState = sensorCacheMap[sensorId][offset];
-                        }
-                        else
-                        {
-                            previousState = itr.first;
-                        }
-                        eventData->event_class[2] = previousState;
-                        this->sendEventMsg(PLDM_SENSOR_EVENT,
-                                           sensorEventDataVec);
-                        updateSensorCacheMaps(sensorId, offset, previousState);
+                        queueSensorEvent(sensorId, static_cast<uint8_t>(offset),
+                                         itr.first);
                         break;
                     }
                 }
@@ -174,6 +153,76 @@ void DbusToPLDMEvent::sendStateSensorEvent(SensorId sensorId,
     }
 }
 
+void DbusToPLDMEvent::queueSensorEvent(SensorId sensorId, uint8_t offset,
+                                       uint8_t state)
+{
+    if (debounceWindow == std::chrono::milliseconds::zero())
+    {
+        sendSensorStateEvent(sensorId, offset, state);
+        return;
+    }
+
+    auto [it, inserted] =
+        pendingSensorEvents[sensorId].insert_or_assign(offset, state);
+    if (!inserted)
+    {
+        debounceCounters.suppressed++;
+    }
+
+    if (!debounceTimer.isRunning())
+    {
+        try
+        {
+            debounceTimer.start(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    debounceWindow));
+        }
+        catch (const std::runtime_error& e)
+        {
+            error(
+                "Failed to start the sensor event debounce timer, error - {ERROR}",
+                "ERROR", e);
+            flushSensorEvents();
+        }
+    }
+}
+
+void DbusToPLDMEvent::flushSensorEvents()
+{
+    auto pending = std::exchange(pendingSensorEvents, {});
+    for (const auto& [sensorId, offsets] : pending)
+    {
+        for (const auto& [offset, state] : offsets)
+        {
+            sendSensorStateEvent(sensorId, offset, state);
+        }
+    }
+}
+
+void DbusToPLDMEvent::sendSensorStateEvent(SensorId sensorId, uint8_t offset,
+                                           uint8_t state)
+{
+    std::vector<uint8_t> sensorEventDataVec(
+        PLDM_SENSOR_EVENT_DATA_MIN_LENGTH + 1);
+    auto eventData = new (sensorEventDataVec.data()) pldm_sensor_event_data;
+    eventData->sensor_id = sensorId;
+    eventData->sensor_event_class_type = PLDM_STATE_SENSOR_STATE;
+    eventData->event_class[0] = offset;
+    eventData->event_class[1] = state;
+
+    uint8_t previousState = state;
+    if (sensorCacheMap.contains(sensorId) &&
+        sensorCacheMap[sensorId][offset] != PLDM_SENSOR_UNKNOWN)
+    {
+        previousState = sensorCacheMap[sensorId][offset];
+    }
+    eventData->event_class[2] = previousState;
+
+    sendEventMsg(PLDM_SENSOR_EVENT, sensorEventDataVec);
+    updateSensorCacheMaps(sensorId, offset, previousState);
+    debounceCounters.sent++;
+}
+
 void DbusToPLDMEvent::listenSensorEvent(const pdr_utils::Repo& repo,
                                         const DbusObjMaps& dbusMaps)
 {
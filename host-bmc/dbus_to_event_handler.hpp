@@ -1,11 +1,16 @@
 #pragma once
 
 #include "common/instance_id.hpp"
+#include "common/types.hpp"
 #include "libpldmresponder/pdr_utils.hpp"
 #include "requester/handler.hpp"
 
 #include <libpldm/platform.h>
 
+#include <sdbusplus/timer.hpp>
+#include <sdeventplus/event.hpp>
+
+#include <chrono>
 #include <map>
 
 namespace pldm
@@ -34,17 +39,19 @@ class DbusToPLDMEvent
     DbusToPLDMEvent(DbusToPLDMEvent&&) = delete;
     DbusToPLDMEvent& operator=(const DbusToPLDMEvent&) = delete;
     DbusToPLDMEvent& operator=(DbusToPLDMEvent&&) = delete;
-    ~DbusToPLDMEvent() = default;
+    virtual ~DbusToPLDMEvent() = default;
 
     /** @brief Constructor
      *  @param[in] mctp_fd - fd of MCTP communications socket
      *  @param[in] mctp_eid - MCTP EID of host firmware
      *  @param[in] requester - reference to Requester object
      *  @param[in] handler - PLDM request handler
+     *  @param[in] event - reference of the main event loop
      */
     explicit DbusToPLDMEvent(
         int mctp_fd, uint8_t mctp_eid, pldm::InstanceIdDb& instanceIdDb,
-        pldm::requester::Handler<pldm::requester::Request>* handler);
+        pldm::requester::Handler<pldm::requester::Request>* handler,
+        sdeventplus::Event& event);
 
   public:
     /** @brief Listen all of the state sensor PDRs
@@ -72,18 +79,45 @@ class DbusToPLDMEvent
         sensorCacheMap[sensorId][sensorRearm] = previousState;
     }
 
-  private:
+    /** @brief Get the number of sensor events sent and suppressed */
+    inline const DebounceCounters& getDebounceCounters() const
+    {
+        return debounceCounters;
+    }
+
+  protected:
     /** @brief Send state sensor event msg when a D-Bus property changes
      *  @param[in] sensorId - sensor id
      */
     void sendStateSensorEvent(SensorId sensorId, const DbusObjMaps& dbusMaps);
 
+    /** @brief Queue a state sensor event until the debounce window expires,
+     *         a pending event of the same sensor offset is replaced
+     *  @param[in] sensorId - sensor id
+     *  @param[in] offset - composite sensor offset
+     *  @param[in] state - new event state
+     */
+    void queueSensorEvent(SensorId sensorId, uint8_t offset, uint8_t state);
+
+    /** @brief Send the pending state sensor events, the offsets of a
+     *         composite sensor are sent together
+     */
+    void flushSensorEvents();
+
+    /** @brief Send a state sensor state event
+     *  @param[in] sensorId - sensor id
+     *  @param[in] offset - composite sensor offset
+     *  @param[in] state - new event state
+     */
+    void sendSensorStateEvent(SensorId sensorId, uint8_t offset,
+                              uint8_t state);
+
     /** @brief Send all of sensor event
      *  @param[in] eventType - PLDM Event types
      *  @param[in] eventDataVec - std::vector, contains send event data
      */
-    void sendEventMsg(uint8_t eventType,
-                      const std::vector<uint8_t>& eventDataVec);
+    virtual void sendEventMsg(uint8_t eventType,
+                              const std::vector<uint8_t>& eventDataVec);
 
     /** @brief MCTP EID of host firmware */
     uint8_t mctp_eid;
@@ -101,6 +135,18 @@ class DbusToPLDMEvent
 
     /** @brief sensor cache */
     stateSensorCacheMaps sensorCacheMap;
+
+    /** @brief time the D-Bus property changes are merged for */
+    std::chrono::milliseconds debounceWindow{DBUS_EVENT_DEBOUNCE_WINDOW};
+
+    /** @brief pending event state of each sensor offset */
+    std::map<SensorId, std::map<uint8_t, uint8_t>> pendingSensorEvents;
+
+    /** @brief timer flushing the pending sensor events */
+    sdbusplus::Timer debounceTimer;
+
+    /** @brief sensor events sent and suppressed */
+    DebounceCounters debounceCounters;
 };
 
 } // namespace state_sensor
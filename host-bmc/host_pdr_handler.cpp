@@ -51,14 +51,10 @@ uint16_t extractTerminusHandle(std::vector<uint8_t>& pdr)
 }
 
 template <typename T>
-void updateContainerId(pldm_entity_association_tree* entityTree,
+void updateContainerId(pldm::utils::EntityTreeIndex& entityTreeIndex,
                        std::vector<uint8_t>& pdr)
 {
     T* t = nullptr;
-    if (entityTree == nullptr)
-    {
-        return;
-    }
     if (std::is_same<T, pldm_pdr_fru_record_set>::value)
     {
         t = (T*)(pdr.data() + sizeof(pldm_pdr_hdr));
@@ -73,8 +69,7 @@ void updateContainerId(pldm_entity_association_tree* entityTree,
     }
 
     pldm_entity entity{t->entity_type, t->entity_instance, t->container_id};
-    auto node = pldm_entity_association_tree_find_with_locality(
-        entityTree, &entity, true);
+    auto node = entityTreeIndex.findWithLocality(&entity, true);
     if (node)
     {
         pldm_entity e = pldm_entity_extract(node);
@@ -87,12 +82,16 @@ HostPDRHandler::HostPDRHandler(
     pldm_pdr* repo, const std::string& eventsJsonsDir,
     pldm_entity_association_tree* entityTree,
     pldm_entity_association_tree* bmcEntityTree,
+    pldm::utils::EntityTreeIndex& entityTreeIndex,
+    pldm::utils::StatePdrIndex& statePdrIndex,
     pldm::InstanceIdDb& instanceIdDb,
     pldm::requester::Handler<pldm::requester::Request>* handler) :
     mctp_eid(mctp_eid), event(event), repo(repo),
-    stateSensorHandler(eventsJsonsDir), entityTree(entityTree),
-    instanceIdDb(instanceIdDb), handler(handler),
-    entityMaps(parseEntityMap(ENTITY_MAP_JSON)), oemUtilsHandler(nullptr)
+    stateSensorHandler(eventsJsonsDir, event), entityTree(entityTree),
+    entityTreeIndex(entityTreeIndex), statePdrIndex(statePdrIndex),
+    instanceIdDb(instanceIdDb),
+    handler(handler), entityMaps(parseEntityMap(ENTITY_MAP_JSON)),
+    oemUtilsHandler(nullptr)
 {
     mergedHostParents = false;
     hostOffMatch = std::make_unique<sdbusplus::bus::match_t>(
@@ -119,9 +118,11 @@ HostPDRHandler::HostPDRHandler(
                     // state of all the dbus objects to false
                     this->setPresenceFrus();
                     pldm_pdr_remove_remote_pdrs(repo);
+                    this->statePdrIndex.removeRemote();
                     pldm_entity_association_tree_destroy_root(entityTree);
                     pldm_entity_association_tree_copy_root(bmcEntityTree,
                                                            entityTree);
+                    this->entityTreeIndex.rebuild();
                     this->sensorMap.clear();
                     this->responseReceived = false;
                     this->mergedHostParents = false;
@@ -252,13 +253,11 @@ void HostPDRHandler::mergeEntityAssociations(
         pldm_entity_node* pNode = nullptr;
         if (!mergedHostParents)
         {
-            pNode = pldm_entity_association_tree_find_with_locality(
-                entityTree, &entities[0], false);
+            pNode = entityTreeIndex.findWithLocality(&entities[0], false);
         }
         else
         {
-            pNode = pldm_entity_association_tree_find_with_locality(
-                entityTree, &entities[0], true);
+            pNode = entityTreeIndex.findWithLocality(&entities[0], true);
         }
         if (!pNode)
         {
@@ -275,10 +274,9 @@ void HostPDRHandler::mergeEntityAssociations(
                 isUpdateContainerId =
                     checkIfLogicalBitSet(entities[i].entity_container_id);
             }
-            auto node = pldm_entity_association_tree_add_entity(
-                entityTree, &entities[i], entities[i].entity_instance_num,
-                pNode, entityPdr->association_type, true, isUpdateContainerId,
-                0xFFFF);
+            auto node = entityTreeIndex.addEntity(
+                &entities[i], entities[i].entity_instance_num, pNode,
+                entityPdr->association_type, true, isUpdateContainerId, 0xFFFF);
             if (!node)
             {
                 continue;
@@ -297,8 +295,7 @@ void HostPDRHandler::mergeEntityAssociations(
     if (merged)
     {
         // Update our PDR repo with the merged entity association PDRs
-        pldm_entity_node* node = nullptr;
-        pldm_find_entity_ref_in_tree(entityTree, entities[0], &node);
+        pldm_entity_node* node = entityTreeIndex.findEntityRef(entities[0]);
         if (node == nullptr)
         {
             error("Failed to find reference of the entity in the tree");
@@ -585,21 +582,24 @@ void HostPDRHandler::processHostPDRs(
                 {
                     pdrTerminusHandle =
                         extractTerminusHandle<pldm_state_sensor_pdr>(pdr);
-                    updateContainerId<pldm_state_sensor_pdr>(entityTree, pdr);
+                    updateContainerId<pldm_state_sensor_pdr>(entityTreeIndex,
+                                                             pdr);
                     stateSensorPDRs.emplace_back(pdr);
                 }
                 else if (pdrHdr->type == PLDM_PDR_FRU_RECORD_SET)
                 {
                     pdrTerminusHandle =
                         extractTerminusHandle<pldm_pdr_fru_record_set>(pdr);
-                    updateContainerId<pldm_pdr_fru_record_set>(entityTree, pdr);
+                    updateContainerId<pldm_pdr_fru_record_set>(entityTreeIndex,
+                                                               pdr);
                     fruRecordSetPDRs.emplace_back(pdr);
                 }
                 else if (pdrHdr->type == PLDM_STATE_EFFECTER_PDR)
                 {
                     pdrTerminusHandle =
                         extractTerminusHandle<pldm_state_effecter_pdr>(pdr);
-                    updateContainerId<pldm_state_effecter_pdr>(entityTree, pdr);
+                    updateContainerId<pldm_state_effecter_pdr>(entityTreeIndex,
+                                                               pdr);
                 }
                 else if (pdrHdr->type == PLDM_NUMERIC_EFFECTER_PDR)
                 {
@@ -607,7 +607,7 @@ void HostPDRHandler::processHostPDRs(
                         extractTerminusHandle<pldm_numeric_effecter_value_pdr>(
                             pdr);
                     updateContainerId<pldm_numeric_effecter_value_pdr>(
-                        entityTree, pdr);
+                        entityTreeIndex, pdr);
                 }
                 // if the TLPDR is invalid update the repo accordingly
                 if (!tlValid)
@@ -632,14 +632,16 @@ void HostPDRHandler::processHostPDRs(
                         // pldm_pdr_add() assert()ed on failure to add a PDR.
                         throw std::runtime_error("Failed to add PDR");
                     }
+                    statePdrIndex.add(pdr.data(), respCount, true,
+                                      pdrTerminusHandle);
                 }
             }
         }
     }
     if (!nextRecordHandle)
     {
-        updateEntityAssociation(entityAssociations, entityTree, objPathMap,
-                                entityMaps, oemPlatformHandler);
+        updateEntityAssociation(entityAssociations, entityTreeIndex,
+                                objPathMap, entityMaps, oemPlatformHandler);
         if (oemUtilsHandler)
         {
             oemUtilsHandler->setCoreCount(entityAssociations, entityMaps);
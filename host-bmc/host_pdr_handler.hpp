@@ -1,6 +1,8 @@
 #pragma once
 
+#include "common/entity_tree_index.hpp"
 #include "common/instance_id.hpp"
+#include "common/state_pdr_index.hpp"
 #include "common/types.hpp"
 #include "common/utils.hpp"
 #include "libpldmresponder/event_parser.hpp"
@@ -85,6 +87,8 @@ class HostPDRHandler
      *  @param[in] eventsJsonDir - directory path which has the config JSONs
      *  @param[in] entityTree - Pointer to BMC and Host entity association tree
      *  @param[in] bmcEntityTree - pointer to BMC's entity association tree
+     *  @param[in] entityTreeIndex - index over the nodes of entityTree
+     *  @param[in] statePdrIndex - index of the state PDRs of repo
      *  @param[in] instanceIdDb - reference to an InstanceIdDb object
      *  @param[in] handler - PLDM request handler
      *  @param[in] oemUtilsHandler - pointer oem utils handler
@@ -94,6 +98,8 @@ class HostPDRHandler
         pldm_pdr* repo, const std::string& eventsJsonsDir,
         pldm_entity_association_tree* entityTree,
         pldm_entity_association_tree* bmcEntityTree,
+        pldm::utils::EntityTreeIndex& entityTreeIndex,
+        pldm::utils::StatePdrIndex& statePdrIndex,
         pldm::InstanceIdDb& instanceIdDb,
         pldm::requester::Handler<pldm::requester::Request>* handler);
 
@@ -300,6 +306,16 @@ class HostPDRHandler
     /** @brief Pointer to BMC's and Host's entity association tree */
     pldm_entity_association_tree* entityTree;
 
+    /** @brief Index over the nodes of entityTree, all the entities merged from
+     *         the host are added and looked up through it
+     */
+    pldm::utils::EntityTreeIndex& entityTreeIndex;
+
+    /** @brief Index of the state sensor and effecter PDRs of repo, updated
+     *         as the host PDRs are added and removed
+     */
+    pldm::utils::StatePdrIndex& statePdrIndex;
+
     /** @brief reference to Instance ID database object, used to obtain PLDM
      * instance IDs
      */
@@ -0,0 +1,73 @@
+#include "host-bmc/dbus_to_event_handler.hpp"
+#include "platform-mc/test/utils_test.hpp"
+#include "test/test_instance_id.hpp"
+
+#include <libpldm/platform.h>
+
+#include <sdeventplus/event.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::state_sensor;
+
+class TestDbusToPLDMEvent : public DbusToPLDMEvent
+{
+  public:
+    TestDbusToPLDMEvent(pldm::InstanceIdDb& instanceIdDb,
+                        sdeventplus::Event& event) :
+        DbusToPLDMEvent(-1, 9, instanceIdDb, nullptr, event)
+    {}
+
+    using DbusToPLDMEvent::debounceWindow;
+    using DbusToPLDMEvent::queueSensorEvent;
+
+    void sendEventMsg(uint8_t eventType,
+                      const std::vector<uint8_t>& eventDataVec) override
+    {
+        EXPECT_EQ(PLDM_SENSOR_EVENT, eventType);
+        events.emplace_back(eventDataVec);
+    }
+
+    /** @brief The sensor event data sent */
+    std::vector<std::vector<uint8_t>> events;
+};
+
+TEST(DbusToPLDMEvent, debounceSensorEvents)
+{
+    TestInstanceIdDb instanceIdDb;
+    auto event = sdeventplus::Event::get_default();
+    TestDbusToPLDMEvent dbusToPLDMEvent(instanceIdDb, event);
+    dbusToPLDMEvent.debounceWindow = std::chrono::milliseconds(50);
+
+    // Flips of a sensor offset collapse to the latest state, the other
+    // offset of the composite sensor and the other sensor are kept
+    dbusToPLDMEvent.queueSensorEvent(1, 0, 1);
+    dbusToPLDMEvent.queueSensorEvent(1, 0, 2);
+    dbusToPLDMEvent.queueSensorEvent(1, 0, 1);
+    dbusToPLDMEvent.queueSensorEvent(1, 1, 3);
+    dbusToPLDMEvent.queueSensorEvent(2, 0, 2);
+    const auto& counters = dbusToPLDMEvent.getDebounceCounters();
+    EXPECT_TRUE(dbusToPLDMEvent.events.empty());
+    EXPECT_EQ(counters.sent, 0);
+
+    utils::runEventLoopForSeconds(event, 1);
+
+    // A stateSensorState event carries one offset, the pending offsets are
+    // sent one event each: sensor ID, event class, offset, state, previous
+    ASSERT_EQ(dbusToPLDMEvent.events.size(), 3);
+    EXPECT_EQ(dbusToPLDMEvent.events[0],
+              (std::vector<uint8_t>{1, 0, PLDM_STATE_SENSOR_STATE, 0, 1, 1}));
+    EXPECT_EQ(dbusToPLDMEvent.events[1],
+              (std::vector<uint8_t>{1, 0, PLDM_STATE_SENSOR_STATE, 1, 3, 3}));
+    EXPECT_EQ(dbusToPLDMEvent.events[2],
+              (std::vector<uint8_t>{2, 0, PLDM_STATE_SENSOR_STATE, 0, 2, 2}));
+    EXPECT_EQ(counters.sent, 3);
+    EXPECT_EQ(counters.suppressed, 2);
+
+    // The next change reports the state sent before as its previous state
+    dbusToPLDMEvent.queueSensorEvent(1, 0, 2);
+    utils::runEventLoopForSeconds(event, 1);
+    ASSERT_EQ(dbusToPLDMEvent.events.size(), 4);
+    EXPECT_EQ(dbusToPLDMEvent.events[3],
+              (std::vector<uint8_t>{1, 0, PLDM_STATE_SENSOR_STATE, 0, 2, 1}));
+}
@@ -89,8 +89,9 @@ TEST(EntityAssociation, addObjectPathEntityAssociations1)
 
     ObjectPathMaps objPathMap;
     EntityMaps entityMaps = parseEntityMap("./entitymap_test.json");
-    updateEntityAssociation(entityAssociations, tree, objPathMap, entityMaps,
-                            nullptr);
+    EntityTreeIndex entityTreeIndex(tree);
+    updateEntityAssociation(entityAssociations, entityTreeIndex, objPathMap,
+                            entityMaps, nullptr);
 
     EXPECT_EQ(objPathMap.size(), retObjectMaps.size());
 
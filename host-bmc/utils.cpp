@@ -156,9 +156,8 @@ void addObjectPathEntityAssociations(
 }
 
 void updateEntityAssociation(
-    const EntityAssociations& entityAssoc,
-    pldm_entity_association_tree* entityTree, ObjectPathMaps& objPathMap,
-    EntityMaps entityMaps,
+    const EntityAssociations& entityAssoc, EntityTreeIndex& entityTreeIndex,
+    ObjectPathMaps& objPathMap, EntityMaps entityMaps,
     pldm::responder::oem_platform::Handler* oemPlatformHandler)
 {
     std::vector<pldm_entity_node*> parentsEntity =
@@ -168,8 +167,7 @@ void updateEntityAssociation(
         fs::path path{"/xyz/openbmc_project/inventory"};
         std::deque<std::string> paths{};
         pldm_entity node_entity = pldm_entity_extract(entity);
-        auto node = pldm_entity_association_tree_find_with_locality(
-            entityTree, &node_entity, false);
+        auto node = entityTreeIndex.findWithLocality(&node_entity, false);
         if (!node)
         {
             continue;
@@ -199,8 +197,7 @@ void updateEntityAssociation(
                 break;
             }
 
-            node = pldm_entity_association_tree_find_with_locality(
-                entityTree, &parent, false);
+            node = entityTreeIndex.findWithLocality(&parent, false);
         }
 
         if (!found)
@@ -1,3 +1,4 @@
+#include "common/entity_tree_index.hpp"
 #include "common/utils.hpp"
 #include "libpldmresponder/oem_handler.hpp"
 
@@ -23,14 +24,14 @@ namespace utils
 
 /** @brief Vector a entity name to pldm_entity from entity association tree
  *  @param[in]  entityAssoc    - Vector of associated pldm entities
- *  @param[in]  entityTree     - entity association tree
+ *  @param[in]  entityTreeIndex - index over the entity association tree
  *  @param[out] objPathMap     - maps an object path to pldm_entity from the
  *                               BMC's entity association tree
  *  @return
  */
 void updateEntityAssociation(
     const pldm::utils::EntityAssociations& entityAssoc,
-    pldm_entity_association_tree* entityTree,
+    pldm::utils::EntityTreeIndex& entityTreeIndex,
     pldm::utils::ObjectPathMaps& objPathMap, pldm::utils::EntityMaps entityMaps,
     pldm::responder::oem_platform::Handler* oemPlatformHandler);
 
@@ -87,8 +87,8 @@ Handler::Handler(
         });
     handlers.emplace(
         PLDM_GET_BIOS_TABLE,
-        [this](pldm_tid_t, const pldm_msg* request, size_t payloadLength) {
-            return this->getBIOSTable(request, payloadLength);
+        [this](pldm_tid_t tid, const pldm_msg* request, size_t payloadLength) {
+            return this->getBIOSTable(tid, request, payloadLength);
         });
     handlers.emplace(
         PLDM_SET_BIOS_TABLE,
@@ -224,7 +224,8 @@ Response Handler::setDateTime(const pldm_msg* request, size_t payloadLength)
     return ccOnlyResponse(request, PLDM_SUCCESS);
 }
 
-Response Handler::getBIOSTable(const pldm_msg* request, size_t payloadLength)
+Response Handler::getBIOSTable(pldm_tid_t tid, const pldm_msg* request,
+                               size_t payloadLength)
 {
     uint32_t transferHandle{};
     uint8_t transferOpFlag{};
@@ -237,20 +238,42 @@ Response Handler::getBIOSTable(const pldm_msg* request, size_t payloadLength)
         return ccOnlyResponse(request, rc);
     }
 
-    auto table =
-        biosConfig.getBIOSTable(static_cast<pldm_bios_table_types>(tableType));
-    if (!table)
+    TableTransfer::Part part{};
+    if (transferOpFlag == PLDM_GET_FIRSTPART)
     {
-        return ccOnlyResponse(request, PLDM_BIOS_TABLE_UNAVAILABLE);
+        // The table is loaded once per transfer, the parts are served from it
+        auto table = biosConfig.getBIOSTable(
+            static_cast<pldm_bios_table_types>(tableType));
+        if (!table)
+        {
+            return ccOnlyResponse(request, PLDM_BIOS_TABLE_UNAVAILABLE);
+        }
+        part = tableTransfer.getFirstPart(
+            tid, tableType, std::make_shared<const Table>(std::move(*table)));
+    }
+    else if (transferOpFlag == PLDM_GET_NEXTPART)
+    {
+        rc = tableTransfer.getNextPart(tid, tableType, transferHandle, part);
+        if (rc != PLDM_SUCCESS)
+        {
+            return ccOnlyResponse(request, rc);
+        }
+    }
+    else
+    {
+        return ccOnlyResponse(request,
+                              TableTransfer::invalidTransferOperationFlag);
     }
 
     Response response(sizeof(pldm_msg_hdr) +
-                      PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES + table->size());
+                      PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES + part.data.size());
     auto responsePtr = new (response.data()) pldm_msg;
 
+    // The table data is only read by the encoder
     rc = encode_get_bios_table_resp(
-        request->hdr.instance_id, PLDM_SUCCESS, 0 /* nxtTransferHandle */,
-        PLDM_START_AND_END, table->data(), response.size(), responsePtr);
+        request->hdr.instance_id, PLDM_SUCCESS, part.nextDataTransferHandle,
+        part.transferFlag, const_cast<uint8_t*>(part.data.data()),
+        response.size(), responsePtr);
     if (rc != PLDM_SUCCESS)
     {
         return ccOnlyResponse(request, rc);
@@ -6,6 +6,7 @@
 #include "platform_config.hpp"
 #include "pldmd/handler.hpp"
 #include "requester/handler.hpp"
+#include "table_transfer.hpp"
 
 #include <libpldm/bios.h>
 #include <libpldm/bios_table.h>
@@ -50,13 +51,16 @@ class Handler : public CmdHandler
      */
     Response getDateTime(const pldm_msg* request, size_t payloadLength);
 
-    /** @brief Handler for GetBIOSTable
+    /** @brief Handler for GetBIOSTable, the tables are sent in parts of at
+     *         most TABLE_TRANSFER_CHUNK_SIZE bytes
      *
+     *  @param[in] tid - TID of the requester
      *  @param[in] request - Request message
      *  @param[in] payload_length - Request message payload length
      *  @return Response - PLDM Response message
      */
-    Response getBIOSTable(const pldm_msg* request, size_t payloadLength);
+    Response getBIOSTable(pldm_tid_t tid, const pldm_msg* request,
+                          size_t payloadLength);
 
     /** @brief Handler for SetBIOSTable
      *
@@ -94,6 +98,11 @@ class Handler : public CmdHandler
 
   private:
     BIOSConfig biosConfig;
+
+    /** @brief Multipart transfers of the BIOS tables */
+    TableTransfer tableTransfer{
+        TABLE_TRANSFER_CHUNK_SIZE,
+        std::chrono::seconds(TABLE_TRANSFER_TIMEOUT_SECONDS)};
 };
 
 } // namespace bios
@@ -0,0 +1,195 @@
+#include "bios_catalog.hpp"
+
+#include <fcntl.h>
+#include <libpldm/bios_table.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <span>
+
+PHOSPHOR_LOG2_USING;
+
+namespace pldm
+{
+
+namespace responder
+{
+
+namespace bios
+{
+
+namespace
+{
+
+constexpr std::array<char, 8> catalogMagic{'P', 'L', 'D', 'M', 'B', 'C', 'A',
+                                           'T'};
+
+/** @struct CatalogHeader
+ *
+ *  Header of the catalog, followed by the string table and the CBOR of the
+ *  attribute entries. The catalog is only read by the pldmd which wrote it,
+ *  the fields are in the host byte order.
+ */
+struct CatalogHeader
+{
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t stringTableSize;
+    uint64_t sourceHash;
+    uint32_t entriesSize;
+    uint32_t reserved;
+};
+static_assert(sizeof(CatalogHeader) == 32);
+
+/** @brief Decode a mapped catalog
+ *
+ *  @return true if the catalog is valid and compiled from the source hash
+ */
+bool decodeCatalog(std::span<const uint8_t> image, uint64_t hash,
+                   Table& stringTable, nlohmann::json& entries)
+{
+    CatalogHeader header{};
+    if (image.size() < sizeof(header))
+    {
+        return false;
+    }
+    std::memcpy(&header, image.data(), sizeof(header));
+    if (header.magic != catalogMagic ||
+        header.version != BIOSAttributeCatalog::version ||
+        header.sourceHash != hash)
+    {
+        return false;
+    }
+
+    auto payload = image.subspan(sizeof(header));
+    if (payload.size() !=
+        size_t{header.stringTableSize} + size_t{header.entriesSize})
+    {
+        return false;
+    }
+
+    auto strings = payload.first(header.stringTableSize);
+    if (!pldm_bios_table_checksum(strings.data(), strings.size()))
+    {
+        return false;
+    }
+
+    auto cbor = payload.subspan(header.stringTableSize);
+    entries = nlohmann::json::from_cbor(cbor.begin(), cbor.end());
+    if (!entries.is_array())
+    {
+        return false;
+    }
+    stringTable.assign(strings.begin(), strings.end());
+    return true;
+}
+
+} // namespace
+
+BIOSAttributeCatalog::BIOSAttributeCatalog(const fs::path& filePath) :
+    filePath(filePath)
+{}
+
+uint64_t BIOSAttributeCatalog::sourceHash(const fs::path& jsonPath,
+                                          std::string_view source)
+{
+    // FNV-1a, stable across builds unlike std::hash
+    constexpr uint64_t fnvPrime = 0x100000001b3;
+    uint64_t hash = 0xcbf29ce484222325;
+    auto update = [&hash](std::string_view bytes) {
+        for (auto byte : bytes)
+        {
+            hash ^= static_cast<uint8_t>(byte);
+            hash *= fnvPrime;
+        }
+    };
+    update(jsonPath.native());
+    update(std::string_view("\0", 1));
+    update(source);
+    return hash;
+}
+
+bool BIOSAttributeCatalog::load(uint64_t hash, Table& stringTable,
+                                nlohmann::json& entries) const
+{
+    auto fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st{};
+    void* mapped = MAP_FAILED;
+    if (!fstat(fd, &st) && st.st_size > 0)
+    {
+        mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        return false;
+    }
+
+    bool loaded = false;
+    try
+    {
+        loaded = decodeCatalog(
+            std::span(static_cast<const uint8_t*>(mapped),
+                      static_cast<size_t>(st.st_size)),
+            hash, stringTable, entries);
+    }
+    catch (const std::exception& e)
+    {
+        error("Failed to decode BIOS attribute catalog '{PATH}', error - {ERROR}",
+              "PATH", filePath, "ERROR", e);
+    }
+    munmap(mapped, st.st_size);
+    return loaded;
+}
+
+void BIOSAttributeCatalog::store(uint64_t hash, const Table& stringTable,
+                                 const nlohmann::json& entries) const
+{
+    try
+    {
+        auto cbor = nlohmann::json::to_cbor(entries);
+
+        CatalogHeader header{};
+        header.magic = catalogMagic;
+        header.version = version;
+        header.stringTableSize = stringTable.size();
+        header.sourceHash = hash;
+        header.entriesSize = cbor.size();
+
+        // Written aside and renamed, a catalog is never seen partially written
+        auto tmpPath = filePath;
+        tmpPath += ".tmp";
+        {
+            std::ofstream stream(tmpPath, std::ios::out | std::ios::binary |
+                                              std::ios::trunc);
+            stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+            stream.write(reinterpret_cast<const char*>(&header),
+                         sizeof(header));
+            stream.write(reinterpret_cast<const char*>(stringTable.data()),
+                         stringTable.size());
+            stream.write(reinterpret_cast<const char*>(cbor.data()),
+                         cbor.size());
+        }
+        fs::rename(tmpPath, filePath);
+    }
+    catch (const std::exception& e)
+    {
+        error("Failed to store BIOS attribute catalog '{PATH}', error - {ERROR}",
+              "PATH", filePath, "ERROR", e);
+    }
+}
+
+} // namespace bios
+} // namespace responder
+} // namespace pldm
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "bios_table.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace pldm
+{
+
+namespace responder
+{
+
+namespace bios
+{
+
+/** @class BIOSAttributeCatalog
+ *
+ *  @brief Binary cache of a BIOS attribute JSON
+ *
+ *  The catalog holds the BIOS string table built from the attribute JSON and
+ *  the attribute entries, D-Bus mappings included, encoded in CBOR. It is
+ *  tagged with the hash of the JSON it was compiled from, so that pldmd maps
+ *  the catalog at startup instead of parsing the JSON text and building the
+ *  string table, until the JSON changes.
+ */
+class BIOSAttributeCatalog
+{
+  public:
+    /** @brief Version of the catalog format */
+    static constexpr uint32_t version = 1;
+
+    /** @brief Ctor - set file path of the catalog
+     *
+     *  @param[in] filePath - file where the catalog is stored
+     */
+    explicit BIOSAttributeCatalog(const fs::path& filePath);
+
+    /** @brief Hash the attribute JSON a catalog is compiled from
+     *
+     *  @param[in] jsonPath - path of the attribute JSON
+     *  @param[in] source - content of the attribute JSON
+     *
+     *  @return the hash tagging the catalog
+     */
+    static uint64_t sourceHash(const fs::path& jsonPath,
+                               std::string_view source);
+
+    /** @brief Load the catalog compiled from an attribute JSON
+     *
+     *  @param[in] hash - hash of the attribute JSON
+     *  @param[out] stringTable - the BIOS string table
+     *  @param[out] entries - the attribute entries
+     *
+     *  @return true if the catalog is loaded, false if there is no valid
+     *          catalog compiled from the attribute JSON
+     */
+    bool load(uint64_t hash, Table& stringTable, nlohmann::json& entries) const;
+
+    /** @brief Store the catalog compiled from an attribute JSON
+     *
+     *  @param[in] hash - hash of the attribute JSON
+     *  @param[in] stringTable - the BIOS string table
+     *  @param[in] entries - the attribute entries
+     */
+    void store(uint64_t hash, const Table& stringTable,
+               const nlohmann::json& entries) const;
+
+  private:
+    /** @brief file storing the catalog */
+    fs::path filePath;
+};
+
+} // namespace bios
+} // namespace responder
+} // namespace pldm
@@ -1,5 +1,6 @@
 #include "bios_config.hpp"
 
+#include "bios_catalog.hpp"
 #include "bios_enum_attribute.hpp"
 #include "bios_integer_attribute.hpp"
 #include "bios_string_attribute.hpp"
@@ -7,6 +8,7 @@
 #include "common/bios_utils.hpp"
 
 #include <phosphor-logging/lg2.hpp>
+#include <sdeventplus/event.hpp>
 #include <xyz/openbmc_project/BIOSConfig/Manager/server.hpp>
 
 #include <filesystem>
@@ -32,6 +34,7 @@ using BIOSConfigManager =
     sdbusplus::xyz::openbmc_project::BIOSConfig::server::Manager;
 
 constexpr auto attributesJsonFile = "bios_attrs.json";
+constexpr auto attributeCatalogFile = "attributeCatalog";
 
 constexpr auto stringTableFile = "stringTable";
 constexpr auto attrTableFile = "attributeTable";
@@ -48,7 +51,9 @@ BIOSConfig::BIOSConfig(
     jsonDir(jsonDir), tableDir(tableDir), dbusHandler(dbusHandler), eid(eid),
     instanceIdDb(instanceIdDb), handler(handler),
     platformConfigHandler(platformConfigHandler),
-    requestPLDMServiceName(requestPLDMServiceName)
+    requestPLDMServiceName(requestPLDMServiceName),
+    commitTimer(sdeventplus::Event::get_default().get(),
+                std::bind_front(&BIOSConfig::commitAttrValues, this))
 {
     fs::create_directories(tableDir);
     removeTables();
@@ -62,6 +67,19 @@ BIOSConfig::BIOSConfig(
     listenPendingAttributes();
 }
 
+BIOSConfig::~BIOSConfig()
+{
+    try
+    {
+        commitAttrValues();
+    }
+    catch (const std::exception& e)
+    {
+        error("Failed to commit the BIOS attribute values, error - {ERROR}",
+              "ERROR", e);
+    }
+}
+
 void BIOSConfig::checkSystemTypeAvailability()
 {
     if (platformConfigHandler)
@@ -99,6 +117,12 @@ void BIOSConfig::initBIOSAttributes(const std::string& systemType,
     }
     constructAttributes();
     buildTables();
+
+    // The attribute entries are only needed to build the tables
+    attributeJsonPath.clear();
+    attributeEntries = Json();
+    catalogStringTable.reset();
+
     if (registerService)
     {
         requestPLDMServiceName();
@@ -126,6 +150,10 @@ std::optional<Table> BIOSConfig::getBIOSTable(pldm_bios_table_types tableType)
             tablePath = tableDir / attrTableFile;
             break;
         case PLDM_BIOS_ATTR_VAL_TABLE:
+            if (attrValueBatch)
+            {
+                return attrValueBatch->attrValueTable;
+            }
             tablePath = tableDir / attrValueTableFile;
             break;
     }
@@ -144,6 +172,9 @@ int BIOSConfig::setBIOSTable(uint8_t tableType, const Table& table,
         return PLDM_INVALID_BIOS_TABLE_DATA_INTEGRITY_CHECK;
     }
 
+    // The new table replaces the values set and not committed yet
+    commitAttrValues();
+
     if (tableType == PLDM_BIOS_STRING_TABLE)
     {
         storeTable(stringTablePath, table);
@@ -624,6 +655,12 @@ void BIOSConfig::buildAndStoreAttrTables(const Table& stringTable)
 
 std::optional<Table> BIOSConfig::buildAndStoreStringTable()
 {
+    if (catalogStringTable)
+    {
+        setBIOSTable(PLDM_BIOS_STRING_TABLE, *catalogStringTable);
+        return catalogStringTable;
+    }
+
     std::set<std::string> strings;
     load(jsonDir / sysType / attributesJsonFile, [&strings](const Json& entry) {
         if (entry.at("attribute_type") == "enum")
@@ -654,6 +691,12 @@ std::optional<Table> BIOSConfig::buildAndStoreStringTable()
 
     table::appendPadAndChecksum(table);
     setBIOSTable(PLDM_BIOS_STRING_TABLE, table);
+
+    if (!attributeJsonPath.empty())
+    {
+        BIOSAttributeCatalog catalog(tableDir / attributeCatalogFile);
+        catalog.store(attributeSourceHash, table, attributeEntries);
+    }
     return table;
 }
 
@@ -676,35 +719,65 @@ std::optional<Table> BIOSConfig::loadTable(const fs::path& path)
     return table;
 }
 
+const Json& BIOSConfig::loadEntries(const fs::path& filePath)
+{
+    if (!attributeJsonPath.empty() && attributeJsonPath == filePath)
+    {
+        return attributeEntries;
+    }
+
+    attributeJsonPath.clear();
+    attributeEntries = Json::array();
+    catalogStringTable.reset();
+    if (!fs::exists(filePath))
+    {
+        return attributeEntries;
+    }
+
+    try
+    {
+        std::ifstream file(filePath, std::ios::in | std::ios::binary);
+        std::string source{std::istreambuf_iterator<char>(file),
+                           std::istreambuf_iterator<char>()};
+        attributeSourceHash =
+            BIOSAttributeCatalog::sourceHash(filePath, source);
+
+        BIOSAttributeCatalog catalog(tableDir / attributeCatalogFile);
+        Table stringTable;
+        if (catalog.load(attributeSourceHash, stringTable, attributeEntries))
+        {
+            catalogStringTable = std::move(stringTable);
+        }
+        else
+        {
+            info("Compiling BIOS attribute catalog from '{PATH}'", "PATH",
+                 filePath);
+            attributeEntries = Json::parse(source).at("entries");
+        }
+        attributeJsonPath = filePath;
+    }
+    catch (const std::exception& e)
+    {
+        error("Failed to parse JSON config file '{PATH}', error - {ERROR}",
+              "PATH", filePath, "ERROR", e);
+        attributeEntries = Json::array();
+    }
+    return attributeEntries;
+}
+
 void BIOSConfig::load(const fs::path& filePath, ParseHandler handler)
 {
-    std::ifstream file;
-    Json jsonConf;
-    if (fs::exists(filePath))
+    for (const auto& entry : loadEntries(filePath))
     {
         try
         {
-            file.open(filePath);
-            jsonConf = Json::parse(file);
-            auto entries = jsonConf.at("entries");
-            for (auto& entry : entries)
-            {
-                try
-                {
-                    handler(entry);
-                }
-                catch (const std::exception& e)
-                {
-                    error(
-                        "Failed to parse JSON config file at path '{PATH}', error - {ERROR}",
-                        "PATH", filePath, "ERROR", e);
-                }
-            }
+            handler(entry);
         }
         catch (const std::exception& e)
         {
-            error("Failed to parse JSON config file '{PATH}', error - {ERROR}",
-                  "PATH", filePath, "ERROR", e);
+            error(
+                "Failed to parse JSON config file at path '{PATH}', error - {ERROR}",
+                "PATH", filePath, "ERROR", e);
         }
     }
 }
@@ -721,12 +794,12 @@ std::string BIOSConfig::decodeStringFromStringEntry(
     return std::string(buffer.data(), buffer.data() + strLength);
 }
 
-std::string BIOSConfig::displayStringHandle(
-    uint16_t handle, uint8_t index, const std::optional<Table>& attrTable,
-    const std::optional<Table>& stringTable)
+std::string BIOSConfig::displayStringHandle(uint16_t handle, uint8_t index,
+                                            const Table& attrTable,
+                                            const Table& stringTable)
 {
     auto attrEntry = pldm_bios_table_attr_find_by_handle(
-        attrTable->data(), attrTable->size(), handle);
+        attrTable.data(), attrTable.size(), handle);
     uint8_t pvNum;
     int rc = pldm_bios_table_attr_entry_enum_decode_pv_num(attrEntry, &pvNum);
     if (rc != PLDM_SUCCESS)
@@ -746,7 +819,7 @@ std::string BIOSConfig::displayStringHandle(
     std::string displayString = std::to_string(pvHandls[index]);
 
     auto stringEntry = pldm_bios_table_string_find_by_handle(
-        stringTable->data(), stringTable->size(), pvHandls[index]);
+        stringTable.data(), stringTable.size(), pvHandls[index]);
 
     auto decodedStr = decodeStringFromStringEntry(stringEntry);
 
@@ -755,16 +828,14 @@ std::string BIOSConfig::displayStringHandle(
 
 void BIOSConfig::traceBIOSUpdate(
     const pldm_bios_attr_val_table_entry* attrValueEntry,
-    const pldm_bios_attr_table_entry* attrEntry, bool isBMC)
+    const pldm_bios_attr_table_entry* attrEntry, bool isBMC,
+    const Table& attrTable, const Table& stringTable)
 {
-    auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
-    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
-
     auto [attrHandle,
           attrType] = table::attribute_value::decodeHeader(attrValueEntry);
 
     auto attrHeader = table::attribute::decodeHeader(attrEntry);
-    BIOSStringTable biosStringTable(*stringTable);
+    BIOSStringTable biosStringTable(stringTable);
     auto attrName = biosStringTable.findString(attrHeader.stringHandle);
 
     switch (attrType)
@@ -887,13 +958,76 @@ int BIOSConfig::checkAttrValueToUpdate(
     };
 }
 
-int BIOSConfig::setAttrValue(const void* entry, size_t size, bool isBMC,
-                             bool updateDBus, bool updateBaseBIOSTable)
+BIOSConfig::AttrValueBatch* BIOSConfig::getAttrValueBatch()
 {
-    auto attrValueTable = getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
-    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
+    if (attrValueBatch)
+    {
+        return &*attrValueBatch;
+    }
+
     auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
+    auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
+    auto attrValueTable = getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
     if (!attrValueTable || !attrTable || !stringTable)
+    {
+        return nullptr;
+    }
+
+    attrValueBatch.emplace(std::move(*stringTable), std::move(*attrTable),
+                           std::move(*attrValueTable));
+    if (commitWindow.count() > 0)
+    {
+        commitTimer.start(commitWindow);
+    }
+    return &*attrValueBatch;
+}
+
+std::optional<CurrentValue> BIOSConfig::decodeCurrentValue(
+    const pldm_bios_attr_val_table_entry* attrValueEntry,
+    const pldm_bios_attr_table_entry* attrEntry, const Table& stringTable)
+{
+    auto [attrHandle,
+          attrType] = table::attribute_value::decodeHeader(attrValueEntry);
+
+    switch (attrType)
+    {
+        case PLDM_BIOS_ENUMERATION:
+        case PLDM_BIOS_ENUMERATION_READ_ONLY:
+        {
+            auto indices =
+                table::attribute_value::decodeEnumEntry(attrValueEntry);
+            auto [pvHdls, defIndex] =
+                table::attribute::decodeEnumEntry(attrEntry);
+            if (indices.empty() || indices.back() >= pvHdls.size())
+            {
+                return std::nullopt;
+            }
+            auto stringEntry = pldm_bios_table_string_find_by_handle(
+                stringTable.data(), stringTable.size(),
+                pvHdls[indices.back()]);
+            if (stringEntry == nullptr)
+            {
+                return std::nullopt;
+            }
+            return decodeStringFromStringEntry(stringEntry);
+        }
+        case PLDM_BIOS_INTEGER:
+        case PLDM_BIOS_INTEGER_READ_ONLY:
+            return static_cast<int64_t>(
+                table::attribute_value::decodeIntegerEntry(attrValueEntry));
+        case PLDM_BIOS_STRING:
+        case PLDM_BIOS_STRING_READ_ONLY:
+            return table::attribute_value::decodeStringEntry(attrValueEntry);
+        default:
+            return std::nullopt;
+    }
+}
+
+int BIOSConfig::setAttrValue(const void* entry, size_t size, bool isBMC,
+                             bool updateDBus, bool updateBaseBIOSTable)
+{
+    auto batch = getAttrValueBatch();
+    if (batch == nullptr)
     {
         return PLDM_BIOS_TABLE_UNAVAILABLE;
     }
@@ -903,33 +1037,27 @@ int BIOSConfig::setAttrValue(const void* entry, size_t size, bool isBMC,
 
     auto attrValHeader = table::attribute_value::decodeHeader(attrValueEntry);
 
-    auto attrEntry =
-        table::attribute::findByHandle(*attrTable, attrValHeader.attrHandle);
+    auto attrEntry = table::attribute::findByHandle(batch->attrTable,
+                                                    attrValHeader.attrHandle);
     if (!attrEntry)
     {
         return PLDM_ERROR;
     }
 
-    auto rc = checkAttrValueToUpdate(attrValueEntry, attrEntry, *stringTable);
+    auto rc =
+        checkAttrValueToUpdate(attrValueEntry, attrEntry, batch->stringTable);
     if (rc != PLDM_SUCCESS)
     {
         return rc;
     }
 
-    auto destTable =
-        table::attribute_value::updateTable(*attrValueTable, entry, size);
-
-    if (!destTable)
-    {
-        return PLDM_ERROR;
-    }
-
+    AttributeName attrName;
     try
     {
         auto attrHeader = table::attribute::decodeHeader(attrEntry);
 
-        BIOSStringTable biosStringTable(*stringTable);
-        auto attrName = biosStringTable.findString(attrHeader.stringHandle);
+        BIOSStringTable biosStringTable(batch->stringTable);
+        attrName = biosStringTable.findString(attrHeader.stringHandle);
         auto iter = std::find_if(
             biosAttributes.begin(), biosAttributes.end(),
             [&attrName](const auto& attr) { return attr->name == attrName; });
@@ -950,13 +1078,89 @@ int BIOSConfig::setAttrValue(const void* entry, size_t size, bool isBMC,
         return PLDM_ERROR;
     }
 
-    setBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE, *destTable, updateBaseBIOSTable);
+    // A value of the same length is patched in place, only a value of a
+    // new length rebuilds the table
+    if (!table::attribute_value::patchTable(batch->attrValueTable, entry,
+                                            size))
+    {
+        auto destTable = table::attribute_value::updateTable(
+            batch->attrValueTable, entry, size);
+        if (!destTable)
+        {
+            return PLDM_ERROR;
+        }
+        batch->attrValueTable = std::move(*destTable);
+    }
+
+    auto currentValue =
+        decodeCurrentValue(attrValueEntry, attrEntry, batch->stringTable);
+    if (currentValue)
+    {
+        batch->changed.insert_or_assign(std::move(attrName),
+                                        std::move(*currentValue));
+    }
+    batch->updateBaseBIOSTable |= updateBaseBIOSTable;
 
-    traceBIOSUpdate(attrValueEntry, attrEntry, isBMC);
+    traceBIOSUpdate(attrValueEntry, attrEntry, isBMC, batch->attrTable,
+                    batch->stringTable);
+
+    if (commitWindow.count() == 0)
+    {
+        commitAttrValues();
+    }
 
     return PLDM_SUCCESS;
 }
 
+void BIOSConfig::commitAttrValues()
+{
+    if (!attrValueBatch)
+    {
+        return;
+    }
+    auto batch = std::move(*attrValueBatch);
+    attrValueBatch.reset();
+    if (commitTimer.isEnabled())
+    {
+        commitTimer.stop();
+    }
+
+    storeTable(tableDir / attrValueTableFile, batch.attrValueTable);
+
+    if (baseBIOSTableMaps.empty())
+    {
+        auto rc = checkAttributeValueTable(batch.attrValueTable);
+        if (rc == PLDM_SUCCESS && batch.updateBaseBIOSTable)
+        {
+            updateBaseBIOSTableProperty();
+        }
+        return;
+    }
+
+    // Only the current values of the changed attributes are updated, the
+    // property is set again only when one of them is a new value
+    bool modified = false;
+    for (auto& [attrName, currentValue] : batch.changed)
+    {
+        auto it = baseBIOSTableMaps.find(attrName);
+        if (it == baseBIOSTableMaps.end())
+        {
+            continue;
+        }
+        auto& value = std::get<5>(it->second);
+        if (value != currentValue)
+        {
+            value = std::move(currentValue);
+            modified = true;
+        }
+    }
+
+    if (modified && batch.updateBaseBIOSTable)
+    {
+        updateBaseBIOSTableProperty();
+    }
+}
+
 void BIOSConfig::removeTables()
 {
     try
@@ -1024,14 +1228,6 @@ void BIOSConfig::processBiosAttrChangeNotification(
     auto [attrHdl, attrType,
           stringHdl] = table::attribute::decodeHeader(tableEntry);
 
-    auto attrValueSrcTable = getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
-
-    if (!attrValueSrcTable.has_value())
-    {
-        error("Attribute value table not present");
-        return;
-    }
-
     Table newValue;
     auto rc = biosAttributes[biosAttrIndex]->updateAttrVal(
         newValue, attrHdl, attrType, newPropVal);
@@ -1042,13 +1238,6 @@ void BIOSConfig::processBiosAttrChangeNotification(
             "ATTR_HANDLE", attrHdl, "TYPE", attrType);
         return;
     }
-    auto destTable = table::attribute_value::updateTable(
-        *attrValueSrcTable, newValue.data(), newValue.size());
-    if (destTable.has_value())
-    {
-        storeTable(tableDir / attrValueTableFile, *destTable);
-    }
-
     rc = setAttrValue(newValue.data(), newValue.size(), true, false);
     if (rc != PLDM_SUCCESS)
     {
@@ -11,7 +11,9 @@
 
 #include <nlohmann/json.hpp>
 #include <phosphor-logging/lg2.hpp>
+#include <sdbusplus/timer.hpp>
 
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -71,7 +73,10 @@ class BIOSConfig
     BIOSConfig(BIOSConfig&&) = delete;
     BIOSConfig& operator=(const BIOSConfig&) = delete;
     BIOSConfig& operator=(BIOSConfig&&) = delete;
-    ~BIOSConfig() = default;
+
+    /** @brief Commit the attribute values set within the last commit window
+     */
+    ~BIOSConfig();
 
     /** @brief Construct BIOSConfig
      *  @param[in] jsonDir - The directory where json file exists
@@ -94,6 +99,11 @@ class BIOSConfig
         pldm::responder::bios::Callback requestPLDMServiceName);
 
     /** @brief Set attribute value on dbus and attribute value table
+     *
+     *  The attribute value table is patched in memory, the attribute values
+     *  set within the commit window are persisted and published in the
+     *  BaseBIOSTable property together by commitAttrValues().
+     *
      *  @param[in] entry - attribute value entry
      *  @param[in] size - size of the attribute value entry
      *  @param[in] isBMC - indicates if the attribute is set by BMC
@@ -106,6 +116,11 @@ class BIOSConfig
     int setAttrValue(const void* entry, size_t size, bool isBMC,
                      bool updateDBus = true, bool updateBaseBIOSTable = true);
 
+    /** @brief Persist the attribute values set since the last commit and
+     *         publish the changed attributes in the BaseBIOSTable property
+     */
+    void commitAttrValues();
+
     /** @brief Remove the persistent tables */
     void removeTables();
 
@@ -193,6 +208,65 @@ class BIOSConfig
     /** @brief system type/model */
     std::string sysType;
 
+    /** @brief Path of the attribute json the entries are loaded from */
+    fs::path attributeJsonPath;
+
+    /** @brief Hash of the attribute json the entries are loaded from */
+    uint64_t attributeSourceHash = 0;
+
+    /** @brief Entries of the attribute json, until the tables are built */
+    Json attributeEntries;
+
+    /** @brief String table of the attribute catalog, std::nullopt when the
+     *         entries are parsed from the json */
+    std::optional<Table> catalogStringTable;
+
+    /** @struct AttrValueBatch
+     *
+     *  The tables of the attribute values set and not committed yet
+     */
+    struct AttrValueBatch
+    {
+        Table stringTable;
+        Table attrTable;
+        Table attrValueTable;
+
+        /** @brief Current values of the changed attributes */
+        std::map<AttributeName, CurrentValue> changed;
+
+        /** @brief A change asked to update the BaseBIOSTable property */
+        bool updateBaseBIOSTable = false;
+    };
+
+    /** @brief Attribute values not committed yet */
+    std::optional<AttrValueBatch> attrValueBatch;
+
+    /** @brief Time the attribute values set are batched before they are
+     *         committed, 0 to commit each of them */
+    std::chrono::milliseconds commitWindow{BIOS_ATTR_COMMIT_WINDOW};
+
+    /** @brief Timer committing the attribute values at the end of the
+     *         commit window */
+    sdbusplus::Timer commitTimer;
+
+    /** @brief Get the batch of the attribute values not committed, the
+     *         batch is started with the persistent tables when there is none
+     *  @return the batch, nullptr if the tables are unavailable
+     */
+    AttrValueBatch* getAttrValueBatch();
+
+    /** @brief Decode the current value of an attribute value entry as in
+     *         the BaseBIOSTable property
+     *  @param[in] attrValueEntry - The attribute value entry
+     *  @param[in] attrEntry - The attribute table entry
+     *  @param[in] stringTable - The string table
+     *  @return the current value, std::nullopt for the attribute types not
+     *          having one
+     */
+    std::optional<CurrentValue> decodeCurrentValue(
+        const pldm_bios_attr_val_table_entry* attrValueEntry,
+        const pldm_bios_attr_table_entry* attrEntry, const Table& stringTable);
+
     /** @brief Method to update a BIOS attribute when the corresponding Dbus
      *  property is changed
      *  @param[in] chProperties - list of properties which have changed
@@ -276,6 +350,14 @@ class BIOSConfig
      */
     void load(const fs::path& filePath, ParseHandler handler);
 
+    /** @brief Get the entries of the attribute json, from the attribute
+     *         catalog when it is compiled from the json, else parsed from
+     *         the json
+     *  @param[in] filePath - Path of json file
+     *  @return The entries, loaded once per json file
+     */
+    const Json& loadEntries(const fs::path& filePath);
+
     /** @brief Build String Table and persist it
      *  @return The built string table, std::nullopt if it fails.
      */
@@ -320,18 +402,21 @@ class BIOSConfig
      * name handle
      */
     std::string displayStringHandle(uint16_t handle, uint8_t index,
-                                    const std::optional<Table>& attrTable,
-                                    const std::optional<Table>& stringTable);
+                                    const Table& attrTable,
+                                    const Table& stringTable);
 
     /** @brief Method to trace the bios attribute which got changed
      *
      *  @param[in] attrValueEntry - The attribute value entry to update
      *  @param[in] attrEntry - The attribute table entry
      *  @param[in] isBMC - indicates if the attribute is set by BMC
+     *  @param[in] attrTable - the attribute table
+     *  @param[in] stringTable - the string table
      */
     void traceBIOSUpdate(const pldm_bios_attr_val_table_entry* attrValueEntry,
                          const pldm_bios_attr_table_entry* attrEntry,
-                         bool isBMC);
+                         bool isBMC, const Table& attrTable,
+                         const Table& stringTable);
 
     /** @brief Check the attribute value to update
      *  @param[in] attrValueEntry - The attribute value entry to update
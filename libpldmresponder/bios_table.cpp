@@ -1,11 +1,13 @@
 #include "bios_table.hpp"
 
+#include <endian.h>
 #include <libpldm/base.h>
 #include <libpldm/bios_table.h>
 #include <libpldm/utils.h>
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <cstring>
 #include <fstream>
 
 PHOSPHOR_LOG2_USING;
@@ -387,6 +389,34 @@ std::optional<Table> updateTable(const Table& table, const void* entry,
     return destTable;
 }
 
+bool patchTable(Table& table, const void* entry, size_t size)
+{
+    constexpr size_t checksumSize = sizeof(uint32_t);
+    if (size < sizeof(pldm_bios_attr_val_table_entry) ||
+        table.size() < checksumSize)
+    {
+        return false;
+    }
+
+    auto header = decodeHeader(
+        static_cast<const pldm_bios_attr_val_table_entry*>(entry));
+    auto oldEntry = pldm_bios_table_attr_value_find_by_handle(
+        table.data(), table.size(), header.attrHandle);
+    if (!oldEntry || pldm_bios_table_attr_value_entry_length(oldEntry) != size)
+    {
+        return false;
+    }
+
+    auto offset = reinterpret_cast<const uint8_t*>(oldEntry) - table.data();
+    std::memcpy(table.data() + offset, entry, size);
+
+    // The pad is unchanged as the table keeps its size
+    auto checksumOffset = table.size() - checksumSize;
+    auto checksum = htole32(pldm_edac_crc32(table.data(), checksumOffset));
+    std::memcpy(table.data() + checksumOffset, &checksum, checksumSize);
+    return true;
+}
+
 } // namespace attribute_value
 
 } // namespace table
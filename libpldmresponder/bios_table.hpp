@@ -364,6 +364,16 @@ const pldm_bios_attr_val_table_entry* constructEnumEntry(
 std::optional<Table> updateTable(const Table& table, const void* entry,
                                  size_t size);
 
+/** @brief Replace an entry of the table in place and update the table
+ *         checksum, when the new entry has the size of the entry it replaces
+ *  @param[in,out] table - the table need to be updated
+ *  @param[in] entry - the new attribute value entry
+ *  @param[in] size - size of the new entry
+ *  @return true if the table is patched, false if the entry has to be
+ *          replaced with updateTable
+ */
+bool patchTable(Table& table, const void* entry, size_t size);
+
 } // namespace attribute_value
 
 } // namespace table
@@ -5,6 +5,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <set>
 
 PHOSPHOR_LOG2_USING;
@@ -23,6 +24,18 @@ const std::set<std::string_view> supportedDbusPropertyTypes = {
     "uint32_t", "int64_t", "uint64_t", "double",   "string"};
 
 StateSensorHandler::StateSensorHandler(const std::string& dirPath)
+{
+    parseConfig(dirPath);
+}
+
+StateSensorHandler::StateSensorHandler(const std::string& dirPath,
+                                       sdeventplus::Event& event) :
+    event(&event)
+{
+    parseConfig(dirPath);
+}
+
+void StateSensorHandler::parseConfig(const std::string& dirPath)
 {
     fs::path dir(dirPath);
     if (!fs::exists(dir) || fs::is_empty(dir))
@@ -96,9 +109,26 @@ StateSensorHandler::StateSensorHandler(const std::string& dirPath)
 
             auto eventStateMap = mapStateToDBusVal(eventStates, propertyValues,
                                                    dbusInfo.propertyType);
-            eventMap.emplace(
+            auto [it, inserted] = eventMap.emplace(
                 stateSensorEntry,
-                std::make_tuple(std::move(dbusInfo), std::move(eventStateMap)));
+                std::make_tuple(dbusInfo, eventStateMap));
+            if (!inserted)
+            {
+                continue;
+            }
+
+            auto index = dispatchTable.size();
+            dispatchTable.emplace_back(EventDispatchEntry{
+                std::move(dbusInfo), std::move(eventStateMap), {}, {}, false, {},
+                {}});
+            if (stateSensorEntry.skipContainerId)
+            {
+                anyContainerEntries.try_emplace(stateSensorEntry, index);
+            }
+            else
+            {
+                exactEntries.try_emplace(stateSensorEntry, index);
+            }
         }
     }
 }
@@ -119,44 +149,236 @@ StateToDBusValue StateSensorHandler::mapStateToDBusVal(
     return eventStateMap;
 }
 
+std::optional<size_t> StateSensorHandler::findDispatchEntry(
+    const StateSensorEntry& entry) const
+{
+    auto key = entry;
+    key.skipContainerId = false;
+    if (auto it = exactEntries.find(key); it != exactEntries.end())
+    {
+        return it->second;
+    }
+
+    key.containerId = 0xFFFF;
+    key.skipContainerId = true;
+    if (auto it = anyContainerEntries.find(key);
+        it != anyContainerEntries.end())
+    {
+        return it->second;
+    }
+
+    return std::nullopt;
+}
+
 int StateSensorHandler::eventAction(const StateSensorEntry& entry,
                                     pdr::EventState state)
 {
+    auto index = findDispatchEntry(entry);
+    if (!index)
+    {
+        // There is no BMC action for this PLDM event
+        return PLDM_SUCCESS;
+    }
+
+    auto& dispatch = dispatchTable[*index];
+    dispatch.counters.received++;
+
+    auto stateIt = dispatch.eventStateMap.find(state);
+    if (stateIt == dispatch.eventStateMap.end())
+    {
+        dispatch.counters.dropped++;
+        error("Invalid event state '{EVENT_STATE}' for path '{PATH}'",
+              "EVENT_STATE", state, "PATH", dispatch.dbusMapping.objectPath);
+        return PLDM_ERROR_INVALID_DATA;
+    }
+
+    if (!event)
+    {
+        return setProperty(dispatch, stateIt->second);
+    }
+
+    if (dispatch.pendingValue)
+    {
+        // Only the latest state of the sensor is of interest
+        dispatch.counters.coalesced++;
+    }
+    else
+    {
+        pendingQueue.push_back(*index);
+    }
+    dispatch.pendingValue = stateIt->second;
+    scheduleQueue();
+
+    return PLDM_SUCCESS;
+}
+
+std::optional<EventCounters> StateSensorHandler::getEventCounters(
+    const StateSensorEntry& entry) const
+{
+    auto index = findDispatchEntry(entry);
+    if (!index)
+    {
+        return std::nullopt;
+    }
+    return dispatchTable[*index].counters;
+}
+
+std::string StateSensorHandler::getService(
+    const pldm::utils::DBusMapping& dbusMapping) const
+{
+    return pldm::utils::DBusHandler().getService(
+        dbusMapping.objectPath.c_str(), dbusMapping.interface.c_str());
+}
+
+const std::string& StateSensorHandler::entryService(
+    EventDispatchEntry& dispatch)
+{
+    if (dispatch.service.empty())
+    {
+        dispatch.service = getService(dispatch.dbusMapping);
+    }
+    return dispatch.service;
+}
+
+sdbusplus::message_t StateSensorHandler::newSetMethod(
+    EventDispatchEntry& dispatch, const utils::PropertyValue& value)
+{
+    const auto& dbusMapping = dispatch.dbusMapping;
+    const auto& service = entryService(dispatch);
+
+    auto& bus = pldm::utils::DBusHandler::getBus();
+    auto method = bus.new_method_call(
+        service.c_str(), dbusMapping.objectPath.c_str(),
+        pldm::utils::dbusProperties, "Set");
+    method.append(dbusMapping.interface, dbusMapping.propertyName, value);
+    return method;
+}
+
+int StateSensorHandler::setProperty(EventDispatchEntry& dispatch,
+                                    const utils::PropertyValue& value)
+{
+    const auto& dbusMapping = dispatch.dbusMapping;
     try
     {
-        const auto& [dbusMapping, eventStateMap] = eventMap.at(entry);
-        utils::PropertyValue propValue{};
-        try
-        {
-            propValue = eventStateMap.at(state);
-        }
-        catch (const std::out_of_range& e)
+        auto method = newSetMethod(dispatch, value);
+        pldm::utils::DBusHandler::getBus().call_noreply(
+            method, pldm::utils::dbusTimeout);
+    }
+    catch (const std::exception& e)
+    {
+        dispatch.counters.failed++;
+        dispatch.service.clear();
+        error(
+            "Failed to set property '{PROPERTY}' on interface '{INTERFACE}' at path '{PATH}', error - {ERROR}",
+            "PROPERTY", dbusMapping.propertyName, "INTERFACE",
+            dbusMapping.interface, "PATH", dbusMapping.objectPath, "ERROR", e);
+        return PLDM_ERROR;
+    }
+
+    dispatch.counters.set++;
+    return PLDM_SUCCESS;
+}
+
+void StateSensorHandler::scheduleQueue()
+{
+    if (!event || queueEvent)
+    {
+        return;
+    }
+
+    queueEvent = std::make_unique<sdeventplus::source::Defer>(
+        *event, std::bind(std::mem_fn(&StateSensorHandler::processQueue), this,
+                          std::placeholders::_1));
+}
+
+void StateSensorHandler::processQueue(
+    sdeventplus::source::EventBase& /*source*/)
+{
+    queueEvent.reset();
+
+    auto pending = pendingQueue.size();
+    while (pending-- && inFlightCount < maxInFlight)
+    {
+        auto index = pendingQueue.front();
+        pendingQueue.pop_front();
+
+        auto& dispatch = dispatchTable[index];
+        if (dispatch.inFlight)
         {
-            error("Invalid event state '{EVENT_STATE}', error - {ERROR}",
-                  "EVENT_STATE", state, "ERROR", e);
-            return PLDM_ERROR_INVALID_DATA;
+            // Keep the sets of a property ordered, the value is picked up
+            // again once the outstanding set completes
+            pendingQueue.push_back(index);
+            continue;
         }
 
+        auto value = std::move(*dispatch.pendingValue);
+        dispatch.pendingValue.reset();
+
+        const auto& dbusMapping = dispatch.dbusMapping;
         try
         {
-            pldm::utils::DBusHandler().setDbusProperty(dbusMapping, propValue);
+            entryService(dispatch);
+            dispatch.inFlight = true;
+            inFlightCount++;
+            setPropertyAsync(index, value);
         }
         catch (const std::exception& e)
         {
+            if (dispatch.inFlight)
+            {
+                dispatch.inFlight = false;
+                inFlightCount--;
+            }
+            dispatch.counters.failed++;
+            dispatch.service.clear();
             error(
-                "Failed to  set property '{PROPERTY}' on interface '{INTERFACE}' at path '{PATH}', error - {ERROR}",
+                "Failed to set property '{PROPERTY}' on interface '{INTERFACE}' at path '{PATH}', error - {ERROR}",
                 "PROPERTY", dbusMapping.propertyName, "INTERFACE",
                 dbusMapping.interface, "PATH", dbusMapping.objectPath, "ERROR",
                 e);
-            return PLDM_ERROR;
         }
     }
-    catch (const std::out_of_range&)
+}
+
+void StateSensorHandler::setPropertyAsync(size_t index,
+                                          const utils::PropertyValue& value)
+{
+    auto& dispatch = dispatchTable[index];
+    auto& bus = pldm::utils::DBusHandler::getBus();
+    auto method = newSetMethod(dispatch, value);
+    dispatch.call = std::make_unique<sdbusplus::slot_t>(bus.call_async(
+        method,
+        [this, index](sdbusplus::message_t reply) {
+            setPropertyDone(index, !reply.is_method_error());
+        },
+        pldm::utils::dbusTimeout));
+}
+
+void StateSensorHandler::setPropertyDone(size_t index, bool success)
+{
+    auto& dispatch = dispatchTable[index];
+    if (!success)
     {
-        // There is no BMC action for this PLDM event
-        return PLDM_SUCCESS;
+        const auto& dbusMapping = dispatch.dbusMapping;
+        dispatch.counters.failed++;
+        dispatch.service.clear();
+        error(
+            "Failed to set property '{PROPERTY}' on interface '{INTERFACE}' at path '{PATH}'",
+            "PROPERTY", dbusMapping.propertyName, "INTERFACE",
+            dbusMapping.interface, "PATH", dbusMapping.objectPath);
+    }
+    else
+    {
+        dispatch.counters.set++;
+    }
+
+    inFlightCount--;
+    dispatch.inFlight = false;
+    dispatch.call.reset();
+    if (!pendingQueue.empty())
+    {
+        scheduleQueue();
     }
-    return PLDM_SUCCESS;
 }
 
 } // namespace pldm::responder::events
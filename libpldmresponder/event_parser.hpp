@@ -4,11 +4,18 @@
 #include "common/utils.hpp"
 
 #include <nlohmann/json.hpp>
+#include <sdbusplus/slot.hpp>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/event.hpp>
 
+#include <deque>
 #include <filesystem>
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 namespace pldm::responder::events
@@ -68,11 +75,59 @@ struct StateSensorEntry
     }
 };
 
+/** @struct StateSensorEntryHasher
+ *
+ *  Hash of a StateSensorEntry for the compiled dispatch table. Entries that
+ *  skip the container ID are kept in a separate table with the container ID
+ *  normalised to 0xFFFF, so all the fields can take part in the hash.
+ */
+struct StateSensorEntryHasher
+{
+    std::size_t operator()(const StateSensorEntry& e) const
+    {
+        uint64_t key = static_cast<uint64_t>(e.entityType) << 48 |
+                       static_cast<uint64_t>(e.entityInstance) << 32 |
+                       static_cast<uint64_t>(e.containerId) << 16 |
+                       e.stateSetid;
+        return std::hash<uint64_t>{}(key) ^ e.sensorOffset;
+    }
+};
+
 using StateToDBusValue = std::map<pdr::EventState, pldm::utils::PropertyValue>;
 using EventDBusInfo = std::tuple<pldm::utils::DBusMapping, StateToDBusValue>;
 using EventMap = std::map<StateSensorEntry, EventDBusInfo>;
 using Json = nlohmann::json;
 
+/** @struct EventCounters
+ *
+ *  Per entry statistics of the state sensor events handled by the BMC
+ */
+struct EventCounters
+{
+    uint64_t received = 0;  //!< events matching the entry
+    uint64_t set = 0;       //!< D-Bus property sets completed
+    uint64_t coalesced = 0; //!< events superseded before they were set
+    uint64_t dropped = 0;   //!< events with an unknown state
+    uint64_t failed = 0;    //!< D-Bus property sets that failed
+};
+
+/** @struct EventDispatchEntry
+ *
+ *  Compiled form of an event state sensor configuration entry. The D-Bus
+ *  service hosting the property is resolved on the first event and reused
+ *  for the following ones.
+ */
+struct EventDispatchEntry
+{
+    pldm::utils::DBusMapping dbusMapping;
+    StateToDBusValue eventStateMap;
+    std::string service; //!< cached D-Bus service, empty if unresolved
+    std::optional<pldm::utils::PropertyValue> pendingValue; //!< queued value
+    bool inFlight = false; //!< a Set call is outstanding
+    std::unique_ptr<sdbusplus::slot_t> call; //!< slot of the outstanding call
+    EventCounters counters;
+};
+
 /** @class StateSensorHandler
  *
  *  @brief Parses the event state sensor configuration JSON file and build
@@ -91,16 +146,30 @@ class StateSensorHandler
      *  @param[in] dirPath - directory path which has the config JSONs
      */
     explicit StateSensorHandler(const std::string& dirPath);
+
+    /** @brief Parse the event state sensor configuration JSON file, build the
+     *         lookup data structure and set the D-Bus properties
+     *         asynchronously from the event loop.
+     *
+     *  @param[in] dirPath - directory path which has the config JSONs
+     *  @param[in] event - reference of the main event loop
+     */
+    StateSensorHandler(const std::string& dirPath, sdeventplus::Event& event);
+
     virtual ~StateSensorHandler() = default;
-    StateSensorHandler(const StateSensorHandler&) = default;
-    StateSensorHandler& operator=(const StateSensorHandler&) = default;
-    StateSensorHandler(StateSensorHandler&&) = default;
-    StateSensorHandler& operator=(StateSensorHandler&&) = default;
+    StateSensorHandler(const StateSensorHandler&) = delete;
+    StateSensorHandler& operator=(const StateSensorHandler&) = delete;
+    StateSensorHandler(StateSensorHandler&&) = delete;
+    StateSensorHandler& operator=(StateSensorHandler&&) = delete;
 
     /** @brief If the StateSensorEntry and EventState is valid, the D-Bus
      *         property corresponding to the StateSensorEntry is set based on
      *         the EventState
      *
+     *  @details With an event loop the property set is queued and issued
+     *  asynchronously. A newer event for an entry replaces a value that is
+     *  still queued, so the queue never grows beyond the number of entries.
+     *
      *  @param[in] entry - state sensor entry
      *  @param[in] state - event state
      *
@@ -108,6 +177,19 @@ class StateSensorHandler
      */
     int eventAction(const StateSensorEntry& entry, pdr::EventState state);
 
+    /** @brief Get the event statistics of a StateSensorEntry
+     *
+     *  @param[in] entry - state sensor entry
+     *
+     *  @return event counters of the matching entry, std::nullopt if there is
+     *          no BMC action for the entry
+     */
+    std::optional<EventCounters> getEventCounters(
+        const StateSensorEntry& entry) const;
+
+    /** @brief Maximum number of asynchronous property sets outstanding */
+    static constexpr size_t maxInFlight = 16;
+
     /** @brief Helper API to get D-Bus information for a StateSensorEntry
      *
      *  @param[in] entry - state sensor entry
@@ -119,9 +201,115 @@ class StateSensorHandler
         return eventMap.at(entry);
     }
 
+  protected:
+    /** @brief Resolve the D-Bus service hosting a property
+     *
+     *  @param[in] dbusMapping - D-Bus mapping of the property
+     *
+     *  @return D-Bus service name
+     */
+    virtual std::string getService(
+        const pldm::utils::DBusMapping& dbusMapping) const;
+
+    /** @brief Send the asynchronous Set call of a dispatch entry, its
+     *         D-Bus service already resolved. setPropertyDone() is called
+     *         with the result.
+     *
+     *  @param[in] index - index in dispatchTable
+     *  @param[in] value - property value
+     */
+    virtual void setPropertyAsync(size_t index,
+                                  const pldm::utils::PropertyValue& value);
+
+    /** @brief Completion of an asynchronous property set
+     *
+     *  @param[in] index - index in dispatchTable
+     *  @param[in] success - whether the property is set
+     */
+    void setPropertyDone(size_t index, bool success);
+
   private:
+    /** @brief Parse the event state sensor configuration JSON files
+     *
+     *  @param[in] dirPath - directory path which has the config JSONs
+     */
+    void parseConfig(const std::string& dirPath);
+
+    /** @brief Find the compiled dispatch entry of a StateSensorEntry, an
+     *         entry with a matching container ID is preferred over one
+     *         configured without container ID
+     *
+     *  @param[in] entry - state sensor entry
+     *
+     *  @return index in dispatchTable, std::nullopt if not found
+     */
+    std::optional<size_t> findDispatchEntry(
+        const StateSensorEntry& entry) const;
+
+    /** @brief Get the D-Bus service of a dispatch entry, resolved if not
+     *         cached yet
+     *
+     *  @param[in] dispatch - dispatch entry
+     *
+     *  @return D-Bus service name
+     */
+    const std::string& entryService(EventDispatchEntry& dispatch);
+
+    /** @brief Build the D-Bus Set method call of a dispatch entry
+     *
+     *  @param[in] dispatch - dispatch entry
+     *  @param[in] value - property value
+     *
+     *  @return D-Bus method call message
+     */
+    sdbusplus::message_t newSetMethod(EventDispatchEntry& dispatch,
+                                      const pldm::utils::PropertyValue& value);
+
+    /** @brief Set the D-Bus property of a dispatch entry synchronously
+     *
+     *  @param[in] dispatch - dispatch entry
+     *  @param[in] value - property value
+     *
+     *  @return PLDM completion code
+     */
+    int setProperty(EventDispatchEntry& dispatch,
+                    const pldm::utils::PropertyValue& value);
+
+    /** @brief Issue the queued property sets, bounded by maxInFlight
+     *
+     *  @param[in] source - sdeventplus event source
+     */
+    void processQueue(sdeventplus::source::EventBase& source);
+
+    /** @brief Schedule processQueue() on the event loop */
+    void scheduleQueue();
+
     EventMap eventMap; //!< a map of StateSensorEntry to D-Bus information
 
+    /** @brief compiled entries, indexed by the two lookup tables below */
+    std::vector<EventDispatchEntry> dispatchTable;
+
+    /** @brief entries configured with a container ID */
+    std::unordered_map<StateSensorEntry, size_t, StateSensorEntryHasher>
+        exactEntries;
+
+    /** @brief entries configured without a container ID */
+    std::unordered_map<StateSensorEntry, size_t, StateSensorEntryHasher>
+        anyContainerEntries;
+
+    /** @brief main event loop, nullptr when properties are set synchronously
+     */
+    sdeventplus::Event* event = nullptr;
+
+    /** @brief dispatch entries with a property value waiting to be set */
+    std::deque<size_t> pendingQueue;
+
+    /** @brief number of asynchronous property sets outstanding */
+    size_t inFlightCount = 0;
+
+    /** @brief deferred event source draining pendingQueue */
+    std::unique_ptr<sdeventplus::source::Defer> queueEvent;
+
     /** @brief Create a map of EventState to D-Bus property values from
      *         the information provided in the event state configuration
      *         JSON
@@ -42,6 +42,23 @@ std::optional<pldm_entity> FruImpl::getEntityByObjectPath(
     return std::nullopt;
 }
 
+std::optional<pldm_entity> FruImpl::getEntityByObjectPath(
+    const dbus::ObjectPath& path, const dbus::InterfaceMap& intfMaps)
+{
+    auto it = objToEntity.find(path);
+    if (it != objToEntity.end())
+    {
+        return it->second;
+    }
+
+    auto entity = getEntityByObjectPath(intfMaps);
+    if (entity)
+    {
+        objToEntity.emplace(path, *entity);
+    }
+    return entity;
+}
+
 void FruImpl::updateAssociationTree(const dbus::ObjectValueTree& objects,
                                     const std::string& path)
 {
@@ -79,8 +96,7 @@ void FruImpl::updateAssociationTree(const dbus::ObjectValueTree& objects,
             {
                 pldm_entity node =
                     pldm_entity_extract(objToEntityNode.at(currPath));
-                if (pldm_entity_association_tree_find_with_locality(
-                        entityTree, &node, false))
+                if (entityTreeIndex.findWithLocality(&node, false))
                 {
                     break;
                 }
@@ -92,7 +108,8 @@ void FruImpl::updateAssociationTree(const dbus::ObjectValueTree& objects,
                     break;
                 }
 
-                auto entityPtr = getEntityByObjectPath(objects.at(currPath));
+                auto entityPtr =
+                    getEntityByObjectPath(currPath, objects.at(currPath));
                 if (!entityPtr)
                 {
                     break;
@@ -100,34 +117,29 @@ void FruImpl::updateAssociationTree(const dbus::ObjectValueTree& objects,
 
                 pldm_entity entity = *entityPtr;
 
-                for (const auto& it : objToEntityNode)
+                if (entityTypeToObjPath.contains(entity.entity_type))
                 {
-                    pldm_entity node = pldm_entity_extract(it.second);
-                    if (node.entity_type == entity.entity_type)
-                    {
-                        entity.entity_instance_num =
-                            node.entity_instance_num + 1;
-                        break;
-                    }
+                    pldm_entity node = pldm_entity_extract(objToEntityNode.at(
+                        entityTypeToObjPath.at(entity.entity_type)));
+                    entity.entity_instance_num = node.entity_instance_num + 1;
                 }
 
                 if (currPath == prePath)
                 {
-                    auto node = pldm_entity_association_tree_add_entity(
-                        entityTree, &entity, 0xFFFF, nullptr,
+                    auto node = entityTreeIndex.addEntity(
+                        &entity, 0xFFFF, nullptr,
                         PLDM_ENTITY_ASSOCIAION_PHYSICAL, false, true, 0xFFFF);
-                    objToEntityNode[currPath] = node;
+                    addObjectEntityNode(currPath, node);
                 }
                 else
                 {
                     if (objToEntityNode.contains(prePath))
                     {
-                        auto node = pldm_entity_association_tree_add_entity(
-                            entityTree, &entity, 0xFFFF,
-                            objToEntityNode[prePath],
+                        auto node = entityTreeIndex.addEntity(
+                            &entity, 0xFFFF, objToEntityNode[prePath],
                             PLDM_ENTITY_ASSOCIAION_PHYSICAL, false, true,
                             0xFFFF);
-                        objToEntityNode[currPath] = node;
+                        addObjectEntityNode(currPath, node);
                     }
                 }
             }
@@ -137,6 +149,29 @@ void FruImpl::updateAssociationTree(const dbus::ObjectValueTree& objects,
     }
 }
 
+void FruImpl::addObjectEntityNode(const dbus::ObjectPath& path,
+                                  pldm_entity_node* node)
+{
+    objToEntityNode[path] = node;
+    if (!node)
+    {
+        return;
+    }
+
+    // Keep the first object path of each entity type, which is the node the
+    // next instance number is derived from.
+    auto entityType = pldm_entity_extract(node).entity_type;
+    auto it = entityTypeToObjPath.find(entityType);
+    if (it == entityTypeToObjPath.end())
+    {
+        entityTypeToObjPath.emplace(entityType, path);
+    }
+    else if (path < it->second)
+    {
+        it->second = path;
+    }
+}
+
 void FruImpl::buildFRUTable()
 {
     if (isBuilt)
@@ -190,8 +225,8 @@ void FruImpl::buildFRUTable()
                         entity = pldm_entity_extract(node);
                     }
 
-                    auto recordInfos = parser.getRecordInfo(interface.first);
-                    populateRecords(interfaces, recordInfos, entity);
+                    addFruRecordSet(object.first.str, interfaces,
+                                    interface.first, entity);
 
                     associatedEntityMap.emplace(object.first, entity);
                     break;
@@ -220,8 +255,193 @@ void FruImpl::buildFRUTable()
     // save a copy of bmc's entity association tree
     pldm_entity_association_tree_copy_root(entityTree, bmcEntityTree);
 
+    subscribeInventoryChanges();
+
     isBuilt = true;
 }
+
+void FruImpl::addFruRecordSet(const dbus::ObjectPath& path,
+                              const dbus::InterfaceMap& interfaces,
+                              const dbus::Interface& itemInterface,
+                              const pldm_entity& entity)
+{
+    auto recordInfos = parser.getRecordInfo(itemInterface);
+
+    objects.try_emplace(sdbusplus::message::object_path(path), interfaces);
+    auto& recordSet = fruRecordSets[path];
+    recordSet.entity = entity;
+    recordSet.itemInterface = itemInterface;
+    populateRecords(interfaces, recordInfos, recordSet);
+}
+
+void FruImpl::interfacesAdded(const dbus::ObjectPath& path,
+                              const dbus::InterfaceMap& interfaces)
+{
+    auto recordSet = fruRecordSets.find(path);
+    if (recordSet == fruRecordSets.end())
+    {
+        // A FRU showing up after the FRU table is built needs the entity
+        // association PDRs to be regenerated, it is not added here.
+        return;
+    }
+
+    objToEntity.erase(path);
+    auto& object = objects[sdbusplus::message::object_path(path)];
+    for (const auto& [interface, properties] : interfaces)
+    {
+        auto& objectProperties = object[interface];
+        for (const auto& [property, value] : properties)
+        {
+            objectProperties[property] = value;
+        }
+    }
+    refreshRecords(recordSet->second, object);
+}
+
+void FruImpl::interfacesRemoved(const dbus::ObjectPath& path,
+                                const std::vector<dbus::Interface>& interfaces)
+{
+    auto recordSet = fruRecordSets.find(path);
+    if (recordSet == fruRecordSets.end())
+    {
+        return;
+    }
+
+    objToEntity.erase(path);
+    auto& object = objects[sdbusplus::message::object_path(path)];
+    for (const auto& interface : interfaces)
+    {
+        object.erase(interface);
+    }
+    refreshRecords(recordSet->second, object);
+}
+
+void FruImpl::refreshRecords(FruRecordSet& recordSet,
+                             const dbus::InterfaceMap& interfaces)
+{
+    static constexpr auto presentInterface =
+        "xyz.openbmc_project.Inventory.Item";
+    static constexpr auto presentProperty = "Present";
+
+    bool isPresent = interfaces.contains(recordSet.itemInterface);
+    auto item = interfaces.find(presentInterface);
+    if (isPresent && item != interfaces.end())
+    {
+        auto present = item->second.find(presentProperty);
+        if (present != item->second.end() &&
+            std::holds_alternative<bool>(present->second))
+        {
+            isPresent = std::get<bool>(present->second);
+        }
+    }
+
+    if (!isPresent)
+    {
+        // The record set identifier is kept for the FRU to get its records
+        // back, the FRU record set PDR is removed until then
+        if (recordSet.hasPdr)
+        {
+            uint32_t recordHandle = 0;
+            int rc = pldm_pdr_remove_fru_record_set_by_rsi(
+                pdrRepo, recordSet.rsi, false, &recordHandle);
+            if (rc)
+            {
+                error(
+                    "Failed to remove the FRU record set PDR of the item '{INTERFACE}', response code '{RC}'",
+                    "INTERFACE", recordSet.itemInterface, "RC", rc);
+            }
+            else
+            {
+                recordSet.hasPdr = false;
+            }
+        }
+        numRecs -= recordSet.numRecords;
+        recordSet.numRecords = 0;
+        recordSet.records.clear();
+        tableDirty = true;
+        return;
+    }
+
+    try
+    {
+        populateRecords(interfaces,
+                        parser.getRecordInfo(recordSet.itemInterface),
+                        recordSet);
+    }
+    catch (const std::exception& e)
+    {
+        error(
+            "Failed to refresh the FRU records of the item '{INTERFACE}', error - {ERROR}",
+            "INTERFACE", recordSet.itemInterface, "ERROR", e);
+    }
+}
+
+void FruImpl::subscribeInventoryChanges()
+{
+    namespace rules = sdbusplus::bus::match::rules;
+    static constexpr auto inventoryPath = "/xyz/openbmc_project/inventory";
+    auto& bus = pldm::utils::DBusHandler::getBus();
+
+    inventoryMatches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        bus, rules::interfacesAdded(inventoryPath),
+        [this](sdbusplus::message_t& msg) {
+            sdbusplus::message::object_path path;
+            dbus::InterfaceMap interfaces;
+            try
+            {
+                msg.read(path, interfaces);
+            }
+            catch (const std::exception& e)
+            {
+                error(
+                    "Failed to read the inventory InterfacesAdded signal, error - {ERROR}",
+                    "ERROR", e);
+                return;
+            }
+            this->interfacesAdded(path.str, interfaces);
+        }));
+
+    inventoryMatches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        bus, rules::interfacesRemoved(inventoryPath),
+        [this](sdbusplus::message_t& msg) {
+            sdbusplus::message::object_path path;
+            std::vector<dbus::Interface> interfaces;
+            try
+            {
+                msg.read(path, interfaces);
+            }
+            catch (const std::exception& e)
+            {
+                error(
+                    "Failed to read the inventory InterfacesRemoved signal, error - {ERROR}",
+                    "ERROR", e);
+                return;
+            }
+            this->interfacesRemoved(path.str, interfaces);
+        }));
+
+    inventoryMatches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        bus,
+        rules::type::signal() + rules::member("PropertiesChanged") +
+            rules::interface(pldm::utils::dbusProperties) +
+            rules::path_namespace(inventoryPath),
+        [this](sdbusplus::message_t& msg) {
+            dbus::Interface interface;
+            dbus::PropertyMap properties;
+            try
+            {
+                msg.read(interface, properties);
+            }
+            catch (const std::exception& e)
+            {
+                error(
+                    "Failed to read the inventory PropertiesChanged signal, error - {ERROR}",
+                    "ERROR", e);
+                return;
+            }
+            this->interfacesAdded(msg.get_path(), {{interface, properties}});
+        }));
+}
 std::string FruImpl::populatefwVersion()
 {
     static constexpr auto fwFunctionalObjPath =
@@ -253,13 +473,11 @@ std::string FruImpl::populatefwVersion()
 }
 void FruImpl::populateRecords(
     const pldm::responder::dbus::InterfaceMap& interfaces,
-    const fru_parser::FruRecordInfos& recordInfos, const pldm_entity& entity)
+    const fru_parser::FruRecordInfos& recordInfos, FruRecordSet& recordSet)
 {
-    // recordSetIdentifier for the FRU will be set when the first record gets
-    // added for the FRU
-    uint16_t recordSetIdentifier = 0;
-    auto numRecsCount = numRecs;
-    static uint32_t bmc_record_handle = 0;
+    const auto& entity = recordSet.entity;
+    std::vector<uint8_t> records;
+    uint16_t numRecords = 0;
 
     for (const auto& [recType, encType, fieldInfos] : recordInfos)
     {
@@ -318,71 +536,87 @@ void FruImpl::populateRecords(
 
         if (tlvs.size())
         {
-            if (numRecs == numRecsCount)
+            // recordSetIdentifier for the FRU is set when the first record
+            // gets added for the FRU
+            if (!recordSet.rsi)
+            {
+                recordSet.rsi = nextRSI();
+                recordSet.pdrRecordHandle = nextRecordHandle();
+            }
+            if (!recordSet.hasPdr)
             {
-                recordSetIdentifier = nextRSI();
-                bmc_record_handle = nextRecordHandle();
                 int rc = pldm_pdr_add_fru_record_set(
-                    pdrRepo, TERMINUS_HANDLE, recordSetIdentifier,
+                    pdrRepo, TERMINUS_HANDLE, recordSet.rsi,
                     entity.entity_type, entity.entity_instance_num,
-                    entity.entity_container_id, &bmc_record_handle);
+                    entity.entity_container_id, &recordSet.pdrRecordHandle);
                 if (rc)
                 {
                     // pldm_pdr_add_fru_record_set() assert()ed on failure
                     throw std::runtime_error(
                         "Failed to add PDR FRU record set");
                 }
+                recordSet.hasPdr = true;
             }
-            auto curSize = table.size();
-            table.resize(curSize + recHeaderSize + tlvs.size());
-            encode_fru_record(table.data(), table.size(), &curSize,
-                              recordSetIdentifier, recType, numFRUFields,
-                              encType, tlvs.data(), tlvs.size());
-            numRecs++;
+            auto curSize = records.size();
+            records.resize(curSize + recHeaderSize + tlvs.size());
+            encode_fru_record(records.data(), records.size(), &curSize,
+                              recordSet.rsi, recType, numFRUFields, encType,
+                              tlvs.data(), tlvs.size());
+            numRecords++;
         }
     }
+
+    numRecs = numRecs - recordSet.numRecords + numRecords;
+    recordSet.numRecords = numRecords;
+    recordSet.records = std::move(records);
+    tableDirty = true;
 }
 
-std::vector<uint8_t> FruImpl::tableResize()
+void FruImpl::refreshTable()
 {
-    std::vector<uint8_t> tempTable;
-
-    if (table.size())
+    if (!tableDirty)
     {
-        std::copy(table.begin(), table.end(), std::back_inserter(tempTable));
-        padBytes = pldm::utils::getNumPadBytes(table.size());
-        tempTable.resize(tempTable.size() + padBytes, 0);
+        return;
     }
-    return tempTable;
-}
 
-void FruImpl::getFRUTable(Response& response)
-{
-    auto hdrSize = response.size();
-    std::vector<uint8_t> tempTable;
-
-    if (table.size())
+    // A new buffer is built, transfers in progress keep the previous one
+    auto newTable = std::make_shared<std::vector<uint8_t>>();
+    for (const auto& [path, recordSet] : fruRecordSets)
     {
-        tempTable = tableResize();
-        checksum = pldm_edac_crc32(tempTable.data(), tempTable.size());
+        newTable->insert(newTable->end(), recordSet.records.begin(),
+                         recordSet.records.end());
     }
-    response.resize(hdrSize + tempTable.size() + sizeof(checksum), 0);
-    std::copy(tempTable.begin(), tempTable.end(), response.begin() + hdrSize);
 
-    // Copy the checksum to response data
-    auto iter = response.begin() + hdrSize + tempTable.size();
+    padBytes = 0;
+    checksum = 0;
+    if (newTable->size())
+    {
+        padBytes = pldm::utils::getNumPadBytes(newTable->size());
+        newTable->resize(newTable->size() + padBytes, 0);
+        checksum = pldm_edac_crc32(newTable->data(), newTable->size());
+    }
     std::copy_n(reinterpret_cast<const uint8_t*>(&checksum), sizeof(checksum),
-                iter);
+                std::back_inserter(*newTable));
+
+    table = std::move(newTable);
+    tableDirty = false;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> FruImpl::getTable()
+{
+    refreshTable();
+    return table;
+}
+
+void FruImpl::getFRUTable(Response& response)
+{
+    refreshTable();
+    response.insert(response.end(), table->begin(), table->end());
 }
 
 void FruImpl::getFRURecordTableMetadata()
 {
-    std::vector<uint8_t> tempTable;
-    if (table.size())
-    {
-        tempTable = tableResize();
-        checksum = pldm_edac_crc32(tempTable.data(), tempTable.size());
-    }
+    refreshTable();
 }
 
 int FruImpl::getFRURecordByOption(
@@ -393,18 +627,19 @@ int FruImpl::getFRURecordByOption(
 
     // FRU table is built lazily, build if not done.
     buildFRUTable();
+    refreshTable();
 
     /* 7 is sizeof(checksum,4) + padBytesMax(3)
      * We can not know size of the record table got by options in advance, but
      * it must be less than the source table. So it's safe to use sizeof the
      * source table + 7 as the buffer length
      */
-    size_t recordTableSize = table.size() - padBytes + 7;
+    size_t recordTableSize = size() + 7;
     fruData.resize(recordTableSize, 0);
 
-    int rc = get_fru_record_by_option(
-        table.data(), table.size() - padBytes, fruData.data(), &recordTableSize,
-        recordSetIdentifer, recordType, fieldType);
+    int rc = get_fru_record_by_option(table->data(), size(), fruData.data(),
+                                      &recordTableSize, recordSetIdentifer,
+                                      recordType, fieldType);
 
     if (rc != PLDM_SUCCESS || recordTableSize == 0)
     {
@@ -471,9 +706,12 @@ Response Handler::getFRURecordTableMetadata(const pldm_msg* request,
     return response;
 }
 
-Response Handler::getFRURecordTable(const pldm_msg* request,
+Response Handler::getFRURecordTable(pldm_tid_t tid, const pldm_msg* request,
                                     size_t payloadLength)
 {
+    // There is a single FRU table
+    constexpr uint8_t tableType = 0;
+
     // FRU table is built lazily, build if not done.
     buildFRUTable();
 
@@ -482,19 +720,48 @@ Response Handler::getFRURecordTable(const pldm_msg* request,
         return ccOnlyResponse(request, PLDM_ERROR_INVALID_LENGTH);
     }
 
-    Response response(
-        sizeof(pldm_msg_hdr) + PLDM_GET_FRU_RECORD_TABLE_MIN_RESP_BYTES, 0);
+    uint32_t dataTransferHandle{};
+    uint8_t transferOpFlag{};
+    auto rc = decode_get_fru_record_table_req(
+        request, payloadLength, &dataTransferHandle, &transferOpFlag);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+
+    TableTransfer::Part part{};
+    if (transferOpFlag == PLDM_GET_FIRSTPART)
+    {
+        part = tableTransfer.getFirstPart(tid, tableType, impl.getTable());
+    }
+    else if (transferOpFlag == PLDM_GET_NEXTPART)
+    {
+        rc = tableTransfer.getNextPart(tid, tableType, dataTransferHandle,
+                                       part);
+        if (rc != PLDM_SUCCESS)
+        {
+            return ccOnlyResponse(request, rc);
+        }
+    }
+    else
+    {
+        return ccOnlyResponse(request,
+                              TableTransfer::invalidTransferOperationFlag);
+    }
+
+    constexpr auto hdrSize =
+        sizeof(pldm_msg_hdr) + PLDM_GET_FRU_RECORD_TABLE_MIN_RESP_BYTES;
+    Response response(hdrSize + part.data.size(), 0);
     auto responsePtr = new (response.data()) pldm_msg;
 
-    auto rc =
-        encode_get_fru_record_table_resp(request->hdr.instance_id, PLDM_SUCCESS,
-                                         0, PLDM_START_AND_END, responsePtr);
+    rc = encode_get_fru_record_table_resp(
+        request->hdr.instance_id, PLDM_SUCCESS, part.nextDataTransferHandle,
+        part.transferFlag, responsePtr);
     if (rc != PLDM_SUCCESS)
     {
         return ccOnlyResponse(request, rc);
     }
-
-    impl.getFRUTable(response);
+    std::ranges::copy(part.data, response.begin() + hdrSize);
 
     return response;
 }
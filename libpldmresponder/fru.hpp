@@ -1,17 +1,22 @@
 #pragma once
 
+#include "common/entity_tree_index.hpp"
 #include "fru_parser.hpp"
 #include "libpldmresponder/pdr_utils.hpp"
 #include "oem_handler.hpp"
 #include "pldmd/handler.hpp"
+#include "table_transfer.hpp"
 
 #include <libpldm/fru.h>
 #include <libpldm/pdr.h>
 
+#include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message.hpp>
 
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -61,24 +66,27 @@ class FruImpl
      *  @param[in] entityTree - opaque pointer to the entity association tree
      *  @param[in] bmcEntityTree - opaque pointer to bmc's entity association
      *                             tree
+     *  @param[in] entityTreeIndex - index over the nodes of entityTree
      *  @param[in] oemFruHandler - OEM fru handler
      */
     FruImpl(const std::string& configPath,
             const std::filesystem::path& fruMasterJsonPath, pldm_pdr* pdrRepo,
             pldm_entity_association_tree* entityTree,
-            pldm_entity_association_tree* bmcEntityTree) :
+            pldm_entity_association_tree* bmcEntityTree,
+            pldm::utils::EntityTreeIndex& entityTreeIndex) :
         parser(configPath, fruMasterJsonPath), pdrRepo(pdrRepo),
-        entityTree(entityTree), bmcEntityTree(bmcEntityTree)
+        entityTree(entityTree), bmcEntityTree(bmcEntityTree),
+        entityTreeIndex(entityTreeIndex)
     {}
 
-    /** @brief Total length of the FRU table in bytes, this includes the pad
-     *         bytes and the checksum.
+    /** @brief Total length of the FRU records in the FRU table in bytes,
+     *         this excludes the pad bytes and the checksum.
      *
      *  @return size of the FRU table
      */
     uint32_t size() const
     {
-        return table.size();
+        return table->size() - padBytes - sizeof(checksum);
     }
 
     /** @brief The checksum of the contents of the FRU table
@@ -114,7 +122,16 @@ class FruImpl
      */
     void getFRUTable(Response& response);
 
-    /** @brief Get the Fru Table MetaData
+    /** @brief Get the FRU table as sent by GetFRURecordTable, the FRU records
+     *         followed by the pad bytes and the checksum. The buffer is never
+     *         modified, a change to the FRU records creates a new one.
+     *
+     *  @return the FRU table
+     */
+    std::shared_ptr<const std::vector<uint8_t>> getTable();
+
+    /** @brief Get the Fru Table MetaData, brings the padded table, size and
+     *         checksum up to date with the FRU records
      *
      */
     void getFRURecordTableMetadata();
@@ -159,6 +176,18 @@ class FruImpl
     std::optional<pldm_entity> getEntityByObjectPath(
         const dbus::InterfaceMap& intfMaps);
 
+    /** @brief Get pldm entity by the object path, from the object path to
+     *         entity map when the object was already resolved
+     *
+     *  @param[in] path - object path of the FRU
+     *  @param[in] intfMaps - D-Bus interfaces and the associated property
+     *                        values for the FRU
+     *
+     *  @return pldm_entity
+     */
+    std::optional<pldm_entity> getEntityByObjectPath(
+        const dbus::ObjectPath& path, const dbus::InterfaceMap& intfMaps);
+
     /** @brief Update pldm entity to association tree
      *
      *  @param[in] objects - std::map The object value tree
@@ -185,11 +214,41 @@ class FruImpl
      */
     std::string populatefwVersion();
 
-    /* @brief Method to resize the table
+    /** @brief Build the FRU records of a FRU instance and add them to the
+     *         FRU table. The records are rebuilt when the inventory object
+     *         of the FRU changes.
+     *
+     *  @param[in] path - inventory object path of the FRU
+     *  @param[in] interfaces - D-Bus interfaces and the associated property
+     *                          values for the FRU
+     *  @param[in] itemInterface - item interface the FRU records are built for
+     *  @param[in] entity - PLDM entity corresponding to FRU instance
+     *
+     *  @throw std::exception if there is no FRU record config for the item
+     *         interface
+     */
+    void addFruRecordSet(const dbus::ObjectPath& path,
+                         const dbus::InterfaceMap& interfaces,
+                         const dbus::Interface& itemInterface,
+                         const pldm_entity& entity);
+
+    /** @brief Update the FRU records of a FRU for interfaces added to or
+     *         properties changed on its inventory object
+     *
+     *  @param[in] path - inventory object path
+     *  @param[in] interfaces - added interfaces or changed properties
+     */
+    void interfacesAdded(const dbus::ObjectPath& path,
+                         const dbus::InterfaceMap& interfaces);
+
+    /** @brief Update the FRU records of a FRU for interfaces removed from its
+     *         inventory object
      *
-     * @return resized table
+     *  @param[in] path - inventory object path
+     *  @param[in] interfaces - removed interfaces
      */
-    std::vector<uint8_t> tableResize();
+    void interfacesRemoved(const dbus::ObjectPath& path,
+                           const std::vector<dbus::Interface>& interfaces);
 
     /* @brief set FRU Record Table
      *
@@ -219,34 +278,104 @@ class FruImpl
         return ++rh;
     }
 
+    /** @brief FRU records of a FRU instance */
+    struct FruRecordSet
+    {
+        pldm_entity entity;
+        dbus::Interface itemInterface;
+        /** @brief FRU record set identifier, 0 until the FRU has a record */
+        uint16_t rsi;
+        /** @brief Record handle of the FRU record set PDR, kept for the PDR
+         *         to be added back when the FRU is present again
+         */
+        uint32_t pdrRecordHandle;
+        /** @brief Whether the FRU record set PDR is in the PDR repo */
+        bool hasPdr;
+        uint16_t numRecords;
+        /** @brief Encoded FRU records */
+        std::vector<uint8_t> records;
+    };
+
+    /** @brief Rebuild the padded table and its checksum from the FRU records
+     *         if they changed since the last rebuild
+     */
+    void refreshTable();
+
+    /** @brief Rebuild the FRU records of the FRU at an inventory path from the
+     *         cached inventory object
+     *
+     *  @param[in] recordSet - FRU records of the FRU
+     *  @param[in] interfaces - D-Bus interfaces of the inventory object
+     */
+    void refreshRecords(FruRecordSet& recordSet,
+                        const dbus::InterfaceMap& interfaces);
+
+    /** @brief Watch the inventory to keep the FRU records up to date */
+    void subscribeInventoryChanges();
+
     uint32_t rh = 0;
     uint16_t rsi = 0;
     uint16_t numRecs = 0;
     uint8_t padBytes = 0;
-    std::vector<uint8_t> table;
+    /** @brief FRU records of all the FRUs followed by the pad bytes and the
+     *         checksum
+     */
+    std::shared_ptr<std::vector<uint8_t>> table =
+        std::make_shared<std::vector<uint8_t>>(sizeof(uint32_t), 0);
     uint32_t checksum = 0;
+    /** @brief Whether the FRU records changed since the table was built */
+    bool tableDirty = false;
     bool isBuilt = false;
 
+    /** @brief FRU records per inventory object path, in FRU table order */
+    std::map<dbus::ObjectPath, FruRecordSet> fruRecordSets;
+
+    /** @brief D-Bus matches for the inventory changes */
+    std::vector<std::unique_ptr<sdbusplus::bus::match_t>> inventoryMatches;
+
     fru_parser::FruParser parser;
     pldm_pdr* pdrRepo;
     pldm_entity_association_tree* entityTree;
     pldm_entity_association_tree* bmcEntityTree;
+    pldm::utils::EntityTreeIndex& entityTreeIndex;
     pldm::responder::oem_fru::Handler* oemFruHandler = nullptr;
     dbus::ObjectValueTree objects;
 
     std::map<dbus::ObjectPath, pldm_entity_node*> objToEntityNode{};
 
+    /** @brief maps an object path to the entity its interfaces resolve to,
+     *         dropped when the interfaces of the object change
+     */
+    std::unordered_map<dbus::ObjectPath, pldm_entity> objToEntity{};
+
+    /** @brief maps an entity type to the first object path (in objToEntityNode
+     *         order) of that type, used to number new entity instances
+     *         without scanning objToEntityNode
+     */
+    std::map<pldm::responder::dbus::EntityType, dbus::ObjectPath>
+        entityTypeToObjPath{};
+
+    /** @brief Record the entity node added for an object path
+     *
+     *  @param[in] path - object path
+     *  @param[in] node - entity node of the object path
+     */
+    void addObjectEntityNode(const dbus::ObjectPath& path,
+                             pldm_entity_node* node);
+
     /** @brief populateRecord builds the FRU records for an instance of FRU and
-     *         updates the FRU table with the FRU records.
+     *         replaces the previous FRU records of the instance. The FRU
+     *         record set PDR is added when the FRU gets its first record,
+     *         and added back when a FRU which was not present gets records.
      *
      *  @param[in] interfaces - D-Bus interfaces and the associated property
      *                          values for the FRU
      *  @param[in] recordInfos - FRU record info to build the FRU records
-     *  @param[in/out] entity - PLDM entity corresponding to FRU instance
+     *  @param[in/out] recordSet - FRU records of the FRU instance
      */
     void populateRecords(const dbus::InterfaceMap& interfaces,
                          const fru_parser::FruRecordInfos& recordInfos,
-                         const pldm_entity& entity);
+                         FruRecordSet& recordSet);
 
     /** @brief Associate sensor/effecter to FRU entity
      */
@@ -262,8 +391,10 @@ class Handler : public CmdHandler
     Handler(const std::string& configPath,
             const std::filesystem::path& fruMasterJsonPath, pldm_pdr* pdrRepo,
             pldm_entity_association_tree* entityTree,
-            pldm_entity_association_tree* bmcEntityTree) :
-        impl(configPath, fruMasterJsonPath, pdrRepo, entityTree, bmcEntityTree)
+            pldm_entity_association_tree* bmcEntityTree,
+            pldm::utils::EntityTreeIndex& entityTreeIndex) :
+        impl(configPath, fruMasterJsonPath, pdrRepo, entityTree, bmcEntityTree,
+             entityTreeIndex)
     {
         handlers.emplace(
             PLDM_GET_FRU_RECORD_TABLE_METADATA,
@@ -272,8 +403,9 @@ class Handler : public CmdHandler
             });
         handlers.emplace(
             PLDM_GET_FRU_RECORD_TABLE,
-            [this](pldm_tid_t, const pldm_msg* request, size_t payloadLength) {
-                return this->getFRURecordTable(request, payloadLength);
+            [this](pldm_tid_t tid, const pldm_msg* request,
+                   size_t payloadLength) {
+                return this->getFRURecordTable(tid, request, payloadLength);
             });
         handlers.emplace(
             PLDM_GET_FRU_RECORD_BY_OPTION,
@@ -297,14 +429,17 @@ class Handler : public CmdHandler
     Response getFRURecordTableMetadata(const pldm_msg* request,
                                        size_t payloadLength);
 
-    /** @brief Handler for GetFRURecordTable
+    /** @brief Handler for GetFRURecordTable, the table is sent in parts of
+     *         at most TABLE_TRANSFER_CHUNK_SIZE bytes
      *
+     *  @param[in] tid - TID of the requester
      *  @param[in] request - Request message payload
      *  @param[in] payloadLength - Request payload length
      *
      *  @return PLDM response message
      */
-    Response getFRURecordTable(const pldm_msg* request, size_t payloadLength);
+    Response getFRURecordTable(pldm_tid_t tid, const pldm_msg* request,
+                               size_t payloadLength);
 
     /** @brief Build FRU table is bnot already built
      *
@@ -358,6 +493,11 @@ class Handler : public CmdHandler
 
   private:
     FruImpl impl;
+
+    /** @brief Multipart transfers of the FRU table */
+    TableTransfer tableTransfer{
+        TABLE_TRANSFER_CHUNK_SIZE,
+        std::chrono::seconds(TABLE_TRANSFER_TIMEOUT_SECONDS)};
 };
 
 } // namespace fru
@@ -200,6 +200,7 @@ Response Handler::getPDR(const pldm_msg* request, size_t payloadLength)
             oemPlatformHandler->buildOEMPDR(pdrRepo);
         }
         generate(*dBusIntf, pdrJsonsDir, pdrRepo);
+        invalidateStatePdrIndex();
 
         pdrCreated = true;
 
@@ -609,6 +610,10 @@ int Handler::pldmPDRRepositoryChgEvent(
                 {
                     pldm_pdr_remove_pdrs_by_terminus_handle(pdrRepo.getPdr(),
                                                             it->first);
+                    if (statePdrIndex)
+                    {
+                        statePdrIndex->removeByTerminusHandle(it->first);
+                    }
                     hostPDRHandler->tlPDRInfo.erase(it++);
                 }
                 else
@@ -57,9 +57,10 @@ class Handler : public CmdHandler
             pldm::responder::platform_config::Handler* platformConfigHandler,
             pldm::requester::Handler<pldm::requester::Request>* handler,
             sdeventplus::Event& event, bool buildPDRLazily = false,
-            const std::optional<EventMap>& addOnHandlersMap = std::nullopt) :
+            const std::optional<EventMap>& addOnHandlersMap = std::nullopt,
+            pldm::utils::StatePdrIndex* statePdrIndex = nullptr) :
         eid(eid), instanceIdDb(instanceIdDb), pdrRepo(repo),
-        hostPDRHandler(hostPDRHandler),
+        statePdrIndex(statePdrIndex), hostPDRHandler(hostPDRHandler),
         dbusToPLDMEventHandler(dbusToPLDMEventHandler), fruHandler(fruHandler),
         dBusIntf(dBusIntf), platformConfigHandler(platformConfigHandler),
         handler(handler), event(event), pdrJsonDir(pdrJsonDir),
@@ -69,6 +70,7 @@ class Handler : public CmdHandler
         {
             generateTerminusLocatorPDR(pdrRepo);
             generate(*dBusIntf, pdrJsonsDir, pdrRepo);
+            invalidateStatePdrIndex();
             pdrCreated = true;
         }
 
@@ -513,9 +515,21 @@ class Handler : public CmdHandler
     void setEventReceiver();
 
   private:
+    /** @brief Rebuild the state PDR index from the repo on its next lookup,
+     *         called once the PDRs of the BMC are generated
+     */
+    inline void invalidateStatePdrIndex()
+    {
+        if (statePdrIndex)
+        {
+            statePdrIndex->invalidate();
+        }
+    }
+
     uint8_t eid;
     InstanceIdDb* instanceIdDb;
     pdr_utils::Repo pdrRepo;
+    pldm::utils::StatePdrIndex* statePdrIndex;
     uint16_t nextEffecterId{};
     uint16_t nextSensorId{};
     DbusObjMaps effecterDbusObjMaps{};
@@ -0,0 +1,103 @@
+#include "table_transfer.hpp"
+
+#include <algorithm>
+
+namespace pldm
+{
+
+namespace responder
+{
+
+TableTransfer::Part TableTransfer::getFirstPart(pldm_tid_t tid,
+                                                uint8_t tableType, Table table)
+{
+    auto now = Clock::now();
+    dropExpired(now);
+
+    auto transfer = transfers
+                        .insert_or_assign(makeKey(tid, tableType),
+                                          Transfer{std::move(table), 0, now})
+                        .first;
+    return makePart(transfer, 0);
+}
+
+int TableTransfer::getNextPart(pldm_tid_t tid, uint8_t tableType,
+                               uint32_t dataTransferHandle, Part& part)
+{
+    auto now = Clock::now();
+    dropExpired(now);
+
+    auto transfer = transfers.find(makeKey(tid, tableType));
+    if (transfer == transfers.end())
+    {
+        return invalidDataTransferHandle;
+    }
+
+    // The next part, or the last part sent again if its response was lost
+    auto offset = transfer->second.offset;
+    auto length = chunkSize ? chunkSize : transfer->second.table->size();
+    if (dataTransferHandle != offset + length &&
+        dataTransferHandle != offset)
+    {
+        return invalidDataTransferHandle;
+    }
+
+    transfer->second.lastAccess = now;
+    part = makePart(transfer, dataTransferHandle);
+    return PLDM_SUCCESS;
+}
+
+void TableTransfer::dropExpired(Clock::time_point now)
+{
+    std::erase_if(transfers, [this, now](const auto& transfer) {
+        return now - transfer.second.lastAccess > timeout;
+    });
+}
+
+TableTransfer::Part TableTransfer::makePart(
+    std::map<Key, Transfer>::iterator transfer, uint32_t offset)
+{
+    Part part{};
+    part.table = transfer->second.table;
+    const auto& table = *part.table;
+    auto length = table.size() - offset;
+    if (chunkSize)
+    {
+        length = std::min(length, chunkSize);
+    }
+
+    part.data = std::span(table).subspan(offset, length);
+    bool start = offset == 0;
+    bool end = offset + length == table.size();
+    if (start && end)
+    {
+        part.transferFlag = PLDM_START_AND_END;
+    }
+    else if (start)
+    {
+        part.transferFlag = PLDM_START;
+    }
+    else if (end)
+    {
+        part.transferFlag = PLDM_END;
+    }
+    else
+    {
+        part.transferFlag = PLDM_MIDDLE;
+    }
+
+    if (end)
+    {
+        part.nextDataTransferHandle = 0;
+        transfers.erase(transfer);
+        return part;
+    }
+
+    part.nextDataTransferHandle = offset + length;
+    transfer->second.offset = offset;
+    return part;
+}
+
+} // namespace responder
+
+} // namespace pldm
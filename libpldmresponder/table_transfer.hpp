@@ -0,0 +1,133 @@
+#pragma once
+
+#include <libpldm/base.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace pldm
+{
+
+namespace responder
+{
+
+/** @class TableTransfer
+ *
+ *  @brief Serves a table to its requesters in parts, as done by
+ *         GetFRURecordTable and GetBIOSTable.
+ *
+ *  A requester starts a transfer with GetFirstPart, the table is then held
+ *  for the requester until the last part is sent or the requester stops
+ *  asking for parts for longer than the timeout. Parts are spans into the
+ *  table so the table is neither copied nor reloaded for each part. The data
+ *  transfer handle of a part is its offset in the table.
+ */
+class TableTransfer
+{
+  public:
+    using Table = std::shared_ptr<const std::vector<uint8_t>>;
+
+    /** @brief Completion codes common to GetFRURecordTable (DSP0257) and
+     *         GetBIOSTable (DSP0247)
+     */
+    static constexpr uint8_t invalidDataTransferHandle = 0x80;
+    static constexpr uint8_t invalidTransferOperationFlag = 0x81;
+
+    /** @brief A part of a table */
+    struct Part
+    {
+        /** @brief The table, keeps data valid after the transfer is done */
+        Table table;
+        std::span<const uint8_t> data;
+        uint32_t nextDataTransferHandle;
+        uint8_t transferFlag;
+    };
+
+    TableTransfer() = delete;
+    TableTransfer(const TableTransfer&) = delete;
+    TableTransfer(TableTransfer&&) = delete;
+    TableTransfer& operator=(const TableTransfer&) = delete;
+    TableTransfer& operator=(TableTransfer&&) = delete;
+    ~TableTransfer() = default;
+
+    /** @brief Constructor
+     *
+     *  @param[in] chunkSize - maximum number of table bytes in a part, 0 to
+     *                         send the tables in one part
+     *  @param[in] timeout - time a requester has to ask for the next part
+     */
+    TableTransfer(size_t chunkSize, std::chrono::milliseconds timeout) :
+        chunkSize(chunkSize), timeout(timeout)
+    {}
+
+    /** @brief Start the transfer of a table to a requester, a transfer of the
+     *         requester in progress for the same table type is dropped
+     *
+     *  @param[in] tid - TID of the requester
+     *  @param[in] tableType - type of the table
+     *  @param[in] table - table data
+     *
+     *  @return the first part of the table
+     */
+    Part getFirstPart(pldm_tid_t tid, uint8_t tableType, Table table);
+
+    /** @brief Get the next part of the table transferred to a requester
+     *
+     *  @param[in] tid - TID of the requester
+     *  @param[in] tableType - type of the table
+     *  @param[in] dataTransferHandle - handle returned with the previous part,
+     *                                  or the handle of the previous part to
+     *                                  get it again
+     *  @param[out] part - the requested part
+     *
+     *  @return PLDM_SUCCESS or invalidDataTransferHandle
+     */
+    int getNextPart(pldm_tid_t tid, uint8_t tableType,
+                    uint32_t dataTransferHandle, Part& part);
+
+    /** @brief Number of transfers in progress */
+    size_t size() const
+    {
+        return transfers.size();
+    }
+
+  private:
+    using Key = uint16_t;
+    using Clock = std::chrono::steady_clock;
+
+    static Key makeKey(pldm_tid_t tid, uint8_t tableType)
+    {
+        return static_cast<Key>(tid) << 8 | tableType;
+    }
+
+    /** @brief Transfer of a table to a requester */
+    struct Transfer
+    {
+        Table table;
+        /** @brief Offset of the last part sent */
+        uint32_t offset;
+        Clock::time_point lastAccess;
+    };
+
+    /** @brief Drop the transfers whose requester timed out */
+    void dropExpired(Clock::time_point now);
+
+    /** @brief Build the part of a transfer starting at an offset, drops the
+     *         transfer after its last part
+     */
+    Part makePart(std::map<Key, Transfer>::iterator transfer, uint32_t offset);
+
+    size_t chunkSize;
+    std::chrono::milliseconds timeout;
+
+    std::map<Key, Transfer> transfers;
+};
+
+} // namespace responder
+
+} // namespace pldm
@@ -0,0 +1,101 @@
+#include "libpldmresponder/bios_catalog.hpp"
+#include "libpldmresponder/bios_table.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::responder::bios;
+using Json = nlohmann::json;
+
+class TestBIOSAttributeCatalog : public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/pldm_bios_catalog.XXXXXX";
+        dir = fs::path(mkdtemp(tmpdir));
+
+        table::string::constructEntry(stringTable, "str_example1");
+        table::string::constructEntry(stringTable, "Enabled");
+        table::appendPadAndChecksum(stringTable);
+
+        entries = Json::parse(R"([
+            {
+                "attribute_type": "string",
+                "attribute_name": "str_example1",
+                "string_type": "ASCII",
+                "minimum_string_length": 1,
+                "maximum_string_length": 100,
+                "default_string": "abcd",
+                "read_only": false,
+                "help_text": "str_example1",
+                "display_name": "str_example1",
+                "dbus": {
+                    "object_path": "/xyz/abc/def",
+                    "interface": "xyz.openbmc_project.str_example1.value",
+                    "property_name": "Str_example1",
+                    "property_type": "string"
+                }
+            }
+        ])");
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(dir);
+    }
+
+    fs::path dir;
+    Table stringTable;
+    Json entries;
+};
+
+TEST_F(TestBIOSAttributeCatalog, testStoreLoad)
+{
+    BIOSAttributeCatalog catalog(dir / "attributeCatalog");
+    auto hash = BIOSAttributeCatalog::sourceHash("bios_attrs.json", "{}");
+
+    Table loadedTable;
+    Json loadedEntries;
+    EXPECT_FALSE(catalog.load(hash, loadedTable, loadedEntries));
+
+    catalog.store(hash, stringTable, entries);
+    ASSERT_TRUE(catalog.load(hash, loadedTable, loadedEntries));
+    EXPECT_EQ(loadedTable, stringTable);
+    EXPECT_EQ(loadedEntries, entries);
+}
+
+TEST_F(TestBIOSAttributeCatalog, testSourceChanged)
+{
+    BIOSAttributeCatalog catalog(dir / "attributeCatalog");
+    auto hash = BIOSAttributeCatalog::sourceHash("bios_attrs.json", "{}");
+    catalog.store(hash, stringTable, entries);
+
+    // The JSON content and path are both part of the hash
+    auto newContent =
+        BIOSAttributeCatalog::sourceHash("bios_attrs.json", "{ }");
+    auto newPath = BIOSAttributeCatalog::sourceHash("bios_attrs2.json", "{}");
+    EXPECT_NE(newContent, hash);
+    EXPECT_NE(newPath, hash);
+
+    Table loadedTable;
+    Json loadedEntries;
+    EXPECT_FALSE(catalog.load(newContent, loadedTable, loadedEntries));
+    EXPECT_FALSE(catalog.load(newPath, loadedTable, loadedEntries));
+}
+
+TEST_F(TestBIOSAttributeCatalog, testTruncated)
+{
+    auto path = dir / "attributeCatalog";
+    BIOSAttributeCatalog catalog(path);
+    auto hash = BIOSAttributeCatalog::sourceHash("bios_attrs.json", "{}");
+    catalog.store(hash, stringTable, entries);
+
+    fs::resize_file(path, fs::file_size(path) - 1);
+
+    Table loadedTable;
+    Json loadedEntries;
+    EXPECT_FALSE(catalog.load(hash, loadedTable, loadedEntries));
+}
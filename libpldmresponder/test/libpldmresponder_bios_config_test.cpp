@@ -8,6 +8,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 
@@ -252,6 +253,31 @@ TEST_F(TestBIOSConfig, buildTablesTest)
     }
 }
 
+TEST_F(TestBIOSConfig, buildTablesFromCatalog)
+{
+    MockdBusHandler dbusHandler;
+    MockSystemConfig mockSystemConfig;
+
+    std::optional<Table> stringTable;
+    std::optional<Table> attrTable;
+    {
+        BIOSConfig biosConfig("./bios_jsons", tableDir.c_str(), &dbusHandler,
+                              0, 0, nullptr, nullptr, &mockSystemConfig,
+                              []() {});
+        stringTable = biosConfig.getBIOSTable(PLDM_BIOS_STRING_TABLE);
+        attrTable = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_TABLE);
+    }
+    ASSERT_TRUE(stringTable);
+    ASSERT_TRUE(attrTable);
+    EXPECT_TRUE(fs::exists(tableDir / "attributeCatalog"));
+
+    // The next start builds the same tables from the compiled catalog
+    BIOSConfig biosConfig("./bios_jsons", tableDir.c_str(), &dbusHandler, 0, 0,
+                          nullptr, nullptr, &mockSystemConfig, []() {});
+    EXPECT_EQ(biosConfig.getBIOSTable(PLDM_BIOS_STRING_TABLE), stringTable);
+    EXPECT_EQ(biosConfig.getBIOSTable(PLDM_BIOS_ATTR_TABLE), attrTable);
+}
+
 TEST_F(TestBIOSConfig, setBIOSTable)
 {
     MockdBusHandler dbusHandler;
@@ -388,3 +414,114 @@ TEST_F(TestBIOSConfig, setAttrValue)
     EXPECT_THAT(std::vector<uint8_t>(p, p + attrValueEntry.size()),
                 ElementsAreArray(attrValueEntry));
 }
+
+TEST_F(TestBIOSConfig, setAttrValueBatch)
+{
+    MockdBusHandler dbusHandler;
+    MockSystemConfig mockSystemConfig;
+
+    BIOSConfig biosConfig("./bios_jsons", tableDir.c_str(), &dbusHandler, 0, 0,
+                          nullptr, nullptr, &mockSystemConfig, []() {});
+
+    auto stringTable = biosConfig.getBIOSTable(PLDM_BIOS_STRING_TABLE);
+    auto attrTable = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_TABLE);
+    auto storedTable = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
+    ASSERT_TRUE(storedTable.has_value());
+
+    BIOSStringTable biosStringTable(*stringTable);
+    auto stringHandle = biosStringTable.findHandle("str_example1");
+    auto attrEntry =
+        table::attribute::findByStringHandle(*attrTable, stringHandle);
+    ASSERT_NE(attrEntry, nullptr);
+    auto attrHandle = table::attribute::decodeHeader(attrEntry).attrHandle;
+
+    std::vector<uint8_t> attrValueEntry{
+        0,   0,             /* attr handle */
+        1,                  /* attr type string read-write */
+        4,   0,             /* current string length */
+        'a', 'b', 'c', 'd', /* default value string handle index */
+    };
+    attrValueEntry[0] = attrHandle & 0xff;
+    attrValueEntry[1] = (attrHandle >> 8) & 0xff;
+
+    EXPECT_CALL(dbusHandler, setDbusProperty(_, _)).Times(2);
+
+    auto rc = biosConfig.setAttrValue(
+        attrValueEntry.data(), attrValueEntry.size(), false, true, false);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    auto firstTable = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
+
+    // A value of the same length patches the table of the batch in place
+    std::copy_n("wxyz", 4, attrValueEntry.begin() + 5);
+    rc = biosConfig.setAttrValue(attrValueEntry.data(), attrValueEntry.size(),
+                                 false, true, false);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    auto attrValueTable = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
+    ASSERT_TRUE(attrValueTable.has_value());
+    EXPECT_EQ(attrValueTable->size(), firstTable->size());
+    EXPECT_TRUE(pldm_bios_table_checksum(attrValueTable->data(),
+                                         attrValueTable->size()));
+    auto entry = pldm_bios_table_attr_value_find_by_handle(
+        attrValueTable->data(), attrValueTable->size(), attrHandle);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(table::attribute_value::decodeStringEntry(entry), "wxyz");
+
+    // The stored table is written once, when the batch is committed
+    BIOSTable storedAttrValueTable(
+        (tableDir / "attributeValueTable").c_str());
+    Table onDisk;
+    storedAttrValueTable.load(onDisk);
+    EXPECT_EQ(onDisk, *storedTable);
+
+    biosConfig.commitAttrValues();
+    onDisk.clear();
+    storedAttrValueTable.load(onDisk);
+    EXPECT_EQ(onDisk, *attrValueTable);
+    EXPECT_EQ(biosConfig.getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE), onDisk);
+}
+
+TEST_F(TestBIOSConfig, setAttrValueCommittedOnDestruction)
+{
+    MockdBusHandler dbusHandler;
+    MockSystemConfig mockSystemConfig;
+    std::vector<uint8_t> attrValueEntry{
+        0,   0,             /* attr handle */
+        1,                  /* attr type string read-write */
+        4,   0,             /* current string length */
+        'w', 'x', 'y', 'z', /* default value string handle index */
+    };
+    uint16_t attrHandle = 0;
+
+    {
+        BIOSConfig biosConfig("./bios_jsons", tableDir.c_str(), &dbusHandler,
+                              0, 0, nullptr, nullptr, &mockSystemConfig,
+                              []() {});
+
+        auto stringTable = biosConfig.getBIOSTable(PLDM_BIOS_STRING_TABLE);
+        auto attrTable = biosConfig.getBIOSTable(PLDM_BIOS_ATTR_TABLE);
+        BIOSStringTable biosStringTable(*stringTable);
+        auto stringHandle = biosStringTable.findHandle("str_example1");
+        auto attrEntry =
+            table::attribute::findByStringHandle(*attrTable, stringHandle);
+        ASSERT_NE(attrEntry, nullptr);
+        attrHandle = table::attribute::decodeHeader(attrEntry).attrHandle;
+        attrValueEntry[0] = attrHandle & 0xff;
+        attrValueEntry[1] = (attrHandle >> 8) & 0xff;
+
+        EXPECT_CALL(dbusHandler, setDbusProperty(_, _)).Times(1);
+        auto rc = biosConfig.setAttrValue(
+            attrValueEntry.data(), attrValueEntry.size(), false, true, false);
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+    }
+
+    // The batch pending when the BIOSConfig is destroyed is stored
+    BIOSTable storedAttrValueTable(
+        (tableDir / "attributeValueTable").c_str());
+    Table onDisk;
+    storedAttrValueTable.load(onDisk);
+    auto entry = pldm_bios_table_attr_value_find_by_handle(
+        onDisk.data(), onDisk.size(), attrHandle);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(table::attribute_value::decodeStringEntry(entry), "wxyz");
+}
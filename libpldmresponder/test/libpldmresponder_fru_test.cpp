@@ -4,9 +4,12 @@
 
 #include <config.h>
 #include <libpldm/pdr.h>
+#include <libpldm/utils.h>
 
 #include <sdbusplus/message.hpp>
 
+#include <cstring>
+
 #include <gtest/gtest.h>
 
 TEST(FruParser, allScenarios)
@@ -93,6 +96,7 @@ TEST(FruImpl, updateAssociationTreeTest)
                     decltype(&pldm_entity_association_tree_destroy)>
         bmcEntityTree(pldm_entity_association_tree_init(),
                       pldm_entity_association_tree_destroy);
+    pldm::utils::EntityTreeIndex entityTreeIndex(entityTree.get());
 
     ObjectValueTree objects{
         {sdbusplus::message::object_path(
@@ -117,7 +121,7 @@ TEST(FruImpl, updateAssociationTreeTest)
 
     pldm::responder::FruImpl mockedFruHandler(
         FRU_JSONS_DIR, "./fru_jsons/fru_master/fru_master.json", pdrRepo.get(),
-        entityTree.get(), bmcEntityTree.get());
+        entityTree.get(), bmcEntityTree.get(), entityTreeIndex);
 
     pldm_entity systemEntity{0x2d01, 1, 0};
     pldm_entity chassisEntity{0x2d, 1, 1};
@@ -166,11 +170,12 @@ TEST(FruImpl, entityByObjectPath)
                     decltype(&pldm_entity_association_tree_destroy)>
         bmcEntityTree(pldm_entity_association_tree_init(),
                       pldm_entity_association_tree_destroy);
+    pldm::utils::EntityTreeIndex entityTreeIndex(entityTree.get());
 
     InterfaceMap iface = {{"xyz.openbmc_project.Inventory.Item.Chassis", {}}};
     pldm::responder::FruImpl mockedFruHandler(
         FRU_JSONS_DIR, "./fru_jsons/fru_master/fru_master.json", pdrRepo.get(),
-        entityTree.get(), bmcEntityTree.get());
+        entityTree.get(), bmcEntityTree.get(), entityTreeIndex);
 
     // Good path
     auto entityPtr = mockedFruHandler.getEntityByObjectPath(iface);
@@ -181,4 +186,130 @@ TEST(FruImpl, entityByObjectPath)
         {"xyz.openbmc_project.Inventory.Item.Motherboard", {}}};
     entityPtr = mockedFruHandler.getEntityByObjectPath(invalidIface);
     ASSERT_TRUE(!entityPtr);
+
+    // The entity of a resolved object path comes from the path map, the
+    // interfaces are not looked at again
+    const std::string chassis = "/xyz/openbmc_project/inventory/system/chassis";
+    entityPtr = mockedFruHandler.getEntityByObjectPath(chassis, iface);
+    ASSERT_TRUE(entityPtr);
+    EXPECT_EQ(entityPtr->entity_type, 45);
+    entityPtr = mockedFruHandler.getEntityByObjectPath(chassis, invalidIface);
+    ASSERT_TRUE(entityPtr);
+    EXPECT_EQ(entityPtr->entity_type, 45);
+    EXPECT_FALSE(mockedFruHandler.getEntityByObjectPath(
+        "/xyz/openbmc_project/inventory/system/motherboard", invalidIface));
+}
+
+TEST(FruImpl, incrementalFruTable)
+{
+    using namespace pldm::responder::dbus;
+    std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)> pdrRepo(
+        pldm_pdr_init(), pldm_pdr_destroy);
+    std::unique_ptr<pldm_entity_association_tree,
+                    decltype(&pldm_entity_association_tree_destroy)>
+        entityTree(pldm_entity_association_tree_init(),
+                   pldm_entity_association_tree_destroy);
+    std::unique_ptr<pldm_entity_association_tree,
+                    decltype(&pldm_entity_association_tree_destroy)>
+        bmcEntityTree(pldm_entity_association_tree_init(),
+                      pldm_entity_association_tree_destroy);
+    pldm::utils::EntityTreeIndex entityTreeIndex(entityTree.get());
+
+    pldm::responder::FruImpl fruImpl(
+        "./fru_jsons/good", "./fru_jsons/fru_master/fru_master.json",
+        pdrRepo.get(), entityTree.get(), bmcEntityTree.get(), entityTreeIndex);
+
+    constexpr auto cpuPath = "/xyz/openbmc_project/inventory/system/cpu0";
+    constexpr auto cpuIntf = "xyz.openbmc_project.Inventory.Item.Cpu";
+    constexpr auto assetIntf = "xyz.openbmc_project.Inventory.Decorator.Asset";
+    InterfaceMap cpu{{cpuIntf, {}},
+                     {assetIntf,
+                      {{"PartNumber", std::string("PN0001")},
+                       {"SerialNumber", std::string("SN0001")}}}};
+    // The Version of an entity in container 0 is read from D-Bus
+    pldm_entity cpuEntity{135, 1, 2};
+
+    // The FRU table and its checksum as returned by GetFRURecordTable
+    auto getTable = [&fruImpl]() {
+        pldm::Response response;
+        fruImpl.getFRUTable(response);
+        return response;
+    };
+    auto checkTable = [&fruImpl](const pldm::Response& table) {
+        ASSERT_GE(table.size(), sizeof(uint32_t));
+        auto paddedSize = table.size() - sizeof(uint32_t);
+        EXPECT_EQ(paddedSize % sizeof(uint32_t), 0);
+        EXPECT_GE(paddedSize, fruImpl.size());
+        EXPECT_LT(paddedSize, fruImpl.size() + sizeof(uint32_t));
+        uint32_t checksum{};
+        std::memcpy(&checksum, table.data() + paddedSize, sizeof(checksum));
+        EXPECT_EQ(checksum, fruImpl.checkSum());
+        if (paddedSize)
+        {
+            EXPECT_EQ(pldm_edac_crc32(table.data(), paddedSize), checksum);
+        }
+    };
+
+    fruImpl.addFruRecordSet(cpuPath, cpu, cpuIntf, cpuEntity);
+    fruImpl.getFRURecordTableMetadata();
+    EXPECT_EQ(fruImpl.numRSI(), 1);
+    EXPECT_EQ(fruImpl.numRecords(), 2);
+    EXPECT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), 1);
+    auto table = getTable();
+    checkTable(table);
+    auto size = fruImpl.size();
+
+    // Changes to objects which are not in the FRU table are ignored
+    fruImpl.interfacesAdded(
+        "/xyz/openbmc_project/inventory/system/cpu1",
+        {{assetIntf, {{"SerialNumber", std::string("SN0002")}}}});
+    EXPECT_EQ(getTable(), table);
+
+    // A property change rewrites the records of the FRU, both records carry
+    // the serial number. The record set identifier and the FRU record set
+    // PDR are kept.
+    fruImpl.interfacesAdded(
+        cpuPath, {{assetIntf, {{"SerialNumber", std::string("SN0001-2")}}}});
+    auto updated = getTable();
+    checkTable(updated);
+    EXPECT_NE(updated, table);
+    EXPECT_EQ(fruImpl.size(), size + 4);
+    EXPECT_EQ(fruImpl.numRSI(), 1);
+    EXPECT_EQ(fruImpl.numRecords(), 2);
+    EXPECT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), 1);
+
+    // Removing the item interface drops the records of the FRU and its FRU
+    // record set PDR
+    fruImpl.interfacesRemoved(cpuPath, {cpuIntf});
+    checkTable(getTable());
+    EXPECT_EQ(fruImpl.size(), 0);
+    EXPECT_EQ(fruImpl.numRecords(), 0);
+    EXPECT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), 0);
+
+    // and the FRU gets them back with the same record set identifier
+    fruImpl.interfacesAdded(cpuPath, {{cpuIntf, {}}});
+    EXPECT_EQ(getTable(), updated);
+    EXPECT_EQ(fruImpl.numRSI(), 1);
+    EXPECT_EQ(fruImpl.numRecords(), 2);
+    EXPECT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), 1);
+
+    // The same for a FRU which becomes not present
+    constexpr auto itemIntf = "xyz.openbmc_project.Inventory.Item";
+    fruImpl.interfacesAdded(cpuPath, {{itemIntf, {{"Present", false}}}});
+    EXPECT_EQ(fruImpl.numRecords(), 0);
+    EXPECT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), 0);
+
+    fruImpl.interfacesAdded(cpuPath, {{itemIntf, {{"Present", true}}}});
+    EXPECT_EQ(getTable(), updated);
+    EXPECT_EQ(fruImpl.numRecords(), 2);
+    ASSERT_EQ(pldm_pdr_get_record_count(pdrRepo.get()), 1);
+    uint16_t terminusHandle = 0;
+    uint16_t entityType = 0;
+    uint16_t entityInstance = 0;
+    uint16_t containerId = 0;
+    EXPECT_NE(pldm_pdr_fru_record_set_find_by_rsi(
+                  pdrRepo.get(), 1, &terminusHandle, &entityType,
+                  &entityInstance, &containerId),
+              nullptr);
+    EXPECT_EQ(entityType, cpuEntity.entity_type);
 }
@@ -10,9 +10,18 @@
 #include "libpldmresponder/platform_state_effecter.hpp"
 #include "libpldmresponder/platform_state_sensor.hpp"
 
+#include <stdlib.h>
+#include <systemd/sd-event.h>
+
 #include <sdbusplus/test/sdbus_mock.hpp>
 #include <sdeventplus/event.hpp>
 
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
 using namespace pldm::pdr;
 using namespace pldm::utils;
 using namespace pldm::responder;
@@ -731,6 +740,186 @@ TEST(StateSensorHandler, allScenarios)
     }
 }
 
+TEST(StateSensorHandler, eventCounters)
+{
+    using namespace pldm::responder::events;
+
+    StateSensorHandler handler{"./event_jsons/good"};
+    constexpr uint8_t invalidEventState = 5;
+
+    // No BMC action configured for the entry
+    StateSensorEntry unknown{1, 64, 1, 7, 1, false};
+    EXPECT_EQ(handler.eventAction(unknown, invalidEventState), PLDM_SUCCESS);
+    EXPECT_EQ(handler.getEventCounters(unknown), std::nullopt);
+
+    StateSensorEntry entry{1, 64, 1, 0, 1, false};
+    EXPECT_EQ(handler.eventAction(entry, invalidEventState),
+              PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(handler.eventAction(entry, invalidEventState),
+              PLDM_ERROR_INVALID_DATA);
+    auto counters = handler.getEventCounters(entry);
+    ASSERT_TRUE(counters.has_value());
+    EXPECT_EQ(counters->received, 2);
+    EXPECT_EQ(counters->dropped, 2);
+    EXPECT_EQ(counters->set, 0);
+    EXPECT_EQ(counters->failed, 0);
+
+    // Entry configured without container ID matches any container ID
+    StateSensorEntry anyContainer{7, 120, 2, 0, 2, false};
+    EXPECT_EQ(handler.eventAction(anyContainer, invalidEventState),
+              PLDM_ERROR_INVALID_DATA);
+    counters = handler.getEventCounters({0xFFFF, 120, 2, 0, 2, true});
+    ASSERT_TRUE(counters.has_value());
+    EXPECT_EQ(counters->received, 1);
+    EXPECT_EQ(counters->dropped, 1);
+}
+
+namespace
+{
+
+/** @brief StateSensorHandler recording the property sets instead of calling
+ *         D-Bus
+ */
+class TestStateSensorHandler :
+    public pldm::responder::events::StateSensorHandler
+{
+  public:
+    using StateSensorHandler::setPropertyDone;
+    using StateSensorHandler::StateSensorHandler;
+
+    std::string getService(const DBusMapping& /*dbusMapping*/) const override
+    {
+        serviceLookups++;
+        return "xyz.openbmc_project.Test";
+    }
+
+    void setPropertyAsync(size_t index, const PropertyValue& value) override
+    {
+        sets.emplace_back(index, value);
+    }
+
+    mutable size_t serviceLookups = 0;
+
+    /** @brief dispatch entry index and value of the property sets */
+    std::vector<std::pair<size_t, PropertyValue>> sets;
+};
+
+/** @brief Run the event loop until there is nothing left to dispatch */
+void runEventLoop(sdeventplus::Event& event)
+{
+    while (sd_event_run(event.get(), 0) > 0)
+    {}
+}
+
+} // namespace
+
+TEST(StateSensorHandler, asyncSetCoalescing)
+{
+    using namespace pldm::responder::events;
+
+    auto event = sdeventplus::Event::get_default();
+    TestStateSensorHandler handler{"./event_jsons/good", event};
+    StateSensorEntry entry{1, 64, 1, 0, 1, false};
+    PropertyValue critical{std::in_place_type<std::string>,
+                           "xyz.openbmc_project.State.Critical"};
+    PropertyValue fatal{std::in_place_type<std::string>,
+                        "xyz.openbmc_project.State.Fatal"};
+
+    // Nothing is set before the event loop runs, the second event replaces
+    // the queued value
+    EXPECT_EQ(handler.eventAction(entry, 0), PLDM_SUCCESS);
+    EXPECT_EQ(handler.eventAction(entry, 1), PLDM_SUCCESS);
+    EXPECT_TRUE(handler.sets.empty());
+    runEventLoop(event);
+    ASSERT_EQ(handler.sets.size(), 1);
+    EXPECT_EQ(handler.sets[0].second, critical);
+    EXPECT_EQ(handler.serviceLookups, 1);
+    EXPECT_EQ(handler.getEventCounters(entry)->coalesced, 1);
+
+    // A single set per entry is outstanding, the next value waits for the
+    // completion
+    EXPECT_EQ(handler.eventAction(entry, 2), PLDM_SUCCESS);
+    runEventLoop(event);
+    EXPECT_EQ(handler.sets.size(), 1);
+    auto index = handler.sets[0].first;
+    handler.setPropertyDone(index, true);
+    runEventLoop(event);
+    ASSERT_EQ(handler.sets.size(), 2);
+    EXPECT_EQ(handler.sets[1].second, fatal);
+    EXPECT_EQ(handler.serviceLookups, 1);
+
+    // A failed set drops the cached service, it is resolved again
+    handler.setPropertyDone(index, false);
+    EXPECT_EQ(handler.eventAction(entry, 0), PLDM_SUCCESS);
+    runEventLoop(event);
+    EXPECT_EQ(handler.sets.size(), 3);
+    EXPECT_EQ(handler.serviceLookups, 2);
+    handler.setPropertyDone(index, true);
+
+    auto counters = handler.getEventCounters(entry);
+    ASSERT_TRUE(counters.has_value());
+    EXPECT_EQ(counters->received, 4);
+    EXPECT_EQ(counters->set, 2);
+    EXPECT_EQ(counters->failed, 1);
+    EXPECT_EQ(counters->coalesced, 1);
+}
+
+TEST(StateSensorHandler, asyncSetMaxInFlight)
+{
+    using namespace pldm::responder::events;
+    namespace fs = std::filesystem;
+
+    constexpr size_t numEntries = TestStateSensorHandler::maxInFlight + 4;
+    char tmpdir[] = "/tmp/pldm_event_jsons.XXXXXX";
+    fs::path dir(mkdtemp(tmpdir));
+    {
+        Json entries = Json::array();
+        for (size_t offset = 0; offset < numEntries; ++offset)
+        {
+            entries.push_back(
+                {{"containerID", 1},
+                 {"entityType", 64},
+                 {"entityInstance", 1},
+                 {"sensorOffset", offset},
+                 {"stateSetId", 1},
+                 {"event_states", {0, 1}},
+                 {"dbus",
+                  {{"object_path", "/xyz/abc/sensor" + std::to_string(offset)},
+                   {"interface", "xyz.openbmc_project.example.value"},
+                   {"property_name", "value"},
+                   {"property_type", "bool"},
+                   {"property_values", {false, true}}}}});
+        }
+        std::ofstream file(dir / "events.json");
+        file << Json{{"entries", entries}}.dump();
+    }
+
+    auto event = sdeventplus::Event::get_default();
+    TestStateSensorHandler handler{dir.string(), event};
+    fs::remove_all(dir);
+
+    for (size_t offset = 0; offset < numEntries; ++offset)
+    {
+        StateSensorEntry entry{1, 64, 1, static_cast<uint8_t>(offset), 1,
+                               false};
+        EXPECT_EQ(handler.eventAction(entry, 1), PLDM_SUCCESS);
+    }
+    runEventLoop(event);
+    ASSERT_EQ(handler.sets.size(), TestStateSensorHandler::maxInFlight);
+
+    // Each completion lets a queued set go
+    handler.setPropertyDone(handler.sets[0].first, true);
+    runEventLoop(event);
+    EXPECT_EQ(handler.sets.size(), TestStateSensorHandler::maxInFlight + 1);
+
+    for (size_t i = 1; i < handler.sets.size(); ++i)
+    {
+        handler.setPropertyDone(handler.sets[i].first, true);
+        runEventLoop(event);
+    }
+    EXPECT_EQ(handler.sets.size(), numEntries);
+}
+
 TEST(TerminusLocatorPDR, BMCTerminusLocatorPDR)
 {
     auto inPDRRepo = pldm_pdr_init();
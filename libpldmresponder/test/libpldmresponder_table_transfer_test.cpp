@@ -0,0 +1,227 @@
+#include "libpldmresponder/fru.hpp"
+#include "libpldmresponder/table_transfer.hpp"
+
+#include <libpldm/base.h>
+#include <libpldm/pdr.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::responder;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+TableTransfer::Table makeTable(size_t size)
+{
+    auto table = std::make_shared<std::vector<uint8_t>>(size);
+    std::iota(table->begin(), table->end(), 0);
+    return table;
+}
+
+/** @brief Transfer a table the way a host does, GetFirstPart followed by
+ *         GetNextPart with the returned handle until the end of the table
+ *
+ *  @return the reassembled table and the transfer flags of the parts
+ */
+std::pair<std::vector<uint8_t>, std::vector<uint8_t>> getTable(
+    TableTransfer& transfer, pldm_tid_t tid, uint8_t tableType,
+    const TableTransfer::Table& table)
+{
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> flags;
+    auto part = transfer.getFirstPart(tid, tableType, table);
+    while (true)
+    {
+        data.insert(data.end(), part.data.begin(), part.data.end());
+        flags.emplace_back(part.transferFlag);
+        if (part.transferFlag == PLDM_END ||
+            part.transferFlag == PLDM_START_AND_END)
+        {
+            EXPECT_EQ(part.nextDataTransferHandle, 0);
+            break;
+        }
+        auto handle = part.nextDataTransferHandle;
+        EXPECT_EQ(transfer.getNextPart(tid, tableType, handle, part),
+                  PLDM_SUCCESS);
+        if (flags.size() > table->size())
+        {
+            ADD_FAILURE() << "transfer does not end";
+            break;
+        }
+    }
+    return {data, flags};
+}
+
+} // namespace
+
+TEST(TableTransfer, singlePart)
+{
+    TableTransfer transfer(0, 10s);
+    auto table = makeTable(1000);
+
+    auto [data, flags] = getTable(transfer, 1, 0, table);
+    EXPECT_EQ(data, *table);
+    EXPECT_EQ(flags, std::vector<uint8_t>{PLDM_START_AND_END});
+    EXPECT_EQ(transfer.size(), 0);
+
+    // A table as large as a part is sent in one part
+    TableTransfer chunked(1000, 10s);
+    std::tie(data, flags) = getTable(chunked, 1, 0, table);
+    EXPECT_EQ(data, *table);
+    EXPECT_EQ(flags, std::vector<uint8_t>{PLDM_START_AND_END});
+}
+
+TEST(TableTransfer, smallChunks)
+{
+    auto table = makeTable(1000);
+    for (size_t chunkSize : {1, 7, 64, 999})
+    {
+        TableTransfer transfer(chunkSize, 10s);
+        auto [data, flags] = getTable(transfer, 1, 0, table);
+        EXPECT_EQ(data, *table);
+
+        auto parts = (table->size() + chunkSize - 1) / chunkSize;
+        ASSERT_EQ(flags.size(), parts);
+        EXPECT_EQ(flags.front(), PLDM_START);
+        EXPECT_EQ(flags.back(), PLDM_END);
+        for (size_t i = 1; i + 1 < parts; ++i)
+        {
+            EXPECT_EQ(flags[i], PLDM_MIDDLE);
+        }
+        EXPECT_EQ(transfer.size(), 0);
+    }
+}
+
+TEST(TableTransfer, requestersAndRetries)
+{
+    TableTransfer transfer(100, 10s);
+    auto table = makeTable(250);
+    auto otherTable = makeTable(150);
+    TableTransfer::Part part{};
+
+    // No transfer in progress
+    EXPECT_EQ(transfer.getNextPart(1, 0, 100, part),
+              TableTransfer::invalidDataTransferHandle);
+
+    auto first = transfer.getFirstPart(1, 0, table);
+    EXPECT_EQ(first.nextDataTransferHandle, 100);
+
+    // Transfers of other requesters and other table types are independent
+    auto other = transfer.getFirstPart(2, 0, otherTable);
+    EXPECT_EQ(other.nextDataTransferHandle, 100);
+    transfer.getFirstPart(1, 1, otherTable);
+    EXPECT_EQ(transfer.size(), 3);
+
+    // The handle must be the one of the next part or of the part sent last
+    EXPECT_EQ(transfer.getNextPart(1, 0, 50, part),
+              TableTransfer::invalidDataTransferHandle);
+    EXPECT_EQ(transfer.getNextPart(1, 0, 200, part),
+              TableTransfer::invalidDataTransferHandle);
+
+    ASSERT_EQ(transfer.getNextPart(1, 0, 100, part), PLDM_SUCCESS);
+    EXPECT_EQ(part.transferFlag, PLDM_MIDDLE);
+    EXPECT_EQ(part.data.front(), (*table)[100]);
+    auto middle = part;
+
+    // The response of the middle part was lost, ask for it again
+    ASSERT_EQ(transfer.getNextPart(1, 0, 100, part), PLDM_SUCCESS);
+    EXPECT_TRUE(std::ranges::equal(part.data, middle.data));
+    EXPECT_EQ(part.nextDataTransferHandle, 200);
+
+    ASSERT_EQ(transfer.getNextPart(2, 0, 100, part), PLDM_SUCCESS);
+    EXPECT_EQ(part.transferFlag, PLDM_END);
+    EXPECT_EQ(part.data.size(), 50);
+
+    ASSERT_EQ(transfer.getNextPart(1, 0, 200, part), PLDM_SUCCESS);
+    EXPECT_EQ(part.transferFlag, PLDM_END);
+    EXPECT_EQ(part.data.size(), 50);
+    EXPECT_EQ(transfer.size(), 1);
+
+    // GetFirstPart restarts a transfer in progress
+    transfer.getFirstPart(1, 1, table);
+    EXPECT_EQ(transfer.size(), 1);
+    ASSERT_EQ(transfer.getNextPart(1, 1, 100, part), PLDM_SUCCESS);
+    EXPECT_EQ(part.transferFlag, PLDM_MIDDLE);
+}
+
+TEST(TableTransfer, timeout)
+{
+    TableTransfer transfer(10, 20ms);
+    auto table = makeTable(100);
+    TableTransfer::Part part{};
+
+    transfer.getFirstPart(1, 0, table);
+    ASSERT_EQ(transfer.getNextPart(1, 0, 10, part), PLDM_SUCCESS);
+
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(transfer.getNextPart(1, 0, 20, part),
+              TableTransfer::invalidDataTransferHandle);
+    EXPECT_EQ(transfer.size(), 0);
+}
+
+TEST(TableTransfer, fruTableChangesDuringTransfer)
+{
+    using namespace pldm::responder::dbus;
+    std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)> pdrRepo(
+        pldm_pdr_init(), pldm_pdr_destroy);
+    std::unique_ptr<pldm_entity_association_tree,
+                    decltype(&pldm_entity_association_tree_destroy)>
+        entityTree(pldm_entity_association_tree_init(),
+                   pldm_entity_association_tree_destroy);
+    std::unique_ptr<pldm_entity_association_tree,
+                    decltype(&pldm_entity_association_tree_destroy)>
+        bmcEntityTree(pldm_entity_association_tree_init(),
+                      pldm_entity_association_tree_destroy);
+    pldm::utils::EntityTreeIndex entityTreeIndex(entityTree.get());
+
+    FruImpl fruImpl("./fru_jsons/good",
+                    "./fru_jsons/fru_master/fru_master.json", pdrRepo.get(),
+                    entityTree.get(), bmcEntityTree.get(), entityTreeIndex);
+
+    constexpr auto cpuPath = "/xyz/openbmc_project/inventory/system/cpu0";
+    constexpr auto cpuIntf = "xyz.openbmc_project.Inventory.Item.Cpu";
+    constexpr auto assetIntf = "xyz.openbmc_project.Inventory.Decorator.Asset";
+    InterfaceMap cpu{{cpuIntf, {}},
+                     {assetIntf,
+                      {{"PartNumber", std::string("PN0001")},
+                       {"SerialNumber", std::string("SN0001")}}}};
+    fruImpl.addFruRecordSet(cpuPath, cpu, cpuIntf, {135, 1, 2});
+
+    // The host reads the FRU table 8 bytes at a time
+    TableTransfer transfer(8, 10s);
+    auto table = fruImpl.getTable();
+    auto part = transfer.getFirstPart(1, 0, table);
+    std::vector<uint8_t> data(part.data.begin(), part.data.end());
+
+    // The part is served from the FRU table buffer
+    EXPECT_EQ(part.data.data(), table->data());
+
+    // The FRU changes in the middle of the transfer
+    fruImpl.interfacesAdded(
+        cpuPath, {{assetIntf, {{"SerialNumber", std::string("SN0002")}}}});
+    auto updated = fruImpl.getTable();
+    EXPECT_NE(*updated, *table);
+
+    // The transfer in progress completes with the table it started with
+    while (part.transferFlag != PLDM_END)
+    {
+        auto handle = part.nextDataTransferHandle;
+        ASSERT_EQ(transfer.getNextPart(1, 0, handle, part), PLDM_SUCCESS);
+        data.insert(data.end(), part.data.begin(), part.data.end());
+    }
+    EXPECT_EQ(data, *table);
+
+    pldm::Response response;
+    fruImpl.getFRUTable(response);
+    EXPECT_EQ(response, *updated);
+}
@@ -15,6 +15,7 @@
 #include <xyz/openbmc_project/Logging/Entry/server.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <map>
 #include <set>
 #include <sstream>
@@ -291,7 +292,7 @@ uint8_t OemEventManager::sensorIdToDIMMIdx(const uint16_t& sensorId)
 }
 
 void OemEventManager::handleBootOverallEvent(
-    pldm_tid_t /*tid*/, uint16_t /*sensorId*/, uint32_t presentReading)
+    pldm_tid_t tid, uint16_t /*sensorId*/, uint32_t presentReading)
 {
     log_level logLevel{log_level::OK};
     std::string description;
@@ -381,6 +382,8 @@ void OemEventManager::handleBootOverallEvent(
 
     // Log to Redfish event
     sendJournalRedfish(description, logLevel);
+
+    noteBootProgress(tid);
 }
 
 int OemEventManager::processNumericSensorEvent(
@@ -592,6 +595,8 @@ int OemEventManager::handleSensorEvent(
     const uint8_t* sensorData = eventData + eventClassDataOffset;
     size_t sensorDataLength = eventDataSize - eventClassDataOffset;
 
+    noteEventActivity(tid);
+
     switch (sensorEventClassType)
     {
         case PLDM_NUMERIC_SENSOR_STATE:
@@ -912,6 +917,8 @@ int OemEventManager::processOemMsgPollEvent(pldm_tid_t tid, uint16_t eventId,
 {
     EFI_AMPERE_ERROR_DATA ampHdr;
 
+    noteEventActivity(tid);
+
     decodeCperRecord(eventData, eventDataSize, &ampHdr);
 
     addCperSELLog(tid, eventId, &ampHdr);
@@ -966,6 +973,9 @@ int OemEventManager::handlepldmMessagePollEvent(
         return rc;
     }
 
+    /* The SoC has events queued, poll them without waiting for the timer */
+    noteEventActivity(tid, true);
+
     auto sensorID = poll_event.event_id;
     /* The UE errors */
     if (rasUESensorIDs.contains(sensorID))
@@ -991,31 +1001,186 @@ int OemEventManager::handlepldmMessagePollEvent(
 
 exec::task<int> OemEventManager::oemPollForPlatformEvent(pldm_tid_t tid)
 {
-    uint64_t t0 = 0;
-
     /* This OEM event handler is only used for SoC terminus */
     if (!tidToSocketNameMap.contains(tid))
     {
         co_return PLDM_SUCCESS;
     }
 
-    if (!timeStampMap.contains(tid))
+    /*
+     * The events are polled on the timer of the terminus, so that a long
+     * sensor polling cycle does not delay them. The timer is restarted here
+     * once the sensor polling of the terminus resumes.
+     */
+    auto& poller = eventPollers[tid];
+    if (!poller.timer)
     {
-        sd_event_now(event.get(), CLOCK_MONOTONIC, &t0);
-        timeStampMap.emplace(std::make_pair(tid, t0));
+        poller.timer = std::make_unique<sdbusplus::Timer>(
+            event.get(),
+            std::bind_front(&OemEventManager::doEventPolling, this, tid));
     }
-    else
+
+    try
     {
-        sd_event_now(event.get(), CLOCK_MONOTONIC, &t0);
-        uint64_t elapsed = t0 - timeStampMap[tid];
-        if (elapsed >= NORMAL_EVENT_POLLING_TIME)
+        if (!poller.polling && !poller.timer->isRunning())
         {
-            co_await manager->pollForPlatformEvent(tid, 0, 0);
-            timeStampMap[tid] = t0;
+            poller.timer->start(poller.interval);
         }
     }
+    catch (const std::exception& e)
+    {
+        lg2::error(
+            "Terminus ID {TID}: Failed to start event polling timer. Exception: {EXCEPTION}",
+            "TID", tid, "EXCEPTION", e);
+        co_return PLDM_ERROR;
+    }
 
     co_return PLDM_SUCCESS;
 }
+
+OemEventManager::~OemEventManager()
+{
+    /* A stopped poll finds no poller and does not restart the timer */
+    eventPollers.clear();
+    eventPollingScope.request_stop();
+    stdexec::sync_wait(eventPollingScope.on_empty());
+}
+
+void OemEventManager::removeTerminus(pldm_tid_t tid)
+{
+    /* A running poll finds no poller and does not restart the timer */
+    eventPollers.erase(tid);
+}
+
+bool OemEventManager::isTerminusAvailable(pldm_tid_t tid)
+{
+    return manager && manager->getAvailableState(tid);
+}
+
+exec::task<int> OemEventManager::pollEvents(pldm_tid_t tid)
+{
+    return manager->pollForPlatformEvent(tid, 0, 0);
+}
+
+void OemEventManager::doEventPolling(pldm_tid_t tid)
+{
+    auto it = eventPollers.find(tid);
+    if (it == eventPollers.end() || it->second.polling)
+    {
+        return;
+    }
+
+    /* The terminus is removed or not available for PLDM requests */
+    if (!isTerminusAvailable(tid))
+    {
+        return;
+    }
+
+    it->second.polling = true;
+    eventPollingScope.spawn(
+        stdexec::just() | stdexec::let_value([this, tid] -> exec::task<void> {
+            auto rc =
+                co_await stdexec::stopped_as_optional(pollEvents(tid));
+            updateEventPolling(tid, rc);
+        }),
+        exec::default_task_context<void>(exec::inline_scheduler{}));
+}
+
+void OemEventManager::updateEventPolling(pldm_tid_t tid,
+                                         std::optional<int> rc)
+{
+    auto it = eventPollers.find(tid);
+    if (it == eventPollers.end())
+    {
+        return;
+    }
+    auto& poller = it->second;
+    poller.polling = false;
+
+    uint64_t now = 0;
+    sd_event_now(event.get(), CLOCK_MONOTONIC, &now);
+    bool booting =
+        poller.bootProgressTime &&
+        now - *poller.bootProgressTime <
+            static_cast<uint64_t>(
+                duration_cast<microseconds>(bootProgressPollingTime).count());
+
+    if (rc == PLDM_SUCCESS && (poller.events > 0 || booting))
+    {
+        poller.interval = minEventPollingInterval;
+    }
+    else
+    {
+        poller.interval =
+            std::min(poller.interval * 2, maxEventPollingInterval);
+    }
+    poller.events = 0;
+
+    /* The poll is stopped while the terminus is not available */
+    if (!rc || !isTerminusAvailable(tid))
+    {
+        return;
+    }
+
+    try
+    {
+        if (!poller.timer->isRunning())
+        {
+            poller.timer->start(poller.interval);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        lg2::error(
+            "Terminus ID {TID}: Failed to restart event polling timer. Exception: {EXCEPTION}",
+            "TID", tid, "EXCEPTION", e);
+    }
+}
+
+void OemEventManager::noteEventActivity(pldm_tid_t tid, bool pollNow)
+{
+    auto it = eventPollers.find(tid);
+    if (it == eventPollers.end())
+    {
+        return;
+    }
+    auto& poller = it->second;
+    poller.events++;
+
+    if (poller.polling || !poller.timer || !poller.timer->isRunning())
+    {
+        return;
+    }
+
+    /* Bring forward the next poll of an idle SoC */
+    auto interval = pollNow ? milliseconds(0) : minEventPollingInterval;
+    if (pollNow || poller.interval > minEventPollingInterval)
+    {
+        try
+        {
+            poller.interval = minEventPollingInterval;
+            poller.timer->start(interval);
+        }
+        catch (const std::exception& e)
+        {
+            lg2::error(
+                "Terminus ID {TID}: Failed to restart event polling timer. Exception: {EXCEPTION}",
+                "TID", tid, "EXCEPTION", e);
+        }
+    }
+}
+
+void OemEventManager::noteBootProgress(pldm_tid_t tid)
+{
+    auto it = eventPollers.find(tid);
+    if (it == eventPollers.end())
+    {
+        return;
+    }
+
+    uint64_t now = 0;
+    sd_event_now(event.get(), CLOCK_MONOTONIC, &now);
+    it->second.bootProgressTime = now;
+}
 } // namespace oem_ampere
 } // namespace pldm
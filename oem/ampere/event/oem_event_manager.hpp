@@ -9,12 +9,30 @@
 
 #include <libpldm/pldm.h>
 
+#include <sdbusplus/timer.hpp>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+
 namespace pldm
 {
 namespace oem_ampere
 {
 using namespace pldm::pdr;
-#define NORMAL_EVENT_POLLING_TIME 5000000 // ms
+
+/** @brief Interval of the OEM event polling while the SoC reports events or
+ *  boot progress
+ */
+constexpr auto minEventPollingInterval = std::chrono::milliseconds(500);
+
+/** @brief Interval the OEM event polling of an idle SoC backs off to */
+constexpr auto maxEventPollingInterval = std::chrono::milliseconds(20000);
+
+/** @brief Time the OEM event polling is kept at its shortest interval after
+ *  a boot progress event of the SoC
+ */
+constexpr auto bootProgressPollingTime = std::chrono::seconds(30);
 
 using EventToMsgMap_t = std::unordered_map<uint8_t, std::string>;
 
@@ -238,7 +256,11 @@ class OemEventManager
     OemEventManager(OemEventManager&&) = delete;
     OemEventManager& operator=(const OemEventManager&) = delete;
     OemEventManager& operator=(OemEventManager&&) = delete;
-    virtual ~OemEventManager() = default;
+
+    /** @brief Stop the running event polls, which refer to the manager, and
+     *         wait for them to end
+     */
+    virtual ~OemEventManager();
 
     explicit OemEventManager(
         sdeventplus::Event& event,
@@ -287,14 +309,38 @@ class OemEventManager
         const pldm_msg* request, size_t payloadLength,
         uint8_t /* formatVersion */, pldm_tid_t tid, size_t eventDataOffset);
 
-    /** @brief A Coroutine to do OEM PollForPlatformEvent action
+    /** @brief A Coroutine to do OEM PollForPlatformEvent action. It is called
+     *  in each sensor polling cycle of the terminus and starts the event
+     *  polling of the SoC terminus, which then runs on its own timer.
      *
      *  @param[in] tid - the destination TID
      *  @return coroutine return_value - PLDM completion code
      */
     exec::task<int> oemPollForPlatformEvent(pldm_tid_t tid);
 
+    /** @brief Stop the event polling of a removed SoC terminus.
+     *
+     *  @param[in] tid - TID
+     */
+    void removeTerminus(pldm_tid_t tid);
+
   protected:
+    /** @brief Check whether the terminus is available for PLDM requests.
+     *
+     *  @param[in] tid - TID
+     *
+     *  @return true if the terminus is available
+     */
+    virtual bool isTerminusAvailable(pldm_tid_t tid);
+
+    /** @brief Poll the events of the terminus.
+     *
+     *  @param[in] tid - TID
+     *
+     *  @return coroutine return_value - PLDM completion code
+     */
+    virtual exec::task<int> pollEvents(pldm_tid_t tid);
+
     /** @brief Create prefix string for logging message.
      *
      *  @param[in] tid - TID
@@ -353,7 +399,7 @@ class OemEventManager
      *  @param[in] sensorId - Sensor ID
      *  @param[in] presentReading - the present reading of the sensor
      */
-    void handleBootOverallEvent(pldm_tid_t /*tid*/, uint16_t /*sensorId*/,
+    void handleBootOverallEvent(pldm_tid_t tid, uint16_t /*sensorId*/,
                                 uint32_t presentReading);
 
     /** @brief Handle numeric sensor event message from DIMM status sensor.
@@ -431,13 +477,69 @@ class OemEventManager
                                   const uint8_t* sensorData,
                                   size_t sensorDataLength);
 
+    /** @brief Poll the events of the SoC terminus on expiry of its event
+     *  polling timer.
+     *
+     *  @param[in] tid - TID
+     */
+    void doEventPolling(pldm_tid_t tid);
+
+    /** @brief Adapt the event polling interval of the SoC terminus after a
+     *  poll and restart its event polling timer. The interval is the shortest
+     *  while the SoC reports events or boot progress, it doubles after each
+     *  idle or failed poll up to maxEventPollingInterval.
+     *
+     *  @param[in] tid - TID
+     *  @param[in] rc - the PLDM completion code of the poll, std::nullopt
+     *                  when the poll was stopped
+     */
+    void updateEventPolling(pldm_tid_t tid, std::optional<int> rc);
+
+    /** @brief Note an event of the SoC terminus, so that it is polled again
+     *  at the shortest interval.
+     *
+     *  @param[in] tid - TID
+     *  @param[in] pollNow - poll the SoC at once
+     */
+    void noteEventActivity(pldm_tid_t tid, bool pollNow = false);
+
+    /** @brief Note a boot progress event of the SoC terminus.
+     *
+     *  @param[in] tid - TID
+     */
+    void noteBootProgress(pldm_tid_t tid);
+
+    /** @brief State of the event polling of a SoC terminus */
+    struct EventPoller
+    {
+        /** @brief Timer of the next poll */
+        std::unique_ptr<sdbusplus::Timer> timer;
+
+        /** @brief Current polling interval */
+        std::chrono::milliseconds interval = minEventPollingInterval;
+
+        /** @brief Number of the events received since the last poll */
+        size_t events = 0;
+
+        /** @brief Monotonic time in microseconds of the last boot progress
+         *  event
+         */
+        std::optional<uint64_t> bootProgressTime;
+
+        /** @brief A poll is running */
+        bool polling = false;
+    };
+
     /** @brief reference of main event loop of pldmd, primarily used to schedule
      *  work
      */
     sdeventplus::Event& event;
 
-    /** @brief Latest OEM PollForPlatformEvent message timeStamp. */
-    std::map<pldm_tid_t, uint64_t> timeStampMap;
+    /** @brief Event polling state of the SoC termini */
+    std::map<pldm_tid_t, EventPoller> eventPollers;
+
+    /** @brief Scope of the running event polls */
+    exec::async_scope eventPollingScope;
 
     /** @brief A Manager interface for calling the hook functions */
     platform_mc::Manager* manager;
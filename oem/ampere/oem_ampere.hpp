@@ -140,6 +140,12 @@ class OemAMPERE
             [oemEventManager](pldm_tid_t tid) {
                 return oemEventManager->oemPollForPlatformEvent(tid);
             });
+
+        /* Stop the event polling of a removed SoC terminus */
+        platformManager->registerOEMRemovedTerminusHandler(
+            [oemEventManager](pldm_tid_t tid) {
+                oemEventManager->removeTerminus(tid);
+            });
     }
 
   private:
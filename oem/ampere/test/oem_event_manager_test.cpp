@@ -0,0 +1,179 @@
+#include "common/instance_id.hpp"
+#include "oem/ampere/event/oem_event_manager.hpp"
+#include "platform-mc/test/utils_test.hpp"
+#include "test/test_instance_id.hpp"
+
+#include <libpldm/base.h>
+#include <libpldm/platform.h>
+
+#include <sdeventplus/event.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+using namespace pldm::oem_ampere;
+using namespace std::chrono;
+
+class TestOemEventManager : public OemEventManager
+{
+  public:
+    TestOemEventManager(sdeventplus::Event& event,
+                        pldm::InstanceIdDb& instanceIdDb) :
+        OemEventManager(event, nullptr, instanceIdDb, nullptr)
+    {}
+
+    using OemEventManager::doEventPolling;
+    using OemEventManager::eventPollers;
+    using OemEventManager::noteBootProgress;
+    using OemEventManager::noteEventActivity;
+    using OemEventManager::updateEventPolling;
+
+    bool isTerminusAvailable(pldm_tid_t /* tid */) override
+    {
+        return available;
+    }
+
+    exec::task<int> pollEvents(pldm_tid_t /* tid */) override
+    {
+        uint64_t now = 0;
+        sd_event_now(event.get(), CLOCK_MONOTONIC, &now);
+        pollTimes.push_back(now);
+        co_return rc;
+    }
+
+    bool available = true;
+    int rc = PLDM_SUCCESS;
+    std::vector<uint64_t> pollTimes;
+};
+
+class OemEventManagerTest : public testing::Test
+{
+  protected:
+    OemEventManagerTest() :
+        event(sdeventplus::Event::get_default()),
+        oemEventManager(event, instanceIdDb)
+    {}
+
+    /** @brief Start the event polling of the SoC terminus */
+    void startEventPolling()
+    {
+        auto [rc] =
+            stdexec::sync_wait(oemEventManager.oemPollForPlatformEvent(tid))
+                .value();
+        ASSERT_EQ(PLDM_SUCCESS, rc);
+        ASSERT_TRUE(oemEventManager.eventPollers.contains(tid));
+    }
+
+    /** @brief The polling state of the SoC terminus */
+    auto& poller()
+    {
+        return oemEventManager.eventPollers.at(tid);
+    }
+
+    sdeventplus::Event event;
+    TestInstanceIdDb instanceIdDb;
+    TestOemEventManager oemEventManager;
+    const pldm_tid_t tid = 1; // SOCKET 0
+};
+
+TEST_F(OemEventManagerTest, idlePollingBacksOff)
+{
+    startEventPolling();
+    EXPECT_EQ(minEventPollingInterval, poller().interval);
+    EXPECT_TRUE(poller().timer->isRunning());
+
+    // An idle SoC is polled at twice the interval, up to the longest one
+    std::vector<milliseconds> intervals;
+    for (int i = 0; i < 7; ++i)
+    {
+        oemEventManager.updateEventPolling(tid, PLDM_SUCCESS);
+        intervals.push_back(poller().interval);
+    }
+    EXPECT_EQ(intervals,
+              (std::vector<milliseconds>{
+                  milliseconds(1000), milliseconds(2000), milliseconds(4000),
+                  milliseconds(8000), milliseconds(16000), milliseconds(20000),
+                  milliseconds(20000)}));
+
+    // A failed poll also backs off
+    poller().interval = minEventPollingInterval;
+    oemEventManager.updateEventPolling(tid, PLDM_ERROR);
+    EXPECT_EQ(milliseconds(1000), poller().interval);
+
+    // The events of the SoC bring the interval back to the shortest, which
+    // it does not go below
+    oemEventManager.noteEventActivity(tid);
+    EXPECT_EQ(minEventPollingInterval, poller().interval);
+    oemEventManager.noteEventActivity(tid);
+    oemEventManager.updateEventPolling(tid, PLDM_SUCCESS);
+    EXPECT_EQ(minEventPollingInterval, poller().interval);
+}
+
+TEST_F(OemEventManagerTest, bootProgressPolling)
+{
+    startEventPolling();
+
+    // The SoC is polled at the shortest interval while it boots
+    oemEventManager.noteBootProgress(tid);
+    for (int i = 0; i < 3; ++i)
+    {
+        oemEventManager.updateEventPolling(tid, PLDM_SUCCESS);
+        EXPECT_EQ(minEventPollingInterval, poller().interval);
+    }
+
+    // Past the boot window the idle SoC backs off again
+    uint64_t now = 0;
+    sd_event_now(event.get(), CLOCK_MONOTONIC, &now);
+    poller().bootProgressTime =
+        now - duration_cast<microseconds>(bootProgressPollingTime).count() - 1;
+    oemEventManager.updateEventPolling(tid, PLDM_SUCCESS);
+    EXPECT_EQ(milliseconds(1000), poller().interval);
+}
+
+TEST_F(OemEventManagerTest, pollNowOnMessagePollEvent)
+{
+    startEventPolling();
+    poller().interval = maxEventPollingInterval;
+    poller().timer->start(maxEventPollingInterval);
+
+    // pldmMessagePollEvent: format version, event ID, data transfer handle
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + 7> eventMsg{
+        0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
+    auto request = new (eventMsg.data()) pldm_msg;
+    uint64_t t0 = 0;
+    sd_event_now(event.get(), CLOCK_MONOTONIC, &t0);
+    EXPECT_EQ(PLDM_SUCCESS, oemEventManager.handlepldmMessagePollEvent(
+                                request, eventMsg.size() - sizeof(pldm_msg_hdr),
+                                0, tid, 0));
+
+    utils::runEventLoopForSeconds(event, 1);
+    ASSERT_FALSE(oemEventManager.pollTimes.empty());
+    EXPECT_LT(oemEventManager.pollTimes[0] - t0, 100000u);
+    EXPECT_LE(poller().interval, milliseconds(1000));
+}
+
+TEST_F(OemEventManagerTest, stopOnUnavailability)
+{
+    startEventPolling();
+
+    // A stopped poll does not restart the timer
+    poller().timer->stop();
+    oemEventManager.updateEventPolling(tid, std::nullopt);
+    EXPECT_FALSE(poller().timer->isRunning());
+
+    // Nor does a poll of a terminus which became unavailable
+    oemEventManager.available = false;
+    oemEventManager.updateEventPolling(tid, PLDM_SUCCESS);
+    EXPECT_FALSE(poller().timer->isRunning());
+
+    // An unavailable terminus is not polled
+    oemEventManager.doEventPolling(tid);
+    utils::runEventLoopForSeconds(event, 1);
+    EXPECT_TRUE(oemEventManager.pollTimes.empty());
+    EXPECT_FALSE(poller().polling);
+
+    // The polling state of a removed terminus is dropped
+    oemEventManager.removeTerminus(tid);
+    EXPECT_FALSE(oemEventManager.eventPollers.contains(tid));
+}
@@ -8,6 +8,7 @@
 #include "file_io_type_pel.hpp"
 #include "file_io_type_progress_src.hpp"
 #include "file_io_type_vpd.hpp"
+#include "file_session_cache.hpp"
 #include "xyz/openbmc_project/Common/error.hpp"
 
 #include <libpldm/base.h>
@@ -20,7 +21,6 @@
 #include <cstdint>
 #include <exception>
 #include <filesystem>
-#include <fstream>
 #include <vector>
 
 PHOSPHOR_LOG2_USING;
@@ -75,52 +75,40 @@ int FileHandler::transferFileData(const fs::path& path, bool upstream,
                                   uint32_t offset, uint32_t& length,
                                   uint64_t address)
 {
-    bool fileExists = false;
+    auto& sessions = FileSessionCache::get();
     if (upstream)
     {
-        fileExists = fs::exists(path);
-        if (!fileExists)
+        auto fileSize = sessions.fileSize(path);
+        if (!fileSize)
         {
             error("File '{PATH}' does not exist.", "PATH", path);
             return PLDM_INVALID_FILE_HANDLE;
         }
 
-        size_t fileSize = fs::file_size(path);
-        if (offset >= fileSize)
+        if (offset >= *fileSize)
         {
             error(
                 "Offset '{OFFSET}' exceeds file size '{SIZE}' for file handle {FILE_HANDLE}",
-                "OFFSET", offset, "SIZE", fileSize, "FILE_HANDLE", fileHandle);
+                "OFFSET", offset, "SIZE", *fileSize, "FILE_HANDLE", fileHandle);
             return PLDM_DATA_OUT_OF_RANGE;
         }
-        if (offset + length > fileSize)
+        if (uint64_t{offset} + length > *fileSize)
         {
-            length = fileSize - offset;
+            length = *fileSize - offset;
         }
     }
 
-    int flags{};
-    if (upstream)
-    {
-        flags = O_RDONLY;
-    }
-    else if (fileExists)
-    {
-        flags = O_RDWR;
-    }
-    else
-    {
-        flags = O_WRONLY;
-    }
-    int file = open(path.string().c_str(), flags);
-    if (file == -1)
+    // The file stays open for the next chunks the host transfers
+    auto fd = sessions.acquire(path, !upstream);
+    if (fd == -1)
     {
         error("File '{PATH}' does not exist.", "PATH", path);
         return PLDM_ERROR;
     }
-    utils::CustomFD fd(file);
 
-    return transferFileData(fd(), upstream, offset, length, address);
+    auto rc = transferFileData(fd, upstream, offset, length, address);
+    sessions.release(path);
+    return rc;
 }
 
 std::unique_ptr<FileHandler> getHandlerByType(uint16_t fileType,
@@ -187,42 +175,19 @@ std::unique_ptr<FileHandler> getHandlerByType(uint16_t fileType,
 int FileHandler::readFile(const std::string& filePath, uint32_t offset,
                           uint32_t& length, Response& response)
 {
-    if (!fs::exists(filePath))
+    auto rc = FileSessionCache::get().read(filePath, offset, length, response);
+    if (rc == PLDM_INVALID_FILE_HANDLE)
     {
         error("File '{PATH}' and handle {FILE_HANDLE} does not exist", "PATH",
               filePath, "FILE_HANDLE", fileHandle);
-        return PLDM_INVALID_FILE_HANDLE;
     }
-
-    size_t fileSize = fs::file_size(filePath);
-    if (offset >= fileSize)
+    else if (rc == PLDM_DATA_OUT_OF_RANGE)
     {
         error(
-            "Offset '{OFFSET}' exceeds file size '{SIZE}' and file handle '{FILE_HANDLE}'",
-            "OFFSET", offset, "SIZE", fileSize, "FILE_HANDLE", fileHandle);
-        return PLDM_DATA_OUT_OF_RANGE;
-    }
-
-    if (offset + length > fileSize)
-    {
-        length = fileSize - offset;
-    }
-
-    size_t currSize = response.size();
-    response.resize(currSize + length);
-    auto filePos = reinterpret_cast<char*>(response.data());
-    filePos += currSize;
-    std::ifstream stream(filePath, std::ios::in | std::ios::binary);
-    if (stream)
-    {
-        stream.seekg(offset);
-        stream.read(filePos, length);
-        return PLDM_SUCCESS;
+            "Offset '{OFFSET}' exceeds the size of file '{PATH}' and file handle '{FILE_HANDLE}'",
+            "OFFSET", offset, "PATH", filePath, "FILE_HANDLE", fileHandle);
     }
-    error(
-        "Unable to read file '{PATH}' at offset '{OFFSET}' for length '{LENGTH}'",
-        "PATH", filePath, "OFFSET", offset, "LENGTH", length);
-    return PLDM_ERROR;
+    return rc;
 }
 
 } // namespace responder
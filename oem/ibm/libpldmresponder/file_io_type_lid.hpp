@@ -1,6 +1,7 @@
 #pragma once
 
 #include "file_io_by_type.hpp"
+#include "file_session_cache.hpp"
 
 #include <phosphor-logging/lg2.hpp>
 
@@ -199,62 +200,32 @@ class LidHandler : public FileHandler
                 lidPath = std::move(dir) + '/' + lidName;
             }
         }
-        bool fileExists = fs::exists(lidPath);
-        int flags{};
-        if (fileExists)
+        // The LID stays open for the next chunks, each chunk is written
+        // synchronously before it is acknowledged
+        auto& sessions = FileSessionCache::get();
+        auto fileSize = sessions.fileSize(lidPath);
+        if (fileSize)
         {
-            flags = O_RDWR;
-            size_t fileSize = fs::file_size(lidPath);
-            if (offset > fileSize)
+            if (offset > *fileSize)
             {
                 error(
                     "Offset '{OFFSET}' exceeds file size '{SIZE}' and file handle '{FILE_HANDLE}'",
-                    "OFFSET", offset, "SIZE", fileSize, "FILE_HANDLE",
+                    "OFFSET", offset, "SIZE", *fileSize, "FILE_HANDLE",
                     fileHandle);
                 return PLDM_DATA_OUT_OF_RANGE;
             }
         }
-        else
+        else if (offset > 0)
         {
-            flags = O_WRONLY | O_CREAT | O_TRUNC | O_SYNC;
-            if (offset > 0)
-            {
-                error("Offset '{OFFSET}' is non zero in a new file '{PATH}'",
-                      "OFFSET", offset, "PATH", lidPath);
-                return PLDM_DATA_OUT_OF_RANGE;
-            }
+            error("Offset '{OFFSET}' is non zero in a new file '{PATH}'",
+                  "OFFSET", offset, "PATH", lidPath);
+            return PLDM_DATA_OUT_OF_RANGE;
         }
-        auto fd = open(lidPath.c_str(), flags, S_IRUSR);
-        if (fd == -1)
-        {
-            error("Failed to open file '{LID_PATH}'", "LID_PATH", lidPath);
-            return PLDM_ERROR;
-        }
-        rc = lseek(fd, offset, SEEK_SET);
-        if (rc == -1)
-        {
-            error(
-                "Failed to lseek at offset '{OFFSET}', error number - {ERROR_NUM}",
-                "ERROR_NUM", errno, "OFFSET", offset);
-            return PLDM_ERROR;
-        }
-        rc = ::write(fd, buffer, length);
-        if (rc == -1)
-        {
-            error(
-                "Failed to do file write of length '{LENGTH}' at offset '{OFFSET}', error number - {ERROR_NUM}",
-                "LENGTH", length, "OFFSET", offset, "ERROR_NUM", errno);
-            return PLDM_ERROR;
-        }
-        else if (rc == static_cast<int>(length))
-        {
-            rc = PLDM_SUCCESS;
-        }
-        else if (rc < static_cast<int>(length))
+        rc = sessions.write(lidPath, buffer, offset, length, true);
+        if (rc != PLDM_SUCCESS)
         {
-            rc = PLDM_ERROR;
+            return rc;
         }
-        close(fd);
 
         if (lidType == PLDM_FILE_TYPE_LID_MARKER)
         {
@@ -0,0 +1,316 @@
+#include "file_session_cache.hpp"
+
+#include <fcntl.h>
+#include <libpldm/base.h>
+#include <libpldm/oem/ibm/file_io.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+#include <sdeventplus/event.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <functional>
+
+PHOSPHOR_LOG2_USING;
+
+namespace pldm
+{
+namespace responder
+{
+
+namespace
+{
+
+/** @brief pread the whole length, unless the end of the file is reached
+ *  @return the length read, -1 on error
+ */
+ssize_t readAll(int fd, uint8_t* data, size_t length, uint64_t offset)
+{
+    size_t done = 0;
+    while (done < length)
+    {
+        auto rc = pread(fd, data + done, length - done, offset + done);
+        if (rc < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        if (rc == 0)
+        {
+            break;
+        }
+        done += rc;
+    }
+    return done;
+}
+
+/** @brief pwrite the whole length
+ *  @return true on success
+ */
+bool writeAll(int fd, const uint8_t* data, size_t length, uint64_t offset)
+{
+    size_t done = 0;
+    while (done < length)
+    {
+        auto rc = pwrite(fd, data + done, length - done, offset + done);
+        if (rc < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        done += rc;
+    }
+    return true;
+}
+
+} // namespace
+
+FileSessionCache::FileSessionCache(std::chrono::milliseconds idleTimeout) :
+    idleTimeout(idleTimeout),
+    idleTimer(sdeventplus::Event::get_default().get(),
+              std::bind_front(&FileSessionCache::closeIdle, this))
+{}
+
+FileSessionCache::~FileSessionCache()
+{
+    while (!sessions.empty())
+    {
+        close(sessions.begin());
+    }
+}
+
+FileSessionCache& FileSessionCache::get()
+{
+    static FileSessionCache cache{
+        std::chrono::milliseconds(FILE_SESSION_IDLE_TIMEOUT)};
+    return cache;
+}
+
+FileSessionCache::Session* FileSessionCache::getSession(
+    const fs::path& path, bool writable, bool create, bool sync)
+{
+    struct stat st{};
+    bool exists = ::stat(path.c_str(), &st) == 0;
+
+    auto it = sessions.find(path);
+    if (it != sessions.end())
+    {
+        auto& session = it->second;
+        if (exists && session.dev == st.st_dev && session.ino == st.st_ino &&
+            (session.writable || !writable) && (session.sync || !sync))
+        {
+            // The file may have been written other than through the cache
+            session.size = st.st_size;
+            session.lastAccess = Clock::now();
+            return &session;
+        }
+        // The path was removed or replaced, or is written now
+        close(it);
+    }
+
+    if (!exists && !create)
+    {
+        return nullptr;
+    }
+
+    int flags = writable ? O_RDWR : O_RDONLY;
+    if (!exists)
+    {
+        flags = O_RDWR | O_CREAT | O_TRUNC;
+    }
+    if (sync)
+    {
+        flags |= O_SYNC;
+    }
+    auto fd = open(path.c_str(), flags | O_CLOEXEC, S_IRUSR);
+    if (fd < 0)
+    {
+        error("Failed to open file '{PATH}', error number - {ERROR_NUM}",
+              "PATH", path, "ERROR_NUM", errno);
+        return nullptr;
+    }
+    if (fstat(fd, &st))
+    {
+        error("Failed to stat file '{PATH}', error number - {ERROR_NUM}",
+              "PATH", path, "ERROR_NUM", errno);
+        ::close(fd);
+        return nullptr;
+    }
+
+    if (sessions.size() >= maxSessions)
+    {
+        close(std::ranges::min_element(sessions, {}, [](const auto& entry) {
+            return entry.second.lastAccess;
+        }));
+    }
+
+    Session session{};
+    session.fd = fd;
+    session.writable = writable || !exists;
+    session.sync = sync;
+    session.dev = st.st_dev;
+    session.ino = st.st_ino;
+    session.size = st.st_size;
+    session.lastAccess = Clock::now();
+
+    if (idleTimeout.count() > 0 && !idleTimer.isEnabled())
+    {
+        idleTimer.start(idleTimeout, true);
+    }
+    return &sessions.insert_or_assign(path, std::move(session)).first->second;
+}
+
+int FileSessionCache::read(const fs::path& path, uint32_t offset,
+                           uint32_t& length, Response& response)
+{
+    auto session = getSession(path, false, false, false);
+    if (session == nullptr)
+    {
+        std::error_code ec;
+        if (!fs::exists(path, ec))
+        {
+            return PLDM_INVALID_FILE_HANDLE;
+        }
+        return PLDM_ERROR;
+    }
+
+    if (offset >= session->size)
+    {
+        release(path);
+        return PLDM_DATA_OUT_OF_RANGE;
+    }
+    if (uint64_t{offset} + length > session->size)
+    {
+        length = session->size - offset;
+    }
+
+    // Widen the kernel read-ahead while the host reads the file in order
+    bool sequential = offset != 0 && offset == session->nextRead;
+    if (sequential != session->sequential)
+    {
+        posix_fadvise(session->fd, 0, 0,
+                      sequential ? POSIX_FADV_SEQUENTIAL : POSIX_FADV_NORMAL);
+        session->sequential = sequential;
+    }
+
+    size_t currSize = response.size();
+    response.resize(currSize + length);
+    auto count = readAll(session->fd, response.data() + currSize, length,
+                         offset);
+    if (count != static_cast<ssize_t>(length))
+    {
+        error(
+            "Unable to read file '{PATH}' at offset '{OFFSET}' for length '{LENGTH}', error number - {ERROR_NUM}",
+            "PATH", path, "OFFSET", offset, "LENGTH", length, "ERROR_NUM",
+            errno);
+        response.resize(currSize);
+        close(path);
+        return PLDM_ERROR;
+    }
+    session->nextRead = uint64_t{offset} + length;
+
+    release(path);
+    return PLDM_SUCCESS;
+}
+
+int FileSessionCache::write(const fs::path& path, const char* buffer,
+                            uint32_t offset, uint32_t length, bool sync)
+{
+    auto session = getSession(path, true, true, sync);
+    if (session == nullptr)
+    {
+        return PLDM_ERROR;
+    }
+
+    // The chunk is written before it is acknowledged, so that a failure is
+    // reported to the host for the chunk which failed
+    if (!writeAll(session->fd, reinterpret_cast<const uint8_t*>(buffer),
+                  length, offset))
+    {
+        error(
+            "Failed to do file write of length '{LENGTH}' at offset '{OFFSET}' to file '{PATH}', error number - {ERROR_NUM}",
+            "LENGTH", length, "OFFSET", offset, "PATH", path, "ERROR_NUM",
+            errno);
+        close(path);
+        return PLDM_ERROR;
+    }
+    session->size =
+        std::max<uint64_t>(session->size, uint64_t{offset} + length);
+
+    release(path);
+    return PLDM_SUCCESS;
+}
+
+std::optional<uint64_t> FileSessionCache::fileSize(const fs::path& path)
+{
+    struct stat st{};
+    if (::stat(path.c_str(), &st))
+    {
+        return std::nullopt;
+    }
+    return st.st_size;
+}
+
+int FileSessionCache::acquire(const fs::path& path, bool writable)
+{
+    auto session = getSession(path, writable, false, false);
+    if (session == nullptr)
+    {
+        return -1;
+    }
+    session->sequential = false;
+    session->nextRead = 0;
+    return session->fd;
+}
+
+void FileSessionCache::release(const fs::path& path)
+{
+    if (idleTimeout.count() == 0)
+    {
+        close(path);
+    }
+}
+
+void FileSessionCache::close(const fs::path& path)
+{
+    auto it = sessions.find(path);
+    if (it != sessions.end())
+    {
+        close(it);
+    }
+}
+
+void FileSessionCache::close(std::map<fs::path, Session>::iterator it)
+{
+    ::close(it->second.fd);
+    sessions.erase(it);
+
+    if (sessions.empty() && idleTimer.isEnabled())
+    {
+        idleTimer.stop();
+    }
+}
+
+void FileSessionCache::closeIdle()
+{
+    auto now = Clock::now();
+    for (auto it = sessions.begin(); it != sessions.end();)
+    {
+        auto next = std::next(it);
+        if (now - it->second.lastAccess >= idleTimeout)
+        {
+            close(it);
+        }
+        it = next;
+    }
+}
+
+} // namespace responder
+} // namespace pldm
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "common/types.hpp"
+
+#include <sys/stat.h>
+
+#include <sdbusplus/timer.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace pldm
+{
+namespace responder
+{
+
+namespace fs = std::filesystem;
+
+/** @class FileSessionCache
+ *
+ *  @brief Keeps the files transferred by type open across the commands
+ *
+ *  The host reads and writes LIDs, VPD and PELs in small chunks, one
+ *  ReadFileByType/WriteFileByType command each, and a file handler is
+ *  created per command. The cache keeps a session per file path instead:
+ *  an open file descriptor, read with pread so that the reads see the page
+ *  cache as is, with the kernel read-ahead widened once the host reads
+ *  sequentially. The writes go to the file before the command is answered,
+ *  so that the host gets the error of the chunk which failed. The path is
+ *  checked on every access so that a file which is removed or replaced gets
+ *  reopened, and the sessions idle for longer than the idle timeout are
+ *  closed.
+ */
+class FileSessionCache
+{
+  public:
+    /** @brief Sessions kept open, the least recently used is closed first */
+    static constexpr size_t maxSessions = 16;
+
+    FileSessionCache() = delete;
+    FileSessionCache(const FileSessionCache&) = delete;
+    FileSessionCache(FileSessionCache&&) = delete;
+    FileSessionCache& operator=(const FileSessionCache&) = delete;
+    FileSessionCache& operator=(FileSessionCache&&) = delete;
+
+    /** @brief Close all the sessions */
+    ~FileSessionCache();
+
+    /** @brief Constructor
+     *
+     *  @param[in] idleTimeout - time a session is kept open without access,
+     *                           0 to close the file after each access
+     */
+    explicit FileSessionCache(std::chrono::milliseconds idleTimeout);
+
+    /** @brief Get the cache shared by the file handlers */
+    static FileSessionCache& get();
+
+    /** @brief Read a file into a PLDM response
+     *
+     *  @param[in] path - file to read from
+     *  @param[in] offset - offset to read
+     *  @param[in,out] length - length to be read, set to the length read
+     *  @param[in,out] response - PLDM response the data is appended to
+     *
+     *  @return PLDM_SUCCESS, PLDM_INVALID_FILE_HANDLE when the file does not
+     *          exist, PLDM_DATA_OUT_OF_RANGE when the offset is past the end
+     *          of the file, else PLDM_ERROR
+     */
+    int read(const fs::path& path, uint32_t offset, uint32_t& length,
+             Response& response);
+
+    /** @brief Write to a file, a new file is created
+     *
+     *  @param[in] path - file to write to
+     *  @param[in] buffer - data to be written
+     *  @param[in] offset - offset to write to
+     *  @param[in] length - length to be written
+     *  @param[in] sync - the file is opened with O_SYNC
+     *
+     *  @return PLDM_SUCCESS or PLDM_ERROR
+     */
+    int write(const fs::path& path, const char* buffer, uint32_t offset,
+              uint32_t length, bool sync = false);
+
+    /** @brief Get the size of a file
+     *
+     *  @param[in] path - the file
+     *
+     *  @return the size, std::nullopt if the file does not exist
+     */
+    std::optional<uint64_t> fileSize(const fs::path& path);
+
+    /** @brief Get the descriptor of an existing file, to access the file
+     *         directly
+     *
+     *  @param[in] path - the file
+     *  @param[in] writable - the file is written
+     *
+     *  @return the file descriptor owned by the cache, -1 if the file does
+     *          not exist or can not be opened
+     */
+    int acquire(const fs::path& path, bool writable);
+
+    /** @brief End an access to a file, the file is closed when the sessions
+     *         are not kept open
+     *
+     *  @param[in] path - the file
+     */
+    void release(const fs::path& path);
+
+    /** @brief Close the session of a file
+     *
+     *  @param[in] path - the file
+     */
+    void close(const fs::path& path);
+
+    /** @brief Close the sessions idle for longer than the idle timeout */
+    void closeIdle();
+
+    /** @brief Get the number of open sessions */
+    size_t size() const
+    {
+        return sessions.size();
+    }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    /** @struct Session
+     *
+     *  An open file and how it is accessed
+     */
+    struct Session
+    {
+        int fd = -1;
+        bool writable = false;
+        bool sync = false;
+
+        /** @brief Identity of the open file, to detect the path replaced */
+        dev_t dev = 0;
+        ino_t ino = 0;
+
+        /** @brief Size of the file */
+        uint64_t size = 0;
+
+        /** @brief Offset following the last read, to detect sequential
+         *         reads */
+        uint64_t nextRead = 0;
+        bool sequential = false;
+
+        Clock::time_point lastAccess;
+    };
+
+    /** @brief Get the session of a file, open the file when it has no
+     *         session or its path was replaced
+     *
+     *  @param[in] path - the file
+     *  @param[in] writable - the session is used to write
+     *  @param[in] create - create the file when it does not exist
+     *  @param[in] sync - the file is opened with O_SYNC
+     *
+     *  @return the session, nullptr if the file can not be opened
+     */
+    Session* getSession(const fs::path& path, bool writable, bool create,
+                        bool sync);
+
+    /** @brief Close a session */
+    void close(std::map<fs::path, Session>::iterator it);
+
+    /** @brief Time a session is kept open without access */
+    std::chrono::milliseconds idleTimeout;
+
+    /** @brief The sessions by file path */
+    std::map<fs::path, Session> sessions;
+
+    /** @brief Timer closing the idle sessions */
+    sdbusplus::Timer idleTimer;
+};
+
+} // namespace responder
+} // namespace pldm
@@ -1,18 +1,29 @@
 #include "inband_code_update.hpp"
 
+#include "file_session_cache.hpp"
 #include "libpldmresponder/pdr.hpp"
 #include "oem_ibm_handler.hpp"
 #include "xyz/openbmc_project/Common/error.hpp"
 
 #include <arpa/inet.h>
+#include <fcntl.h>
 #include <libpldm/entity.h>
+#include <sys/sendfile.h>
+#include <unistd.h>
 
 #include <phosphor-logging/lg2.hpp>
 #include <sdbusplus/server.hpp>
 #include <xyz/openbmc_project/Dump/NewDump/server.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <exception>
 #include <fstream>
+#include <optional>
 
 PHOSPHOR_LOG2_USING;
 
@@ -30,8 +41,10 @@ auto lidDirPath = fs::path(LID_STAGING_DIR) / "lid";
 /** @brief Directory where the image files are stored as they are built */
 auto imageDirPath = fs::path(LID_STAGING_DIR) / "image";
 
-/** @brief Directory where the code update tarball files are stored */
-auto updateDirPath = fs::path(LID_STAGING_DIR) / "update";
+/** @brief Directory where the code update tarball is built, on the file
+ *         system of the directory watched by the phosphor software manager
+ *         so that the tarball is moved there with a rename */
+auto tarDirPath = fs::path("/tmp") / "pldm-image";
 
 /** @brief The file name of the code update tarball */
 constexpr auto tarImageName = "image.tar";
@@ -40,7 +53,7 @@ constexpr auto tarImageName = "image.tar";
 constexpr auto hostfwImageName = "image-hostfw";
 
 /** @brief The path to the code update tarball file */
-auto tarImagePath = fs::path(imageDirPath) / tarImageName;
+auto tarImagePath = fs::path(tarDirPath) / tarImageName;
 
 /** @brief The path to the hostfw image */
 auto hostfwImagePath = fs::path(imageDirPath) / hostfwImageName;
@@ -49,6 +62,164 @@ auto hostfwImagePath = fs::path(imageDirPath) / hostfwImageName;
  *         manager */
 auto updateImagePath = fs::path("/tmp/images") / tarImageName;
 
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+/** @brief Time spent and data processed in the stages of the image assembly
+ */
+struct AssemblyStats
+{
+    Clock::duration lidTime{};
+    size_t lidCount = 0;
+    uint64_t lidBytes = 0;
+};
+
+/** @brief The stats of the LIDs received since the last assembly */
+AssemblyStats assemblyStats;
+
+/** @brief Log the time spent in a stage of the image assembly
+ *
+ *  @param[in] stage - the stage
+ *  @param[in] duration - time spent in the stage
+ */
+void reportStage(const char* stage, Clock::duration duration)
+{
+    info("Code update image assembly stage '{STAGE}' took {DURATION}ms",
+         "STAGE", stage, "DURATION",
+         std::chrono::duration_cast<std::chrono::milliseconds>(duration)
+             .count());
+}
+
+/** @brief Copy a range of a file into another one in the kernel, with
+ *         copy_file_range, or sendfile when the files can not be copied
+ *         between
+ *
+ *  @return true when the whole range is copied
+ */
+bool copyRange(int inFd, off_t inOffset, int outFd, off_t outOffset,
+               size_t length)
+{
+    bool useSendfile = false;
+    while (length > 0)
+    {
+        ssize_t rc = 0;
+        if (!useSendfile)
+        {
+            rc = copy_file_range(inFd, &inOffset, outFd, &outOffset, length,
+                                 0);
+            if (rc < 0 && (errno == EXDEV || errno == EINVAL ||
+                           errno == ENOSYS || errno == EOPNOTSUPP))
+            {
+                useSendfile = true;
+                continue;
+            }
+        }
+        else
+        {
+            if (lseek(outFd, outOffset, SEEK_SET) < 0)
+            {
+                return false;
+            }
+            rc = sendfile(outFd, inFd, &inOffset, length);
+            if (rc > 0)
+            {
+                outOffset += rc;
+            }
+        }
+
+        if (rc < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (rc <= 0)
+        {
+            return false;
+        }
+        length -= rc;
+    }
+    return true;
+}
+
+/** @brief Size of the tar blocks */
+constexpr size_t tarBlockSize = 512;
+
+/** @brief Round a size up to the tar blocks */
+constexpr uint64_t tarBlocks(uint64_t size)
+{
+    return (size + tarBlockSize - 1) / tarBlockSize * tarBlockSize;
+}
+
+/** @brief Find the end of the members of a tarball, where the blocks of zeros
+ *         ending the archive start
+ *
+ *  @return the offset, std::nullopt if the tarball is malformed
+ */
+std::optional<uint64_t> findTarEnd(int fd, uint64_t size)
+{
+    std::array<char, tarBlockSize> block{};
+    uint64_t offset = 0;
+    while (offset + tarBlockSize <= size)
+    {
+        if (pread(fd, block.data(), block.size(), offset) !=
+            static_cast<ssize_t>(block.size()))
+        {
+            return std::nullopt;
+        }
+        if (std::all_of(block.begin(), block.end(),
+                        [](char c) { return c == 0; }))
+        {
+            return offset;
+        }
+
+        // The member size is in octal at offset 124 of the header
+        std::string sizeField(block.data() + 124, 12);
+        uint64_t memberSize = 0;
+        try
+        {
+            memberSize = std::stoull(sizeField, nullptr, 8);
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+        offset += tarBlockSize + tarBlocks(memberSize);
+    }
+    return offset == size ? std::optional<uint64_t>(offset) : std::nullopt;
+}
+
+/** @brief Build the ustar header of a regular file */
+std::array<char, tarBlockSize> makeTarHeader(const std::string& name,
+                                             uint64_t size)
+{
+    std::array<char, tarBlockSize> header{};
+    std::memcpy(header.data(), name.data(), std::min<size_t>(name.size(), 99));
+    std::snprintf(header.data() + 100, 8, "%07o", 0644);
+    std::snprintf(header.data() + 108, 8, "%07o", 0);
+    std::snprintf(header.data() + 116, 8, "%07o", 0);
+    std::snprintf(header.data() + 124, 12, "%011llo",
+                  static_cast<unsigned long long>(size));
+    std::snprintf(header.data() + 136, 12, "%011llo",
+                  static_cast<unsigned long long>(std::time(nullptr)));
+    header[156] = '0';
+    std::memcpy(header.data() + 257, "ustar", 6);
+    std::memcpy(header.data() + 263, "00", 2);
+
+    // The checksum is computed with its own field set to spaces
+    std::memset(header.data() + 148, ' ', 8);
+    unsigned int checksum = 0;
+    for (auto c : header)
+    {
+        checksum += static_cast<uint8_t>(c);
+    }
+    std::snprintf(header.data() + 148, 8, "%06o", checksum);
+    header[155] = ' ';
+    return header;
+}
+
+} // namespace
+
 std::string CodeUpdate::fetchCurrentBootSide()
 {
     return currBootSide;
@@ -357,6 +528,18 @@ void CodeUpdate::clearDirPath(const std::string& dirPath)
     }
 }
 
+void CodeUpdate::clearImageStaging()
+{
+    clearDirPath(LID_STAGING_DIR);
+    std::error_code ec;
+    fs::remove_all(tarDirPath, ec);
+    if (ec)
+    {
+        error("Failed to remove '{PATH}', error - {ERROR}", "PATH",
+              tarDirPath, "ERROR", ec.message());
+    }
+}
+
 void CodeUpdate::sendStateSensorEvent(
     uint16_t sensorId, enum sensor_event_class_states sensorEventClass,
     uint8_t sensorOffset, uint8_t eventState, uint8_t prevEventState)
@@ -479,22 +662,29 @@ int processCodeUpdateLid(const std::string& filePath)
     };
     LidHeader header;
 
-    std::ifstream ifs(filePath, std::ios::in | std::ios::binary);
-    if (!ifs)
+    auto start = Clock::now();
+    auto fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
     {
-        error("Failed to opening file '{FILE}' ifstream", "PATH", filePath);
+        error("Failed to open file '{PATH}'", "PATH", filePath);
         return PLDM_ERROR;
     }
-    ifs.seekg(0);
-    ifs.read(reinterpret_cast<char*>(&header), sizeof(header));
+    pldm::utils::CustomFD lidFd(fd);
+
+    struct stat st{};
+    if (fstat(fd, &st) ||
+        pread(fd, &header, sizeof(header), 0) != sizeof(header))
+    {
+        // File is not completely written yet
+        return PLDM_SUCCESS;
+    }
 
     // File size should be the value of lid size minus the header size
-    auto fileSize = fs::file_size(filePath);
-    fileSize -= htonl(header.headerSize);
-    if (fileSize < htonl(header.lidSize))
+    uint64_t headerSize = htonl(header.headerSize);
+    uint64_t fileSize = st.st_size;
+    if (fileSize < headerSize || fileSize - headerSize < htonl(header.lidSize))
     {
         // File is not completely written yet
-        ifs.close();
         return PLDM_SUCCESS;
     }
 
@@ -502,39 +692,112 @@ int processCodeUpdateLid(const std::string& filePath)
     if (htons(header.magicNumber) != magicNumber)
     {
         error("Invalid magic number for file '{PATH}'", "PATH", filePath);
-        ifs.close();
         return PLDM_ERROR;
     }
 
-    fs::create_directories(imageDirPath);
+    fs::create_directories(tarDirPath);
     fs::create_directories(lidDirPath);
 
+    // Skip the header with an in-kernel copy of the LID data
+    fs::path outPath;
+    int outFlags = O_WRONLY | O_CREAT | O_CLOEXEC;
     constexpr auto bmcClass = 0x2000;
     if (htons(header.lidClass) == bmcClass)
     {
-        // Skip the header and concatenate the BMC LIDs into a tar file
-        std::ofstream ofs(tarImagePath,
-                          std::ios::out | std::ios::binary | std::ios::app);
-        ifs.seekg(htonl(header.headerSize));
-        ofs << ifs.rdbuf();
-        ofs.flush();
-        ofs.close();
+        // The BMC LIDs are the parts of the tarball, appended as they arrive
+        outPath = tarImagePath;
     }
     else
     {
         std::stringstream lidFileName;
         lidFileName << std::hex << htonl(header.lidNumber) << ".lid";
-        auto lidNoHeaderPath = fs::path(lidDirPath) / lidFileName.str();
-        std::ofstream ofs(lidNoHeaderPath,
-                          std::ios::out | std::ios::binary | std::ios::trunc);
-        ifs.seekg(htonl(header.headerSize));
-        ofs << ifs.rdbuf();
-        ofs.flush();
-        ofs.close();
+        outPath = fs::path(lidDirPath) / lidFileName.str();
+        outFlags |= O_TRUNC;
+    }
+
+    auto outFd = open(outPath.c_str(), outFlags, S_IRUSR | S_IWUSR);
+    if (outFd < 0)
+    {
+        error("Failed to open file '{PATH}', error number - {ERROR_NUM}",
+              "PATH", outPath, "ERROR_NUM", errno);
+        return PLDM_ERROR;
+    }
+    pldm::utils::CustomFD outLidFd(outFd);
+
+    struct stat outSt{};
+    auto length = fileSize - headerSize;
+    if (fstat(outFd, &outSt) ||
+        !copyRange(fd, headerSize, outFd, outSt.st_size, length))
+    {
+        error(
+            "Failed to copy LID '{PATH}' to '{OUT_PATH}', error number - {ERROR_NUM}",
+            "PATH", filePath, "OUT_PATH", outPath, "ERROR_NUM", errno);
+        return PLDM_ERROR;
     }
 
-    ifs.close();
+    // The LID is not read by the host anymore, free its space
+    FileSessionCache::get().close(filePath);
     fs::remove(filePath);
+
+    assemblyStats.lidTime += Clock::now() - start;
+    assemblyStats.lidCount++;
+    assemblyStats.lidBytes += length;
+    return PLDM_SUCCESS;
+}
+
+int appendTarMember(const std::string& tarPath, const std::string& name,
+                    const std::string& filePath)
+{
+    auto fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        error("Failed to open file '{PATH}', error number - {ERROR_NUM}",
+              "PATH", filePath, "ERROR_NUM", errno);
+        return PLDM_ERROR;
+    }
+    pldm::utils::CustomFD fileFd(fd);
+
+    auto tarFd = open(tarPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC,
+                      S_IRUSR | S_IWUSR);
+    if (tarFd < 0)
+    {
+        error("Failed to open tarball '{PATH}', error number - {ERROR_NUM}",
+              "PATH", tarPath, "ERROR_NUM", errno);
+        return PLDM_ERROR;
+    }
+    pldm::utils::CustomFD tarballFd(tarFd);
+
+    struct stat st{};
+    struct stat tarSt{};
+    if (fstat(fd, &st) || fstat(tarFd, &tarSt))
+    {
+        error("Failed to stat tarball '{PATH}', error number - {ERROR_NUM}",
+              "PATH", tarPath, "ERROR_NUM", errno);
+        return PLDM_ERROR;
+    }
+
+    // The member replaces the blocks of zeros ending the archive
+    auto end = findTarEnd(tarFd, tarSt.st_size);
+    if (!end)
+    {
+        error("Invalid tarball '{PATH}'", "PATH", tarPath);
+        return PLDM_ERROR;
+    }
+
+    auto header = makeTarHeader(name, st.st_size);
+    uint64_t dataOffset = *end + tarBlockSize;
+    uint64_t archiveEnd = dataOffset + tarBlocks(st.st_size);
+    if (pwrite(tarFd, header.data(), header.size(), *end) !=
+            static_cast<ssize_t>(header.size()) ||
+        !copyRange(fd, 0, tarFd, dataOffset, st.st_size) ||
+        ftruncate(tarFd, dataOffset + st.st_size) ||
+        ftruncate(tarFd, archiveEnd + 2 * tarBlockSize))
+    {
+        error(
+            "Failed to append '{PATH}' to tarball '{TAR_PATH}', error number - {ERROR_NUM}",
+            "PATH", filePath, "TAR_PATH", tarPath, "ERROR_NUM", errno);
+        return PLDM_ERROR;
+    }
     return PLDM_SUCCESS;
 }
 
@@ -547,66 +810,85 @@ int CodeUpdate::assembleCodeUpdateImage()
         pid_t nextPid = fork();
         if (nextPid == 0)
         {
-            // Create the hostfw squashfs image from the LID files without
-            // header
-            auto rc = executeCmd("/usr/sbin/mksquashfs", lidDirPath.c_str(),
-                                 hostfwImagePath.c_str(), "-all-root",
-                                 "-no-recovery");
-            if (rc < 0)
-            {
-                error("Error occurred during the mksqusquashfs call");
+            auto failUpdate = [this]() {
+                // Do not leave a partial tarball for the next update to
+                // append to
+                std::error_code ec;
+                fs::remove_all(tarDirPath, ec);
+                fs::remove_all(lidDirPath, ec);
+                fs::remove_all(imageDirPath, ec);
                 setCodeUpdateProgress(false);
                 auto sensorId = getFirmwareUpdateSensor();
                 sendStateSensorEvent(sensorId, PLDM_STATE_SENSOR_STATE, 0,
                                      uint8_t(CodeUpdateState::FAIL),
                                      uint8_t(CodeUpdateState::START));
                 exit(EXIT_FAILURE);
-            }
+            };
 
-            fs::create_directories(updateDirPath);
+            info(
+                "Assembling the code update image from {LID_COUNT} LIDs of {LID_BYTES} bytes",
+                "LID_COUNT", assemblyStats.lidCount, "LID_BYTES",
+                assemblyStats.lidBytes);
+            reportStage("lid", assemblyStats.lidTime);
+            auto assemblyStart = Clock::now();
 
-            // Extract the BMC tarball content
-            rc = executeCmd("/bin/tar", "-xf", tarImagePath.c_str(), "-C",
-                            updateDirPath);
+            // Create the hostfw squashfs image from the LID files without
+            // header
+            auto stageStart = Clock::now();
+            fs::create_directories(imageDirPath);
+            auto rc = executeCmd("/usr/sbin/mksquashfs", lidDirPath.c_str(),
+                                 hostfwImagePath.c_str(), "-all-root",
+                                 "-no-recovery");
             if (rc < 0)
             {
-                setCodeUpdateProgress(false);
-                auto sensorId = getFirmwareUpdateSensor();
-                sendStateSensorEvent(sensorId, PLDM_STATE_SENSOR_STATE, 0,
-                                     uint8_t(CodeUpdateState::FAIL),
-                                     uint8_t(CodeUpdateState::START));
-                exit(EXIT_FAILURE);
+                error("Error occurred during the mksqusquashfs call");
+                failUpdate();
             }
-
-            // Add the hostfw image to the directory where the contents were
-            // extracted
-            fs::copy_file(hostfwImagePath,
-                          fs::path(updateDirPath) / hostfwImageName,
-                          fs::copy_options::overwrite_existing);
-
-            // Remove the tarball file, then re-generate it with so that the
-            // hostfw image becomes part of the tarball
-            fs::remove(tarImagePath);
-            rc = executeCmd("/bin/tar", "-cf", tarImagePath, ".", "-C",
-                            updateDirPath);
-            if (rc < 0)
+            reportStage("squashfs", Clock::now() - stageStart);
+
+            // Append the hostfw image to the tarball of the BMC LIDs, in
+            // place of extracting and re-generating the tarball
+            stageStart = Clock::now();
+            fs::create_directories(tarDirPath);
+            rc = appendTarMember(tarImagePath, hostfwImageName,
+                                 hostfwImagePath);
+            if (rc != PLDM_SUCCESS)
             {
                 error("Error occurred during the generation of the tarball");
-                setCodeUpdateProgress(false);
-                auto sensorId = getFirmwareUpdateSensor();
-                sendStateSensorEvent(sensorId, PLDM_STATE_SENSOR_STATE, 0,
-                                     uint8_t(CodeUpdateState::FAIL),
-                                     uint8_t(CodeUpdateState::START));
-                exit(EXIT_FAILURE);
+                failUpdate();
             }
-
-            // Copy the tarball to the update directory to trigger the phosphor
-            // software manager to create a version interface
-            fs::copy_file(tarImagePath, updateImagePath,
-                          fs::copy_options::overwrite_existing);
+            reportStage("tarball", Clock::now() - stageStart);
+
+            // Move the tarball to the update directory to trigger the
+            // phosphor software manager to create a version interface
+            stageStart = Clock::now();
+            std::error_code ec;
+            fs::rename(tarImagePath, updateImagePath, ec);
+            if (ec)
+            {
+                // Not on the same file system, copy the tarball instead
+                fs::copy_file(tarImagePath, updateImagePath,
+                              fs::copy_options::overwrite_existing, ec);
+                if (ec)
+                {
+                    error(
+                        "Failed to move the tarball to '{PATH}', error - {ERROR}",
+                        "PATH", updateImagePath, "ERROR", ec.message());
+                    failUpdate();
+                }
+            }
+            else
+            {
+                // The software manager is notified of the files closed after
+                // being written, which a rename is not
+                pldm::utils::CustomFD notifyFd(
+                    open(updateImagePath.c_str(), O_WRONLY | O_CLOEXEC));
+            }
+            reportStage("publish", Clock::now() - stageStart);
+            reportStage("total", Clock::now() - assemblyStart);
 
             // Cleanup
-            fs::remove_all(updateDirPath);
+            fs::remove_all(tarDirPath);
             fs::remove_all(lidDirPath);
             fs::remove_all(imageDirPath);
 
@@ -625,6 +907,9 @@ int CodeUpdate::assembleCodeUpdateImage()
     }
     else if (pid > 0)
     {
+        // The next update starts with a new set of LIDs
+        assemblyStats = {};
+
         int status;
         if (waitpid(pid, &status, 0) < 0)
         {
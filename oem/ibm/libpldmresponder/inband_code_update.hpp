@@ -103,6 +103,13 @@ class CodeUpdate
      */
     void clearDirPath(const std::string& dirPath);
 
+    /** @brief Method to discard the image of an unfinished code update, the
+     *  LID staging directory and the partially built tarball, so that the
+     *  next update does not append to it.
+     *  @return none
+     */
+    void clearImageStaging();
+
     /* @brief Method to set the RequestApplyTime D-Bus property
      *        on start update to OnReset
      * @return - Completion codes
@@ -233,5 +240,15 @@ int setBootSide(uint16_t entityInstance, uint8_t currState,
  */
 int processCodeUpdateLid(const std::string& filePath);
 
+/* @brief Method to append a file to a tarball, in place of the blocks ending
+ *        the archive, so that the tarball is built without being extracted
+ * @param[in] tarPath - Path to the tarball, created if it does not exist
+ * @param[in] name - Name of the file in the tarball
+ * @param[in] filePath - Path to the file to be appended
+ * @return - PLDM_SUCCESS codes
+ */
+int appendTarMember(const std::string& tarPath, const std::string& name,
+                    const std::string& filePath);
+
 } // namespace responder
 } // namespace pldm
@@ -92,6 +92,8 @@ int pldm::responder::oem_ibm_platform::Handler::
                 if (stateField[currState].effecter_state ==
                     uint8_t(CodeUpdateState::START))
                 {
+                    // The LIDs of the new update start a new tarball
+                    codeUpdate->clearImageStaging();
                     codeUpdate->setCodeUpdateProgress(true);
                     startUpdateEvent =
                         std::make_unique<sdeventplus::source::Defer>(
@@ -118,7 +120,7 @@ int pldm::responder::oem_ibm_platform::Handler::
                          uint8_t(CodeUpdateState::ABORT))
                 {
                     codeUpdate->setCodeUpdateProgress(false);
-                    codeUpdate->clearDirPath(LID_STAGING_DIR);
+                    codeUpdate->clearImageStaging();
                     auto sensorId = codeUpdate->getFirmwareUpdateSensor();
                     sendStateSensorEvent(sensorId, PLDM_STATE_SENSOR_STATE, 0,
                                          uint8_t(CodeUpdateState::ABORT),
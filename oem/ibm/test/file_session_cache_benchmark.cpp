@@ -0,0 +1,105 @@
+#include "libpldmresponder/file_session_cache.hpp"
+#include "oem/ibm/test/file_session_cache_test.hpp"
+
+#include <fcntl.h>
+#include <libpldm/base.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+using namespace pldm;
+using namespace pldm::responder;
+using namespace std::chrono_literals;
+
+/** @brief Replay of a host LID download and upload in ReadFileByType and
+ *         WriteFileByType chunks, comparing a file opened for each chunk as
+ *         done before the cache with the cached sessions
+ */
+TEST_F(TestFileSessionCache, benchmarkLidReplay)
+{
+    constexpr size_t lidSize = 8 * 1024 * 1024;
+    constexpr uint32_t chunkSize = 4096;
+    auto lidPath = dir / "81e00640.lid";
+    auto content = makeContent(lidSize, 9);
+    writeContent(lidPath, content);
+
+    using Clock = std::chrono::steady_clock;
+    auto chunks = lidSize / chunkSize;
+
+    // Download, a stream opened for every chunk
+    Response baseline;
+    auto start = Clock::now();
+    for (uint32_t offset = 0; offset < lidSize; offset += chunkSize)
+    {
+        ASSERT_TRUE(fs::exists(lidPath));
+        size_t fileSize = fs::file_size(lidPath);
+        uint32_t length = std::min<size_t>(chunkSize, fileSize - offset);
+        size_t currSize = baseline.size();
+        baseline.resize(currSize + length);
+        std::ifstream stream(lidPath, std::ios::in | std::ios::binary);
+        stream.seekg(offset);
+        stream.read(reinterpret_cast<char*>(baseline.data() + currSize),
+                    length);
+    }
+    auto openReadTime = Clock::now() - start;
+
+    FileSessionCache cache(5000ms);
+    Response cached;
+    start = Clock::now();
+    for (uint32_t offset = 0; offset < lidSize; offset += chunkSize)
+    {
+        uint32_t length = chunkSize;
+        ASSERT_EQ(cache.read(lidPath, offset, length, cached), PLDM_SUCCESS);
+    }
+    auto cachedReadTime = Clock::now() - start;
+    EXPECT_EQ(baseline, content);
+    EXPECT_EQ(cached, content);
+
+    // Upload, the file opened and seeked for every chunk
+    auto uploadPath = dir / "81e00641.lid";
+    start = Clock::now();
+    for (uint32_t offset = 0; offset < lidSize; offset += chunkSize)
+    {
+        int flags = O_RDWR;
+        if (!fs::exists(uploadPath))
+        {
+            flags = O_WRONLY | O_CREAT | O_TRUNC | O_SYNC;
+        }
+        auto fd = open(uploadPath.c_str(), flags, S_IRUSR | S_IWUSR);
+        ASSERT_NE(fd, -1);
+        ASSERT_EQ(lseek(fd, offset, SEEK_SET), static_cast<off_t>(offset));
+        ASSERT_EQ(::write(fd, &content[offset], chunkSize),
+                  static_cast<ssize_t>(chunkSize));
+        close(fd);
+    }
+    auto openWriteTime = Clock::now() - start;
+    EXPECT_EQ(readContent(uploadPath), content);
+    fs::remove(uploadPath);
+
+    start = Clock::now();
+    for (uint32_t offset = 0; offset < lidSize; offset += chunkSize)
+    {
+        ASSERT_EQ(cache.write(uploadPath,
+                              reinterpret_cast<const char*>(&content[offset]),
+                              offset, chunkSize, true),
+                  PLDM_SUCCESS);
+    }
+    auto cachedWriteTime = Clock::now() - start;
+    EXPECT_EQ(readContent(uploadPath), content);
+
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    auto perChunk = [chunks](auto time) {
+        return static_cast<int>(duration_cast<nanoseconds>(time).count() /
+                                chunks);
+    };
+    RecordProperty("chunks", static_cast<int>(chunks));
+    RecordProperty("openReadNsPerChunk", perChunk(openReadTime));
+    RecordProperty("cachedReadNsPerChunk", perChunk(cachedReadTime));
+    RecordProperty("openWriteNsPerChunk", perChunk(openWriteTime));
+    RecordProperty("cachedWriteNsPerChunk", perChunk(cachedWriteTime));
+}
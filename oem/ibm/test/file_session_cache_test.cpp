@@ -0,0 +1,132 @@
+#include "libpldmresponder/file_session_cache.hpp"
+#include "oem/ibm/test/file_session_cache_test.hpp"
+
+#include <libpldm/base.h>
+#include <libpldm/oem/ibm/file_io.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm;
+using namespace pldm::responder;
+using namespace std::chrono_literals;
+
+TEST_F(TestFileSessionCache, readSequential)
+{
+    auto path = dir / "81e0066b.lid";
+    auto content = makeContent(100000, 7);
+    writeContent(path, content);
+
+    FileSessionCache cache(5000ms);
+    Response response;
+    uint32_t offset = 0;
+    while (offset < content.size())
+    {
+        uint32_t length = 4096;
+        ASSERT_EQ(cache.read(path, offset, length, response), PLDM_SUCCESS);
+        offset += length;
+    }
+    EXPECT_EQ(response, content);
+    EXPECT_EQ(cache.size(), 1);
+
+    uint32_t length = 10;
+    EXPECT_EQ(cache.read(path, offset, length, response),
+              PLDM_DATA_OUT_OF_RANGE);
+    EXPECT_EQ(cache.read(dir / "missing", 0, length, response),
+              PLDM_INVALID_FILE_HANDLE);
+    EXPECT_EQ(cache.read({}, 0, length, response), PLDM_INVALID_FILE_HANDLE);
+}
+
+TEST_F(TestFileSessionCache, readReplacedFile)
+{
+    auto path = dir / "pel";
+    writeContent(path, makeContent(64, 1));
+
+    FileSessionCache cache(5000ms);
+    Response response;
+    uint32_t length = 64;
+    ASSERT_EQ(cache.read(path, 0, length, response), PLDM_SUCCESS);
+
+    // A file renamed over the path is read instead of the open one
+    auto newContent = makeContent(32, 2);
+    writeContent(dir / "pel.new", newContent);
+    fs::rename(dir / "pel.new", path);
+
+    response.clear();
+    length = 64;
+    ASSERT_EQ(cache.read(path, 0, length, response), PLDM_SUCCESS);
+    EXPECT_EQ(length, newContent.size());
+    EXPECT_EQ(response, newContent);
+
+    fs::remove(path);
+    EXPECT_EQ(cache.read(path, 0, length, response), PLDM_INVALID_FILE_HANDLE);
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST_F(TestFileSessionCache, writeThrough)
+{
+    auto path = dir / "81e00664.lid";
+    auto content = makeContent(3000, 3);
+
+    FileSessionCache cache(5000ms);
+    EXPECT_FALSE(cache.fileSize(path));
+    for (uint32_t offset = 0; offset < 2000; offset += 500)
+    {
+        ASSERT_EQ(cache.write(path,
+                              reinterpret_cast<const char*>(&content[offset]),
+                              offset, 500, true),
+                  PLDM_SUCCESS);
+        // Each chunk is in the file once acknowledged
+        EXPECT_EQ(fs::file_size(path), offset + 500);
+    }
+    EXPECT_EQ(cache.fileSize(path), 2000);
+    EXPECT_EQ(cache.size(), 1);
+
+    // The O_SYNC session is kept for the reads and the next writes
+    Response response;
+    uint32_t length = 3000;
+    ASSERT_EQ(cache.read(path, 0, length, response), PLDM_SUCCESS);
+    EXPECT_EQ(length, 2000);
+    EXPECT_TRUE(std::equal(response.begin(), response.end(), content.begin()));
+
+    ASSERT_EQ(cache.write(path, reinterpret_cast<const char*>(&content[2000]),
+                          2000, 1000, true),
+              PLDM_SUCCESS);
+    EXPECT_EQ(readContent(path), content);
+    EXPECT_EQ(cache.size(), 1);
+
+    // A chunk which can not be written fails itself
+    EXPECT_EQ(cache.write(dir / "missing" / "81e00665.lid",
+                          reinterpret_cast<const char*>(content.data()), 0,
+                          500, true),
+              PLDM_ERROR);
+}
+
+TEST_F(TestFileSessionCache, closeIdle)
+{
+    auto path = dir / "vpd";
+    auto content = makeContent(100, 5);
+
+    FileSessionCache cache(1ms);
+    ASSERT_EQ(cache.write(path, reinterpret_cast<const char*>(content.data()),
+                          0, content.size()),
+              PLDM_SUCCESS);
+    EXPECT_EQ(cache.size(), 1);
+
+    std::this_thread::sleep_for(5ms);
+    cache.closeIdle();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(readContent(path), content);
+
+    // The files are closed after each access without idle timeout
+    FileSessionCache uncached(0ms);
+    Response response;
+    uint32_t length = 100;
+    ASSERT_EQ(uncached.read(path, 0, length, response), PLDM_SUCCESS);
+    EXPECT_EQ(uncached.size(), 0);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdlib.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+inline std::vector<uint8_t> makeContent(size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> content(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        content[i] = static_cast<uint8_t>(i * 31 + seed);
+    }
+    return content;
+}
+
+inline void writeContent(const std::filesystem::path& path,
+                         const std::vector<uint8_t>& content)
+{
+    std::ofstream stream(path, std::ios::out | std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(content.data()),
+                 content.size());
+}
+
+inline std::vector<uint8_t> readContent(const std::filesystem::path& path)
+{
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+    return {std::istreambuf_iterator<char>(stream),
+            std::istreambuf_iterator<char>()};
+}
+
+class TestFileSessionCache : public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/pldm_file_session.XXXXXX";
+        dir = std::filesystem::path(mkdtemp(tmpdir));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(dir);
+    }
+
+    std::filesystem::path dir;
+};
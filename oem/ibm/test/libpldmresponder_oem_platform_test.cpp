@@ -223,6 +223,62 @@ TEST(clearDirPath, testClearDirPath)
     ASSERT_EQ(stat(dirPath, &buffer), 0);
 }
 
+TEST(clearImageStaging, testClearImageStaging)
+{
+    fs::path tarPath("/tmp/pldm-image/image.tar");
+    fs::create_directories(tarPath.parent_path());
+    std::ofstream(tarPath) << std::string(512, 'a');
+    ASSERT_TRUE(fs::exists(tarPath));
+
+    auto mockDbusHandler = std::make_unique<MockdBusHandler>();
+    std::unique_ptr<CodeUpdate> mockCodeUpdate =
+        std::make_unique<MockCodeUpdate>(mockDbusHandler.get());
+
+    // An aborted update leaves no partial tarball to append to
+    mockCodeUpdate->clearImageStaging();
+    EXPECT_FALSE(fs::exists(tarPath));
+    EXPECT_FALSE(fs::exists(tarPath.parent_path()));
+}
+
+TEST(appendTarMember, testAppend)
+{
+    fs::path dir("/tmp/testTarAppend");
+    fs::create_directories(dir);
+    auto tarPath = dir / "image.tar";
+    auto bmcPath = dir / "image-bmc";
+    auto hostfwPath = dir / "image-hostfw";
+    std::string bmcData(1000, 'a');
+    std::string hostfwData(10, 'b');
+    std::ofstream(bmcPath) << bmcData;
+    std::ofstream(hostfwPath) << hostfwData;
+
+    ASSERT_EQ(appendTarMember(tarPath, "image-bmc", bmcPath), PLDM_SUCCESS);
+    EXPECT_EQ(fs::file_size(tarPath), 512 + 1024 + 1024);
+
+    // The second member replaces the end of the archive
+    ASSERT_EQ(appendTarMember(tarPath, "image-hostfw", hostfwPath),
+              PLDM_SUCCESS);
+    EXPECT_EQ(fs::file_size(tarPath), 512 + 1024 + 512 + 512 + 1024);
+
+    std::ifstream tar(tarPath, std::ios::binary);
+    std::string content{std::istreambuf_iterator<char>(tar),
+                        std::istreambuf_iterator<char>()};
+    EXPECT_STREQ(content.c_str(), "image-bmc");
+    EXPECT_EQ(content.substr(257, 5), "ustar");
+    EXPECT_EQ(content.substr(512, bmcData.size()), bmcData);
+    EXPECT_STREQ(content.c_str() + 1536, "image-hostfw");
+    EXPECT_EQ(content.substr(2048, hostfwData.size()), hostfwData);
+    EXPECT_EQ(content.find_first_not_of('\0', 2048 + hostfwData.size()),
+              std::string::npos);
+
+    // A file which is not a tarball is not appended to
+    std::ofstream(tarPath) << std::string(512, 'x');
+    EXPECT_EQ(appendTarMember(tarPath, "image-hostfw", hostfwPath),
+              PLDM_ERROR);
+
+    fs::remove_all(dir);
+}
+
 TEST(generateStateEffecterOEMPDR, testGoodRequest)
 {
     const AssociatedEntityMap associateMap = {};
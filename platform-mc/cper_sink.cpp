@@ -0,0 +1,330 @@
+#include "cper_sink.hpp"
+
+#include "common/utils.hpp"
+
+#include <fcntl.h>
+#include <libpldm/platform.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <variant>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+bool CperSink::push(pldm_tid_t tid, const std::string& terminusName,
+                    uint8_t formatType, std::span<const uint8_t> data)
+{
+    auto now = Clock::now();
+    stats.received++;
+
+    // Copies are checked first so that they do not use up the rate limit
+    auto hash = recordHash(tid, formatType, data);
+    if (isDuplicate(hash, tid, formatType, data, now))
+    {
+        stats.duplicates++;
+        unreportedDrops++;
+        reportDrops(now);
+        return false;
+    }
+
+    if (!takeToken(tid, now))
+    {
+        stats.rateLimited++;
+        unreportedDrops++;
+        reportDrops(now);
+        return false;
+    }
+
+    if (queue.size() >= maxQueueDepth)
+    {
+        stats.overflows++;
+        unreportedDrops++;
+        reportDrops(now);
+        return false;
+    }
+
+    // Only the accepted records are copies to drop, a record dropped over
+    // the limits is accepted once it is resent
+    rememberRecord(hash, tid, formatType, data, now);
+    queue.emplace_back(terminusName, formatType,
+                       std::vector<uint8_t>(data.begin(), data.end()));
+    stats.queueDepth = queue.size();
+    stats.maxQueueDepth = std::max(stats.maxQueueDepth, stats.queueDepth);
+
+    if (!queueEvent)
+    {
+        queueEvent = std::make_unique<sdeventplus::source::Defer>(
+            event, std::bind(std::mem_fn(&CperSink::processQueue), this,
+                             std::placeholders::_1));
+    }
+    return true;
+}
+
+bool CperSink::takeToken(pldm_tid_t tid, Clock::time_point now)
+{
+    auto capacity = static_cast<double>(rateLimit);
+    auto [bucket, inserted] =
+        tokenBuckets.try_emplace(tid, TokenBucket{capacity, now});
+    if (!inserted)
+    {
+        std::chrono::duration<double> elapsed = now - bucket->second.lastRefill;
+        bucket->second.tokens = std::min(
+            capacity, bucket->second.tokens + elapsed.count() * capacity);
+        bucket->second.lastRefill = now;
+    }
+
+    if (bucket->second.tokens < 1)
+    {
+        return false;
+    }
+    bucket->second.tokens -= 1;
+    return true;
+}
+
+size_t CperSink::recordHash(pldm_tid_t tid, uint8_t formatType,
+                            std::span<const uint8_t> data) const
+{
+    std::string_view bytes(reinterpret_cast<const char*>(data.data()),
+                           data.size());
+    return std::hash<std::string_view>{}(bytes) ^
+           ((static_cast<size_t>(tid) << 8 | formatType) *
+            0x9e3779b97f4a7c15ULL);
+}
+
+std::unordered_multimap<size_t, CperSink::RecentRecord>::iterator
+    CperSink::findRecent(size_t hash, pldm_tid_t tid, uint8_t formatType,
+                         std::span<const uint8_t> data)
+{
+    auto [first, last] = recentRecords.equal_range(hash);
+    auto record = std::find_if(first, last, [&](const auto& recent) {
+        return recent.second.tid == tid &&
+               recent.second.formatType == formatType &&
+               std::ranges::equal(recent.second.data, data);
+    });
+    return record == last ? recentRecords.end() : record;
+}
+
+bool CperSink::isDuplicate(size_t hash, pldm_tid_t tid, uint8_t formatType,
+                           std::span<const uint8_t> data,
+                           Clock::time_point now)
+{
+    auto record = findRecent(hash, tid, formatType, data);
+    return record != recentRecords.end() &&
+           now - record->second.firstSeen < dedupWindow;
+}
+
+void CperSink::rememberRecord(size_t hash, pldm_tid_t tid, uint8_t formatType,
+                              std::span<const uint8_t> data,
+                              Clock::time_point now)
+{
+    // The window bounds the map, the expired entries are dropped when it
+    // grows past the number of records accepted within a window
+    if (recentRecords.size() > maxQueueDepth)
+    {
+        std::erase_if(recentRecords, [this, now](const auto& record) {
+            return now - record.second.firstSeen >= dedupWindow;
+        });
+    }
+
+    auto record = findRecent(hash, tid, formatType, data);
+    if (record != recentRecords.end())
+    {
+        record->second.firstSeen = now;
+        return;
+    }
+    recentRecords.emplace(
+        hash, RecentRecord{tid, formatType,
+                           std::vector<uint8_t>(data.begin(), data.end()),
+                           now});
+}
+
+void CperSink::reportDrops(Clock::time_point now)
+{
+    if (now - lastDropReport < std::chrono::seconds(1))
+    {
+        return;
+    }
+
+    lg2::error(
+        "Dropped {COUNT} CPER records, {DUPLICATES} duplicates, {RATELIMITED} over the rate limit and {OVERFLOWS} on a full queue in total.",
+        "COUNT", unreportedDrops, "DUPLICATES", stats.duplicates,
+        "RATELIMITED", stats.rateLimited, "OVERFLOWS", stats.overflows);
+    unreportedDrops = 0;
+    lastDropReport = now;
+}
+
+void CperSink::processQueue(sdeventplus::source::EventBase& /*source*/)
+{
+    queueEvent.reset();
+
+    for (size_t count = 0; count < batchSize && !queue.empty(); ++count)
+    {
+        auto record = std::move(queue.front());
+        queue.pop_front();
+
+        auto path = spool(record);
+        if (path.empty())
+        {
+            stats.spoolFailures++;
+            continue;
+        }
+        stats.spooled++;
+
+        auto dataType =
+            record.formatType == PLDM_PLATFORM_CPER_EVENT_WITH_HEADER
+                ? "CPER"
+                : "CPERSection";
+        dumpQueue.emplace_back(dataType, std::move(path),
+                               std::move(record.terminusName));
+    }
+    stats.queueDepth = queue.size();
+
+    startDumps();
+
+    // Leave the other event sources a chance to run between the batches
+    if (!queue.empty())
+    {
+        queueEvent = std::make_unique<sdeventplus::source::Defer>(
+            event, std::bind(std::mem_fn(&CperSink::processQueue), this,
+                             std::placeholders::_1));
+    }
+}
+
+std::string CperSink::spool(const Record& record)
+{
+    std::error_code ec;
+    if (!std::filesystem::exists(spoolDir, ec))
+    {
+        std::filesystem::create_directory(spoolDir, ec);
+        if (ec)
+        {
+            lg2::error("Failed to create {DIR} directory: {ERROR}", "DIR",
+                       spoolDir.string(), "ERROR", ec.message());
+            return {};
+        }
+    }
+
+    std::string fileName{(spoolDir / "cper-XXXXXX").string()};
+    auto fd = mkostemp(fileName.data(), O_CLOEXEC);
+    if (fd < 0)
+    {
+        lg2::error("Failed to generate temp file, error {ERRORNO}", "ERRORNO",
+                   std::strerror(errno));
+        return {};
+    }
+
+    size_t written = 0;
+    while (written < record.data.size())
+    {
+        auto rc = write(fd, record.data.data() + written,
+                        record.data.size() - written);
+        if (rc < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (rc <= 0)
+        {
+            lg2::error("Failed to save CPER to '{FILENAME}', error {ERRORNO}.",
+                       "FILENAME", fileName, "ERRORNO", std::strerror(errno));
+            close(fd);
+            unlink(fileName.c_str());
+            return {};
+        }
+        written += rc;
+    }
+    close(fd);
+
+    return fileName;
+}
+
+void CperSink::startDumps()
+{
+    while (!dumpQueue.empty() && dumpsInFlight < maxDumpsInFlight)
+    {
+        auto entry = std::move(dumpQueue.front());
+        dumpQueue.pop_front();
+
+        if (!createDumpEntry(nextDumpId++, entry))
+        {
+            stats.dumpFailures++;
+            continue;
+        }
+        dumpsInFlight++;
+    }
+    stats.dumpsPending = dumpQueue.size() + dumpsInFlight;
+}
+
+bool CperSink::createDumpEntry(uint64_t id, const DumpEntry& entry)
+{
+    static constexpr auto dumpObjPath = "/xyz/openbmc_project/dump/faultlog";
+    static constexpr auto dumpInterface = "xyz.openbmc_project.Dump.Create";
+    auto& bus = pldm::utils::DBusHandler::getBus();
+
+    try
+    {
+        if (dumpService.empty())
+        {
+            dumpService = pldm::utils::DBusHandler().getService(dumpObjPath,
+                                                                dumpInterface);
+        }
+        auto method = bus.new_method_call(dumpService.c_str(), dumpObjPath,
+                                          dumpInterface, "CreateDump");
+        std::map<std::string, std::variant<std::string, uint64_t>> addData;
+        addData["Type"] = entry.dataType;
+        addData["PrimaryLogId"] = entry.path;
+        addData["AdditionalTypeName"] = entry.terminusName;
+        method.append(addData);
+
+        dumpCalls.emplace(
+            id, bus.call_async(
+                    method,
+                    [this, id](sdbusplus::message_t reply) {
+                        if (reply.is_method_error())
+                        {
+                            dumpService.clear();
+                            lg2::error(
+                                "Failed to create D-Bus Dump entry, error - {ERROR}.",
+                                "ERROR", reply.get_error()->message);
+                        }
+                        dumpCreated(id, !reply.is_method_error());
+                    },
+                    pldm::utils::dbusTimeout));
+    }
+    catch (const std::exception& e)
+    {
+        dumpService.clear();
+        lg2::error("Failed to create D-Bus Dump entry, error - {ERROR}.",
+                   "ERROR", e);
+        return false;
+    }
+    return true;
+}
+
+void CperSink::dumpCreated(uint64_t id, bool success)
+{
+    if (success)
+    {
+        stats.dumpsCreated++;
+    }
+    else
+    {
+        stats.dumpFailures++;
+    }
+    dumpsInFlight--;
+    startDumps();
+
+    // Releases the completed call, this is the last use of its callback
+    dumpCalls.erase(id);
+}
+
+} // namespace platform_mc
+} // namespace pldm
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <libpldm/base.h>
+
+#include <sdbusplus/slot.hpp>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/event.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @brief Queue depths and counters of the CPER sink */
+struct CperSinkStats
+{
+    /** @brief CPER records handed to the sink */
+    uint64_t received = 0;
+    /** @brief Records dropped as copies of a recent record */
+    uint64_t duplicates = 0;
+    /** @brief Records dropped over the rate limit of their terminus */
+    uint64_t rateLimited = 0;
+    /** @brief Records dropped because the spool queue was full */
+    uint64_t overflows = 0;
+    /** @brief Records written to a spool file */
+    uint64_t spooled = 0;
+    /** @brief Records which could not be written */
+    uint64_t spoolFailures = 0;
+    /** @brief Dump entries created */
+    uint64_t dumpsCreated = 0;
+    /** @brief Dump entries which could not be created */
+    uint64_t dumpFailures = 0;
+    /** @brief Records waiting to be written */
+    size_t queueDepth = 0;
+    /** @brief Highest number of records waiting to be written */
+    size_t maxQueueDepth = 0;
+    /** @brief Written records waiting for their dump entry to be created */
+    size_t dumpsPending = 0;
+};
+
+/**
+ * @brief CperSink
+ *
+ * Writes the CPER records received from the termini to spool files and
+ * creates a fault log dump entry for each of them. Records are queued by
+ * push() and written in batches from the event loop, the dump entries are
+ * created with asynchronous D-Bus calls so a burst of CPER events does not
+ * block the other event sources. Copies of a record received within the
+ * deduplication window and records over the rate limit of their terminus
+ * are dropped and counted.
+ */
+class CperSink
+{
+  public:
+    CperSink() = delete;
+    CperSink(const CperSink&) = delete;
+    CperSink(CperSink&&) = delete;
+    CperSink& operator=(const CperSink&) = delete;
+    CperSink& operator=(CperSink&&) = delete;
+    virtual ~CperSink() = default;
+
+    /** @brief Constructor
+     *
+     *  @param[in] event - event loop the records are written from
+     *  @param[in] spoolDir - directory of the spool files
+     */
+    CperSink(sdeventplus::Event event, const std::filesystem::path& spoolDir) :
+        event(std::move(event)), spoolDir(spoolDir)
+    {}
+
+    /** @brief Queue a CPER record
+     *
+     *  @param[in] tid - TID of the terminus which sent the record
+     *  @param[in] terminusName - name of the terminus
+     *  @param[in] formatType - CPER event format type
+     *  @param[in] data - CPER record
+     *
+     *  @return true if the record is queued, false if it is dropped
+     */
+    bool push(pldm_tid_t tid, const std::string& terminusName,
+              uint8_t formatType, std::span<const uint8_t> data);
+
+    /** @brief Get the queue depths and counters */
+    const CperSinkStats& getStats() const
+    {
+        return stats;
+    }
+
+    /** @brief Maximum number of records written per event loop iteration */
+    size_t batchSize = 16;
+
+    /** @brief Maximum number of records waiting to be written */
+    size_t maxQueueDepth = 1024;
+
+    /** @brief Sustained number of records per second accepted from a
+     *         terminus, a terminus can burst up to this many records
+     */
+    size_t rateLimit = 64;
+
+    /** @brief Copies of a record received within this window are dropped */
+    std::chrono::milliseconds dedupWindow = std::chrono::seconds(10);
+
+    /** @brief Maximum number of outstanding CreateDump calls */
+    size_t maxDumpsInFlight = 8;
+
+  protected:
+    /** @brief Dump entry of a spooled record */
+    struct DumpEntry
+    {
+        std::string dataType;
+        std::string path;
+        std::string terminusName;
+    };
+
+    /** @brief Start the asynchronous creation of a dump entry, dumpCreated()
+     *         is called once the entry is created
+     *
+     *  @param[in] id - identifier of the dump entry request
+     *  @param[in] entry - the dump entry
+     *
+     *  @return true if the request is sent
+     */
+    virtual bool createDumpEntry(uint64_t id, const DumpEntry& entry);
+
+    /** @brief Completion of a dump entry request
+     *
+     *  @param[in] id - identifier of the dump entry request
+     *  @param[in] success - whether the dump entry is created
+     */
+    void dumpCreated(uint64_t id, bool success);
+
+    /** @brief Hash of a record for the deduplication, the records sharing a
+     *         hash are told apart by their content
+     */
+    virtual size_t recordHash(pldm_tid_t tid, uint8_t formatType,
+                              std::span<const uint8_t> data) const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief A record waiting to be written */
+    struct Record
+    {
+        std::string terminusName;
+        uint8_t formatType;
+        std::vector<uint8_t> data;
+    };
+
+    /** @brief Rate limiting state of a terminus */
+    struct TokenBucket
+    {
+        double tokens;
+        Clock::time_point lastRefill;
+    };
+
+    /** @brief Check the rate limit of a terminus and take a token */
+    bool takeToken(pldm_tid_t tid, Clock::time_point now);
+
+    /** @brief A record accepted within the deduplication window */
+    struct RecentRecord
+    {
+        pldm_tid_t tid;
+        uint8_t formatType;
+        std::vector<uint8_t> data;
+        Clock::time_point firstSeen;
+    };
+
+    /** @brief Find the recent record a record is a copy of */
+    std::unordered_multimap<size_t, RecentRecord>::iterator findRecent(
+        size_t hash, pldm_tid_t tid, uint8_t formatType,
+        std::span<const uint8_t> data);
+
+    /** @brief Check if a record is a copy of a record accepted within the
+     *         deduplication window
+     */
+    bool isDuplicate(size_t hash, pldm_tid_t tid, uint8_t formatType,
+                     std::span<const uint8_t> data, Clock::time_point now);
+
+    /** @brief Remember an accepted record for the deduplication */
+    void rememberRecord(size_t hash, pldm_tid_t tid, uint8_t formatType,
+                        std::span<const uint8_t> data, Clock::time_point now);
+
+    /** @brief Log the number of dropped records, at most once per second */
+    void reportDrops(Clock::time_point now);
+
+    /** @brief Write a batch of queued records, run from the event loop */
+    void processQueue(sdeventplus::source::EventBase& source);
+
+    /** @brief Write a record to a new spool file
+     *
+     *  @return the spool file path, empty on failure
+     */
+    std::string spool(const Record& record);
+
+    /** @brief Send dump entry requests up to maxDumpsInFlight */
+    void startDumps();
+
+    sdeventplus::Event event;
+    std::filesystem::path spoolDir;
+
+    CperSinkStats stats;
+
+    /** @brief Records waiting to be written */
+    std::deque<Record> queue;
+
+    /** @brief Deferred write of the queued records */
+    std::unique_ptr<sdeventplus::source::Defer> queueEvent;
+
+    /** @brief Dump entries waiting to be requested */
+    std::deque<DumpEntry> dumpQueue;
+
+    /** @brief Number of outstanding dump entry requests */
+    size_t dumpsInFlight = 0;
+
+    /** @brief Identifier of the next dump entry request */
+    uint64_t nextDumpId = 0;
+
+    /** @brief Outstanding CreateDump calls */
+    std::map<uint64_t, sdbusplus::slot_t> dumpCalls;
+
+    /** @brief Cached service name of the dump manager */
+    std::string dumpService;
+
+    /** @brief Rate limiting state per terminus */
+    std::unordered_map<pldm_tid_t, TokenBucket> tokenBuckets;
+
+    /** @brief The recently accepted records by hash */
+    std::unordered_multimap<size_t, RecentRecord> recentRecords;
+
+    /** @brief Dropped records not yet reported and the last report time */
+    uint64_t unreportedDrops = 0;
+    Clock::time_point lastDropReport{};
+};
+
+} // namespace platform_mc
+} // namespace pldm
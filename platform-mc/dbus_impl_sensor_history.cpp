@@ -0,0 +1,69 @@
+#include "dbus_impl_sensor_history.hpp"
+
+#include <sdbusplus/exception.hpp>
+#include <sdbusplus/message.hpp>
+
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace pldm
+{
+namespace dbus_api
+{
+
+const sdbusplus::vtable_t SensorHistoryIntf::vtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::method("GetSensorHistories", "a(yq)t", "a(yqatad)",
+                              SensorHistoryIntf::getSensorHistories),
+    sdbusplus::vtable::end()};
+
+SensorHistoryIntf::SensorHistoryIntf(
+    sdbusplus::bus_t& bus, const std::string& path,
+    std::shared_ptr<pldm::platform_mc::SensorHistoryRegion> region) :
+    region(std::move(region)),
+    serverInterface(bus, path.c_str(), interface, vtable, this)
+{}
+
+int SensorHistoryIntf::getSensorHistories(sd_bus_message* msg, void* context,
+                                          sd_bus_error* error)
+{
+    auto self = static_cast<SensorHistoryIntf*>(context);
+    try
+    {
+        auto m = sdbusplus::message_t(msg);
+        std::vector<std::tuple<uint8_t, uint16_t>> sensors{};
+        uint64_t since = 0;
+        m.read(sensors, since);
+
+        std::vector<std::pair<pldm_tid_t, uint16_t>> keys{};
+        keys.reserve(sensors.size());
+        for (const auto& [tid, sensorId] : sensors)
+        {
+            keys.emplace_back(tid, sensorId);
+        }
+
+        std::vector<std::tuple<uint8_t, uint16_t, std::vector<uint64_t>,
+                               std::vector<double>>>
+            histories{};
+        for (auto& samples : self->region->read(keys, since))
+        {
+            histories.emplace_back(samples.tid, samples.sensorId,
+                                   std::move(samples.timestamps),
+                                   std::move(samples.values));
+        }
+
+        auto reply = m.new_method_return();
+        reply.append(histories);
+        reply.method_return();
+    }
+    catch (const sdbusplus::exception_t& e)
+    {
+        return sd_bus_error_set(error, e.name(), e.description());
+    }
+
+    return 1;
+}
+
+} // namespace dbus_api
+} // namespace pldm
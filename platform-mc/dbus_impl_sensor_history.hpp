@@ -0,0 +1,65 @@
+#pragma once
+
+#include "sensor_history.hpp"
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/interface.hpp>
+#include <sdbusplus/vtable.hpp>
+
+#include <memory>
+#include <string>
+
+namespace pldm
+{
+namespace dbus_api
+{
+
+/** @class SensorHistoryIntf
+ *  @brief D-Bus interface returning the reading histories of the numeric
+ *         sensors.
+ *  @details org.openbmc.pldm.SensorHistory is private to pldm, it is not
+ *           defined in phosphor-dbus-interfaces and may change with pldmd.
+ *           It has a single method,
+ *           GetSensorHistories(a(yq) sensors, t since) -> a(yqatad). It
+ *           takes the terminus and sensor IDs of the sensors, an empty list
+ *           for all the sensors, and returns the terminus ID, sensor ID,
+ *           timestamps and values of the readings of each sensor taken
+ *           after since, in usec since the epoch.
+ */
+class SensorHistoryIntf
+{
+  public:
+    SensorHistoryIntf() = delete;
+    SensorHistoryIntf(const SensorHistoryIntf&) = delete;
+    SensorHistoryIntf& operator=(const SensorHistoryIntf&) = delete;
+    SensorHistoryIntf(SensorHistoryIntf&&) = delete;
+    SensorHistoryIntf& operator=(SensorHistoryIntf&&) = delete;
+    virtual ~SensorHistoryIntf() = default;
+
+    /** @brief Constructor to put object onto bus at a dbus path.
+     *  @param[in] bus - Bus to attach to.
+     *  @param[in] path - Path to attach at.
+     *  @param[in] region - the sensor histories
+     */
+    SensorHistoryIntf(
+        sdbusplus::bus_t& bus, const std::string& path,
+        std::shared_ptr<pldm::platform_mc::SensorHistoryRegion> region);
+
+    static constexpr auto interface = "org.openbmc.pldm.SensorHistory";
+
+  private:
+    /** @brief Handler of the GetSensorHistories method */
+    static int getSensorHistories(sd_bus_message* msg, void* context,
+                                  sd_bus_error* error);
+
+    static const sdbusplus::vtable_t vtable[];
+
+    /** @brief The sensor histories */
+    std::shared_ptr<pldm::platform_mc::SensorHistoryRegion> region;
+
+    /** @brief The registered interface */
+    sdbusplus::server::interface_t serverInterface;
+};
+
+} // namespace dbus_api
+} // namespace pldm
@@ -9,6 +9,8 @@
 #include <xyz/openbmc_project/State/OperatingSystem/Status/server.hpp>
 
 #include <fstream>
+#include <functional>
+#include <utility>
 
 PHOSPHOR_LOG2_USING;
 
@@ -286,19 +288,67 @@ void HostEffecterParser::processHostEffecterChangeNotification(
         return;
     }
 
-    std::vector<set_effecter_state_field> stateField;
-    for (uint8_t i = 0; i < hostEffecterInfo[effecterInfoIndex].compEffecterCnt;
-         i++)
+    queueStateEffecter(effecterInfoIndex, dbusInfoIndex, effecterId, newState);
+}
+
+void HostEffecterParser::queueStateEffecter(
+    size_t effecterInfoIndex, size_t dbusInfoIndex, uint16_t effecterId,
+    uint8_t newState)
+{
+    auto [it, inserted] = pendingStateEffecters.try_emplace(
+        std::make_pair(effecterInfoIndex, effecterId),
+        hostEffecterInfo[effecterInfoIndex].compEffecterCnt,
+        set_effecter_state_field{PLDM_NO_CHANGE, 0});
+    if (!inserted)
+    {
+        debounceCounters.suppressed++;
+    }
+
+    auto& stateField = it->second;
+    if (dbusInfoIndex < stateField.size())
+    {
+        stateField[dbusInfoIndex] = {PLDM_REQUEST_SET, newState};
+    }
+
+    if (debounceWindow == std::chrono::milliseconds::zero())
+    {
+        flushStateEffecters();
+        return;
+    }
+
+    if (!debounceTimer.isRunning())
     {
-        if (i == dbusInfoIndex)
+        try
         {
-            stateField.push_back({PLDM_REQUEST_SET, newState});
+            debounceTimer.start(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    debounceWindow));
         }
-        else
+        catch (const std::runtime_error& e)
         {
-            stateField.push_back({PLDM_NO_CHANGE, 0});
+            error(
+                "Failed to start the effecter debounce timer, error - {ERROR}",
+                "ERROR", e);
+            flushStateEffecters();
         }
     }
+}
+
+void HostEffecterParser::flushStateEffecters()
+{
+    auto pending = std::exchange(pendingStateEffecters, {});
+    for (auto& [key, stateField] : pending)
+    {
+        const auto& [effecterInfoIndex, effecterId] = key;
+        sendStateEffecter(effecterInfoIndex, effecterId, stateField);
+    }
+}
+
+void HostEffecterParser::sendStateEffecter(
+    size_t effecterInfoIndex, uint16_t effecterId,
+    std::vector<set_effecter_state_field>& stateField)
+{
+    debounceCounters.sent++;
     int rc{};
     try
     {
@@ -7,7 +7,11 @@
 #include "requester/handler.hpp"
 
 #include <phosphor-logging/lg2.hpp>
+#include <sdbusplus/timer.hpp>
+#include <sdeventplus/event.hpp>
 
+#include <chrono>
+#include <map>
 #include <string>
 #include <utility>
 #include <vector>
@@ -99,16 +103,20 @@ class HostEffecterParser
      *  @param[in] dbusHandler - D-bus Handler
      *  @param[in] jsonPath - path for the json file
      *  @param[in] handler - PLDM request handler
+     *  @param[in] platformManager - MC Platform manager
+     *  @param[in] event - reference of the main event loop
      */
     explicit HostEffecterParser(
         pldm::InstanceIdDb* instanceIdDb, int fd, const pldm_pdr* repo,
         pldm::utils::DBusHandler* const dbusHandler,
         const std::string& jsonPath,
         pldm::requester::Handler<pldm::requester::Request>* handler,
-        platform_mc::Manager* platformManager) :
+        platform_mc::Manager* platformManager, sdeventplus::Event& event) :
         instanceIdDb(instanceIdDb), sockFd(fd), pdrRepo(repo),
         dbusHandler(dbusHandler), handler(handler),
-        platformManager(platformManager)
+        platformManager(platformManager),
+        debounceTimer(event.get(),
+                      std::bind(&HostEffecterParser::flushStateEffecters, this))
     {
         try
         {
@@ -230,7 +238,39 @@ class HostEffecterParser
     double adjustValue(double value, double offset, double resolution,
                        int8_t modify);
 
+    /* @brief Queue a new state of a host state effecter until the debounce
+     *        window expires. The states of the composite effecters changed
+     *        within the window are merged in a single request and a pending
+     *        state of the same composite effecter is replaced.
+     *
+     * @param[in] effecterInfoIndex - index of effecterInfo in hostEffecterInfo
+     * @param[in] dbusInfoIndex - index of dbusInfo within effecterInfo
+     * @param[in] effecterId - host effecter id
+     * @param[in] newState - new state of the composite effecter
+     */
+    void queueStateEffecter(size_t effecterInfoIndex, size_t dbusInfoIndex,
+                            uint16_t effecterId, uint8_t newState);
+
+    /* @brief Send the pending host state effecter requests */
+    void flushStateEffecters();
+
+    /* @brief Get the number of effecter requests sent and suppressed */
+    const DebounceCounters& getDebounceCounters() const
+    {
+        return debounceCounters;
+    }
+
   private:
+    /* @brief Set a host state effecter and log the failures
+     *
+     * @param[in] effecterInfoIndex - index of effecterInfo in hostEffecterInfo
+     * @param[in] effecterId - host effecter id
+     * @param[in] stateField - vector of state fields equal to composite
+     *                         effecter count in number
+     */
+    void sendStateEffecter(size_t effecterInfoIndex, uint16_t effecterId,
+                           std::vector<set_effecter_state_field>& stateField);
+
     /* @brief Verify host On state before configure the host effecters
      *
      * @return - true if host is on and false for others cases
@@ -252,6 +292,21 @@ class HostEffecterParser
 
     /** @brief MC Platform manager*/
     platform_mc::Manager* platformManager = nullptr;
+
+    /** @brief time the D-Bus property changes are merged for */
+    std::chrono::milliseconds debounceWindow{DBUS_EVENT_DEBOUNCE_WINDOW};
+
+    /** @brief pending state fields keyed by effecterInfo index and effecter
+     *         id
+     */
+    std::map<std::pair<size_t, uint16_t>, std::vector<set_effecter_state_field>>
+        pendingStateEffecters;
+
+    /** @brief timer flushing the pending effecter requests */
+    sdbusplus::Timer debounceTimer;
+
+    /** @brief effecter requests sent and suppressed */
+    DebounceCounters debounceCounters;
 };
 
 } // namespace host_effecters
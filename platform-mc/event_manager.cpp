@@ -8,7 +8,6 @@
 #include <phosphor-logging/lg2.hpp>
 #include <xyz/openbmc_project/Logging/Entry/server.hpp>
 
-#include <cerrno>
 #include <memory>
 
 PHOSPHOR_LOG2_USING;
@@ -125,7 +124,22 @@ int EventManager::processNumericSensorEvent(pldm_tid_t tid, uint16_t sensorId,
         return rc;
     }
 
-    double value = static_cast<double>(presentReading);
+    double value = 0;
+    switch (sensorDataSize)
+    {
+        case PLDM_SENSOR_DATA_SIZE_SINT8:
+            value = static_cast<int8_t>(presentReading);
+            break;
+        case PLDM_SENSOR_DATA_SIZE_SINT16:
+            value = static_cast<int16_t>(presentReading);
+            break;
+        case PLDM_SENSOR_DATA_SIZE_SINT32:
+            value = static_cast<int32_t>(presentReading);
+            break;
+        default:
+            value = static_cast<double>(presentReading);
+            break;
+    }
     lg2::error(
         "processNumericSensorEvent tid {TID}, sensorID {SID} value {VAL} previousState {PSTATE} eventState {ESTATE}",
         "TID", tid, "SID", sensorId, "VAL", value, "PSTATE", previousEventState,
@@ -149,6 +163,12 @@ int EventManager::processNumericSensorEvent(pldm_tid_t tid, uint16_t sensorId,
         return PLDM_ERROR;
     }
 
+    sensor->updateFromEvent(eventState, value);
+    if (sensorManager)
+    {
+        sensorManager->recordReading(*sensor);
+    }
+
     switch (previousEventState)
     {
         case PLDM_SENSOR_UNKNOWN:
@@ -392,96 +412,10 @@ int EventManager::processCperEvent(pldm_tid_t tid, uint16_t eventId,
         return PLDM_ERROR;
     }
 
-    // Save event data to file
-    std::filesystem::path dirName{"/var/cper"};
-    if (!std::filesystem::exists(dirName))
-    {
-        try
-        {
-            std::filesystem::create_directory(dirName);
-        }
-        catch (const std::filesystem::filesystem_error& e)
-        {
-            lg2::error("Failed to create /var/cper directory: {ERROR}", "ERROR",
-                       e);
-            return PLDM_ERROR;
-        }
-    }
-
-    std::string fileName{dirName.string() + "/cper-XXXXXX"};
-    auto fd = mkstemp(fileName.data());
-    if (fd < 0)
-    {
-        lg2::error("Failed to generate temp file, error {ERRORNO}", "ERRORNO",
-                   std::strerror(errno));
-        return PLDM_ERROR;
-    }
-    close(fd);
-
-    std::ofstream ofs;
-    ofs.exceptions(std::ofstream::failbit | std::ofstream::badbit |
-                   std::ofstream::eofbit);
-
-    try
-    {
-        ofs.open(fileName);
-        ofs.write(reinterpret_cast<const char*>(
-                      pldm_platform_cper_event_event_data(cperEvent)),
-                  cperEvent->event_data_length);
-        if (cperEvent->format_type == PLDM_PLATFORM_CPER_EVENT_WITH_HEADER)
-        {
-            rc = createCperDumpEntry("CPER", fileName, terminusName);
-        }
-        else
-        {
-            rc = createCperDumpEntry("CPERSection", fileName, terminusName);
-        }
-        ofs.close();
-    }
-    catch (const std::ofstream::failure& e)
-    {
-        lg2::error("Failed to save CPER to '{FILENAME}', error - {ERROR}.",
-                   "FILENAME", fileName, "ERROR", e);
-        return PLDM_ERROR;
-    }
-    return rc;
-}
-
-int EventManager::createCperDumpEntry(const std::string& dataType,
-                                      const std::string& dataPath,
-                                      const std::string& typeName)
-{
-    auto createDump =
-        [](std::map<std::string, std::variant<std::string, uint64_t>>&
-               addData) {
-            static constexpr auto dumpObjPath =
-                "/xyz/openbmc_project/dump/faultlog";
-            static constexpr auto dumpInterface =
-                "xyz.openbmc_project.Dump.Create";
-            auto& bus = pldm::utils::DBusHandler::getBus();
-
-            try
-            {
-                auto service = pldm::utils::DBusHandler().getService(
-                    dumpObjPath, dumpInterface);
-                auto method = bus.new_method_call(service.c_str(), dumpObjPath,
-                                                  dumpInterface, "CreateDump");
-                method.append(addData);
-                bus.call_noreply(method);
-            }
-            catch (const std::exception& e)
-            {
-                lg2::error(
-                    "Failed to create D-Bus Dump entry, error - {ERROR}.",
-                    "ERROR", e);
-            }
-        };
-
-    std::map<std::string, std::variant<std::string, uint64_t>> addData;
-    addData["Type"] = dataType;
-    addData["PrimaryLogId"] = dataPath;
-    addData["AdditionalTypeName"] = typeName;
-    createDump(addData);
+    // The record is written and its dump entry created from the event loop
+    cperSink.push(tid, terminusName, cperEvent->format_type,
+                  std::span(pldm_platform_cper_event_event_data(cperEvent),
+                            cperEvent->event_data_length));
     return PLDM_SUCCESS;
 }
 
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "common/types.hpp"
+#include "cper_sink.hpp"
 #include "numeric_sensor.hpp"
 #include "requester/handler.hpp"
+#include "sensor_manager.hpp"
 #include "terminus.hpp"
 #include "terminus_manager.hpp"
 
@@ -39,9 +41,19 @@ class EventManager
     EventManager& operator=(EventManager&&) = delete;
     virtual ~EventManager() = default;
 
+    /** @brief Constructor
+     *
+     *  @param[in] terminusManager - reference of the terminus manager
+     *  @param[in] termini - the discovered termini
+     *  @param[in] sensorManager - sensor manager recording the readings of
+     *                             the sensor events, nullptr to record none
+     */
     explicit EventManager(TerminusManager& terminusManager,
-                          TerminiMapper& termini) :
-        terminusManager(terminusManager), termini(termini)
+                          TerminiMapper& termini,
+                          SensorManager* sensorManager = nullptr) :
+        terminusManager(terminusManager), termini(termini),
+        sensorManager(sensorManager),
+        cperSink(sdeventplus::Event::get_default(), "/var/cper")
     {
         // Default response handler for PollForPlatFormEventMessage
         registerPolledEventHandler(
@@ -97,6 +109,12 @@ class EventManager
         return availableState[tid];
     };
 
+    /** @brief Get the queue depths and counters of the CPER sink */
+    const CperSinkStats& getCperSinkStats() const
+    {
+        return cperSink.getStats();
+    }
+
     /** @brief A Coroutine to poll all events from terminus
      *
      *  @param[in] tid - the destination TID
@@ -149,18 +167,6 @@ class EventManager
                                  const uint8_t* eventData,
                                  const size_t eventDataSize);
 
-    /** @brief Helper method to create CPER dump log
-     *
-     *  @param[in] dataType - CPER event data type
-     *  @param[in] dataPath - CPER event data fault log file path
-     *  @param[in] typeName - Terminus name which creates CPER event
-     *
-     *  @return PLDM completion code
-     */
-    int createCperDumpEntry(const std::string& dataType,
-                            const std::string& dataPath,
-                            const std::string& typeName);
-
     /** @brief Send pollForPlatformEventMessage and return response
      *
      *  @param[in] tid - Destination TID
@@ -226,11 +232,17 @@ class EventManager
     /** @brief List of discovered termini */
     TerminiMapper& termini;
 
+    /** @brief Sensor manager recording the readings of the sensor events */
+    SensorManager* sensorManager;
+
     /** @brief Available state for pldm request of terminus */
     std::unordered_map<pldm_tid_t, Availability> availableState;
 
     /** @brief map of PLDM event type of polled event to EventHandlers */
     pldm::platform_mc::EventMap eventHandlers;
+
+    /** @brief Spools the CPER records and creates their dump entries */
+    CperSink cperSink;
 };
 } // namespace platform_mc
 } // namespace pldm
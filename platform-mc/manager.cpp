@@ -8,6 +8,24 @@ namespace pldm
 {
 namespace platform_mc
 {
+namespace
+{
+
+/** @brief Remove the terminus from the polled termini at the end of its poll
+ */
+struct EventPollingGuard
+{
+    std::set<pldm_tid_t>& polling;
+    pldm_tid_t tid;
+
+    ~EventPollingGuard()
+    {
+        polling.erase(tid);
+    }
+};
+
+} // namespace
+
 exec::task<int> Manager::beforeDiscoverTerminus()
 {
     // Add any setup or checks needed before discovering a terminus
@@ -35,14 +53,27 @@ exec::task<int> Manager::pollForPlatformEvent(
     pldm_tid_t tid, uint16_t /* pollEventId */, uint32_t pollDataTransferHandle)
 {
     auto it = termini.find(tid);
-    if (it != termini.end())
+    if (it == termini.end())
     {
-        auto& terminus = it->second;
-        co_await eventManager.pollForPlatformEventTask(tid,
-                                                       pollDataTransferHandle);
-        terminus->pollEvent = false;
+        co_return PLDM_SUCCESS;
     }
-    co_return PLDM_SUCCESS;
+
+    // The poll request of the terminus is kept for the next sensor polling
+    // cycle, a pldmMessagePollEvent may arrive after the running poll read
+    // the events
+    auto terminus = it->second;
+    if (!eventPollingTermini.insert(tid).second)
+    {
+        co_return PLDM_SUCCESS;
+    }
+
+    // The poll may be stopped when the terminus becomes unavailable
+    EventPollingGuard guard{eventPollingTermini, tid};
+
+    auto rc = co_await eventManager.pollForPlatformEventTask(
+        tid, pollDataTransferHandle);
+    terminus->pollEvent = false;
+    co_return rc;
 }
 
 exec::task<int> Manager::oemPollForPlatformEvent(pldm_tid_t tid)
@@ -2,6 +2,7 @@
 
 #include "common/instance_id.hpp"
 #include "common/types.hpp"
+#include "dbus_impl_sensor_history.hpp"
 #include "event_manager.hpp"
 #include "platform_manager.hpp"
 #include "requester/handler.hpp"
@@ -11,6 +12,12 @@
 
 #include <libpldm/pldm.h>
 
+#include <phosphor-logging/lg2.hpp>
+
+#include <exception>
+#include <memory>
+#include <set>
+
 namespace pldm
 {
 namespace platform_mc
@@ -18,6 +25,8 @@ namespace platform_mc
 
 using PollHandler = std::function<exec::task<int>(pldm_tid_t tid)>;
 using PollHandlers = std::vector<PollHandler>;
+using RemovedTerminusHandler = std::function<void(pldm_tid_t tid)>;
+using RemovedTerminusHandlers = std::vector<RemovedTerminusHandler>;
 
 /**
  * @brief Manager
@@ -38,11 +47,33 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
     explicit Manager(sdeventplus::Event& event, RequesterHandler& handler,
                      pldm::InstanceIdDb& instanceIdDb) :
         terminusManager(event, handler, instanceIdDb, termini, this,
-                        pldm::BmcMctpEid),
-        platformManager(terminusManager, termini, this),
-        sensorManager(event, terminusManager, termini, this),
-        eventManager(terminusManager, termini)
-    {}
+                        pldm::BmcMctpEid, TERMINUS_SNAPSHOT_DIR),
+        platformManager(terminusManager, termini, this,
+                        TERMINUS_SNAPSHOT_DIR),
+        historyRegion(SensorHistoryRegion::create(sensorHistoryShmName,
+                                                  SENSOR_HISTORY_SENSORS,
+                                                  SENSOR_HISTORY_DEPTH)),
+        sensorManager(event, terminusManager, termini, this, historyRegion),
+        eventManager(terminusManager, termini, &sensorManager)
+    {
+        if (!historyRegion)
+        {
+            return;
+        }
+
+        try
+        {
+            historyIntf = std::make_unique<pldm::dbus_api::SensorHistoryIntf>(
+                pldm::utils::DBusHandler::getBus(),
+                "/xyz/openbmc_project/pldm", historyRegion);
+        }
+        catch (const std::exception& e)
+        {
+            lg2::error(
+                "Failed to export the sensor histories on D-Bus. Exception: {EXCEPTION}",
+                "EXCEPTION", e);
+        }
+    }
 
     /** @brief Helper function to do the actions before discovering terminus
      *
@@ -123,6 +154,14 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
         }
     }
 
+    /** @brief Helper function to get the available state of the terminus TID
+     *         for the PLDM requests, false once its sensor polling stopped
+     */
+    bool getAvailableState(pldm_tid_t tid)
+    {
+        return termini.contains(tid) && sensorManager.getAvailableState(tid);
+    }
+
     /** @brief Helper function to stop sensor polling of the terminus TID
      */
     void stopSensorPolling(pldm_tid_t tid)
@@ -130,6 +169,18 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
         sensorManager.stopPolling(tid);
     }
 
+    /** @brief Helper function to stop sensor polling of the removed terminus
+     *         TID and invoke the registered OEM handlers
+     */
+    void handleRemovedTerminus(pldm_tid_t tid)
+    {
+        sensorManager.stopPolling(tid);
+        for (auto& handler : removedTerminusHandlers)
+        {
+            handler(tid);
+        }
+    }
+
     /** @brief Sensor event handler function
      *
      *  @param[in] request - Event message
@@ -199,7 +250,10 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
         return PLDM_SUCCESS;
     }
 
-    /** @brief The function to trigger the event polling
+    /** @brief The function to trigger the event polling. A call for a
+     *         terminus whose events are already being polled returns at once
+     *         and leaves its poll request set, it is retried on the next
+     *         sensor polling cycle.
      *
      *  @param[in] tid - Terminus ID
      *  @param[in] pollEventId - The source eventID from pldmMessagePollEvent
@@ -255,6 +309,15 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
      */
     exec::task<int> oemPollForPlatformEvent(pldm_tid_t tid);
 
+    /** @brief Register OEM flow to clean up the state of a removed terminus
+     *
+     *  @param[in] handler - Removed terminus handler
+     */
+    void registerOEMRemovedTerminusHandler(RemovedTerminusHandler handler)
+    {
+        removedTerminusHandlers.push_back(std::move(handler));
+    }
+
     /** @brief Get Active EIDs.
      *
      *  @param[in] addr - MCTP address of terminus
@@ -276,14 +339,27 @@ class Manager : public pldm::MctpDiscoveryHandlerIntf
     /** @brief Platform interface for calling the hook functions */
     PlatformManager platformManager;
 
+    /** @brief Reading histories of the sensors, in the shared memory object
+     *         read by the other processes */
+    std::shared_ptr<SensorHistoryRegion> historyRegion;
+
     /** @brief Store platform manager handler */
     SensorManager sensorManager;
 
+    /** @brief D-Bus interface of the reading histories */
+    std::unique_ptr<pldm::dbus_api::SensorHistoryIntf> historyIntf;
+
     /** @brief Store event manager handler */
     EventManager eventManager;
 
     /** @brief map of PLDM event type to EventHandlers */
     PollHandlers pollHandlers;
+
+    /** @brief OEM handlers of the removed termini */
+    RemovedTerminusHandlers removedTerminusHandlers;
+
+    /** @brief The termini whose events are being polled */
+    std::set<pldm_tid_t> eventPollingTermini;
 };
 } // namespace platform_mc
 } // namespace pldm
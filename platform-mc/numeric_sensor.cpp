@@ -7,6 +7,7 @@
 
 #include <limits>
 #include <regex>
+#include <utility>
 
 PHOSPHOR_LOG2_USING;
 
@@ -15,6 +16,20 @@ namespace pldm
 namespace platform_mc
 {
 
+/** @brief Create a D-Bus interface of a sensor object without announcing it,
+ *         the object is announced once all of its interfaces are populated
+ *
+ *  @param[in] bus - D-Bus connection
+ *  @param[in] path - object path
+ *  @return the interface
+ */
+template <typename Intf>
+inline std::unique_ptr<Intf> makeDeferredIntf(sdbusplus::bus_t& bus,
+                                              const std::string& path)
+{
+    return std::make_unique<Intf>(bus, path.c_str(), Intf::action::defer_emit);
+}
+
 inline bool NumericSensor::createInventoryPath(
     const std::string& associationPath, const std::string& sensorName,
     const uint16_t entityType, const uint16_t entityInstanceNum,
@@ -24,7 +39,7 @@ inline bool NumericSensor::createInventoryPath(
     std::string invPath = associationPath + "/" + sensorName;
     try
     {
-        entityIntf = std::make_unique<EntityIntf>(bus, invPath.c_str());
+        entityIntf = makeDeferredIntf<EntityIntf>(bus, invPath);
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -33,9 +48,9 @@ inline bool NumericSensor::createInventoryPath(
             "PATH", invPath, "ERROR", e);
         return false;
     }
-    entityIntf->entityType(entityType);
-    entityIntf->entityInstanceNumber(entityInstanceNum);
-    entityIntf->containerID(containerId);
+    entityIntf->entityType(entityType, true);
+    entityIntf->entityInstanceNumber(entityInstanceNum, true);
+    entityIntf->containerID(containerId, true);
 
     return true;
 }
@@ -194,7 +209,7 @@ NumericSensor::NumericSensor(
     try
     {
         associationDefinitionsIntf =
-            std::make_unique<AssociationDefinitionsInft>(bus, path.c_str());
+            makeDeferredIntf<AssociationDefinitionsInft>(bus, path);
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -205,7 +220,7 @@ NumericSensor::NumericSensor(
     }
 
     associationDefinitionsIntf->associations(
-        {{"chassis", "all_sensors", associationPath}});
+        {{"chassis", "all_sensors", associationPath}}, true);
 
     double maxValue =
         getSensorDataValue(pdr->sensor_data_size, pdr->max_readable);
@@ -267,7 +282,7 @@ NumericSensor::NumericSensor(
     {
         try
         {
-            valueIntf = std::make_unique<ValueIntf>(bus, path.c_str());
+            valueIntf = makeDeferredIntf<ValueIntf>(bus, path);
         }
         catch (const sdbusplus::exception_t& e)
         {
@@ -277,15 +292,15 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        valueIntf->maxValue(unitModifier(conversionFormula(maxValue)));
-        valueIntf->minValue(unitModifier(conversionFormula(minValue)));
-        valueIntf->unit(sensorUnit);
+        valueIntf->maxValue(unitModifier(conversionFormula(maxValue)), true);
+        valueIntf->minValue(unitModifier(conversionFormula(minValue)), true);
+        valueIntf->unit(sensorUnit, true);
     }
     else
     {
         try
         {
-            metricIntf = std::make_unique<MetricIntf>(bus, path.c_str());
+            metricIntf = makeDeferredIntf<MetricIntf>(bus, path);
         }
         catch (const sdbusplus::exception_t& e)
         {
@@ -295,9 +310,9 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        metricIntf->maxValue(unitModifier(conversionFormula(maxValue)));
-        metricIntf->minValue(unitModifier(conversionFormula(minValue)));
-        metricIntf->unit(metricUnit);
+        metricIntf->maxValue(unitModifier(conversionFormula(maxValue)), true);
+        metricIntf->minValue(unitModifier(conversionFormula(minValue)), true);
+        metricIntf->unit(metricUnit, true);
     }
 
     hysteresis = unitModifier(conversionFormula(hysteresis));
@@ -310,8 +325,7 @@ NumericSensor::NumericSensor(
 
     try
     {
-        availabilityIntf =
-            std::make_unique<AvailabilityIntf>(bus, path.c_str());
+        availabilityIntf = makeDeferredIntf<AvailabilityIntf>(bus, path);
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -320,12 +334,12 @@ NumericSensor::NumericSensor(
             "PATH", path, "ERROR", e);
         throw sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument();
     }
-    availabilityIntf->available(true);
+    availabilityIntf->available(true, true);
 
     try
     {
         operationalStatusIntf =
-            std::make_unique<OperationalStatusIntf>(bus, path.c_str());
+            makeDeferredIntf<OperationalStatusIntf>(bus, path);
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -334,14 +348,14 @@ NumericSensor::NumericSensor(
             "PATH", path, "ERROR", e);
         throw sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument();
     }
-    operationalStatusIntf->functional(!sensorDisabled);
+    operationalStatusIntf->functional(!sensorDisabled, true);
 
     if (hasWarningThresholds && !useMetricInterface)
     {
         try
         {
             thresholdWarningIntf =
-                std::make_unique<ThresholdWarningIntf>(bus, path.c_str());
+                makeDeferredIntf<ThresholdWarningIntf>(bus, path);
         }
         catch (const sdbusplus::exception_t& e)
         {
@@ -351,8 +365,8 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        thresholdWarningIntf->warningHigh(unitModifier(warningHigh));
-        thresholdWarningIntf->warningLow(unitModifier(warningLow));
+        thresholdWarningIntf->warningHigh(unitModifier(warningHigh), true);
+        thresholdWarningIntf->warningLow(unitModifier(warningLow), true);
     }
 
     if (hasCriticalThresholds && !useMetricInterface)
@@ -360,7 +374,7 @@ NumericSensor::NumericSensor(
         try
         {
             thresholdCriticalIntf =
-                std::make_unique<ThresholdCriticalIntf>(bus, path.c_str());
+                makeDeferredIntf<ThresholdCriticalIntf>(bus, path);
         }
         catch (const sdbusplus::exception_t& e)
         {
@@ -370,9 +384,11 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        thresholdCriticalIntf->criticalHigh(unitModifier(criticalHigh));
-        thresholdCriticalIntf->criticalLow(unitModifier(criticalLow));
+        thresholdCriticalIntf->criticalHigh(unitModifier(criticalHigh), true);
+        thresholdCriticalIntf->criticalLow(unitModifier(criticalLow), true);
     }
+
+    emitObjectAdded();
 }
 
 NumericSensor::NumericSensor(
@@ -418,7 +434,7 @@ NumericSensor::NumericSensor(
     try
     {
         associationDefinitionsIntf =
-            std::make_unique<AssociationDefinitionsInft>(bus, path.c_str());
+            makeDeferredIntf<AssociationDefinitionsInft>(bus, path);
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -428,7 +444,7 @@ NumericSensor::NumericSensor(
         throw sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument();
     }
     associationDefinitionsIntf->associations(
-        {{"chassis", "all_sensors", associationPath.c_str()}});
+        {{"chassis", "all_sensors", associationPath.c_str()}}, true);
 
     double maxValue = std::numeric_limits<double>::quiet_NaN();
     double minValue = std::numeric_limits<double>::quiet_NaN();
@@ -478,7 +494,7 @@ NumericSensor::NumericSensor(
     {
         try
         {
-            valueIntf = std::make_unique<ValueIntf>(bus, path.c_str());
+            valueIntf = makeDeferredIntf<ValueIntf>(bus, path);
         }
         catch (const sdbusplus::exception_t& e)
         {
@@ -488,15 +504,15 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        valueIntf->maxValue(unitModifier(conversionFormula(maxValue)));
-        valueIntf->minValue(unitModifier(conversionFormula(minValue)));
-        valueIntf->unit(sensorUnit);
+        valueIntf->maxValue(unitModifier(conversionFormula(maxValue)), true);
+        valueIntf->minValue(unitModifier(conversionFormula(minValue)), true);
+        valueIntf->unit(sensorUnit, true);
     }
     else
     {
         try
         {
-            metricIntf = std::make_unique<MetricIntf>(bus, path.c_str());
+            metricIntf = makeDeferredIntf<MetricIntf>(bus, path);
         }
         catch (const sdbusplus::exception_t& e)
         {
@@ -506,9 +522,9 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        metricIntf->maxValue(unitModifier(conversionFormula(maxValue)));
-        metricIntf->minValue(unitModifier(conversionFormula(minValue)));
-        metricIntf->unit(metricUnit);
+        metricIntf->maxValue(unitModifier(conversionFormula(maxValue)), true);
+        metricIntf->minValue(unitModifier(conversionFormula(minValue)), true);
+        metricIntf->unit(metricUnit, true);
     }
 
     hysteresis = unitModifier(conversionFormula(hysteresis));
@@ -521,8 +537,7 @@ NumericSensor::NumericSensor(
 
     try
     {
-        availabilityIntf =
-            std::make_unique<AvailabilityIntf>(bus, path.c_str());
+        availabilityIntf = makeDeferredIntf<AvailabilityIntf>(bus, path);
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -531,12 +546,12 @@ NumericSensor::NumericSensor(
             "PATH", path, "ERROR", e);
         throw sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument();
     }
-    availabilityIntf->available(true);
+    availabilityIntf->available(true, true);
 
     try
     {
         operationalStatusIntf =
-            std::make_unique<OperationalStatusIntf>(bus, path.c_str());
+            makeDeferredIntf<OperationalStatusIntf>(bus, path);
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -545,14 +560,14 @@ NumericSensor::NumericSensor(
             "PATH", path, "ERROR", e);
         throw sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument();
     }
-    operationalStatusIntf->functional(!sensorDisabled);
+    operationalStatusIntf->functional(!sensorDisabled, true);
 
     if (hasWarningThresholds && !useMetricInterface)
     {
         try
         {
             thresholdWarningIntf =
-                std::make_unique<ThresholdWarningIntf>(bus, path.c_str());
+                makeDeferredIntf<ThresholdWarningIntf>(bus, path);
         }
         catch (const sdbusplus::exception_t& e)
         {
@@ -562,8 +577,8 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        thresholdWarningIntf->warningHigh(unitModifier(warningHigh));
-        thresholdWarningIntf->warningLow(unitModifier(warningLow));
+        thresholdWarningIntf->warningHigh(unitModifier(warningHigh), true);
+        thresholdWarningIntf->warningLow(unitModifier(warningLow), true);
     }
 
     if (hasCriticalThresholds && !useMetricInterface)
@@ -571,7 +586,7 @@ NumericSensor::NumericSensor(
         try
         {
             thresholdCriticalIntf =
-                std::make_unique<ThresholdCriticalIntf>(bus, path.c_str());
+                makeDeferredIntf<ThresholdCriticalIntf>(bus, path);
         }
         catch (const sdbusplus::exception_t& e)
         {
@@ -581,8 +596,27 @@ NumericSensor::NumericSensor(
             throw sdbusplus::xyz::openbmc_project::Common::Error::
                 InvalidArgument();
         }
-        thresholdCriticalIntf->criticalHigh(unitModifier(criticalHigh));
-        thresholdCriticalIntf->criticalLow(unitModifier(criticalLow));
+        thresholdCriticalIntf->criticalHigh(unitModifier(criticalHigh), true);
+        thresholdCriticalIntf->criticalLow(unitModifier(criticalLow), true);
+    }
+
+    emitObjectAdded();
+}
+
+void NumericSensor::emitObjectAdded()
+{
+    // The object-added signal of a path carries all the interfaces registered
+    // on it, Value or Metric, Availability, OperationalStatus, the thresholds
+    // and the associations, with their initial property values. It is sent
+    // by the interface destroyed first, so that its object-removed signal
+    // also lists all of them.
+    if (entityIntf)
+    {
+        entityIntf->emit_object_added();
+    }
+    if (associationDefinitionsIntf)
+    {
+        associationDefinitionsIntf->emit_object_added();
     }
 }
 
@@ -667,6 +701,32 @@ void NumericSensor::updateReading(bool available, bool functional, double value)
     }
 }
 
+void NumericSensor::updateFromEvent(uint8_t state, double value)
+{
+    updateReading(true, true, value);
+    eventState = state;
+    if (eventMessageEnabled && !eventDriven)
+    {
+        lg2::info(
+            "Sensor {NAME} is updated from its events, polling it for liveness only.",
+            "NAME", sensorName);
+        eventDriven = true;
+    }
+}
+
+double NumericSensor::getReading()
+{
+    if (!useMetricInterface && valueIntf)
+    {
+        return valueIntf->value();
+    }
+    if (useMetricInterface && metricIntf)
+    {
+        return metricIntf->value();
+    }
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
 void NumericSensor::handleErrGetSensorReading()
 {
     if (!operationalStatusIntf || (!useMetricInterface && !valueIntf) ||
@@ -736,13 +796,77 @@ void NumericSensor::updateThresholds()
     {
         value = metricIntf->value();
     }
-    if (thresholdWarningIntf &&
-        std::isfinite(thresholdWarningIntf->warningHigh()))
+    applyThresholds(value, evaluateThresholds(value, getConversion()));
+}
+
+SensorConversion NumericSensor::getConversion()
+{
+    SensorConversion conversion{};
+    conversion.resolution = resolution;
+    conversion.offset = offset;
+    conversion.multiplier = std::pow(10, baseUnitModifier);
+    conversion.hysteresis = hysteresis;
+    conversion.warningHigh = getThresholdUpperWarning();
+    conversion.warningLow = getThresholdLowerWarning();
+    conversion.criticalHigh = getThresholdUpperCritical();
+    conversion.criticalLow = getThresholdLowerCritical();
+    return conversion;
+}
+
+bool NumericSensor::takeThresholdsChanged()
+{
+    bool changed = false;
+    if (thresholdWarningIntf)
+    {
+        changed |= std::exchange(thresholdWarningIntf->thresholdsChanged,
+                                 false);
+    }
+    if (thresholdCriticalIntf)
+    {
+        changed |= std::exchange(thresholdCriticalIntf->thresholdsChanged,
+                                 false);
+    }
+    return changed;
+}
+
+void NumericSensor::updateConvertedReading(double value, uint8_t conditions)
+{
+    if (!availabilityIntf || !operationalStatusIntf ||
+        (!useMetricInterface && !valueIntf) ||
+        (useMetricInterface && !metricIntf))
+    {
+        lg2::error(
+            "Failed to update sensor {NAME} D-Bus interface don't exist.",
+            "NAME", sensorName);
+        return;
+    }
+    availabilityIntf->available(true);
+    operationalStatusIntf->functional(true);
+
+    auto curValue = getReading();
+    if (value == curValue ||
+        (!std::isfinite(value) && !std::isfinite(curValue)))
+    {
+        return;
+    }
+    if (!useMetricInterface)
+    {
+        valueIntf->value(value);
+        applyThresholds(value, conditions);
+    }
+    else
+    {
+        metricIntf->value(value);
+    }
+}
+
+void NumericSensor::applyThresholds(double value, uint8_t conditions)
+{
+    if (thresholdWarningIntf)
     {
-        auto threshold = thresholdWarningIntf->warningHigh();
         auto alarm = thresholdWarningIntf->warningAlarmHigh();
-        auto newAlarm =
-            checkThreshold(alarm, true, value, threshold, hysteresis);
+        auto newAlarm = nextAlarmState(alarm, conditions, warningHighAssert,
+                                       warningHighDeassert);
         if (alarm != newAlarm)
         {
             thresholdWarningIntf->warningAlarmHigh(newAlarm);
@@ -755,15 +879,10 @@ void NumericSensor::updateThresholds()
                 thresholdWarningIntf->warningHighAlarmDeasserted(value);
             }
         }
-    }
 
-    if (thresholdWarningIntf &&
-        std::isfinite(thresholdWarningIntf->warningLow()))
-    {
-        auto threshold = thresholdWarningIntf->warningLow();
-        auto alarm = thresholdWarningIntf->warningAlarmLow();
-        auto newAlarm =
-            checkThreshold(alarm, false, value, threshold, hysteresis);
+        alarm = thresholdWarningIntf->warningAlarmLow();
+        newAlarm = nextAlarmState(alarm, conditions, warningLowAssert,
+                                  warningLowDeassert);
         if (alarm != newAlarm)
         {
             thresholdWarningIntf->warningAlarmLow(newAlarm);
@@ -778,13 +897,11 @@ void NumericSensor::updateThresholds()
         }
     }
 
-    if (thresholdCriticalIntf &&
-        std::isfinite(thresholdCriticalIntf->criticalHigh()))
+    if (thresholdCriticalIntf)
     {
-        auto threshold = thresholdCriticalIntf->criticalHigh();
         auto alarm = thresholdCriticalIntf->criticalAlarmHigh();
-        auto newAlarm =
-            checkThreshold(alarm, true, value, threshold, hysteresis);
+        auto newAlarm = nextAlarmState(alarm, conditions, criticalHighAssert,
+                                       criticalHighDeassert);
         if (alarm != newAlarm)
         {
             thresholdCriticalIntf->criticalAlarmHigh(newAlarm);
@@ -797,15 +914,10 @@ void NumericSensor::updateThresholds()
                 thresholdCriticalIntf->criticalHighAlarmDeasserted(value);
             }
         }
-    }
 
-    if (thresholdCriticalIntf &&
-        std::isfinite(thresholdCriticalIntf->criticalLow()))
-    {
-        auto threshold = thresholdCriticalIntf->criticalLow();
-        auto alarm = thresholdCriticalIntf->criticalAlarmLow();
-        auto newAlarm =
-            checkThreshold(alarm, false, value, threshold, hysteresis);
+        alarm = thresholdCriticalIntf->criticalAlarmLow();
+        newAlarm = nextAlarmState(alarm, conditions, criticalLowAssert,
+                                  criticalLowDeassert);
         if (alarm != newAlarm)
         {
             thresholdCriticalIntf->criticalAlarmLow(newAlarm);
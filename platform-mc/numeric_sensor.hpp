@@ -2,6 +2,8 @@
 
 #include "common/types.hpp"
 #include "common/utils.hpp"
+#include "sensor_conversion.hpp"
+#include "sensor_history.hpp"
 
 #include <libpldm/platform.h>
 #include <libpldm/pldm.h>
@@ -16,6 +18,7 @@
 #include <xyz/openbmc_project/State/Decorator/Availability/server.hpp>
 #include <xyz/openbmc_project/State/Decorator/OperationalStatus/server.hpp>
 
+#include <memory>
 #include <string>
 
 namespace pldm
@@ -32,10 +35,10 @@ using ValueIntf = sdbusplus::server::object_t<
 using MetricUnit = sdbusplus::xyz::openbmc_project::Metric::server::Value::Unit;
 using MetricIntf = sdbusplus::server::object_t<
     sdbusplus::xyz::openbmc_project::Metric::server::Value>;
-using ThresholdWarningIntf = sdbusplus::server::object_t<
-    sdbusplus::xyz::openbmc_project::Sensor::Threshold::server::Warning>;
-using ThresholdCriticalIntf = sdbusplus::server::object_t<
-    sdbusplus::xyz::openbmc_project::Sensor::Threshold::server::Critical>;
+using ThresholdWarning =
+    sdbusplus::xyz::openbmc_project::Sensor::Threshold::server::Warning;
+using ThresholdCritical =
+    sdbusplus::xyz::openbmc_project::Sensor::Threshold::server::Critical;
 using OperationalStatusIntf =
     sdbusplus::server::object_t<sdbusplus::xyz::openbmc_project::State::
                                     Decorator::server::OperationalStatus>;
@@ -46,6 +49,68 @@ using AssociationDefinitionsInft = sdbusplus::server::object_t<
 using EntityIntf = sdbusplus::server::object_t<
     sdbusplus::xyz::openbmc_project::Inventory::Source::PLDM::server::Entity>;
 
+/**
+ * @brief ThresholdWarningIntf
+ *
+ * Warning threshold interface noting the thresholds set, on D-Bus or not, so
+ * that the conversion table of the terminus gets the new values.
+ */
+class ThresholdWarningIntf :
+    public sdbusplus::server::object_t<ThresholdWarning>
+{
+  public:
+    using Base = sdbusplus::server::object_t<ThresholdWarning>;
+    using Base::Base;
+    using ThresholdWarning::warningHigh;
+    using ThresholdWarning::warningLow;
+
+    double warningHigh(double value, bool skipSignal) override
+    {
+        thresholdsChanged = true;
+        return ThresholdWarning::warningHigh(value, skipSignal);
+    }
+
+    double warningLow(double value, bool skipSignal) override
+    {
+        thresholdsChanged = true;
+        return ThresholdWarning::warningLow(value, skipSignal);
+    }
+
+    /** @brief A threshold was set since the flag was cleared */
+    bool thresholdsChanged = false;
+};
+
+/**
+ * @brief ThresholdCriticalIntf
+ *
+ * Critical threshold interface noting the thresholds set, on D-Bus or not,
+ * so that the conversion table of the terminus gets the new values.
+ */
+class ThresholdCriticalIntf :
+    public sdbusplus::server::object_t<ThresholdCritical>
+{
+  public:
+    using Base = sdbusplus::server::object_t<ThresholdCritical>;
+    using Base::Base;
+    using ThresholdCritical::criticalHigh;
+    using ThresholdCritical::criticalLow;
+
+    double criticalHigh(double value, bool skipSignal) override
+    {
+        thresholdsChanged = true;
+        return ThresholdCritical::criticalHigh(value, skipSignal);
+    }
+
+    double criticalLow(double value, bool skipSignal) override
+    {
+        thresholdsChanged = true;
+        return ThresholdCritical::criticalLow(value, skipSignal);
+    }
+
+    /** @brief A threshold was set since the flag was cleared */
+    bool thresholdsChanged = false;
+};
+
 /**
  * @brief NumericSensor
  *
@@ -74,6 +139,42 @@ class NumericSensor
      */
     void updateReading(bool available, bool functional, double value = 0);
 
+    /** @brief Updating the D-Bus interface with a reading converted and
+     *  checked against the thresholds by a SensorConversionTable
+     *
+     *  @param[in] value - reading in the sensor unit
+     *  @param[in] conditions - ThresholdCondition bits of the reading
+     */
+    void updateConvertedReading(double value, uint8_t conditions);
+
+    /** @brief Updating the sensor from a numeric sensor state event, the
+     *  sensor is no longer polled at its update interval once the terminus
+     *  reported its event generation enabled
+     *
+     *  @param[in] state - present event state carried by the event
+     *  @param[in] value - raw reading carried by the event
+     */
+    void updateFromEvent(uint8_t state, double value);
+
+    /** @brief Get the conversion factors and the thresholds of the sensor
+     *
+     *  @return SensorConversion - conversion of the raw readings
+     */
+    SensorConversion getConversion();
+
+    /** @brief Check whether a threshold was set since the last call, so
+     *         that the conversion table entry of the sensor is refreshed
+     *
+     *  @return bool - true when a threshold was set
+     */
+    bool takeThresholdsChanged();
+
+    /** @brief Get the reading exported on the D-Bus interface
+     *
+     *  @return double - the reading, NaN if the sensor has no value
+     */
+    double getReading();
+
     /** @brief ConversionFormula is used to convert raw value to the unit
      * specified in PDR
      *
@@ -212,6 +313,24 @@ class NumericSensor
     /** @brief Sensor Unit */
     SensorUnit sensorUnit;
 
+    /** @brief Ring buffer of the latest readings, allocated by the sensor
+     *  manager on the first reading */
+    std::unique_ptr<SensorHistory> history;
+
+    /** @brief Index of the sensor in the conversion table of its terminus */
+    uint32_t conversionIndex = 0;
+
+    /** @brief The last reading of the sensor reported its event generation
+     *  enabled */
+    bool eventMessageEnabled = false;
+
+    /** @brief The sensor is updated from its events and is only polled at
+     *  the liveness interval of the sensor manager */
+    bool eventDriven = false;
+
+    /** @brief Present event state carried by the last event of the sensor */
+    uint8_t eventState = PLDM_SENSOR_UNKNOWN;
+
   private:
     /**
      * @brief Check sensor reading if any threshold has been crossed and update
@@ -219,11 +338,28 @@ class NumericSensor
      */
     void updateThresholds();
 
+    /**
+     * @brief Update the threshold alarms from the threshold conditions of a
+     * reading
+     *
+     * @param[in] value - reading in the sensor unit
+     * @param[in] conditions - ThresholdCondition bits of the reading
+     */
+    void applyThresholds(double value, uint8_t conditions);
+
     /**
      * @brief Update the object units based on the PDR baseUnit
      */
     void setSensorUnit(uint8_t baseUnit);
 
+    /** @brief Announce the sensor D-Bus objects once all of their interfaces
+     *         are created and populated. The interfaces are created without
+     *         emitting signals so that bringing up a sensor sends a single
+     *         InterfacesAdded per object path instead of a burst of
+     *         InterfacesAdded and PropertiesChanged signals.
+     */
+    void emitObjectAdded();
+
     /** @brief Create the sensor inventory path.
      *
      *  @param[in] associationPath - sensor association path
@@ -245,6 +381,9 @@ class NumericSensor
     std::unique_ptr<ThresholdCriticalIntf> thresholdCriticalIntf = nullptr;
     std::unique_ptr<AvailabilityIntf> availabilityIntf = nullptr;
     std::unique_ptr<OperationalStatusIntf> operationalStatusIntf = nullptr;
+    /** @brief Declared after the other interfaces of the sensor path so that
+     *         it is destroyed first, it sends the object-added and
+     *         object-removed signals of the path */
     std::unique_ptr<AssociationDefinitionsInft> associationDefinitionsIntf =
         nullptr;
     std::unique_ptr<EntityIntf> entityIntf = nullptr;
@@ -0,0 +1,111 @@
+#include "pdr_store.hpp"
+
+#include <endian.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+void PdrStore::add(std::span<const uint8_t> pdr)
+{
+    auto offset = (slab.size() + recordAlignment - 1) & ~(recordAlignment - 1);
+    slab.resize(offset + pdr.size());
+    if (!pdr.empty())
+    {
+        std::memcpy(slab.data() + offset, pdr.data(), pdr.size());
+    }
+
+    auto index = static_cast<uint32_t>(entries.size());
+    if (pdr.size() < sizeof(pldm_pdr_hdr))
+    {
+        entries.emplace_back(Entry{static_cast<uint32_t>(offset),
+                                   static_cast<uint32_t>(pdr.size()), 0});
+        return;
+    }
+
+    pldm_pdr_hdr hdr{};
+    std::memcpy(&hdr, pdr.data(), sizeof(hdr));
+    auto recordHandle = le32toh(hdr.record_handle);
+    entries.emplace_back(Entry{static_cast<uint32_t>(offset),
+                               static_cast<uint32_t>(pdr.size()),
+                               recordHandle});
+
+    auto it = std::ranges::lower_bound(
+        handleIndex, recordHandle, {},
+        [this](uint32_t position) { return entries[position].recordHandle; });
+    // The first record of a handle wins
+    if (it == handleIndex.end() || entries[*it].recordHandle != recordHandle)
+    {
+        handleIndex.insert(it, index);
+    }
+    typeIndex[hdr.type].emplace_back(index);
+}
+
+void PdrStore::clear()
+{
+    slab.clear();
+    entries.clear();
+    handleIndex.clear();
+    typeIndex.clear();
+}
+
+void PdrStore::reserve(size_t bytes, size_t count)
+{
+    slab.reserve(bytes + count * (recordAlignment - 1));
+    entries.reserve(count);
+    handleIndex.reserve(count);
+}
+
+void PdrStore::shrinkToFit()
+{
+    slab.shrink_to_fit();
+    entries.shrink_to_fit();
+    handleIndex.shrink_to_fit();
+    for (auto& [type, positions] : typeIndex)
+    {
+        positions.shrink_to_fit();
+    }
+}
+
+std::optional<size_t> PdrStore::findByHandle(uint32_t recordHandle) const
+{
+    auto it = std::ranges::lower_bound(
+        handleIndex, recordHandle, {},
+        [this](uint32_t position) { return entries[position].recordHandle; });
+    if (it == handleIndex.end() || entries[*it].recordHandle != recordHandle)
+    {
+        return std::nullopt;
+    }
+    return *it;
+}
+
+const std::vector<uint32_t>& PdrStore::findByType(uint8_t type) const
+{
+    static const std::vector<uint32_t> noRecords{};
+    auto it = typeIndex.find(type);
+    if (it == typeIndex.end())
+    {
+        return noRecords;
+    }
+    return it->second;
+}
+
+size_t PdrStore::memoryUsage() const
+{
+    size_t usage = slab.capacity() + entries.capacity() * sizeof(Entry) +
+                   handleIndex.capacity() * sizeof(uint32_t);
+    for (const auto& [type, positions] : typeIndex)
+    {
+        // Map nodes are estimated with three pointers of overhead
+        usage += sizeof(decltype(typeIndex)::value_type) +
+                 3 * sizeof(void*) + positions.capacity() * sizeof(uint32_t);
+    }
+    return usage;
+}
+
+} // namespace platform_mc
+} // namespace pldm
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <libpldm/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @class PdrStore
+ *
+ *  @brief Arena backed storage of the PDRs fetched from a terminus
+ *
+ *  All the records of a terminus are appended to one contiguous byte slab
+ *  instead of being held in a heap allocation each. Records are indexed by
+ *  position, by record handle and by PDR type, and are handed out as spans
+ *  into the slab. Spans are invalidated when a record is added or the store
+ *  is cleared, positions stay valid until the store is cleared.
+ */
+class PdrStore
+{
+  public:
+    using Record = std::span<const uint8_t>;
+
+    /** @brief Iterator over the records in insertion order */
+    class const_iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Record;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Record;
+
+        const_iterator() = default;
+        const_iterator(const PdrStore* store, size_t index) :
+            store(store), index(index)
+        {}
+
+        Record operator*() const
+        {
+            return (*store)[index];
+        }
+
+        const_iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto it = *this;
+            ++index;
+            return it;
+        }
+
+        bool operator==(const const_iterator& it) const
+        {
+            return store == it.store && index == it.index;
+        }
+
+      private:
+        const PdrStore* store = nullptr;
+        size_t index = 0;
+    };
+
+    /** @brief Append a record to the store
+     *
+     *  @param[in] pdr - PDR data including the common PDR header
+     */
+    void add(std::span<const uint8_t> pdr);
+
+    /** @brief Remove all the records, the slab memory is kept for reuse */
+    void clear();
+
+    /** @brief Reserve memory for the records to be added
+     *
+     *  @param[in] bytes - total size of the records
+     *  @param[in] count - number of records
+     */
+    void reserve(size_t bytes, size_t count);
+
+    /** @brief Release the memory reserved beyond the stored records */
+    void shrinkToFit();
+
+    /** @brief Number of records in the store */
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+    /** @brief Check if the store holds no record */
+    bool empty() const
+    {
+        return entries.empty();
+    }
+
+    /** @brief Get the record at a position
+     *
+     *  @param[in] index - position of the record in insertion order
+     *  @return span over the record data
+     */
+    Record operator[](size_t index) const
+    {
+        const auto& entry = entries[index];
+        return {slab.data() + entry.offset, entry.length};
+    }
+
+    const_iterator begin() const
+    {
+        return {this, 0};
+    }
+
+    const_iterator end() const
+    {
+        return {this, entries.size()};
+    }
+
+    /** @brief Find a record by record handle
+     *
+     *  @param[in] recordHandle - PDR record handle
+     *  @return position of the record, std::nullopt if not found
+     */
+    std::optional<size_t> findByHandle(uint32_t recordHandle) const;
+
+    /** @brief Find the records of a PDR type
+     *
+     *  @param[in] type - PDR type
+     *  @return positions of the records in insertion order
+     */
+    const std::vector<uint32_t>& findByType(uint8_t type) const;
+
+    /** @brief Heap memory held by the store, in bytes */
+    size_t memoryUsage() const;
+
+    /** @brief Alignment of the record offsets in the slab, the PDR fields
+     *         are at most 32 bits wide
+     */
+    static constexpr size_t recordAlignment = alignof(uint32_t);
+
+  private:
+    /** @brief Location of a record in the slab */
+    struct Entry
+    {
+        uint32_t offset;
+        uint32_t length;
+        uint32_t recordHandle;
+    };
+
+    /** @brief Record data of all the records */
+    std::vector<uint8_t> slab;
+
+    /** @brief Record locations in insertion order */
+    std::vector<Entry> entries;
+
+    /** @brief Record positions sorted by record handle. Termini report the
+     *         records in ascending handle order, so this is appended to in
+     *         the common case.
+     */
+    std::vector<uint32_t> handleIndex;
+
+    /** @brief PDR type to record positions */
+    std::map<uint8_t, std::vector<uint32_t>> typeIndex;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -16,6 +16,7 @@ namespace platform_mc
 
 exec::task<int> PlatformManager::initTerminus()
 {
+    std::vector<std::pair<pldm_tid_t, PdrRepositoryInfo>> restoredTermini;
     for (auto& [tid, terminus] : termini)
     {
         if (terminus->initialized)
@@ -23,51 +24,28 @@ exec::task<int> PlatformManager::initTerminus()
             continue;
         }
 
-        /* Get Fru */
-        uint16_t totalTableRecords = 0;
-        if (terminus->doesSupportCommand(PLDM_FRU,
-                                         PLDM_GET_FRU_RECORD_TABLE_METADATA))
-        {
-            auto rc =
-                co_await getFRURecordTableMetadata(tid, &totalTableRecords);
-            if (rc)
-            {
-                lg2::error(
-                    "Failed to get FRU Metadata for terminus {TID}, error {ERROR}",
-                    "TID", tid, "ERROR", rc);
-            }
-            if (!totalTableRecords)
-            {
-                lg2::info("Fru record table meta data has 0 records");
-            }
-        }
-
         std::vector<uint8_t> fruData{};
-        if ((totalTableRecords != 0) &&
-            terminus->doesSupportCommand(PLDM_FRU, PLDM_GET_FRU_RECORD_TABLE))
+        PdrRepositoryInfo snapshotInfo{};
+        if (terminus->doesSupportCommand(PLDM_PLATFORM, PLDM_GET_PDR) &&
+            terminus->doesSupportCommand(PLDM_PLATFORM,
+                                         PLDM_GET_PDR_REPOSITORY_INFO) &&
+            snapshotCache.load(getTerminusUUID(tid), snapshotInfo,
+                               terminus->pdrs, fruData))
         {
-            auto rc =
-                co_await getFRURecordTables(tid, totalTableRecords, fruData);
-            if (rc)
-            {
-                lg2::error(
-                    "Failed to get Fru Record table for terminus {TID}, error {ERROR}",
-                    "TID", tid, "ERROR", rc);
-            }
+            /* Bring the sensors up from the snapshot, the snapshot is
+             * checked against the terminus once all the termini are up */
+            lg2::info("Restored {COUNT} PDRs of terminus {TID} from snapshot",
+                      "COUNT", terminus->pdrs.size(), "TID", tid);
+            restoredTermini.emplace_back(tid, snapshotInfo);
+            terminus->parseTerminusPDRs();
         }
-
-        if (terminus->doesSupportCommand(PLDM_PLATFORM, PLDM_GET_PDR))
+        else
         {
-            auto rc = co_await getPDRs(terminus);
+            auto rc = co_await downloadTerminusData(terminus, fruData);
             if (rc)
             {
-                lg2::error(
-                    "Failed to fetch PDRs for terminus with TID: {TID}, error: {ERROR}",
-                    "TID", tid, "ERROR", rc);
                 continue; // Continue to next terminus
             }
-
-            terminus->parseTerminusPDRs();
         }
 
         /**
@@ -122,9 +100,148 @@ exec::task<int> PlatformManager::initTerminus()
         }
     }
 
+    for (const auto& [tid, snapshotInfo] : restoredTermini)
+    {
+        co_await checkSnapshot(tid, snapshotInfo);
+    }
+
     co_return PLDM_SUCCESS;
 }
 
+UUID PlatformManager::getTerminusUUID(pldm_tid_t tid)
+{
+    auto mctpInfo = terminusManager.toMctpInfo(tid);
+    if (!mctpInfo)
+    {
+        return {};
+    }
+    return std::get<1>(*mctpInfo);
+}
+
+exec::task<int> PlatformManager::downloadTerminusData(
+    std::shared_ptr<Terminus> terminus, std::vector<uint8_t>& fruData)
+{
+    auto tid = terminus->getTid();
+
+    /* Get Fru */
+    uint16_t totalTableRecords = 0;
+    bool fruComplete = true;
+    if (terminus->doesSupportCommand(PLDM_FRU,
+                                     PLDM_GET_FRU_RECORD_TABLE_METADATA))
+    {
+        auto rc = co_await getFRURecordTableMetadata(tid, &totalTableRecords);
+        if (rc)
+        {
+            lg2::error(
+                "Failed to get FRU Metadata for terminus {TID}, error {ERROR}",
+                "TID", tid, "ERROR", rc);
+            fruComplete = false;
+        }
+        if (!totalTableRecords)
+        {
+            lg2::info("Fru record table meta data has 0 records");
+        }
+    }
+
+    if ((totalTableRecords != 0) &&
+        terminus->doesSupportCommand(PLDM_FRU, PLDM_GET_FRU_RECORD_TABLE))
+    {
+        auto rc = co_await getFRURecordTables(tid, totalTableRecords, fruData);
+        if (rc)
+        {
+            lg2::error(
+                "Failed to get Fru Record table for terminus {TID}, error {ERROR}",
+                "TID", tid, "ERROR", rc);
+            fruComplete = false;
+        }
+    }
+
+    if (terminus->doesSupportCommand(PLDM_PLATFORM, PLDM_GET_PDR))
+    {
+        std::optional<PdrRepositoryInfo> repositoryInfo;
+        auto rc = co_await getPDRs(terminus, repositoryInfo);
+        if (rc)
+        {
+            lg2::error(
+                "Failed to fetch PDRs for terminus with TID: {TID}, error: {ERROR}",
+                "TID", tid, "ERROR", rc);
+            co_return rc;
+        }
+
+        terminus->parseTerminusPDRs();
+
+        /* Only a repository with a known state can be checked for changes,
+         * and the snapshot does not check the FRU data so it is only taken
+         * with the complete FRU record table */
+        if (repositoryInfo && fruComplete)
+        {
+            snapshotCache.save(getTerminusUUID(tid), *repositoryInfo,
+                               terminus->pdrs, fruData);
+        }
+    }
+
+    co_return PLDM_SUCCESS;
+}
+
+exec::task<int> PlatformManager::checkSnapshot(
+    pldm_tid_t tid, const PdrRepositoryInfo& snapshotInfo)
+{
+    auto it = termini.find(tid);
+    if (it == termini.end() || !it->second)
+    {
+        co_return PLDM_ERROR;
+    }
+    auto terminus = it->second;
+    auto uuid = getTerminusUUID(tid);
+
+    uint8_t repositoryState = PLDM_AVAILABLE;
+    PdrRepositoryInfo repositoryInfo{};
+    auto rc = co_await getPDRRepositoryInfo(tid, repositoryState,
+                                            repositoryInfo);
+    if (rc)
+    {
+        /* Keep the snapshot, it is checked again on the next start */
+        lg2::error(
+            "Failed to check the snapshot of terminus {TID}, error {ERROR}",
+            "TID", tid, "ERROR", rc);
+        co_return rc;
+    }
+
+    if (repositoryState == PLDM_AVAILABLE && repositoryInfo == snapshotInfo)
+    {
+        co_return PLDM_SUCCESS;
+    }
+
+    /* The terminus may be removed while the response is awaited */
+    it = termini.find(tid);
+    if (it == termini.end() || it->second != terminus)
+    {
+        co_return PLDM_ERROR;
+    }
+
+    lg2::info("PDR repository of terminus {TID} changed, download the PDRs",
+              "TID", tid);
+    snapshotCache.remove(uuid);
+    if (manager)
+    {
+        manager->stopSensorPolling(tid);
+    }
+
+    std::vector<uint8_t> fruData{};
+    rc = co_await downloadTerminusData(terminus, fruData);
+    if (!rc && fruData.size())
+    {
+        updateInventoryWithFru(tid, fruData.data(), fruData.size());
+    }
+
+    if (manager && termini.contains(tid))
+    {
+        manager->startSensorPolling(tid);
+    }
+
+    co_return rc;
+}
+
 exec::task<int> PlatformManager::configEventReceiver(pldm_tid_t tid)
 {
     if (!termini.contains(tid))
@@ -221,7 +338,9 @@ exec::task<int> PlatformManager::configEventReceiver(pldm_tid_t tid)
     co_return PLDM_SUCCESS;
 }
 
-exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
+exec::task<int> PlatformManager::getPDRs(
+    std::shared_ptr<Terminus> terminus,
+    std::optional<PdrRepositoryInfo>& repositoryInfo)
 {
     pldm_tid_t tid = terminus->getTid();
 
@@ -231,12 +350,12 @@ exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
     uint32_t recordCount = std::numeric_limits<uint32_t>::max();
     uint32_t repositorySize = 0;
     uint32_t largestRecordSize = std::numeric_limits<uint32_t>::max();
+    repositoryInfo.reset();
     if (terminus->doesSupportCommand(PLDM_PLATFORM,
                                      PLDM_GET_PDR_REPOSITORY_INFO))
     {
-        auto rc =
-            co_await getPDRRepositoryInfo(tid, repositoryState, recordCount,
-                                          repositorySize, largestRecordSize);
+        PdrRepositoryInfo info{};
+        auto rc = co_await getPDRRepositoryInfo(tid, repositoryState, info);
         if (rc)
         {
             lg2::error(
@@ -245,10 +364,12 @@ exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
         }
         else
         {
-            recordCount =
-                std::min(recordCount + 1, std::numeric_limits<uint32_t>::max());
-            largestRecordSize = std::min(largestRecordSize + 1,
+            recordCount = std::min(info.recordCount + 1,
+                                   std::numeric_limits<uint32_t>::max());
+            repositorySize = info.repositorySize;
+            largestRecordSize = std::min(info.largestRecordSize + 1,
                                          std::numeric_limits<uint32_t>::max());
+            repositoryInfo = info;
         }
     }
 
@@ -267,6 +388,15 @@ exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
     uint8_t transferCrc = 0;
 
     terminus->pdrs.clear();
+    if (repositorySize)
+    {
+        // The repository info is reported by the terminus, bound the memory
+        // reserved up front
+        constexpr uint32_t maxReservedSize = 1024 * 1024;
+        constexpr uint32_t maxReservedRecords = 8192;
+        terminus->pdrs.reserve(std::min(repositorySize, maxReservedSize),
+                               std::min(recordCount, maxReservedRecords));
+    }
     uint32_t receivedRecordCount = 0;
 
     do
@@ -288,8 +418,7 @@ exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
         if (transferFlag == PLDM_PLATFORM_TRANSFER_START_AND_END)
         {
             // single-part
-            terminus->pdrs.emplace_back(std::vector<uint8_t>(
-                recvBuf.begin(), recvBuf.begin() + responseCnt));
+            terminus->pdrs.add(std::span(recvBuf.data(), responseCnt));
             recordHndl = nextRecordHndl;
         }
         else
@@ -322,7 +451,7 @@ exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
 
                 if (transferFlag == PLDM_PLATFORM_TRANSFER_END)
                 {
-                    terminus->pdrs.emplace_back(std::move(receivedPdr));
+                    terminus->pdrs.add(receivedPdr);
                     recordHndl = nextRecordHndl;
                 }
             } while (nextDataTransferHndl != 0 &&
@@ -331,6 +460,8 @@ exec::task<int> PlatformManager::getPDRs(std::shared_ptr<Terminus> terminus)
         receivedRecordCount++;
     } while (nextRecordHndl != 0 && receivedRecordCount < recordCount);
 
+    terminus->pdrs.shrinkToFit();
+
     co_return PLDM_SUCCESS;
 }
 
@@ -391,8 +522,8 @@ exec::task<int> PlatformManager::getPDR(
 }
 
 exec::task<int> PlatformManager::getPDRRepositoryInfo(
-    const pldm_tid_t tid, uint8_t& repositoryState, uint32_t& recordCount,
-    uint32_t& repositorySize, uint32_t& largestRecordSize)
+    const pldm_tid_t tid, uint8_t& repositoryState,
+    PdrRepositoryInfo& repositoryInfo)
 {
     Request request(sizeof(pldm_msg_hdr));
     auto requestMsg = new (request.data()) pldm_msg;
@@ -419,14 +550,14 @@ exec::task<int> PlatformManager::getPDRRepositoryInfo(
     }
 
     uint8_t completionCode = 0;
-    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime = {};
     std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> oemUpdateTime = {};
     uint8_t dataTransferHandleTimeout = 0;
 
     rc = decode_get_pdr_repository_info_resp(
         responseMsg, responseLen, &completionCode, &repositoryState,
-        updateTime.data(), oemUpdateTime.data(), &recordCount, &repositorySize,
-        &largestRecordSize, &dataTransferHandleTimeout);
+        repositoryInfo.updateTime.data(), oemUpdateTime.data(),
+        &repositoryInfo.recordCount, &repositoryInfo.repositorySize,
+        &repositoryInfo.largestRecordSize, &dataTransferHandleTimeout);
     if (rc)
     {
         lg2::error(
@@ -725,8 +856,8 @@ exec::task<int> PlatformManager::getFRURecordTable(
 
     auto responsePtr = reinterpret_cast<const struct pldm_msg*>(responseMsg);
     rc = decode_get_fru_record_table_resp(
-        responsePtr, responseLen - sizeof(pldm_msg_hdr), &completionCode,
-        nextDataTransferHndl, transferFlag, recordData.data(), responseCnt);
+        responsePtr, responseLen, &completionCode, nextDataTransferHndl,
+        transferFlag, recordData.data(), responseCnt);
 
     if (rc)
     {
@@ -2,11 +2,14 @@
 
 #include "terminus.hpp"
 #include "terminus_manager.hpp"
+#include "terminus_snapshot.hpp"
 
 #include <libpldm/fru.h>
 #include <libpldm/platform.h>
 #include <libpldm/pldm.h>
 
+#include <filesystem>
+#include <optional>
 #include <vector>
 
 namespace pldm
@@ -30,12 +33,29 @@ class PlatformManager
     PlatformManager& operator=(PlatformManager&&) = delete;
     ~PlatformManager() = default;
 
+    /** @brief Constructor
+     *
+     *  @param[in] terminusManager - sends the PLDM requests to the termini
+     *  @param[in] termini - managed termini
+     *  @param[in] manager - platform-mc manager
+     *  @param[in] snapshotDir - directory of the terminus snapshots, an empty
+     *                           path disables the snapshots
+     */
     explicit PlatformManager(TerminusManager& terminusManager,
-                             TerminiMapper& termini, Manager* manager) :
-        terminusManager(terminusManager), termini(termini), manager(manager)
+                             TerminiMapper& termini, Manager* manager,
+                             const std::filesystem::path& snapshotDir = {}) :
+        terminusManager(terminusManager), termini(termini), manager(manager),
+        snapshotCache(snapshotDir)
     {}
 
     /** @brief Initialize terminus which supports PLDM Type 2
+     *
+     *  The PDRs and FRU record table of a terminus are restored from its
+     *  snapshot when there is one, so its sensors come up without waiting
+     *  for the PDRs to be downloaded. Once all the termini are initialized,
+     *  the restored snapshots are checked against the PDR repository info
+     *  reported by the termini and the PDRs are downloaded again on a
+     *  mismatch.
      *
      *  @return coroutine return_value - PLDM completion code
      */
@@ -49,12 +69,43 @@ class PlatformManager
     exec::task<int> configEventReceiver(pldm_tid_t tid);
 
   private:
+    /** @brief Get the MCTP endpoint UUID of a terminus
+     *
+     *  @param[in] tid - TID of the terminus
+     *  @return the UUID, empty if the terminus is not an MCTP endpoint
+     */
+    UUID getTerminusUUID(pldm_tid_t tid);
+
+    /** @brief Download the FRU record table and the PDRs of a terminus,
+     *         parse the PDRs and save them to the terminus snapshot.
+     *
+     *  @param[in] terminus - The terminus object to store fetched PDRs
+     *  @param[out] fruData - Returned fru record table data
+     *  @return coroutine return_value - PLDM completion code
+     */
+    exec::task<int> downloadTerminusData(std::shared_ptr<Terminus> terminus,
+                                         std::vector<uint8_t>& fruData);
+
+    /** @brief Check that the PDR repository of a terminus restored from its
+     *         snapshot did not change, download the PDRs and recreate the
+     *         sensors otherwise.
+     *
+     *  @param[in] tid - TID of the terminus
+     *  @param[in] snapshotInfo - repository info stored in the snapshot
+     *  @return coroutine return_value - PLDM completion code
+     */
+    exec::task<int> checkSnapshot(pldm_tid_t tid,
+                                  const PdrRepositoryInfo& snapshotInfo);
+
     /** @brief Fetch all PDRs from terminus.
      *
      *  @param[in] terminus - The terminus object to store fetched PDRs
+     *  @param[out] repositoryInfo - PDR repository info the PDRs were
+     *              fetched at, std::nullopt if the terminus did not report it
      *  @return coroutine return_value - PLDM completion code
      */
-    exec::task<int> getPDRs(std::shared_ptr<Terminus> terminus);
+    exec::task<int> getPDRs(std::shared_ptr<Terminus> terminus,
+                            std::optional<PdrRepositoryInfo>& repositoryInfo);
 
     /** @brief Fetch PDR from terminus
      *
@@ -84,15 +135,14 @@ class PlatformManager
      *
      *  @param[in] tid - Destination TID
      *  @param[out] repositoryState - the state of repository
-     *  @param[out] recordCount - number of records
-     *  @param[out] repositorySize - repository size
-     *  @param[out] largestRecordSize - largest record size
+     *  @param[out] repositoryInfo - update time, number of records,
+     *              repository size and largest record size
      * *
      *  @return coroutine return_value - PLDM completion code
      */
-    exec::task<int> getPDRRepositoryInfo(
-        const pldm_tid_t tid, uint8_t& repositoryState, uint32_t& recordCount,
-        uint32_t& repositorySize, uint32_t& largestRecordSize);
+    exec::task<int> getPDRRepositoryInfo(const pldm_tid_t tid,
+                                         uint8_t& repositoryState,
+                                         PdrRepositoryInfo& repositoryInfo);
 
     /** @brief Send setEventReceiver command to destination EID.
      *
@@ -193,6 +243,9 @@ class PlatformManager
      *        and other platform-level PLDM operations.
      */
     Manager* manager;
+
+    /** @brief Persisted PDRs and FRU record tables of the termini */
+    TerminusSnapshotCache snapshotCache;
 };
 } // namespace platform_mc
 } // namespace pldm
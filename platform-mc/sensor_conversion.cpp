@@ -0,0 +1,197 @@
+#include "sensor_conversion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <utility>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+namespace
+{
+
+constexpr double quietNaN = std::numeric_limits<double>::quiet_NaN();
+
+/** @brief Threshold and bound clearing its alarm, NaN when the sensor does
+ *         not have the threshold
+ */
+std::pair<double, double> thresholdBounds(double threshold, double clear)
+{
+    if (!std::isfinite(threshold))
+    {
+        return {quietNaN, quietNaN};
+    }
+    return {threshold, clear};
+}
+
+/** @brief Convert readings and evaluate their thresholds. The loop has no
+ *         branch, the comparisons with a NaN threshold are false, so that
+ *         the compiler turns it into SIMD code.
+ *
+ *  @param[in] count - number of readings
+ *  @param[in] index - maps the position of a reading to its table index
+ */
+template <typename Index>
+void convertReadings(
+    size_t count, Index index, const double* __restrict resolution,
+    const double* __restrict offset, const double* __restrict multiplier,
+    const double* __restrict warningHigh,
+    const double* __restrict warningHighClear,
+    const double* __restrict warningLow,
+    const double* __restrict warningLowClear,
+    const double* __restrict criticalHigh,
+    const double* __restrict criticalHighClear,
+    const double* __restrict criticalLow,
+    const double* __restrict criticalLowClear, const double* __restrict raw,
+    double* __restrict values, uint8_t* __restrict conditions)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto j = index(i);
+        double value = (raw[i] * resolution[j] + offset[j]) * multiplier[j];
+        values[i] = value;
+
+        uint8_t bits = 0;
+        bits |= uint8_t(value >= warningHigh[j]) << 0;
+        bits |= uint8_t(value < warningHighClear[j]) << 1;
+        bits |= uint8_t(value <= warningLow[j]) << 2;
+        bits |= uint8_t(value > warningLowClear[j]) << 3;
+        bits |= uint8_t(value >= criticalHigh[j]) << 4;
+        bits |= uint8_t(value < criticalHighClear[j]) << 5;
+        bits |= uint8_t(value <= criticalLow[j]) << 6;
+        bits |= uint8_t(value > criticalLowClear[j]) << 7;
+        conditions[i] = bits;
+    }
+}
+
+} // namespace
+
+uint8_t evaluateThresholds(double value, const SensorConversion& conversion)
+{
+    uint8_t conditions = 0;
+    auto hyst = conversion.hysteresis;
+
+    if (std::isfinite(conversion.warningHigh))
+    {
+        conditions |= (value >= conversion.warningHigh) ? warningHighAssert : 0;
+        conditions |= (value < conversion.warningHigh - hyst)
+                          ? warningHighDeassert
+                          : 0;
+    }
+    if (std::isfinite(conversion.warningLow))
+    {
+        conditions |= (value <= conversion.warningLow) ? warningLowAssert : 0;
+        conditions |= (value > conversion.warningLow + hyst)
+                          ? warningLowDeassert
+                          : 0;
+    }
+    if (std::isfinite(conversion.criticalHigh))
+    {
+        conditions |=
+            (value >= conversion.criticalHigh) ? criticalHighAssert : 0;
+        conditions |= (value < conversion.criticalHigh - hyst)
+                          ? criticalHighDeassert
+                          : 0;
+    }
+    if (std::isfinite(conversion.criticalLow))
+    {
+        conditions |= (value <= conversion.criticalLow) ? criticalLowAssert : 0;
+        conditions |= (value > conversion.criticalLow + hyst)
+                          ? criticalLowDeassert
+                          : 0;
+    }
+    return conditions;
+}
+
+uint32_t SensorConversionTable::add(uint16_t sensorId,
+                                    const SensorConversion& conversion)
+{
+    auto index = static_cast<uint32_t>(sensorIds.size());
+    sensorIds.emplace_back(sensorId);
+    resolution.emplace_back();
+    offset.emplace_back();
+    multiplier.emplace_back();
+    warningHigh.emplace_back();
+    warningHighClear.emplace_back();
+    warningLow.emplace_back();
+    warningLowClear.emplace_back();
+    criticalHigh.emplace_back();
+    criticalHighClear.emplace_back();
+    criticalLow.emplace_back();
+    criticalLowClear.emplace_back();
+    update(index, conversion);
+    return index;
+}
+
+void SensorConversionTable::update(uint32_t index,
+                                   const SensorConversion& conversion)
+{
+    auto hyst = conversion.hysteresis;
+
+    // Same as NumericSensor::conversionFormula, which skips the factors
+    // not finite
+    resolution[index] =
+        std::isfinite(conversion.resolution) ? conversion.resolution : 1;
+    offset[index] = std::isfinite(conversion.offset) ? conversion.offset : 0;
+    multiplier[index] = conversion.multiplier;
+
+    std::tie(warningHigh[index], warningHighClear[index]) =
+        thresholdBounds(conversion.warningHigh, conversion.warningHigh - hyst);
+    std::tie(warningLow[index], warningLowClear[index]) =
+        thresholdBounds(conversion.warningLow, conversion.warningLow + hyst);
+    std::tie(criticalHigh[index], criticalHighClear[index]) = thresholdBounds(
+        conversion.criticalHigh, conversion.criticalHigh - hyst);
+    std::tie(criticalLow[index], criticalLowClear[index]) =
+        thresholdBounds(conversion.criticalLow, conversion.criticalLow + hyst);
+}
+
+void SensorConversionTable::clear()
+{
+    sensorIds.clear();
+    resolution.clear();
+    offset.clear();
+    multiplier.clear();
+    warningHigh.clear();
+    warningHighClear.clear();
+    warningLow.clear();
+    warningLowClear.clear();
+    criticalHigh.clear();
+    criticalHighClear.clear();
+    criticalLow.clear();
+    criticalLowClear.clear();
+}
+
+void SensorConversionTable::convert(
+    std::span<const uint32_t> indexes, std::span<const double> raw,
+    std::span<double> values, std::span<uint8_t> conditions) const
+{
+    auto count = std::min({indexes.size(), raw.size(), values.size(),
+                           conditions.size()});
+    auto ids = indexes.data();
+    convertReadings(
+        count, [ids](size_t i) { return ids[i]; }, resolution.data(),
+        offset.data(), multiplier.data(), warningHigh.data(),
+        warningHighClear.data(), warningLow.data(), warningLowClear.data(),
+        criticalHigh.data(), criticalHighClear.data(), criticalLow.data(),
+        criticalLowClear.data(), raw.data(), values.data(), conditions.data());
+}
+
+void SensorConversionTable::convertAll(std::span<const double> raw,
+                                       std::span<double> values,
+                                       std::span<uint8_t> conditions) const
+{
+    auto count =
+        std::min({size(), raw.size(), values.size(), conditions.size()});
+    convertReadings(
+        count, [](size_t i) { return i; }, resolution.data(), offset.data(),
+        multiplier.data(), warningHigh.data(), warningHighClear.data(),
+        warningLow.data(), warningLowClear.data(), criticalHigh.data(),
+        criticalHighClear.data(), criticalLow.data(), criticalLowClear.data(),
+        raw.data(), values.data(), conditions.data());
+}
+
+} // namespace platform_mc
+} // namespace pldm
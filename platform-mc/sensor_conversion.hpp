@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @struct SensorConversion
+ *
+ *  Conversion of the raw readings of a numeric sensor to its unit, the
+ *  reading is (raw * resolution + offset) * multiplier. The thresholds are
+ *  in the sensor unit, NaN when the sensor does not have them.
+ */
+struct SensorConversion
+{
+    double resolution = 1;
+    double offset = 0;
+    double multiplier = 1;
+    double hysteresis = 0;
+    double warningHigh = std::numeric_limits<double>::quiet_NaN();
+    double warningLow = std::numeric_limits<double>::quiet_NaN();
+    double criticalHigh = std::numeric_limits<double>::quiet_NaN();
+    double criticalLow = std::numeric_limits<double>::quiet_NaN();
+};
+
+/** @brief Threshold conditions of a reading. Each threshold has an assert
+ *         bit, set when the reading crosses the threshold, and a deassert
+ *         bit, set when the reading is back past the hysteresis. The alarm
+ *         of a threshold is unchanged when neither bit is set.
+ */
+enum ThresholdCondition : uint8_t
+{
+    warningHighAssert = 1 << 0,
+    warningHighDeassert = 1 << 1,
+    warningLowAssert = 1 << 2,
+    warningLowDeassert = 1 << 3,
+    criticalHighAssert = 1 << 4,
+    criticalHighDeassert = 1 << 5,
+    criticalLowAssert = 1 << 6,
+    criticalLowDeassert = 1 << 7,
+};
+
+/** @brief Get the new state of a threshold alarm
+ *
+ *  @param[in] alarm - current alarm state
+ *  @param[in] conditions - threshold conditions of the reading
+ *  @param[in] assertBit - assert condition of the threshold
+ *  @param[in] deassertBit - deassert condition of the threshold
+ *
+ *  @return bool - new alarm state
+ */
+inline bool nextAlarmState(bool alarm, uint8_t conditions, uint8_t assertBit,
+                           uint8_t deassertBit)
+{
+    if (conditions & assertBit)
+    {
+        return true;
+    }
+    if (conditions & deassertBit)
+    {
+        return false;
+    }
+    return alarm;
+}
+
+/** @brief Evaluate the thresholds of a converted reading
+ *
+ *  @param[in] value - reading in the sensor unit
+ *  @param[in] conversion - thresholds and hysteresis of the sensor
+ *
+ *  @return the ThresholdCondition bits of the reading
+ */
+uint8_t evaluateThresholds(double value, const SensorConversion& conversion);
+
+/**
+ * @brief SensorConversionTable
+ *
+ * The conversion factors and threshold bounds of the numeric sensors of a
+ * terminus, one array per field, so that the readings of a whole poll
+ * window are converted and checked against the thresholds in branch free
+ * loops the compiler vectorizes.
+ */
+class SensorConversionTable
+{
+  public:
+    /** @brief Add a sensor
+     *
+     *  @param[in] sensorId - sensor ID
+     *  @param[in] conversion - conversion and thresholds of the sensor
+     *
+     *  @return index of the sensor in the table
+     */
+    uint32_t add(uint16_t sensorId, const SensorConversion& conversion);
+
+    /** @brief Update the conversion and thresholds of a sensor
+     *
+     *  @param[in] index - index of the sensor in the table
+     *  @param[in] conversion - conversion and thresholds of the sensor
+     */
+    void update(uint32_t index, const SensorConversion& conversion);
+
+    /** @brief Remove all the sensors */
+    void clear();
+
+    /** @brief Get the number of sensors */
+    size_t size() const
+    {
+        return sensorIds.size();
+    }
+
+    /** @brief Get the sensor ID at an index */
+    uint16_t sensorId(uint32_t index) const
+    {
+        return sensorIds[index];
+    }
+
+    /** @brief Convert a batch of raw readings of some of the sensors and
+     *         evaluate their thresholds
+     *
+     *  @param[in] indexes - indexes of the sensors in the table
+     *  @param[in] raw - raw reading of each sensor
+     *  @param[out] values - converted reading of each sensor
+     *  @param[out] conditions - ThresholdCondition bits of each reading
+     */
+    void convert(std::span<const uint32_t> indexes, std::span<const double> raw,
+                 std::span<double> values,
+                 std::span<uint8_t> conditions) const;
+
+    /** @brief Convert a raw reading of every sensor of the table and
+     *         evaluate their thresholds
+     *
+     *  @param[in] raw - raw reading of each sensor, in table order
+     *  @param[out] values - converted reading of each sensor
+     *  @param[out] conditions - ThresholdCondition bits of each reading
+     */
+    void convertAll(std::span<const double> raw, std::span<double> values,
+                    std::span<uint8_t> conditions) const;
+
+  private:
+    std::vector<uint16_t> sensorIds;
+    std::vector<double> resolution;
+    std::vector<double> offset;
+    std::vector<double> multiplier;
+
+    /** @brief The thresholds and the bounds clearing their alarms, NaN
+     *         when the sensor does not have the threshold so that no
+     *         condition is ever set for it
+     */
+    std::vector<double> warningHigh;
+    std::vector<double> warningHighClear;
+    std::vector<double> warningLow;
+    std::vector<double> warningLowClear;
+    std::vector<double> criticalHigh;
+    std::vector<double> criticalHighClear;
+    std::vector<double> criticalLow;
+    std::vector<double> criticalLowClear;
+};
+
+} // namespace platform_mc
+} // namespace pldm
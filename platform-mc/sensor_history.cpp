@@ -0,0 +1,409 @@
+#include "sensor_history.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <set>
+#include <thread>
+
+PHOSPHOR_LOG2_USING;
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+namespace
+{
+
+constexpr size_t cacheLineSize = 64;
+
+/** @brief Attempts to copy a slot, a slot still being written after them is
+ *         skipped rather than waiting for a writer which may have died */
+constexpr int maxReadAttempts = 100;
+
+constexpr size_t alignUp(size_t size, size_t alignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+constexpr size_t headerSize =
+    alignUp(sizeof(SensorHistoryHeader), cacheLineSize);
+constexpr size_t slotHeaderSize =
+    alignUp(sizeof(SensorHistorySlot), sizeof(uint64_t));
+
+constexpr size_t slotSize(uint32_t capacity)
+{
+    return alignUp(
+        slotHeaderSize + capacity * (sizeof(uint64_t) + sizeof(double)),
+        cacheLineSize);
+}
+
+SensorHistorySlot* slotHeader(uint8_t* slot)
+{
+    return reinterpret_cast<SensorHistorySlot*>(slot);
+}
+
+const SensorHistorySlot* slotHeader(const uint8_t* slot)
+{
+    return reinterpret_cast<const SensorHistorySlot*>(slot);
+}
+
+uint64_t* slotTimestamps(uint8_t* slot)
+{
+    return reinterpret_cast<uint64_t*>(slot + slotHeaderSize);
+}
+
+const uint64_t* slotTimestamps(const uint8_t* slot)
+{
+    return reinterpret_cast<const uint64_t*>(slot + slotHeaderSize);
+}
+
+double* slotValues(uint8_t* slot, uint32_t capacity)
+{
+    return reinterpret_cast<double*>(slotTimestamps(slot) + capacity);
+}
+
+const double* slotValues(const uint8_t* slot, uint32_t capacity)
+{
+    return reinterpret_cast<const double*>(slotTimestamps(slot) + capacity);
+}
+
+/** @brief Update a slot under its sequence lock */
+template <typename Update>
+void writeSlot(uint8_t* slot, Update update)
+{
+    auto header = slotHeader(slot);
+    auto sequence = header->sequence.load(std::memory_order_relaxed);
+    header->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    update(*header);
+    header->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+/** @brief Copy the readings of a slot taken after a time
+ *
+ *  @return false if the slot is not in use, or is never seen unchanged
+ *          during a copy within maxReadAttempts attempts
+ */
+bool readSlot(const uint8_t* slot, uint32_t capacity, uint64_t since,
+              SensorSamples& samples)
+{
+    auto header = slotHeader(slot);
+    auto timestamps = slotTimestamps(slot);
+    auto values = slotValues(slot, capacity);
+
+    for (int attempt = 0; attempt < maxReadAttempts; ++attempt)
+    {
+        auto sequence = header->sequence.load(std::memory_order_acquire);
+        if (sequence & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        bool inUse = header->inUse;
+        samples.tid = header->tid;
+        samples.sensorId = header->sensorId;
+        samples.timestamps.clear();
+        samples.values.clear();
+        auto count = std::min(header->count, capacity);
+        auto next = std::min(header->next, capacity);
+
+        // Oldest reading first
+        auto index = (next + capacity - count) % capacity;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (timestamps[index] > since)
+            {
+                samples.timestamps.emplace_back(timestamps[index]);
+                samples.values.emplace_back(values[index]);
+            }
+            index = (index + 1) % capacity;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header->sequence.load(std::memory_order_relaxed) == sequence)
+        {
+            return inUse;
+        }
+    }
+
+    error(
+        "Skipping the history of sensor {SENSOR_ID} of terminus {TID}, its slot is being written",
+        "SENSOR_ID", header->sensorId, "TID", header->tid);
+    return false;
+}
+
+/** @brief Check that a mapped region holds a complete sensor history */
+bool isValidRegion(const uint8_t* base, size_t size)
+{
+    if (!base || size < headerSize)
+    {
+        return false;
+    }
+    auto header = reinterpret_cast<const SensorHistoryHeader*>(base);
+    return header->magic == SensorHistoryRegion::magic &&
+           header->version == SensorHistoryRegion::version &&
+           header->capacity && header->slotSize == slotSize(header->capacity) &&
+           (size - headerSize) / header->slotSize >= header->slotCount;
+}
+
+/** @brief Copy the readings of the in use slots of a region */
+std::vector<SensorSamples> readRegion(
+    const uint8_t* base,
+    const std::vector<std::pair<pldm_tid_t, uint16_t>>& sensors, uint64_t since)
+{
+    std::vector<SensorSamples> histories;
+    auto header = reinterpret_cast<const SensorHistoryHeader*>(base);
+    std::set<std::pair<pldm_tid_t, uint16_t>> wanted(sensors.begin(),
+                                                     sensors.end());
+
+    SensorSamples samples;
+    for (uint32_t slot = 0; slot < header->slotCount; ++slot)
+    {
+        auto slotBase = base + headerSize + slot * header->slotSize;
+        auto slotInfo = slotHeader(slotBase);
+        if (!slotInfo->inUse ||
+            (!wanted.empty() &&
+             !wanted.contains({slotInfo->tid, slotInfo->sensorId})))
+        {
+            continue;
+        }
+
+        if (readSlot(slotBase, header->capacity, since, samples) &&
+            (wanted.empty() ||
+             wanted.contains({samples.tid, samples.sensorId})))
+        {
+            histories.emplace_back(std::move(samples));
+            samples = {};
+        }
+    }
+    return histories;
+}
+
+} // namespace
+
+SensorHistory::SensorHistory(std::shared_ptr<SensorHistoryRegion> region,
+                             uint32_t slot) :
+    region(std::move(region)), slot(slot)
+{}
+
+SensorHistory::~SensorHistory()
+{
+    region->release(slot);
+}
+
+void SensorHistory::push(uint64_t timestamp, double value)
+{
+    auto capacity = region->header().capacity;
+    auto base = region->slotBase(slot);
+    writeSlot(base, [&](SensorHistorySlot& header) {
+        slotTimestamps(base)[header.next] = timestamp;
+        slotValues(base, capacity)[header.next] = value;
+        header.next = (header.next + 1) % capacity;
+        header.count = std::min(header.count + 1, capacity);
+    });
+}
+
+void SensorHistory::read(uint64_t since, SensorSamples& samples) const
+{
+    readSlot(region->slotBase(slot), region->header().capacity, since,
+             samples);
+}
+
+size_t SensorHistory::size() const
+{
+    return slotHeader(region->slotBase(slot))->count;
+}
+
+size_t SensorHistory::capacity() const
+{
+    return region->header().capacity;
+}
+
+SensorHistoryRegion::SensorHistoryRegion(const std::string& shmName,
+                                         uint8_t* base, size_t size) :
+    shmName(shmName), base(base), size(size)
+{
+    auto slotCount = header().slotCount;
+    freeSlots.reserve(slotCount);
+    for (auto slot = slotCount; slot > 0; --slot)
+    {
+        freeSlots.emplace_back(slot - 1);
+    }
+}
+
+SensorHistoryRegion::~SensorHistoryRegion()
+{
+    munmap(base, size);
+    if (!shmName.empty())
+    {
+        shm_unlink(shmName.c_str());
+    }
+}
+
+std::shared_ptr<SensorHistoryRegion> SensorHistoryRegion::create(
+    const std::string& shmName, uint32_t slotCount, uint32_t capacity)
+{
+    if (!slotCount || !capacity)
+    {
+        return nullptr;
+    }
+
+    auto size = headerSize + slotCount * slotSize(capacity);
+    void* mapped = MAP_FAILED;
+    std::string name = shmName;
+    if (!name.empty())
+    {
+        // A new object each time, the readers of a previous instance keep
+        // their mapping of the old one
+        shm_unlink(name.c_str());
+        auto fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC,
+                           0644);
+        if (fd >= 0)
+        {
+            if (!ftruncate(fd, size))
+            {
+                mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                              MAP_SHARED, fd, 0);
+            }
+            close(fd);
+        }
+        if (mapped == MAP_FAILED)
+        {
+            error(
+                "Failed to create the sensor history shared memory {NAME}, error {ERROR}",
+                "NAME", name, "ERROR", std::strerror(errno));
+            shm_unlink(name.c_str());
+            name.clear();
+        }
+    }
+    if (mapped == MAP_FAILED)
+    {
+        mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapped == MAP_FAILED)
+        {
+            error("Failed to allocate the sensor history, error {ERROR}",
+                  "ERROR", std::strerror(errno));
+            return nullptr;
+        }
+    }
+
+    // The mapping is zero filled
+    auto base = static_cast<uint8_t*>(mapped);
+    for (uint32_t slot = 0; slot < slotCount; ++slot)
+    {
+        new (base + headerSize + slot * slotSize(capacity)) SensorHistorySlot{};
+    }
+    auto header = new (base) SensorHistoryHeader{};
+    header->version = version;
+    header->slotCount = slotCount;
+    header->capacity = capacity;
+    header->slotSize = slotSize(capacity);
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = magic;
+
+    return std::shared_ptr<SensorHistoryRegion>(
+        new SensorHistoryRegion(name, base, size));
+}
+
+uint8_t* SensorHistoryRegion::slotBase(uint32_t slot) const
+{
+    return base + headerSize + slot * header().slotSize;
+}
+
+std::unique_ptr<SensorHistory> SensorHistoryRegion::allocate(
+    pldm_tid_t tid, uint16_t sensorId)
+{
+    if (freeSlots.empty())
+    {
+        return nullptr;
+    }
+    auto slot = freeSlots.back();
+    freeSlots.pop_back();
+
+    writeSlot(slotBase(slot), [&](SensorHistorySlot& header) {
+        header.tid = tid;
+        header.sensorId = sensorId;
+        header.next = 0;
+        header.count = 0;
+        header.inUse = 1;
+    });
+    return std::make_unique<SensorHistory>(shared_from_this(), slot);
+}
+
+void SensorHistoryRegion::release(uint32_t slot)
+{
+    writeSlot(slotBase(slot), [](SensorHistorySlot& header) {
+        header.inUse = 0;
+        header.count = 0;
+    });
+    freeSlots.emplace_back(slot);
+}
+
+std::vector<SensorSamples> SensorHistoryRegion::read(
+    const std::vector<std::pair<pldm_tid_t, uint16_t>>& sensors,
+    uint64_t since) const
+{
+    return readRegion(base, sensors, since);
+}
+
+SensorHistoryReader::SensorHistoryReader(const std::string& shmName)
+{
+    auto fd = shm_open(shmName.c_str(), O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    struct stat st{};
+    if (!fstat(fd, &st) && st.st_size > 0)
+    {
+        auto mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapped != MAP_FAILED)
+        {
+            base = static_cast<const uint8_t*>(mapped);
+            size = st.st_size;
+        }
+    }
+    close(fd);
+
+    if (base && !isValidRegion(base, size))
+    {
+        munmap(const_cast<uint8_t*>(base), size);
+        base = nullptr;
+        size = 0;
+    }
+}
+
+SensorHistoryReader::~SensorHistoryReader()
+{
+    if (base)
+    {
+        munmap(const_cast<uint8_t*>(base), size);
+    }
+}
+
+std::vector<SensorSamples> SensorHistoryReader::read(
+    const std::vector<std::pair<pldm_tid_t, uint16_t>>& sensors,
+    uint64_t since) const
+{
+    if (!base)
+    {
+        return {};
+    }
+    return readRegion(base, sensors, since);
+}
+
+} // namespace platform_mc
+} // namespace pldm
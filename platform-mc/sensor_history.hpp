@@ -0,0 +1,242 @@
+#pragma once
+
+#include <libpldm/base.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @brief Name of the shared memory object holding the sensor histories */
+constexpr auto sensorHistoryShmName = "/pldm-sensor-history";
+
+/** @struct SensorSamples
+ *
+ *  The readings of a sensor in chronological order, the timestamps are in
+ *  usec since the epoch.
+ */
+struct SensorSamples
+{
+    pldm_tid_t tid = 0;
+    uint16_t sensorId = 0;
+    std::vector<uint64_t> timestamps;
+    std::vector<double> values;
+};
+
+/** @struct SensorHistoryHeader
+ *
+ *  Header of the sensor history region. The region is an array of
+ *  slotCount slots of slotSize bytes following the header, each slot holds
+ *  a SensorHistorySlot followed by the ring of capacity timestamps and the
+ *  ring of capacity values.
+ */
+struct SensorHistoryHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t capacity;
+    uint64_t slotSize;
+};
+
+/** @struct SensorHistorySlot
+ *
+ *  Header of the ring buffer of a sensor. The writer makes the sequence odd
+ *  while it updates the slot, a reader retries until it copies the slot
+ *  with the same even sequence before and after the copy.
+ */
+struct SensorHistorySlot
+{
+    std::atomic<uint32_t> sequence;
+    uint16_t sensorId;
+    pldm_tid_t tid;
+    uint8_t inUse;
+    /** @brief Index of the next sample written */
+    uint32_t next;
+    /** @brief Number of valid samples */
+    uint32_t count;
+};
+
+class SensorHistoryRegion;
+
+/**
+ * @brief SensorHistory
+ *
+ * Fixed capacity ring buffer of the readings of one sensor. The timestamps
+ * and the values are kept in separate arrays so that a reader scanning the
+ * timestamps or copying the values touches only the memory it needs. The
+ * ring is a slot of a SensorHistoryRegion and is released with the object.
+ */
+class SensorHistory
+{
+  public:
+    SensorHistory() = delete;
+    SensorHistory(const SensorHistory&) = delete;
+    SensorHistory(SensorHistory&&) = delete;
+    SensorHistory& operator=(const SensorHistory&) = delete;
+    SensorHistory& operator=(SensorHistory&&) = delete;
+    ~SensorHistory();
+
+    SensorHistory(std::shared_ptr<SensorHistoryRegion> region, uint32_t slot);
+
+    /** @brief Add a reading, overwriting the oldest one when full
+     *
+     *  @param[in] timestamp - time of the reading in usec since the epoch
+     *  @param[in] value - the reading
+     */
+    void push(uint64_t timestamp, double value);
+
+    /** @brief Get the readings taken after a time
+     *
+     *  @param[in] since - time in usec since the epoch, 0 for all readings
+     *  @param[out] samples - the readings
+     */
+    void read(uint64_t since, SensorSamples& samples) const;
+
+    /** @brief Get the number of readings held */
+    size_t size() const;
+
+    /** @brief Get the maximum number of readings held */
+    size_t capacity() const;
+
+  private:
+    std::shared_ptr<SensorHistoryRegion> region;
+    uint32_t slot;
+};
+
+/**
+ * @brief SensorHistoryRegion
+ *
+ * Memory holding the ring buffers of all the sensors. The region is a POSIX
+ * shared memory object so that other processes can read the histories with
+ * SensorHistoryReader, it falls back to private memory when the shared
+ * memory object cannot be created.
+ */
+class SensorHistoryRegion :
+    public std::enable_shared_from_this<SensorHistoryRegion>
+{
+  public:
+    SensorHistoryRegion() = delete;
+    SensorHistoryRegion(const SensorHistoryRegion&) = delete;
+    SensorHistoryRegion(SensorHistoryRegion&&) = delete;
+    SensorHistoryRegion& operator=(const SensorHistoryRegion&) = delete;
+    SensorHistoryRegion& operator=(SensorHistoryRegion&&) = delete;
+    ~SensorHistoryRegion();
+
+    /** @brief Create the region
+     *
+     *  @param[in] shmName - name of the shared memory object, empty for
+     *                       private memory
+     *  @param[in] slotCount - maximum number of sensors
+     *  @param[in] capacity - number of readings kept per sensor
+     *
+     *  @return the region, nullptr if there is no memory for it
+     */
+    static std::shared_ptr<SensorHistoryRegion> create(
+        const std::string& shmName, uint32_t slotCount, uint32_t capacity);
+
+    /** @brief Allocate the ring buffer of a sensor
+     *
+     *  @param[in] tid - terminus ID of the sensor
+     *  @param[in] sensorId - sensor ID
+     *
+     *  @return the ring buffer, nullptr if all the slots are in use
+     */
+    std::unique_ptr<SensorHistory> allocate(pldm_tid_t tid, uint16_t sensorId);
+
+    /** @brief Get the readings of many sensors in one pass
+     *
+     *  @param[in] sensors - terminus and sensor IDs, empty for all sensors
+     *  @param[in] since - time in usec since the epoch, 0 for all readings
+     *
+     *  @return the readings of the sensors having a history
+     */
+    std::vector<SensorSamples> read(
+        const std::vector<std::pair<pldm_tid_t, uint16_t>>& sensors,
+        uint64_t since) const;
+
+    /** @brief Layout version, bumped on any change of the region layout */
+    static constexpr uint32_t version = 1;
+    static constexpr uint32_t magic = 0x53484c50; // "PLHS"
+
+  private:
+    friend class SensorHistory;
+
+    SensorHistoryRegion(const std::string& shmName, uint8_t* base,
+                        size_t size);
+
+    SensorHistoryHeader& header() const
+    {
+        return *reinterpret_cast<SensorHistoryHeader*>(base);
+    }
+
+    uint8_t* slotBase(uint32_t slot) const;
+
+    /** @brief Release the ring buffer of a sensor */
+    void release(uint32_t slot);
+
+    /** @brief Name of the shared memory object, empty for private memory */
+    std::string shmName;
+
+    /** @brief The mapped region */
+    uint8_t* base;
+    size_t size;
+
+    /** @brief Free slots */
+    std::vector<uint32_t> freeSlots;
+};
+
+/**
+ * @brief SensorHistoryReader
+ *
+ * Read only view of the sensor histories exported by pldmd, for consumers
+ * which need the readings of many sensors without a D-Bus call per sensor.
+ */
+class SensorHistoryReader
+{
+  public:
+    SensorHistoryReader(const SensorHistoryReader&) = delete;
+    SensorHistoryReader(SensorHistoryReader&&) = delete;
+    SensorHistoryReader& operator=(const SensorHistoryReader&) = delete;
+    SensorHistoryReader& operator=(SensorHistoryReader&&) = delete;
+    ~SensorHistoryReader();
+
+    /** @brief Map the shared memory object
+     *
+     *  @param[in] shmName - name of the shared memory object
+     */
+    explicit SensorHistoryReader(
+        const std::string& shmName = sensorHistoryShmName);
+
+    /** @brief Check if the histories are available */
+    bool isOpen() const
+    {
+        return base != nullptr;
+    }
+
+    /** @brief Get the readings of many sensors in one pass
+     *
+     *  @param[in] sensors - terminus and sensor IDs, empty for all sensors
+     *  @param[in] since - time in usec since the epoch, 0 for all readings
+     *
+     *  @return the readings of the sensors having a history
+     */
+    std::vector<SensorSamples> read(
+        const std::vector<std::pair<pldm_tid_t, uint16_t>>& sensors,
+        uint64_t since) const;
+
+  private:
+    const uint8_t* base = nullptr;
+    size_t size = 0;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -5,6 +5,7 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
 #include <exception>
 
 namespace pldm
@@ -12,13 +13,37 @@ namespace pldm
 namespace platform_mc
 {
 
-SensorManager::SensorManager(sdeventplus::Event& event,
-                             TerminusManager& terminusManager,
-                             TerminiMapper& termini, Manager* manager) :
+SensorManager::SensorManager(
+    sdeventplus::Event& event, TerminusManager& terminusManager,
+    TerminiMapper& termini, Manager* manager,
+    std::shared_ptr<SensorHistoryRegion> historyRegion) :
     event(event), terminusManager(terminusManager), termini(termini),
-    pollingTime(SENSOR_POLLING_TIME), manager(manager)
+    pollingTime(SENSOR_POLLING_TIME),
+    livenessTime(SENSOR_EVENT_LIVENESS_INTERVAL), manager(manager),
+    historyRegion(std::move(historyRegion))
 {}
 
+void SensorManager::recordReading(NumericSensor& sensor)
+{
+    if (!historyRegion)
+    {
+        return;
+    }
+
+    if (!sensor.history)
+    {
+        sensor.history = historyRegion->allocate(sensor.tid, sensor.sensorId);
+        if (!sensor.history)
+        {
+            return;
+        }
+    }
+
+    uint64_t now = 0;
+    sd_event_now(event.get(), CLOCK_REALTIME, &now);
+    sensor.history->push(now, sensor.getReading());
+}
+
 void SensorManager::startPolling(pldm_tid_t tid)
 {
     if (!termini.contains(tid))
@@ -84,6 +109,8 @@ void SensorManager::disableTerminusSensors(pldm_tid_t tid)
     {
         sensor->updateReading(true, false,
                               std::numeric_limits<double>::quiet_NaN());
+        // The events of the terminus are lost while it is not available
+        sensor->eventDriven = false;
     }
 }
 
@@ -166,6 +193,7 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
     uint64_t elapsed = 0;
     uint64_t pollingTimeInUsec = pollingTime * 1000;
     uint8_t rc = PLDM_SUCCESS;
+    SensorReadingBatch batch;
 
     do
     {
@@ -250,9 +278,16 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
 
             sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
             elapsed = t1 - sensor->timeStamp;
-            if ((sensor->updateTime <= elapsed) || (!sensor->timeStamp))
+            auto updateTime = sensor->updateTime;
+            if (sensor->eventDriven)
             {
-                rc = co_await getSensorReading(sensor);
+                updateTime =
+                    std::max(updateTime, uint64_t{livenessTime} * 1000);
+            }
+            if ((updateTime <= elapsed) || (!sensor->timeStamp))
+            {
+                auto batched = batch.sensors.size();
+                rc = co_await getSensorReading(sensor, &batch);
 
                 if ((!sensorPollTimers.contains(tid)) ||
                     (sensorPollTimers[tid] &&
@@ -263,13 +298,24 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
                 sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
                 if (rc == PLDM_SUCCESS)
                 {
-                    sensor->timeStamp = t1;
+                    // A batched reading is time stamped and recorded once it
+                    // is converted
+                    if (batch.sensors.size() == batched)
+                    {
+                        sensor->timeStamp = t1;
+                        recordReading(*sensor);
+                    }
+                    else
+                    {
+                        batch.timeStamps.emplace_back(t1);
+                    }
                 }
                 else
                 {
                     lg2::error(
                         "Failed to get sensor value for terminus {TID}, error: {RC}",
                         "TID", tid, "RC", rc);
+                    sensor->eventDriven = false;
                 }
             }
 
@@ -279,6 +325,8 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
             sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
         }
 
+        updateReadings(*terminus, batch);
+
         sd_event_now(event.get(), CLOCK_MONOTONIC, &t1);
     } while ((t1 - t0) >= pollingTimeInUsec);
 
@@ -286,7 +334,7 @@ exec::task<int> SensorManager::doSensorPollingTask(pldm_tid_t tid)
 }
 
 exec::task<int> SensorManager::getSensorReading(
-    std::shared_ptr<NumericSensor> sensor)
+    std::shared_ptr<NumericSensor> sensor, SensorReadingBatch* batch)
 {
     if (!sensor)
     {
@@ -363,6 +411,9 @@ exec::task<int> SensorManager::getSensorReading(
         co_return completionCode;
     }
 
+    checkSensorEvents(*sensor, sensorOperationalState,
+                      sensorEventMessageEnable, presentState);
+
     double value = std::numeric_limits<double>::quiet_NaN();
     switch (sensorOperationalState)
     {
@@ -405,9 +456,92 @@ exec::task<int> SensorManager::getSensorReading(
             break;
     }
 
+    if (batch)
+    {
+        batch->sensors.emplace_back(std::move(sensor));
+        batch->raw.emplace_back(value);
+        co_return completionCode;
+    }
+
     sensor->updateReading(true, true, value);
     co_return completionCode;
 }
 
+void SensorManager::checkSensorEvents(
+    NumericSensor& sensor, uint8_t operationalState,
+    uint8_t eventMessageEnable, uint8_t presentState)
+{
+    sensor.eventMessageEnabled =
+        livenessTime && (eventMessageEnable == PLDM_EVENTS_ENABLED ||
+                         eventMessageEnable == PLDM_STATE_EVENTS_ONLY_ENABLED);
+    if (!sensor.eventDriven)
+    {
+        return;
+    }
+
+    // The events of the sensor still match its state
+    if (sensor.eventMessageEnabled && operationalState == PLDM_SENSOR_ENABLED &&
+        presentState == sensor.eventState)
+    {
+        return;
+    }
+    lg2::info(
+        "Sensor {NAME} of terminus {TID} missed its events, polling it at its update interval.",
+        "NAME", sensor.sensorName, "TID", sensor.tid);
+    sensor.eventDriven = false;
+}
+
+void SensorManager::updateReadings(Terminus& terminus,
+                                   SensorReadingBatch& batch)
+{
+    auto& table = terminus.sensorConversions;
+
+    // Keep the sensors found in the conversion table, a sensor missing from
+    // it is converted on its own
+    size_t count = 0;
+    batch.indexes.clear();
+    for (size_t i = 0; i < batch.sensors.size(); ++i)
+    {
+        auto& sensor = batch.sensors[i];
+        auto index = sensor->conversionIndex;
+        if (index >= table.size() || table.sensorId(index) != sensor->sensorId)
+        {
+            sensor->updateReading(true, true, batch.raw[i]);
+            sensor->timeStamp = batch.timeStamps[i];
+            recordReading(*sensor);
+            continue;
+        }
+        if (sensor->takeThresholdsChanged())
+        {
+            // The thresholds were set on D-Bus since the last poll
+            table.update(index, sensor->getConversion());
+        }
+        batch.sensors[count] = std::move(sensor);
+        batch.raw[count] = batch.raw[i];
+        batch.timeStamps[count] = batch.timeStamps[i];
+        batch.indexes.emplace_back(index);
+        count++;
+    }
+    batch.sensors.resize(count);
+    batch.raw.resize(count);
+    batch.timeStamps.resize(count);
+    batch.values.resize(count);
+    batch.conditions.resize(count);
+
+    table.convert(batch.indexes, batch.raw, batch.values, batch.conditions);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        batch.sensors[i]->updateConvertedReading(batch.values[i],
+                                                 batch.conditions[i]);
+        batch.sensors[i]->timeStamp = batch.timeStamps[i];
+        recordReading(*batch.sensors[i]);
+    }
+
+    batch.sensors.clear();
+    batch.raw.clear();
+    batch.timeStamps.clear();
+}
+
 } // namespace platform_mc
 } // namespace pldm
@@ -2,6 +2,7 @@
 
 #include "common/types.hpp"
 #include "requester/handler.hpp"
+#include "sensor_history.hpp"
 #include "terminus.hpp"
 #include "terminus_manager.hpp"
 
@@ -21,6 +22,27 @@ namespace platform_mc
 
 using namespace pldm::pdr;
 
+/** @struct SensorReadingBatch
+ *
+ *  The raw readings of a poll window, converted in one batch by the
+ *  conversion table of the terminus at the end of the window. The time
+ *  stamp of a sensor is only updated once its reading is published, a batch
+ *  dropped by a stopped poll leaves its sensors due for the next one.
+ */
+struct SensorReadingBatch
+{
+    std::vector<std::shared_ptr<NumericSensor>> sensors;
+    std::vector<double> raw;
+    std::vector<uint64_t> timeStamps;
+
+    /** @brief Conversion table indexes, converted readings and threshold
+     *         conditions, filled when the batch is converted
+     */
+    std::vector<uint32_t> indexes;
+    std::vector<double> values;
+    std::vector<uint8_t> conditions;
+};
+
 /**
  * @brief SensorManager
  *
@@ -38,9 +60,19 @@ class SensorManager
     SensorManager& operator=(SensorManager&&) = delete;
     virtual ~SensorManager() = default;
 
-    explicit SensorManager(sdeventplus::Event& event,
-                           TerminusManager& terminusManager,
-                           TerminiMapper& termini, Manager* manager);
+    /** @brief Constructor
+     *
+     *  @param[in] event - reference of the main event loop
+     *  @param[in] terminusManager - reference of the terminus manager
+     *  @param[in] termini - the discovered termini
+     *  @param[in] manager - pointer to the platform-mc Manager
+     *  @param[in] historyRegion - memory the reading histories are kept in,
+     *                            nullptr to keep no history
+     */
+    explicit SensorManager(
+        sdeventplus::Event& event, TerminusManager& terminusManager,
+        TerminiMapper& termini, Manager* manager,
+        std::shared_ptr<SensorHistoryRegion> historyRegion = nullptr);
 
     /** @brief starting sensor polling task
      */
@@ -77,6 +109,21 @@ class SensorManager
         return availableState[tid];
     };
 
+    /** @brief Get the reading histories of the sensors
+     *
+     *  @return the histories, nullptr if they are disabled
+     */
+    std::shared_ptr<SensorHistoryRegion> getSensorHistory()
+    {
+        return historyRegion;
+    }
+
+    /** @brief Add the current reading of a sensor to its history
+     *
+     *  @param[in] sensor - the updated sensor
+     */
+    void recordReading(NumericSensor& sensor);
+
   protected:
     /** @brief start a coroutine for polling all sensors.
      */
@@ -92,9 +139,34 @@ class SensorManager
     /** @brief Sending getSensorReading command for the sensor
      *
      *  @param[in] sensor - the sensor to be updated
+     *  @param[in] batch - batch collecting the raw reading of an enabled
+     *                     sensor, nullptr to update the sensor at once
      *  @return coroutine return_value - PLDM completion code
      */
-    exec::task<int> getSensorReading(std::shared_ptr<NumericSensor> sensor);
+    exec::task<int> getSensorReading(std::shared_ptr<NumericSensor> sensor,
+                                     SensorReadingBatch* batch = nullptr);
+
+    /** @brief Check the liveness poll of a sensor updated from its events,
+     *         the sensor is polled at its update interval again when its
+     *         events are disabled or its state changed without an event
+     *
+     *  @param[in] sensor - the polled sensor
+     *  @param[in] operationalState - sensor operational state of the reading
+     *  @param[in] eventMessageEnable - event generation enable of the reading
+     *  @param[in] presentState - present event state of the reading
+     */
+    void checkSensorEvents(NumericSensor& sensor, uint8_t operationalState,
+                           uint8_t eventMessageEnable, uint8_t presentState);
+
+    /** @brief Convert the raw readings of a poll window with the conversion
+     *         table of the terminus, refreshing the entries of the sensors
+     *         whose thresholds were set, then update the sensors, their time
+     *         stamps and their histories
+     *
+     *  @param[in] terminus - terminus of the sensors
+     *  @param[in] batch - the raw readings, emptied
+     */
+    void updateReadings(Terminus& terminus, SensorReadingBatch& batch);
 
     /** @brief Reference to to PLDM daemon's main event loop.
      */
@@ -109,6 +181,10 @@ class SensorManager
     /** @brief sensor polling interval in ms. */
     uint32_t pollingTime;
 
+    /** @brief polling interval in ms of the sensors updated from their
+     *  events, 0 to poll all the sensors at their update interval */
+    uint32_t livenessTime;
+
     /** @brief sensor polling timers */
     std::map<pldm_tid_t, std::unique_ptr<sdbusplus::Timer>> sensorPollTimers;
 
@@ -124,6 +200,9 @@ class SensorManager
 
     /** @brief pointer to Manager */
     Manager* manager;
+
+    /** @brief Reading histories of the sensors */
+    std::shared_ptr<SensorHistoryRegion> historyRegion;
 };
 } // namespace platform_mc
 } // namespace pldm
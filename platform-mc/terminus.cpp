@@ -7,6 +7,7 @@
 
 #include <common/utils.hpp>
 
+#include <algorithm>
 #include <ranges>
 
 namespace pldm
@@ -14,6 +15,28 @@ namespace pldm
 namespace platform_mc
 {
 
+/** @brief Priority of a sensor in the creation order. The sensors consumed by
+ *         the thermal and power control loops are created first.
+ *
+ *  @param[in] baseUnit - sensor PDR base unit
+ *  @return priority, lower is created first
+ */
+static uint8_t sensorCreationPriority(uint8_t baseUnit)
+{
+    switch (baseUnit)
+    {
+        case PLDM_SENSOR_UNIT_DEGRESS_C:
+            return 0;
+        case PLDM_SENSOR_UNIT_WATTS:
+        case PLDM_SENSOR_UNIT_VOLTS:
+        case PLDM_SENSOR_UNIT_AMPS:
+        case PLDM_SENSOR_UNIT_RPM:
+            return 1;
+        default:
+            return 2;
+    }
+}
+
 Terminus::Terminus(pldm_tid_t tid, uint64_t supportedTypes,
                    sdeventplus::Event& event) :
     initialized(false), maxBufferSize(PLDM_PLATFORM_EVENT_MSG_MAX_BUFFER_SIZE),
@@ -120,9 +143,27 @@ bool Terminus::createInventoryPath(std::string tName)
 
 void Terminus::parseTerminusPDRs()
 {
-    for (auto& pdr : pdrs)
+    // The parsed PDRs refer to the records by position in pdrs, the sensors
+    // of a previous parse are replaced by the ones of the current PDRs
+    sensorCreationEvent.reset();
+    numericSensors.clear();
+    sensorConversions.clear();
+    entityAuxiliaryNamesTbl.clear();
+    sensorAuxiliaryNamesPdrs.clear();
+    sensorPdrs.clear();
+    sensorPdrIt = 0;
+
+    for (size_t index = 0; index < pdrs.size(); ++index)
     {
-        auto pdrHdr = new (pdr.data()) pldm_pdr_hdr;
+        auto pdr = pdrs[index];
+        if (pdr.size() < sizeof(pldm_pdr_hdr))
+        {
+            lg2::error("Skip PDR {INDEX} of invalid length {LENGTH}", "INDEX",
+                       index, "LENGTH", pdr.size());
+            continue;
+        }
+
+        auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
         switch (pdrHdr->type)
         {
             case PLDM_SENSOR_AUXILIARY_NAMES_PDR:
@@ -136,7 +177,8 @@ void Terminus::parseTerminusPDRs()
                         static_cast<uint32_t>(pdrHdr->record_handle));
                     continue;
                 }
-                sensorAuxiliaryNamesTbl.emplace_back(std::move(sensorAuxNames));
+                sensorAuxiliaryNamesPdrs.try_emplace(
+                    std::get<0>(*sensorAuxNames), index);
                 break;
             }
             case PLDM_NUMERIC_SENSOR_PDR:
@@ -150,7 +192,8 @@ void Terminus::parseTerminusPDRs()
                         static_cast<uint32_t>(pdrHdr->record_handle));
                     continue;
                 }
-                numericSensorPdrs.emplace_back(std::move(parsedPdr));
+                sensorPdrs.emplace_back(
+                    index, false, sensorCreationPriority(parsedPdr->base_unit));
                 break;
             }
             case PLDM_COMPACT_NUMERIC_SENSOR_PDR:
@@ -173,8 +216,10 @@ void Terminus::parseTerminusPDRs()
                         static_cast<uint32_t>(pdrHdr->record_handle));
                     continue;
                 }
-                compactNumericSensorPdrs.emplace_back(std::move(parsedPdr));
-                sensorAuxiliaryNamesTbl.emplace_back(std::move(sensorAuxNames));
+                sensorPdrs.emplace_back(
+                    index, true, sensorCreationPriority(parsedPdr->base_unit));
+                sensorAuxiliaryNamesPdrs.try_emplace(
+                    std::get<0>(*sensorAuxNames), index);
                 break;
             }
             case PLDM_ENTITY_AUXILIARY_NAMES_PDR:
@@ -201,6 +246,8 @@ void Terminus::parseTerminusPDRs()
         }
     }
 
+    std::ranges::stable_sort(sensorPdrs, {}, &SensorPdrInfo::priority);
+
     auto tName = findTerminusName();
     if (tName && !tName.value().empty())
     {
@@ -209,8 +256,7 @@ void Terminus::parseTerminusPDRs()
         terminusName = static_cast<std::string>(tName.value());
     }
 
-    if (terminusName.empty() &&
-        (numericSensorPdrs.size() || compactNumericSensorPdrs.size()))
+    if (terminusName.empty() && sensorPdrs.size())
     {
         lg2::error(
             "Terminus ID {TID}: DOES NOT have name. Skip Adding sensors.",
@@ -239,56 +285,65 @@ void Terminus::addNextSensorFromPDRs()
         return;
     }
 
-    auto pdrIt = sensorPdrIt;
-
-    if (pdrIt < numericSensorPdrs.size())
-    {
-        const auto& pdr = numericSensorPdrs[pdrIt];
-        // Defer adding the next Numeric Sensor
-        sensorCreationEvent = std::make_unique<sdeventplus::source::Defer>(
-            event,
-            std::bind(std::mem_fn(&Terminus::addNumericSensor), this, pdr));
-    }
-    else if (pdrIt < numericSensorPdrs.size() + compactNumericSensorPdrs.size())
-    {
-        pdrIt -= numericSensorPdrs.size();
-        const auto& pdr = compactNumericSensorPdrs[pdrIt];
-        // Defer adding the next Compact Numeric Sensor
-        sensorCreationEvent = std::make_unique<sdeventplus::source::Defer>(
-            event, std::bind(std::mem_fn(&Terminus::addCompactNumericSensor),
-                             this, pdr));
-    }
-    else
+    if (sensorPdrIt >= sensorPdrs.size())
     {
         sensorPdrIt = 0;
         return;
     }
 
-    // Move the iteration to the next sensor PDR
-    sensorPdrIt++;
+    // Defer adding the next batch of sensors
+    sensorCreationEvent = std::make_unique<sdeventplus::source::Defer>(
+        event, std::bind(std::mem_fn(&Terminus::addSensorBatch), this));
+}
+
+void Terminus::addSensorBatch()
+{
+    // Create a batch of sensors per event loop iteration, the other event
+    // sources still run between the batches
+    for (size_t count = 0;
+         count < sensorCreationBatchSize && sensorPdrIt < sensorPdrs.size();
+         ++count, ++sensorPdrIt)
+    {
+        const auto& sensorPdr = sensorPdrs[sensorPdrIt];
+        if (sensorPdr.position >= pdrs.size())
+        {
+            continue;
+        }
+
+        if (sensorPdr.compact)
+        {
+            addCompactNumericSensor(
+                parseCompactNumericSensorPDR(pdrs[sensorPdr.position]));
+        }
+        else
+        {
+            addNumericSensor(parseNumericSensorPDR(pdrs[sensorPdr.position]));
+        }
+    }
+
+    addNextSensorFromPDRs();
 }
 
 std::shared_ptr<SensorAuxiliaryNames> Terminus::getSensorAuxiliaryNames(
     SensorId id)
 {
-    auto it = std::find_if(
-        sensorAuxiliaryNamesTbl.begin(), sensorAuxiliaryNamesTbl.end(),
-        [id](
-            const std::shared_ptr<SensorAuxiliaryNames>& sensorAuxiliaryNames) {
-            const auto& [sensorId, sensorCnt, sensorNames] =
-                *sensorAuxiliaryNames;
-            return sensorId == id;
-        });
+    auto it = sensorAuxiliaryNamesPdrs.find(id);
+    if (it == sensorAuxiliaryNamesPdrs.end() || it->second >= pdrs.size())
+    {
+        return nullptr;
+    }
 
-    if (it != sensorAuxiliaryNamesTbl.end())
+    auto pdr = pdrs[it->second];
+    auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
+    if (pdrHdr->type == PLDM_COMPACT_NUMERIC_SENSOR_PDR)
     {
-        return *it;
+        return parseCompactNumericSensorNames(pdr);
     }
-    return nullptr;
+    return parseSensorAuxiliaryNamesPDR(pdr);
 };
 
 std::shared_ptr<SensorAuxiliaryNames> Terminus::parseSensorAuxiliaryNamesPDR(
-    const std::vector<uint8_t>& pdrData)
+    std::span<const uint8_t> pdrData)
 {
     constexpr uint8_t nullTerminator = 0;
     auto pdr = reinterpret_cast<const struct pldm_sensor_auxiliary_names_pdr*>(
@@ -343,7 +398,7 @@ std::shared_ptr<SensorAuxiliaryNames> Terminus::parseSensorAuxiliaryNamesPDR(
 }
 
 std::shared_ptr<EntityAuxiliaryNames> Terminus::parseEntityAuxiliaryNamesPDR(
-    const std::vector<uint8_t>& pdrData)
+    std::span<const uint8_t> pdrData)
 {
     auto names_offset = sizeof(struct pldm_pdr_hdr) +
                         PLDM_PDR_ENTITY_AUXILIARY_NAME_PDR_MIN_LENGTH;
@@ -405,7 +460,7 @@ std::shared_ptr<EntityAuxiliaryNames> Terminus::parseEntityAuxiliaryNamesPDR(
 }
 
 std::shared_ptr<pldm_numeric_sensor_value_pdr> Terminus::parseNumericSensorPDR(
-    const std::vector<uint8_t>& pdr)
+    std::span<const uint8_t> pdr)
 {
     const uint8_t* ptr = pdr.data();
     auto parsedPdr = std::make_shared<pldm_numeric_sensor_value_pdr>();
@@ -425,7 +480,7 @@ void Terminus::addNumericSensor(
         lg2::error(
             "Terminus ID {TID}: Skip adding Numeric Sensor - invalid pointer to PDR.",
             "TID", tid);
-        addNextSensorFromPDRs();
+        return;
     }
 
     auto sensorId = pdr->sensor_id;
@@ -436,7 +491,7 @@ void Terminus::addNumericSensor(
         lg2::error(
             "Terminus ID {TID}: Failed to get name for Numeric Sensor {SID}",
             "TID", tid, "SID", sensorId);
-        addNextSensorFromPDRs();
+        return;
     }
 
     std::string sensorName = sensorNames.front();
@@ -447,6 +502,9 @@ void Terminus::addNumericSensor(
             tid, true, pdr, sensorName, inventoryPath);
         lg2::info("Created NumericSensor {NAME}", "NAME", sensorName);
         numericSensors.emplace_back(sensor);
+        sensor->takeThresholdsChanged();
+        sensor->conversionIndex =
+            sensorConversions.add(sensor->sensorId, sensor->getConversion());
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -454,12 +512,10 @@ void Terminus::addNumericSensor(
             "Failed to create NumericSensor. error - {ERROR} sensorname - {NAME}",
             "ERROR", e, "NAME", sensorName);
     }
-
-    addNextSensorFromPDRs();
 }
 
 std::shared_ptr<SensorAuxiliaryNames> Terminus::parseCompactNumericSensorNames(
-    const std::vector<uint8_t>& sPdr)
+    std::span<const uint8_t> sPdr)
 {
     std::vector<std::vector<std::pair<NameLanguageTag, SensorName>>>
         sensorAuxNames{};
@@ -492,7 +548,7 @@ std::shared_ptr<SensorAuxiliaryNames> Terminus::parseCompactNumericSensorNames(
 }
 
 std::shared_ptr<pldm_compact_numeric_sensor_pdr>
-    Terminus::parseCompactNumericSensorPDR(const std::vector<uint8_t>& sPdr)
+    Terminus::parseCompactNumericSensorPDR(std::span<const uint8_t> sPdr)
 {
     auto pdr =
         reinterpret_cast<const pldm_compact_numeric_sensor_pdr*>(sPdr.data());
@@ -531,7 +587,7 @@ void Terminus::addCompactNumericSensor(
         lg2::error(
             "Terminus ID {TID}: Skip adding Compact Numeric Sensor - invalid pointer to PDR.",
             "TID", tid);
-        addNextSensorFromPDRs();
+        return;
     }
 
     auto sensorId = pdr->sensor_id;
@@ -542,7 +598,7 @@ void Terminus::addCompactNumericSensor(
         lg2::error(
             "Terminus ID {TID}: Failed to get name for Compact Numeric Sensor {SID}",
             "TID", tid, "SID", sensorId);
-        addNextSensorFromPDRs();
+        return;
     }
 
     std::string sensorName = sensorNames.front();
@@ -553,6 +609,9 @@ void Terminus::addCompactNumericSensor(
             tid, true, pdr, sensorName, inventoryPath);
         lg2::info("Created Compact NumericSensor {NAME}", "NAME", sensorName);
         numericSensors.emplace_back(sensor);
+        sensor->takeThresholdsChanged();
+        sensor->conversionIndex =
+            sensorConversions.add(sensor->sensorId, sensor->getConversion());
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -560,8 +619,6 @@ void Terminus::addCompactNumericSensor(
             "Failed to create Compact NumericSensor. error - {ERROR} sensorname - {NAME}",
             "ERROR", e, "NAME", sensorName);
     }
-
-    addNextSensorFromPDRs();
 }
 
 std::shared_ptr<NumericSensor> Terminus::getSensorObject(SensorId id)
@@ -3,6 +3,8 @@
 #include "common/types.hpp"
 #include "dbus_impl_fru.hpp"
 #include "numeric_sensor.hpp"
+#include "pdr_store.hpp"
+#include "sensor_conversion.hpp"
 #include "requester/handler.hpp"
 #include "terminus.hpp"
 
@@ -14,8 +16,10 @@
 
 #include <algorithm>
 #include <bitset>
+#include <span>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -129,7 +133,8 @@ class Terminus
         return true;
     }
 
-    /** @brief Parse the PDRs stored in the member variable, pdrs.
+    /** @brief Parse the PDRs stored in the member variable, pdrs. The
+     *         sensors created from previously parsed PDRs are removed.
      */
     void parseTerminusPDRs();
 
@@ -156,8 +161,8 @@ class Terminus
      */
     void updateInventoryWithFru(const uint8_t* fruData, const size_t fruLen);
 
-    /** @brief A list of PDRs fetched from Terminus */
-    std::vector<std::vector<uint8_t>> pdrs{};
+    /** @brief The PDRs fetched from Terminus */
+    PdrStore pdrs{};
 
     /** @brief A flag to indicate if terminus has been initialized */
     bool initialized = false;
@@ -173,6 +178,16 @@ class Terminus
     /** @brief A list of numericSensors */
     std::vector<std::shared_ptr<NumericSensor>> numericSensors{};
 
+    /** @brief Conversion factors and thresholds of the numeric sensors, the
+     *         readings of a poll are converted with it in one batch
+     */
+    SensorConversionTable sensorConversions;
+
+    /** @brief Number of sensors whose D-Bus objects are created per event
+     *         loop iteration
+     */
+    size_t sensorCreationBatchSize = SENSOR_CREATION_BATCH_SIZE;
+
     /** @brief The flag indicates that the terminus FIFO contains a large
      *         message that will require a multipart transfer via the
      *         PollForPlatformEvent command
@@ -225,7 +240,7 @@ class Terminus
      *  @return pointer to numeric sensor info struct
      */
     std::shared_ptr<pldm_numeric_sensor_value_pdr> parseNumericSensorPDR(
-        const std::vector<uint8_t>& pdrData);
+        std::span<const uint8_t> pdrData);
 
     /** @brief Parse the sensor Auxiliary name PDRs
      *
@@ -233,7 +248,7 @@ class Terminus
      *  @return pointer to sensor Auxiliary name info struct
      */
     std::shared_ptr<SensorAuxiliaryNames> parseSensorAuxiliaryNamesPDR(
-        const std::vector<uint8_t>& pdrData);
+        std::span<const uint8_t> pdrData);
 
     /** @brief Parse the Entity Auxiliary name PDRs
      *
@@ -241,7 +256,7 @@ class Terminus
      *  @return pointer to Entity Auxiliary name info struct
      */
     std::shared_ptr<EntityAuxiliaryNames> parseEntityAuxiliaryNamesPDR(
-        const std::vector<uint8_t>& pdrData);
+        std::span<const uint8_t> pdrData);
 
     /** @brief Construct the NumericSensor sensor class for the compact numeric
      *         PLDM sensor.
@@ -257,7 +272,7 @@ class Terminus
      *  @return pointer to compact numeric sensor info struct
      */
     std::shared_ptr<pldm_compact_numeric_sensor_pdr>
-        parseCompactNumericSensorPDR(const std::vector<uint8_t>& pdrData);
+        parseCompactNumericSensorPDR(std::span<const uint8_t> pdrData);
 
     /** @brief Parse the sensor Auxiliary name from compact numeric sensor PDRs
      *
@@ -265,7 +280,7 @@ class Terminus
      *  @return pointer to sensor Auxiliary name info struct
      */
     std::shared_ptr<SensorAuxiliaryNames> parseCompactNumericSensorNames(
-        const std::vector<uint8_t>& pdrData);
+        std::span<const uint8_t> pdrData);
 
     /** @brief Create the terminus inventory path to
      *         /xyz/openbmc_project/inventory/Item/Board/.
@@ -285,11 +300,16 @@ class Terminus
      */
     std::vector<std::string> getSensorNames(const SensorId& sensorId);
 
-    /** @brief Add the next sensor PDR to this terminus, iterated by
-     *         sensorPdrIt.
+    /** @brief Schedule the creation of the next batch of sensors from the
+     *         sensor PDRs of this terminus, iterated by sensorPdrIt.
      */
     void addNextSensorFromPDRs();
 
+    /** @brief Create the sensors of the next batch of sensor PDRs and
+     *         schedule the following batch.
+     */
+    void addSensorBatch();
+
     /* @brief The terminus's TID */
     pldm_tid_t tid;
 
@@ -309,9 +329,10 @@ class Terminus
     /* @brief The PLDM supported type version */
     std::map<uint8_t, ver32_t> supportedTypeVersions;
 
-    /* @brief Sensor Auxiliary Name list */
-    std::vector<std::shared_ptr<SensorAuxiliaryNames>>
-        sensorAuxiliaryNamesTbl{};
+    /* @brief Sensor ID to position in pdrs of the PDR holding the sensor
+     *        names, the names are parsed from the PDR on request
+     */
+    std::unordered_map<SensorId, size_t> sensorAuxiliaryNamesPdrs{};
 
     /* @brief Entity Auxiliary Name list */
     std::vector<std::shared_ptr<EntityAuxiliaryNames>>
@@ -334,16 +355,24 @@ class Terminus
     /** @brief The event source to defer sensor creation tasks to event loop*/
     std::unique_ptr<sdeventplus::source::Defer> sensorCreationEvent;
 
-    /** @brief Numeric Sensor PDR list */
-    std::vector<std::shared_ptr<pldm_numeric_sensor_value_pdr>>
-        numericSensorPdrs{};
+    /** @struct SensorPdrInfo
+     *
+     *  Sensor PDR waiting for the creation of its sensor object
+     */
+    struct SensorPdrInfo
+    {
+        size_t position;  //!< Position of the PDR in pdrs
+        bool compact;     //!< Compact Numeric Sensor PDR
+        uint8_t priority; //!< Creation priority, lower is created first
+    };
 
-    /** @brief Compact Numeric Sensor PDR list */
-    std::vector<std::shared_ptr<pldm_compact_numeric_sensor_pdr>>
-        compactNumericSensorPdrs{};
+    /** @brief The Numeric and Compact Numeric Sensor PDRs, in the order the
+     *         sensor objects are created
+     */
+    std::vector<SensorPdrInfo> sensorPdrs{};
 
     /** @brief Iteration to loop through sensor PDRs when adding sensors */
-    SensorId sensorPdrIt = 0;
+    size_t sensorPdrIt = 0;
 };
 } // namespace platform_mc
 } // namespace pldm
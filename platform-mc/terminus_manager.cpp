@@ -4,6 +4,8 @@
 
 #include <phosphor-logging/lg2.hpp>
 
+#include <algorithm>
+
 PHOSPHOR_LOG2_USING;
 
 namespace pldm
@@ -11,6 +13,49 @@ namespace pldm
 namespace platform_mc
 {
 
+namespace
+{
+
+/** @brief Run a task for each of the items, with at most limit of the tasks
+ *         in progress at a time. A task waiting for a slow item only holds
+ *         its own slot while the other items go on.
+ *
+ *  @param[in] items - the items
+ *  @param[in] limit - maximum number of tasks in progress
+ *  @param[in] fn - function returning the task of an item
+ */
+template <typename T, typename F>
+exec::task<void> forEachConcurrently(std::vector<T> items, size_t limit, F fn)
+{
+    exec::async_scope scope;
+    size_t next = 0;
+    auto worker = [&] -> exec::task<void> {
+        while (next < items.size())
+        {
+            const auto& item = items[next++];
+            try
+            {
+                co_await fn(item);
+            }
+            catch (const std::exception& e)
+            {
+                lg2::error("Concurrent task failed, error - {ERROR}", "ERROR",
+                           e);
+            }
+        }
+    };
+
+    auto workers = std::min(std::max<size_t>(limit, 1), items.size());
+    for (size_t i = 0; i < workers; i++)
+    {
+        scope.spawn(stdexec::just() | stdexec::let_value(worker),
+                    exec::default_task_context<void>(exec::inline_scheduler{}));
+    }
+    co_await scope.on_empty();
+}
+
+} // namespace
+
 std::optional<MctpInfo> TerminusManager::toMctpInfo(const pldm_tid_t& tid)
 {
     if (tid == PLDM_TID_UNASSIGNED || tid == PLDM_TID_RESERVED)
@@ -186,6 +231,7 @@ TerminiMapper::iterator TerminusManager::findTerminusPtr(
 exec::task<int> TerminusManager::discoverMctpTerminusTask()
 {
     std::vector<pldm_tid_t> addedTids;
+    int rc = PLDM_SUCCESS;
     while (!queuedMctpInfos.empty())
     {
         if (manager)
@@ -194,21 +240,37 @@ exec::task<int> TerminusManager::discoverMctpTerminusTask()
         }
 
         const MctpInfos& mctpInfos = queuedMctpInfos.front();
+        std::vector<MctpInfo> newMctpInfos;
         for (const auto& mctpInfo : mctpInfos)
         {
             auto it = findTerminusPtr(mctpInfo);
-            if (it == termini.end())
+            if (it == termini.end() &&
+                std::find(newMctpInfos.begin(), newMctpInfos.end(),
+                          mctpInfo) == newMctpInfos.end())
             {
                 mctpInfoAvailTable[mctpInfo] = true;
-                co_await initMctpTerminus(mctpInfo);
+                newMctpInfos.push_back(mctpInfo);
             }
+        }
 
+        co_await forEachConcurrently(
+            std::move(newMctpInfos), discoveryConcurrency,
+            [this](const MctpInfo& mctpInfo) {
+                return initMctpTerminus(mctpInfo);
+            });
+
+        for (const auto& mctpInfo : mctpInfos)
+        {
             /* Get TID of initialized terminus */
             auto tid = toTid(mctpInfo);
             if (!tid)
             {
+                // The other endpoints are discovered still
+                lg2::error("Failed to discover terminus of endpoint {EID}.",
+                           "EID", std::get<0>(mctpInfo));
                 mctpInfoAvailTable.erase(mctpInfo);
-                co_return PLDM_ERROR;
+                rc = PLDM_ERROR;
+                continue;
             }
             addedTids.push_back(tid.value());
         }
@@ -221,7 +283,7 @@ exec::task<int> TerminusManager::discoverMctpTerminusTask()
         queuedMctpInfos.pop();
     }
 
-    co_return PLDM_SUCCESS;
+    co_return rc;
 }
 
 void TerminusManager::removeMctpTerminus(const MctpInfos& mctpInfos)
@@ -237,7 +299,7 @@ void TerminusManager::removeMctpTerminus(const MctpInfos& mctpInfos)
 
         if (manager)
         {
-            manager->stopSensorPolling(it->second->getTid());
+            manager->handleRemovedTerminus(it->second->getTid());
         }
 
         unmapTid(it->first);
@@ -291,17 +353,11 @@ exec::task<int> TerminusManager::initMctpTerminus(const MctpInfo& mctpInfo)
                 isMapped = false;
             }
         }
-        /* Use the terminus TID for mapping */
+        /* Use the terminus TID for mapping, unless a terminus discovered
+         * concurrently already uses it */
         else
         {
-            auto mappedTid = storeTerminusInfo(mctpInfo, tid);
-            if (!mappedTid)
-            {
-                lg2::error("Failed to store Terminus Info for terminus {TID}.",
-                           "TID", tid);
-                co_return PLDM_ERROR;
-            }
-            isMapped = true;
+            isMapped = storeTerminusInfo(mctpInfo, tid).has_value();
         }
     }
 
@@ -352,9 +408,11 @@ exec::task<int> TerminusManager::initMctpTerminus(const MctpInfo& mctpInfo)
         co_return PLDM_ERROR;
     }
 
+    std::shared_ptr<Terminus> terminus;
     try
     {
-        termini[tid] = std::make_shared<Terminus>(tid, supportedTypes, event);
+        terminus = std::make_shared<Terminus>(tid, supportedTypes, event);
+        termini[tid] = terminus;
     }
     catch (const sdbusplus::exception_t& e)
     {
@@ -364,54 +422,135 @@ exec::task<int> TerminusManager::initMctpTerminus(const MctpInfo& mctpInfo)
         co_return PLDM_ERROR;
     }
 
-    uint8_t type = PLDM_BASE;
-    auto size = PLDM_MAX_TYPES * (PLDM_MAX_CMDS_PER_TYPE / 8);
-    std::vector<uint8_t> pldmCmds(size);
-    while ((type < PLDM_MAX_TYPES))
+    // A terminus discovered again reporting the same types, and the same
+    // version of each type, is not asked the commands of its types. The
+    // versions change with the firmware of the terminus.
+    const auto& uuid = std::get<1>(mctpInfo);
+    auto cached = capabilityCache.find(uuid, supportedTypes);
+    if (cached)
     {
-        if (!termini[tid]->doesSupportType(type))
+        if (co_await matchTypeVersions(tid, *cached))
         {
-            type++;
-            continue;
+            for (const auto& [type, version] : cached->typeVersions)
+            {
+                terminus->setSupportedTypeVersions(type, version);
+            }
+            terminus->setSupportedCommands(cached->supportedCmds);
+            lg2::info("Restored capabilities of terminus {TID} from cache",
+                      "TID", tid);
+            co_return PLDM_SUCCESS;
         }
 
-        ver32_t version{0xFF, 0xFF, 0xFF, 0xFF};
-        auto rc = co_await getPLDMVersion(tid, type, &version);
-        if (rc)
-        {
-            lg2::error(
-                "Failed to Get PLDM Version for terminus {TID}, PLDM Type {TYPE}, error {ERROR}",
-                "TID", tid, "TYPE", type, "ERROR", rc);
-        }
-        termini[tid]->setSupportedTypeVersions(type, version);
-        std::vector<bitfield8_t> cmds(PLDM_MAX_CMDS_PER_TYPE / 8);
-        rc = co_await getPLDMCommands(tid, type, version, cmds.data());
-        if (rc)
+        lg2::info(
+            "Cached capabilities of terminus {TID} are stale, query them again",
+            "TID", tid);
+        capabilityCache.remove(uuid);
+    }
+
+    std::vector<uint8_t> types;
+    for (uint8_t type = PLDM_BASE; type < PLDM_MAX_TYPES; type++)
+    {
+        if (terminus->doesSupportType(type))
         {
-            lg2::error(
-                "Failed to Get PLDM Commands for terminus {TID}, error {ERROR}",
-                "TID", tid, "ERROR", rc);
+            types.push_back(type);
         }
+    }
 
-        for (size_t i = 0; i < cmds.size(); i++)
-        {
-            auto idx = type * (PLDM_MAX_CMDS_PER_TYPE / 8) + i;
-            if (idx >= pldmCmds.size())
+    // The queries of the types are queued together, the requester handler
+    // sends them to the endpoint one after the other
+    TerminusCapabilities capabilities{};
+    capabilities.supportedTypes = supportedTypes;
+    capabilities.supportedCmds.resize(PLDM_MAX_TYPES *
+                                      (PLDM_MAX_CMDS_PER_TYPE / 8));
+    bool complete = true;
+    co_await forEachConcurrently(
+        std::move(types), maxConcurrentTypeQueries,
+        [&](uint8_t type) -> exec::task<void> {
+            if (co_await initPLDMType(terminus, type, capabilities))
             {
-                lg2::error(
-                    "Calculated index {IDX} out of bounds for pldmCmds, type {TYPE}, command index {CMD_IDX}",
-                    "IDX", idx, "TYPE", type, "CMD_IDX", i);
-                continue;
+                complete = false;
             }
-            pldmCmds[idx] = cmds[i].byte;
-        }
-        type++;
+        });
+    terminus->setSupportedCommands(capabilities.supportedCmds);
+
+    // Only the capabilities fully reported are kept
+    if (complete)
+    {
+        capabilityCache.store(uuid, capabilities);
     }
-    termini[tid]->setSupportedCommands(pldmCmds);
 
     co_return PLDM_SUCCESS;
 }
 
+exec::task<bool> TerminusManager::matchTypeVersions(
+    pldm_tid_t tid, const TerminusCapabilities& capabilities)
+{
+    std::vector<uint8_t> types;
+    for (const auto& [type, version] : capabilities.typeVersions)
+    {
+        types.push_back(type);
+    }
+
+    bool match = true;
+    co_await forEachConcurrently(
+        std::move(types), maxConcurrentTypeQueries,
+        [&](uint8_t type) -> exec::task<void> {
+            ver32_t version{0xFF, 0xFF, 0xFF, 0xFF};
+            auto rc = co_await getPLDMVersion(tid, type, &version);
+            const auto& cachedVersion = capabilities.typeVersions.at(type);
+            if (rc || version.major != cachedVersion.major ||
+                version.minor != cachedVersion.minor ||
+                version.update != cachedVersion.update ||
+                version.alpha != cachedVersion.alpha)
+            {
+                match = false;
+            }
+        });
+    co_return match;
+}
+
+exec::task<int> TerminusManager::initPLDMType(
+    std::shared_ptr<Terminus> terminus, uint8_t type,
+    TerminusCapabilities& capabilities)
+{
+    auto tid = terminus->getTid();
+    ver32_t version{0xFF, 0xFF, 0xFF, 0xFF};
+    auto rc = co_await getPLDMVersion(tid, type, &version);
+    if (rc)
+    {
+        lg2::error(
+            "Failed to Get PLDM Version for terminus {TID}, PLDM Type {TYPE}, error {ERROR}",
+            "TID", tid, "TYPE", type, "ERROR", rc);
+    }
+    terminus->setSupportedTypeVersions(type, version);
+    capabilities.typeVersions[type] = version;
+    std::vector<bitfield8_t> cmds(PLDM_MAX_CMDS_PER_TYPE / 8);
+    auto cmdsRc = co_await getPLDMCommands(tid, type, version, cmds.data());
+    if (cmdsRc)
+    {
+        lg2::error(
+            "Failed to Get PLDM Commands for terminus {TID}, error {ERROR}",
+            "TID", tid, "ERROR", cmdsRc);
+        rc = cmdsRc;
+    }
+
+    auto& pldmCmds = capabilities.supportedCmds;
+    for (size_t i = 0; i < cmds.size(); i++)
+    {
+        auto idx = type * (PLDM_MAX_CMDS_PER_TYPE / 8) + i;
+        if (idx >= pldmCmds.size())
+        {
+            lg2::error(
+                "Calculated index {IDX} out of bounds for pldmCmds, type {TYPE}, command index {CMD_IDX}",
+                "IDX", idx, "TYPE", type, "CMD_IDX", i);
+            continue;
+        }
+        pldmCmds[idx] = cmds[i].byte;
+    }
+
+    co_return rc;
+}
+
 exec::task<int> TerminusManager::sendRecvPldmMsgOverMctp(
     mctp_eid_t eid, Request& request, const pldm_msg** responseMsg,
     size_t* responseLen)
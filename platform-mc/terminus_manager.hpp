@@ -5,6 +5,7 @@
 #include "requester/handler.hpp"
 #include "requester/mctp_endpoint_discovery.hpp"
 #include "terminus.hpp"
+#include "terminus_snapshot.hpp"
 
 #include <libpldm/platform.h>
 #include <libpldm/pldm.h>
@@ -44,6 +45,10 @@ class Manager;
 class TerminusManager
 {
   public:
+    /** @brief Maximum number of PLDM types of a terminus queried at a time,
+     *         each one holds an instance ID of the endpoint */
+    static constexpr size_t maxConcurrentTypeQueries = 8;
+
     TerminusManager() = delete;
     TerminusManager(const TerminusManager&) = delete;
     TerminusManager(TerminusManager&&) = delete;
@@ -51,13 +56,20 @@ class TerminusManager
     TerminusManager& operator=(TerminusManager&&) = delete;
     virtual ~TerminusManager() = default;
 
+    /** @brief Constructor
+     *
+     *  @param[in] capabilityDir - directory of the capabilities of the termini
+     *                             kept across restarts, an empty path keeps
+     *                             them in memory only
+     */
     explicit TerminusManager(
         sdeventplus::Event& event, RequesterHandler& handler,
         pldm::InstanceIdDb& instanceIdDb, TerminiMapper& termini,
-        Manager* manager, mctp_eid_t localEid) :
+        Manager* manager, mctp_eid_t localEid,
+        const std::filesystem::path& capabilityDir = {}) :
         handler(handler), instanceIdDb(instanceIdDb), termini(termini),
         tidPool(tidPoolSize, false), manager(manager), localEid(localEid),
-        event(event)
+        event(event), capabilityCache(capabilityDir)
     {
         // DSP0240 v1.1.0 table-8, special value: 0,0xFF = reserved
         tidPool[0] = true;
@@ -181,6 +193,10 @@ class TerminusManager
     std::optional<mctp_eid_t> getActiveEidByName(
         const std::string& terminusName);
 
+  protected:
+    /** @brief Maximum number of MCTP endpoints initialized at a time */
+    size_t discoveryConcurrency = TERMINUS_DISCOVERY_CONCURRENCY;
+
   private:
     /** @brief Find the terminus object pointer in termini list.
      *
@@ -202,6 +218,30 @@ class TerminusManager
      */
     exec::task<int> initMctpTerminus(const MctpInfo& mctpInfo);
 
+    /** @brief Get the version and the supported commands of a PLDM type
+     *         supported by a terminus
+     *
+     *  @param[in] terminus - the terminus
+     *  @param[in] type - PLDM Type
+     *  @param[out] capabilities - capabilities of the terminus, the version
+     *                             and the commands of the type are set
+     *  @return coroutine return_value - PLDM completion code
+     */
+    exec::task<int> initPLDMType(std::shared_ptr<Terminus> terminus,
+                                 uint8_t type,
+                                 TerminusCapabilities& capabilities);
+
+    /** @brief Check the cached capabilities of a terminus against the
+     *         version of each of its PLDM types
+     *
+     *  @param[in] tid - Terminus ID
+     *  @param[in] capabilities - the cached capabilities
+     *  @return coroutine return_value - true if the terminus reports the
+     *          cached version of every type
+     */
+    exec::task<bool> matchTypeVersions(
+        pldm_tid_t tid, const TerminusCapabilities& capabilities);
+
     /** @brief Send getTID PLDM command to destination EID and then return the
      *         value of tid in reference parameter.
      *
@@ -293,6 +333,9 @@ class TerminusManager
      *  work
      */
     sdeventplus::Event& event;
+
+    /** @brief Capabilities of the termini by MCTP endpoint UUID */
+    TerminusCapabilityCache capabilityCache;
 };
 } // namespace platform_mc
 } // namespace pldm
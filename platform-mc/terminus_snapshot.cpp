@@ -0,0 +1,441 @@
+#include "terminus_snapshot.hpp"
+
+#include "requester/mctp_endpoint_discovery.hpp"
+
+#include <endian.h>
+#include <libpldm/utils.h>
+
+#include <phosphor-logging/lg2.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string_view>
+
+PHOSPHOR_LOG2_USING;
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+namespace
+{
+
+constexpr std::string_view snapshotMagic = "PLDMSNAP";
+constexpr std::string_view capabilityMagic = "PLDMCAPS";
+
+void appendLe32(std::vector<uint8_t>& buffer, uint32_t value)
+{
+    value = htole32(value);
+    auto bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+}
+
+/** @brief Bounds checked reader of a snapshot image */
+class SnapshotReader
+{
+  public:
+    explicit SnapshotReader(std::span<const uint8_t> data) : data(data) {}
+
+    bool read(std::span<const uint8_t>& bytes, size_t length)
+    {
+        if (data.size() - offset < length)
+        {
+            return false;
+        }
+        bytes = data.subspan(offset, length);
+        offset += length;
+        return true;
+    }
+
+    bool readLe32(uint32_t& value)
+    {
+        std::span<const uint8_t> bytes;
+        if (!read(bytes, sizeof(value)))
+        {
+            return false;
+        }
+        std::memcpy(&value, bytes.data(), sizeof(value));
+        value = le32toh(value);
+        return true;
+    }
+
+    bool atEnd() const
+    {
+        return offset == data.size();
+    }
+
+  private:
+    std::span<const uint8_t> data;
+    size_t offset = 0;
+};
+
+/** @brief Check that a UUID identifies an endpoint and can name a file */
+bool isUsableUUID(const UUID& uuid)
+{
+    if (uuid.empty() || uuid == emptyUUID)
+    {
+        return false;
+    }
+
+    // The UUID names the file, only accept its canonical characters
+    return std::ranges::all_of(uuid, [](char c) {
+        return std::isxdigit(static_cast<unsigned char>(c)) || c == '-';
+    });
+}
+
+/** @brief Read a cache file and check its CRC32 trailer
+ *
+ *  @return the content without the trailer, std::nullopt if the file can not
+ *          be read or is corrupted
+ */
+std::optional<std::vector<uint8_t>> readImage(
+    const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return std::nullopt;
+    }
+    std::vector<uint8_t> image((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+
+    uint32_t checksum = 0;
+    if (image.size() < snapshotMagic.size() + sizeof(checksum))
+    {
+        lg2::error("Ignore truncated terminus cache file {PATH}", "PATH",
+                   path.string());
+        return std::nullopt;
+    }
+    auto payloadSize = image.size() - sizeof(checksum);
+    std::memcpy(&checksum, image.data() + payloadSize, sizeof(checksum));
+    if (le32toh(checksum) != pldm_edac_crc32(image.data(), payloadSize))
+    {
+        lg2::error("Ignore terminus cache file {PATH} with a bad checksum",
+                   "PATH", path.string());
+        return std::nullopt;
+    }
+    image.resize(payloadSize);
+    return image;
+}
+
+/** @brief Write a cache file with a CRC32 trailer, replacing the previous one
+ *
+ *  @return true if the file is written
+ */
+bool writeImage(const std::filesystem::path& path, std::vector<uint8_t> image)
+{
+    appendLe32(image, pldm_edac_crc32(image.data(), image.size()));
+
+    // Write a new file and rename it over the previous one, a crash leaves
+    // either the old or the new file in place
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    auto tmpPath = path;
+    tmpPath += ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(image.data()), image.size());
+        if (!file.flush())
+        {
+            lg2::error("Failed to write terminus cache file {PATH}", "PATH",
+                       tmpPath.string());
+            std::filesystem::remove(tmpPath, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec)
+    {
+        lg2::error("Failed to save terminus cache file {PATH}, error {ERROR}",
+                   "PATH", path.string(), "ERROR", ec.message());
+        std::filesystem::remove(tmpPath, ec);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+std::optional<std::filesystem::path> TerminusSnapshotCache::snapshotPath(
+    const UUID& uuid) const
+{
+    if (cacheDir.empty() || !isUsableUUID(uuid))
+    {
+        return std::nullopt;
+    }
+
+    return cacheDir / (uuid + ".snapshot");
+}
+
+bool TerminusSnapshotCache::load(const UUID& uuid, PdrRepositoryInfo& info,
+                                 PdrStore& pdrs,
+                                 std::vector<uint8_t>& fruData) const
+{
+    auto path = snapshotPath(uuid);
+    if (!path)
+    {
+        return false;
+    }
+
+    auto image = readImage(*path);
+    if (!image)
+    {
+        return false;
+    }
+    auto payloadSize = image->size();
+
+    SnapshotReader reader(*image);
+    std::span<const uint8_t> magic;
+    std::span<const uint8_t> updateTime;
+    uint32_t version = 0;
+    PdrRepositoryInfo snapshotInfo{};
+    uint32_t pdrCount = 0;
+    uint32_t fruLength = 0;
+    if (!reader.read(magic, snapshotMagic.size()) ||
+        !std::ranges::equal(magic, snapshotMagic) ||
+        !reader.readLe32(version) || version != formatVersion)
+    {
+        lg2::info("Ignore terminus snapshot {PATH} of another format",
+                  "PATH", path->string());
+        return false;
+    }
+
+    if (!reader.read(updateTime, snapshotInfo.updateTime.size()) ||
+        !reader.readLe32(snapshotInfo.recordCount) ||
+        !reader.readLe32(snapshotInfo.repositorySize) ||
+        !reader.readLe32(snapshotInfo.largestRecordSize) ||
+        !reader.readLe32(pdrCount) || !reader.readLe32(fruLength))
+    {
+        lg2::error("Ignore malformed terminus snapshot {PATH}", "PATH",
+                   path->string());
+        return false;
+    }
+    std::ranges::copy(updateTime, snapshotInfo.updateTime.begin());
+
+    PdrStore snapshotPdrs;
+    snapshotPdrs.reserve(payloadSize, pdrCount);
+    for (uint32_t i = 0; i < pdrCount; ++i)
+    {
+        uint32_t length = 0;
+        std::span<const uint8_t> pdr;
+        if (!reader.readLe32(length) || !reader.read(pdr, length))
+        {
+            lg2::error("Ignore malformed terminus snapshot {PATH}", "PATH",
+                       path->string());
+            return false;
+        }
+        snapshotPdrs.add(pdr);
+    }
+
+    std::span<const uint8_t> fru;
+    if (!reader.read(fru, fruLength) || !reader.atEnd())
+    {
+        lg2::error("Ignore malformed terminus snapshot {PATH}", "PATH",
+                   path->string());
+        return false;
+    }
+
+    snapshotPdrs.shrinkToFit();
+    info = snapshotInfo;
+    pdrs = std::move(snapshotPdrs);
+    fruData.assign(fru.begin(), fru.end());
+    return true;
+}
+
+bool TerminusSnapshotCache::save(const UUID& uuid,
+                                 const PdrRepositoryInfo& info,
+                                 const PdrStore& pdrs,
+                                 const std::vector<uint8_t>& fruData) const
+{
+    auto path = snapshotPath(uuid);
+    if (!path)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> image(snapshotMagic.begin(), snapshotMagic.end());
+    appendLe32(image, formatVersion);
+    image.insert(image.end(), info.updateTime.begin(), info.updateTime.end());
+    appendLe32(image, info.recordCount);
+    appendLe32(image, info.repositorySize);
+    appendLe32(image, info.largestRecordSize);
+    appendLe32(image, static_cast<uint32_t>(pdrs.size()));
+    appendLe32(image, static_cast<uint32_t>(fruData.size()));
+    for (const auto& pdr : pdrs)
+    {
+        appendLe32(image, static_cast<uint32_t>(pdr.size()));
+        image.insert(image.end(), pdr.begin(), pdr.end());
+    }
+    image.insert(image.end(), fruData.begin(), fruData.end());
+    return writeImage(*path, std::move(image));
+}
+
+void TerminusSnapshotCache::remove(const UUID& uuid) const
+{
+    auto path = snapshotPath(uuid);
+    if (path)
+    {
+        std::error_code ec;
+        std::filesystem::remove(*path, ec);
+    }
+}
+
+std::optional<std::filesystem::path> TerminusCapabilityCache::capabilityPath(
+    const UUID& uuid) const
+{
+    if (cacheDir.empty() || !isUsableUUID(uuid))
+    {
+        return std::nullopt;
+    }
+
+    return cacheDir / (uuid + ".capabilities");
+}
+
+std::optional<TerminusCapabilities> TerminusCapabilityCache::load(
+    const UUID& uuid) const
+{
+    auto path = capabilityPath(uuid);
+    if (!path)
+    {
+        return std::nullopt;
+    }
+
+    auto image = readImage(*path);
+    if (!image)
+    {
+        return std::nullopt;
+    }
+
+    SnapshotReader reader(*image);
+    std::span<const uint8_t> magic;
+    uint32_t version = 0;
+    if (!reader.read(magic, capabilityMagic.size()) ||
+        !std::ranges::equal(magic, capabilityMagic) ||
+        !reader.readLe32(version) || version != formatVersion)
+    {
+        lg2::info("Ignore terminus capabilities {PATH} of another format",
+                  "PATH", path->string());
+        return std::nullopt;
+    }
+
+    TerminusCapabilities capabilities{};
+    uint32_t typesLow = 0;
+    uint32_t typesHigh = 0;
+    uint32_t versionCount = 0;
+    if (!reader.readLe32(typesLow) || !reader.readLe32(typesHigh) ||
+        !reader.readLe32(versionCount))
+    {
+        lg2::error("Ignore malformed terminus capabilities {PATH}", "PATH",
+                   path->string());
+        return std::nullopt;
+    }
+    capabilities.supportedTypes = (uint64_t{typesHigh} << 32) | typesLow;
+
+    for (uint32_t i = 0; i < versionCount; ++i)
+    {
+        std::span<const uint8_t> entry;
+        ver32_t typeVersion{};
+        if (!reader.read(entry, 1 + sizeof(typeVersion)))
+        {
+            lg2::error("Ignore malformed terminus capabilities {PATH}",
+                       "PATH", path->string());
+            return std::nullopt;
+        }
+        std::memcpy(&typeVersion, entry.data() + 1, sizeof(typeVersion));
+        capabilities.typeVersions[entry[0]] = typeVersion;
+    }
+
+    std::span<const uint8_t> cmds;
+    if (!reader.read(cmds, PLDM_MAX_TYPES * (PLDM_MAX_CMDS_PER_TYPE / 8)) ||
+        !reader.atEnd())
+    {
+        lg2::error("Ignore malformed terminus capabilities {PATH}", "PATH",
+                   path->string());
+        return std::nullopt;
+    }
+    capabilities.supportedCmds.assign(cmds.begin(), cmds.end());
+    return capabilities;
+}
+
+std::optional<TerminusCapabilities> TerminusCapabilityCache::find(
+    const UUID& uuid, uint64_t supportedTypes)
+{
+    if (!isUsableUUID(uuid))
+    {
+        return std::nullopt;
+    }
+
+    auto it = capabilities.find(uuid);
+    if (it == capabilities.end())
+    {
+        auto loaded = load(uuid);
+        if (!loaded)
+        {
+            return std::nullopt;
+        }
+        it = capabilities.emplace(uuid, std::move(*loaded)).first;
+    }
+
+    if (it->second.supportedTypes != supportedTypes)
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+bool TerminusCapabilityCache::store(const UUID& uuid,
+                                    const TerminusCapabilities& terminusCaps)
+{
+    if (!isUsableUUID(uuid) ||
+        terminusCaps.supportedCmds.size() !=
+            PLDM_MAX_TYPES * (PLDM_MAX_CMDS_PER_TYPE / 8))
+    {
+        return false;
+    }
+    capabilities.insert_or_assign(uuid, terminusCaps);
+
+    auto path = capabilityPath(uuid);
+    if (!path)
+    {
+        return true;
+    }
+
+    std::vector<uint8_t> image(capabilityMagic.begin(),
+                               capabilityMagic.end());
+    appendLe32(image, formatVersion);
+    auto types = terminusCaps.supportedTypes;
+    appendLe32(image, static_cast<uint32_t>(types));
+    appendLe32(image, static_cast<uint32_t>(types >> 32));
+    appendLe32(image,
+               static_cast<uint32_t>(terminusCaps.typeVersions.size()));
+    for (const auto& [type, typeVersion] : terminusCaps.typeVersions)
+    {
+        image.push_back(type);
+        auto bytes = reinterpret_cast<const uint8_t*>(&typeVersion);
+        image.insert(image.end(), bytes, bytes + sizeof(typeVersion));
+    }
+    image.insert(image.end(), terminusCaps.supportedCmds.begin(),
+                 terminusCaps.supportedCmds.end());
+    return writeImage(*path, std::move(image));
+}
+
+void TerminusCapabilityCache::remove(const UUID& uuid)
+{
+    capabilities.erase(uuid);
+    auto path = capabilityPath(uuid);
+    if (path)
+    {
+        std::error_code ec;
+        std::filesystem::remove(*path, ec);
+    }
+}
+
+} // namespace platform_mc
+} // namespace pldm
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "common/types.hpp"
+#include "pdr_store.hpp"
+
+#include <libpldm/platform.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace pldm
+{
+namespace platform_mc
+{
+
+/** @struct PdrRepositoryInfo
+ *
+ *  The state of a PDR repository reported by GetPDRRepositoryInfo. A
+ *  snapshot of the repository is current as long as the terminus reports
+ *  the same state.
+ */
+struct PdrRepositoryInfo
+{
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime{};
+    uint32_t recordCount = 0;
+    uint32_t repositorySize = 0;
+    uint32_t largestRecordSize = 0;
+
+    bool operator==(const PdrRepositoryInfo&) const = default;
+};
+
+/**
+ * @brief TerminusSnapshotCache
+ *
+ * Persists the PDRs and the FRU record table of the MCTP termini, so that
+ * their sensors can be brought up on a daemon restart without downloading
+ * the PDRs again. There is one file per terminus, named after the MCTP
+ * endpoint UUID, holding a versioned binary image with a CRC32 trailer. A
+ * snapshot which does not match the format version or the checksum is
+ * ignored.
+ */
+class TerminusSnapshotCache
+{
+  public:
+    /** @brief Constructor
+     *
+     *  @param[in] cacheDir - directory of the snapshots, an empty path
+     *                        disables the cache
+     */
+    explicit TerminusSnapshotCache(const std::filesystem::path& cacheDir) :
+        cacheDir(cacheDir)
+    {}
+
+    /** @brief Load the snapshot of a terminus
+     *
+     *  @param[in] uuid - MCTP endpoint UUID of the terminus
+     *  @param[out] info - repository state the snapshot was taken at
+     *  @param[out] pdrs - the PDRs
+     *  @param[out] fruData - the FRU record table
+     *
+     *  @return true if a valid snapshot is loaded, the outputs are not
+     *          modified otherwise
+     */
+    bool load(const UUID& uuid, PdrRepositoryInfo& info, PdrStore& pdrs,
+              std::vector<uint8_t>& fruData) const;
+
+    /** @brief Save the snapshot of a terminus, replacing the previous one
+     *
+     *  @param[in] uuid - MCTP endpoint UUID of the terminus
+     *  @param[in] info - repository state the PDRs were fetched at
+     *  @param[in] pdrs - the PDRs
+     *  @param[in] fruData - the FRU record table
+     *
+     *  @return true if the snapshot is saved
+     */
+    bool save(const UUID& uuid, const PdrRepositoryInfo& info,
+              const PdrStore& pdrs, const std::vector<uint8_t>& fruData) const;
+
+    /** @brief Remove the snapshot of a terminus
+     *
+     *  @param[in] uuid - MCTP endpoint UUID of the terminus
+     */
+    void remove(const UUID& uuid) const;
+
+    /** @brief Version of the snapshot format, bumped on any layout change */
+    static constexpr uint32_t formatVersion = 1;
+
+  private:
+    /** @brief Get the snapshot file of a terminus
+     *
+     *  @param[in] uuid - MCTP endpoint UUID of the terminus
+     *
+     *  @return the file path, std::nullopt if the cache is disabled or the
+     *          endpoint has no usable UUID
+     */
+    std::optional<std::filesystem::path> snapshotPath(const UUID& uuid) const;
+
+    /** @brief Directory of the snapshots */
+    std::filesystem::path cacheDir;
+};
+
+/** @struct TerminusCapabilities
+ *
+ *  The PLDM types of a terminus with their versions and supported commands,
+ *  as reported by GetPLDMTypes, GetPLDMVersion and GetPLDMCommands.
+ */
+struct TerminusCapabilities
+{
+    uint64_t supportedTypes = 0;
+    std::map<uint8_t, ver32_t> typeVersions;
+
+    /** @brief Bit mask of the supported commands of all the types, as set
+     *         with Terminus::setSupportedCommands */
+    std::vector<uint8_t> supportedCmds;
+};
+
+/**
+ * @brief TerminusCapabilityCache
+ *
+ * Keeps the capabilities of the MCTP termini by endpoint UUID, in memory and
+ * in a file per terminus next to the snapshots, so that a terminus which is
+ * discovered again is not asked the commands of its PLDM types. The cached
+ * capabilities are used as long as the terminus reports the same types, and
+ * the same version of each type.
+ */
+class TerminusCapabilityCache
+{
+  public:
+    /** @brief Constructor
+     *
+     *  @param[in] cacheDir - directory of the capability files, an empty
+     *                        path keeps the capabilities in memory only
+     */
+    explicit TerminusCapabilityCache(const std::filesystem::path& cacheDir) :
+        cacheDir(cacheDir)
+    {}
+
+    /** @brief Find the capabilities of a terminus
+     *
+     *  @param[in] uuid - MCTP endpoint UUID of the terminus
+     *  @param[in] supportedTypes - PLDM types reported by the terminus
+     *
+     *  @return the capabilities, std::nullopt if none are cached or they
+     *          were queried for other types
+     */
+    std::optional<TerminusCapabilities> find(const UUID& uuid,
+                                             uint64_t supportedTypes);
+
+    /** @brief Store the capabilities of a terminus
+     *
+     *  @param[in] uuid - MCTP endpoint UUID of the terminus
+     *  @param[in] terminusCaps - the capabilities
+     *
+     *  @return true if the capabilities are stored
+     */
+    bool store(const UUID& uuid, const TerminusCapabilities& terminusCaps);
+
+    /** @brief Remove the capabilities of a terminus, from memory and file
+     *
+     *  @param[in] uuid - MCTP endpoint UUID of the terminus
+     */
+    void remove(const UUID& uuid);
+
+    /** @brief Version of the file format, bumped on any layout change */
+    static constexpr uint32_t formatVersion = 1;
+
+  private:
+    /** @brief Get the capability file of a terminus
+     *
+     *  @param[in] uuid - MCTP endpoint UUID of the terminus
+     *
+     *  @return the file path, std::nullopt if the files are disabled or the
+     *          endpoint has no usable UUID
+     */
+    std::optional<std::filesystem::path> capabilityPath(
+        const UUID& uuid) const;
+
+    /** @brief Load the capability file of a terminus */
+    std::optional<TerminusCapabilities> load(const UUID& uuid) const;
+
+    /** @brief Directory of the capability files */
+    std::filesystem::path cacheDir;
+
+    /** @brief The capabilities by endpoint UUID */
+    std::map<UUID, TerminusCapabilities> capabilities;
+};
+
+} // namespace platform_mc
+} // namespace pldm
@@ -0,0 +1,270 @@
+#include "platform-mc/cper_sink.hpp"
+
+#include <libpldm/platform.h>
+#include <systemd/sd-event.h>
+
+#include <sdeventplus/event.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+namespace
+{
+
+/** @brief CperSink recording the dump entry requests instead of calling the
+ *         dump manager
+ */
+class TestCperSink : public CperSink
+{
+  public:
+    using CperSink::CperSink;
+    using CperSink::dumpCreated;
+
+    bool createDumpEntry(uint64_t id, const DumpEntry& entry) override
+    {
+        requests.emplace_back(id, entry.dataType, entry.path,
+                              entry.terminusName);
+        return true;
+    }
+
+    size_t recordHash(pldm_tid_t tid, uint8_t formatType,
+                      std::span<const uint8_t> data) const override
+    {
+        return collide ? 0 : CperSink::recordHash(tid, formatType, data);
+    }
+
+    /** @brief Give every record the same hash */
+    bool collide = false;
+
+    /** @brief id, data type, path and terminus name of the requests */
+    std::vector<std::tuple<uint64_t, std::string, std::string, std::string>>
+        requests;
+};
+
+std::vector<uint8_t> makeRecord(uint8_t seed, size_t size = 64)
+{
+    std::vector<uint8_t> record(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        record[i] = static_cast<uint8_t>(seed + i);
+    }
+    return record;
+}
+
+std::vector<uint8_t> readFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()};
+}
+
+} // namespace
+
+class CperSinkTest : public testing::Test
+{
+  protected:
+    CperSinkTest() :
+        event(sdeventplus::Event::get_default()),
+        spoolDir(std::filesystem::temp_directory_path() / "cper_sink_test"),
+        sink(event, spoolDir)
+    {
+        std::filesystem::remove_all(spoolDir);
+    }
+
+    ~CperSinkTest() override
+    {
+        std::filesystem::remove_all(spoolDir);
+    }
+
+    /** @brief Run the event loop until there is nothing left to dispatch */
+    void runEventLoop()
+    {
+        while (sd_event_run(event.get(), 0) > 0)
+        {}
+    }
+
+    sdeventplus::Event event;
+    std::filesystem::path spoolDir;
+    TestCperSink sink;
+};
+
+TEST_F(CperSinkTest, spoolAndCreateDumps)
+{
+    auto record1 = makeRecord(1);
+    auto record2 = makeRecord(2, 1000);
+    EXPECT_TRUE(sink.push(1, "Terminus1",
+                          PLDM_PLATFORM_CPER_EVENT_WITH_HEADER, record1));
+    EXPECT_TRUE(sink.push(2, "Terminus2",
+                          PLDM_PLATFORM_CPER_EVENT_WITHOUT_HEADER, record2));
+
+    // Nothing is written from the event handler
+    EXPECT_EQ(sink.getStats().queueDepth, 2);
+    EXPECT_EQ(sink.getStats().spooled, 0);
+    EXPECT_TRUE(sink.requests.empty());
+
+    runEventLoop();
+    const auto& stats = sink.getStats();
+    EXPECT_EQ(stats.received, 2);
+    EXPECT_EQ(stats.spooled, 2);
+    EXPECT_EQ(stats.queueDepth, 0);
+    EXPECT_EQ(stats.maxQueueDepth, 2);
+    EXPECT_EQ(stats.dumpsPending, 2);
+
+    ASSERT_EQ(sink.requests.size(), 2);
+    auto [id1, type1, path1, name1] = sink.requests[0];
+    auto [id2, type2, path2, name2] = sink.requests[1];
+    EXPECT_EQ(type1, "CPER");
+    EXPECT_EQ(name1, "Terminus1");
+    EXPECT_EQ(readFile(path1), record1);
+    EXPECT_EQ(type2, "CPERSection");
+    EXPECT_EQ(name2, "Terminus2");
+    EXPECT_EQ(readFile(path2), record2);
+    EXPECT_NE(path1, path2);
+    EXPECT_EQ(std::filesystem::path(path1).parent_path(), spoolDir);
+
+    sink.dumpCreated(id1, true);
+    sink.dumpCreated(id2, false);
+    EXPECT_EQ(stats.dumpsCreated, 1);
+    EXPECT_EQ(stats.dumpFailures, 1);
+    EXPECT_EQ(stats.dumpsPending, 0);
+}
+
+TEST_F(CperSinkTest, batchesAndDumpsInFlight)
+{
+    sink.batchSize = 4;
+    sink.maxDumpsInFlight = 3;
+    sink.rateLimit = 100;
+    for (uint8_t i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(sink.push(1, "Terminus1",
+                              PLDM_PLATFORM_CPER_EVENT_WITH_HEADER,
+                              makeRecord(i)));
+    }
+
+    // One batch per event loop iteration
+    ASSERT_GT(sd_event_run(event.get(), 0), 0);
+    EXPECT_EQ(sink.getStats().spooled, 4);
+    EXPECT_EQ(sink.getStats().queueDepth, 6);
+    EXPECT_EQ(sink.requests.size(), 3);
+
+    runEventLoop();
+    EXPECT_EQ(sink.getStats().spooled, 10);
+    EXPECT_EQ(sink.getStats().queueDepth, 0);
+    EXPECT_EQ(sink.getStats().dumpsPending, 10);
+    EXPECT_EQ(sink.requests.size(), 3);
+
+    // A completed request lets the next one go
+    for (size_t i = 0; i < sink.requests.size(); ++i)
+    {
+        sink.dumpCreated(std::get<0>(sink.requests[i]), true);
+    }
+    EXPECT_EQ(sink.requests.size(), 10);
+    EXPECT_EQ(sink.getStats().dumpsCreated, 10);
+    EXPECT_EQ(sink.getStats().dumpsPending, 0);
+}
+
+TEST_F(CperSinkTest, duplicatesAndRateLimit)
+{
+    sink.rateLimit = 5;
+    auto record = makeRecord(1);
+    EXPECT_TRUE(sink.push(1, "Terminus1",
+                          PLDM_PLATFORM_CPER_EVENT_WITH_HEADER, record));
+    EXPECT_FALSE(sink.push(1, "Terminus1",
+                           PLDM_PLATFORM_CPER_EVENT_WITH_HEADER, record));
+    EXPECT_EQ(sink.getStats().duplicates, 1);
+
+    // The same record from another terminus is not a copy
+    EXPECT_TRUE(sink.push(2, "Terminus2",
+                          PLDM_PLATFORM_CPER_EVENT_WITH_HEADER, record));
+
+    // A storm from terminus 1 is cut at the rate limit, the copy did not
+    // use up a token
+    size_t accepted = 0;
+    for (uint8_t i = 2; i < 12; ++i)
+    {
+        accepted += sink.push(1, "Terminus1",
+                              PLDM_PLATFORM_CPER_EVENT_WITH_HEADER,
+                              makeRecord(i));
+    }
+    EXPECT_EQ(accepted, 4);
+    EXPECT_EQ(sink.getStats().rateLimited, 6);
+
+    // Terminus 2 has its own limit
+    EXPECT_TRUE(sink.push(2, "Terminus2",
+                          PLDM_PLATFORM_CPER_EVENT_WITH_HEADER,
+                          makeRecord(20)));
+
+    runEventLoop();
+    EXPECT_EQ(sink.getStats().received, 14);
+    EXPECT_EQ(sink.getStats().spooled, 7);
+    EXPECT_EQ(sink.requests.size(), 7);
+}
+
+TEST_F(CperSinkTest, dedupWindowAndQueueLimit)
+{
+    sink.rateLimit = 100;
+    sink.maxQueueDepth = 3;
+    sink.dedupWindow = std::chrono::milliseconds(0);
+
+    // Copies received after the window are kept
+    auto record = makeRecord(1);
+    EXPECT_TRUE(sink.push(1, "Terminus1",
+                          PLDM_PLATFORM_CPER_EVENT_WITH_HEADER, record));
+    EXPECT_TRUE(sink.push(1, "Terminus1",
+                          PLDM_PLATFORM_CPER_EVENT_WITH_HEADER, record));
+    EXPECT_EQ(sink.getStats().duplicates, 0);
+
+    EXPECT_TRUE(sink.push(1, "Terminus1",
+                          PLDM_PLATFORM_CPER_EVENT_WITH_HEADER,
+                          makeRecord(2)));
+    EXPECT_FALSE(sink.push(1, "Terminus1",
+                           PLDM_PLATFORM_CPER_EVENT_WITH_HEADER,
+                           makeRecord(3)));
+    EXPECT_EQ(sink.getStats().overflows, 1);
+    EXPECT_EQ(sink.getStats().maxQueueDepth, 3);
+
+    runEventLoop();
+    EXPECT_EQ(sink.getStats().spooled, 3);
+}
+
+TEST_F(CperSinkTest, hashCollisionsAndDroppedRecords)
+{
+    // Distinct records sharing a hash are all kept, their copies are not
+    sink.collide = true;
+    sink.rateLimit = 3;
+    for (uint8_t i = 1; i <= 3; ++i)
+    {
+        EXPECT_TRUE(sink.push(1, "Terminus1",
+                              PLDM_PLATFORM_CPER_EVENT_WITH_HEADER,
+                              makeRecord(i)));
+    }
+    EXPECT_FALSE(sink.push(1, "Terminus1",
+                           PLDM_PLATFORM_CPER_EVENT_WITH_HEADER,
+                           makeRecord(2)));
+    EXPECT_EQ(sink.getStats().duplicates, 1);
+
+    // A record dropped over the rate limit is not remembered, once the
+    // bucket refills it is accepted rather than taken for a copy
+    auto record = makeRecord(4);
+    EXPECT_FALSE(sink.push(1, "Terminus1",
+                           PLDM_PLATFORM_CPER_EVENT_WITH_HEADER, record));
+    EXPECT_EQ(sink.getStats().rateLimited, 1);
+    sink.rateLimit = 1000;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_TRUE(sink.push(1, "Terminus1",
+                          PLDM_PLATFORM_CPER_EVENT_WITH_HEADER, record));
+    EXPECT_EQ(sink.getStats().duplicates, 1);
+
+    runEventLoop();
+    EXPECT_EQ(sink.getStats().spooled, 4);
+}
@@ -1,8 +1,10 @@
 #include "common/test/mocked_utils.hpp"
 #include "common/utils.hpp"
 #include "platform-mc/dbus_to_terminus_effecters.hpp"
+#include "utils_test.hpp"
 
 #include <nlohmann/json.hpp>
+#include <sdeventplus/event.hpp>
 
 #include <gtest/gtest.h>
 
@@ -14,9 +16,10 @@ class MockHostEffecterParser : public HostEffecterParser
   public:
     MockHostEffecterParser(int fd, const pldm_pdr* repo,
                            DBusHandler* const dbusHandler,
-                           const std::string& jsonPath) :
+                           const std::string& jsonPath,
+                           sdeventplus::Event& event) :
         HostEffecterParser(nullptr, fd, repo, dbusHandler, jsonPath, nullptr,
-                           nullptr)
+                           nullptr, event)
     {}
 
     MOCK_METHOD(int, setHostStateEffecter,
@@ -32,14 +35,25 @@ class MockHostEffecterParser : public HostEffecterParser
     {
         return hostEffecterInfo;
     }
+
+    void setDebounceWindow(std::chrono::milliseconds window)
+    {
+        debounceWindow = window;
+    }
+
+    void setCompEffecterCnt(size_t effecterInfoIndex, uint8_t count)
+    {
+        hostEffecterInfo[effecterInfoIndex].compEffecterCnt = count;
+    }
 };
 
 TEST(HostEffecterParser, parseEffecterJsonGoodPath)
 {
     MockdBusHandler dbusHandler;
     int sockfd{};
-    MockHostEffecterParser hostEffecterParserGood(sockfd, nullptr, &dbusHandler,
-                                                  "./host_effecter_jsons/good");
+    auto event = sdeventplus::Event::get_default();
+    MockHostEffecterParser hostEffecterParserGood(
+        sockfd, nullptr, &dbusHandler, "./host_effecter_jsons/good", event);
     auto hostEffecterInfo = hostEffecterParserGood.gethostEffecterInfo();
     ASSERT_EQ(hostEffecterInfo.size(), 2);
     ASSERT_EQ(hostEffecterInfo[0].effecterPdrType, PLDM_STATE_EFFECTER_PDR);
@@ -96,8 +110,9 @@ TEST(HostEffecterParser, parseEffecterJsonBadPath)
 {
     MockdBusHandler dbusHandler;
     int sockfd{};
-    MockHostEffecterParser hostEffecterParser(sockfd, nullptr, &dbusHandler,
-                                              "./host_effecter_jsons/no_json");
+    auto event = sdeventplus::Event::get_default();
+    MockHostEffecterParser hostEffecterParser(
+        sockfd, nullptr, &dbusHandler, "./host_effecter_jsons/no_json", event);
     ASSERT_THROW(
         hostEffecterParser.parseEffecterJson("./host_effecter_jsons/no_json"),
         std::exception);
@@ -110,8 +125,9 @@ TEST(HostEffecterParser, findNewStateValue)
 {
     MockdBusHandler dbusHandler;
     int sockfd{};
-    MockHostEffecterParser hostEffecterParser(sockfd, nullptr, &dbusHandler,
-                                              "./host_effecter_jsons/good");
+    auto event = sdeventplus::Event::get_default();
+    MockHostEffecterParser hostEffecterParser(
+        sockfd, nullptr, &dbusHandler, "./host_effecter_jsons/good", event);
 
     PropertyValue val1{std::in_place_type<std::string>,
                        "xyz.openbmc_project.Control.Boot.Mode.Modes.Regular"};
@@ -128,8 +144,9 @@ TEST(HostEffecterParser, adjustValue)
 {
     MockdBusHandler dbusHandler;
     int sockfd{};
-    MockHostEffecterParser hostEffecterParser(sockfd, nullptr, &dbusHandler,
-                                              "./host_effecter_jsons/good");
+    auto event = sdeventplus::Event::get_default();
+    MockHostEffecterParser hostEffecterParser(
+        sockfd, nullptr, &dbusHandler, "./host_effecter_jsons/good", event);
 
     auto realVal = hostEffecterParser.adjustValue(200, -50, 0.5, -2);
     ASSERT_EQ(realVal, 12500);
@@ -142,3 +159,90 @@ TEST(HostEffecterParser, adjustValue)
     realVal = hostEffecterParser.adjustValue(2.35, 0, 1, -1);
     ASSERT_EQ(realVal, 24);
 }
+
+TEST(HostEffecterParser, debounceStateEffecter)
+{
+    using ::testing::_;
+    using ::testing::Invoke;
+
+    MockdBusHandler dbusHandler;
+    int sockfd{};
+    auto event = sdeventplus::Event::get_default();
+    MockHostEffecterParser hostEffecterParser(
+        sockfd, nullptr, &dbusHandler, "./host_effecter_jsons/good", event);
+    hostEffecterParser.setDebounceWindow(std::chrono::milliseconds(50));
+
+    std::vector<std::vector<set_effecter_state_field>> sent;
+    EXPECT_CALL(hostEffecterParser, setHostStateEffecter(0, _, _))
+        .Times(2)
+        .WillRepeatedly(
+            Invoke([&sent](size_t, std::vector<set_effecter_state_field>& field,
+                           uint16_t) {
+                sent.emplace_back(field);
+                return PLDM_SUCCESS;
+            }));
+
+    // Flips of the same effecter collapse to the latest state
+    hostEffecterParser.queueStateEffecter(0, 0, 4, 2);
+    hostEffecterParser.queueStateEffecter(0, 0, 4, 3);
+    hostEffecterParser.queueStateEffecter(0, 0, 4, 2);
+    hostEffecterParser.queueStateEffecter(0, 0, 5, 3);
+    hostEffecterParser.flushStateEffecters();
+
+    ASSERT_EQ(sent.size(), 2);
+    ASSERT_EQ(sent[0].size(), 1);
+    EXPECT_EQ(sent[0][0].set_request, PLDM_REQUEST_SET);
+    EXPECT_EQ(sent[0][0].effecter_state, 2);
+    EXPECT_EQ(sent[1][0].effecter_state, 3);
+
+    const auto& counters = hostEffecterParser.getDebounceCounters();
+    EXPECT_EQ(counters.sent, 2);
+    EXPECT_EQ(counters.suppressed, 2);
+
+    // Nothing left to send
+    hostEffecterParser.flushStateEffecters();
+    EXPECT_EQ(counters.sent, 2);
+}
+
+TEST(HostEffecterParser, debounceStateEffecterWindow)
+{
+    using ::testing::_;
+    using ::testing::Invoke;
+
+    MockdBusHandler dbusHandler;
+    int sockfd{};
+    auto event = sdeventplus::Event::get_default();
+    MockHostEffecterParser hostEffecterParser(
+        sockfd, nullptr, &dbusHandler, "./host_effecter_jsons/good", event);
+    hostEffecterParser.setDebounceWindow(std::chrono::milliseconds(50));
+    hostEffecterParser.setCompEffecterCnt(0, 2);
+
+    std::vector<std::vector<set_effecter_state_field>> sent;
+    EXPECT_CALL(hostEffecterParser, setHostStateEffecter(0, _, 4))
+        .Times(1)
+        .WillOnce(
+            Invoke([&sent](size_t, std::vector<set_effecter_state_field>& field,
+                           uint16_t) {
+                sent.emplace_back(field);
+                return PLDM_SUCCESS;
+            }));
+
+    // The changes of both composite effecters within the window are merged,
+    // the flips of the first one collapse to its latest state
+    hostEffecterParser.queueStateEffecter(0, 0, 4, 2);
+    hostEffecterParser.queueStateEffecter(0, 1, 4, 3);
+    hostEffecterParser.queueStateEffecter(0, 0, 4, 1);
+    const auto& counters = hostEffecterParser.getDebounceCounters();
+    EXPECT_EQ(counters.sent, 0);
+
+    utils::runEventLoopForSeconds(event, 1);
+
+    ASSERT_EQ(sent.size(), 1);
+    ASSERT_EQ(sent[0].size(), 2);
+    EXPECT_EQ(sent[0][0].set_request, PLDM_REQUEST_SET);
+    EXPECT_EQ(sent[0][0].effecter_state, 1);
+    EXPECT_EQ(sent[0][1].set_request, PLDM_REQUEST_SET);
+    EXPECT_EQ(sent[0][1].effecter_state, 3);
+    EXPECT_EQ(counters.sent, 1);
+    EXPECT_EQ(counters.suppressed, 2);
+}
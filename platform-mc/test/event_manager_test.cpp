@@ -144,8 +144,8 @@ TEST_F(EventManagerTest, processNumericSensorEventTest)
     };
 
     // add dummy numeric sensor
-    termini[tid]->pdrs.emplace_back(pdr1);
-    termini[tid]->pdrs.emplace_back(pdr2);
+    termini[tid]->pdrs.add(pdr1);
+    termini[tid]->pdrs.add(pdr2);
     termini[tid]->parseTerminusPDRs();
     // Run event loop for a few seconds to let sensor creation
     // defer tasks be run. May increase time when sensor num is large
@@ -166,6 +166,69 @@ TEST_F(EventManagerTest, processNumericSensorEventTest)
         tid, 0x00, PLDM_SENSOR_EVENT, eventData.data(), eventData.size());
     EXPECT_EQ(PLDM_SUCCESS, rc);
     EXPECT_EQ(PLDM_EVENT_NO_LOGGING, platformEventStatus);
+
+    // The reading of the event updates the sensor, which is still polled at
+    // its update interval as it did not report its event generation enabled
+    auto sensor = termini[tid]->numericSensors[0];
+    EXPECT_EQ(SENSOR_READING, sensor->getReading());
+    EXPECT_EQ(PLDM_SENSOR_UPPERWARNING, sensor->eventState);
+    EXPECT_FALSE(sensor->eventDriven);
+
+    sensor->eventMessageEnabled = true;
+    eventData = {0x1,
+                 0x0, // sensor id
+                 PLDM_NUMERIC_SENSOR_STATE,
+                 PLDM_SENSOR_NORMAL,
+                 PLDM_SENSOR_UPPERWARNING,
+                 PLDM_SENSOR_DATA_SIZE_UINT8,
+                 WARNING_HIGH - 5};
+    rc = eventManager.handlePlatformEvent(tid, 0x00, PLDM_SENSOR_EVENT,
+                                          eventData.data(), eventData.size());
+    EXPECT_EQ(PLDM_SUCCESS, rc);
+    EXPECT_EQ(WARNING_HIGH - 5, sensor->getReading());
+    EXPECT_EQ(PLDM_SENSOR_NORMAL, sensor->eventState);
+    EXPECT_TRUE(sensor->eventDriven);
+
+    // The readings of the events are decoded with the signedness of their
+    // data size and recorded in the history of the sensor
+    auto historyRegion =
+        pldm::platform_mc::SensorHistoryRegion::create({}, 1, 4);
+    ASSERT_NE(nullptr, historyRegion);
+    pldm::platform_mc::SensorManager sensorManager(
+        event, terminusManager, termini, nullptr, historyRegion);
+    pldm::platform_mc::MockEventManager recordingEventManager(
+        terminusManager, termini, &sensorManager);
+
+    eventData = {0x1,
+                 0x0, // sensor id
+                 PLDM_NUMERIC_SENSOR_STATE,
+                 PLDM_SENSOR_NORMAL,
+                 PLDM_SENSOR_NORMAL,
+                 PLDM_SENSOR_DATA_SIZE_SINT8,
+                 0xf6}; // -10
+    rc = recordingEventManager.handlePlatformEvent(
+        tid, 0x00, PLDM_SENSOR_EVENT, eventData.data(), eventData.size());
+    EXPECT_EQ(PLDM_SUCCESS, rc);
+    EXPECT_EQ(-10, sensor->getReading());
+
+    eventData = {0x1,
+                 0x0, // sensor id
+                 PLDM_NUMERIC_SENSOR_STATE,
+                 PLDM_SENSOR_NORMAL,
+                 PLDM_SENSOR_NORMAL,
+                 PLDM_SENSOR_DATA_SIZE_SINT16,
+                 0x18,
+                 0xfc}; // -1000
+    rc = recordingEventManager.handlePlatformEvent(
+        tid, 0x00, PLDM_SENSOR_EVENT, eventData.data(), eventData.size());
+    EXPECT_EQ(PLDM_SUCCESS, rc);
+    EXPECT_EQ(-1000, sensor->getReading());
+
+    auto histories = historyRegion->read({}, 0);
+    ASSERT_EQ(1, histories.size());
+    EXPECT_EQ(tid, histories[0].tid);
+    EXPECT_EQ(1, histories[0].sensorId);
+    EXPECT_EQ((std::vector<double>{-10, -1000}), histories[0].values);
 }
 
 TEST_F(EventManagerTest, SetEventReceiverTest)
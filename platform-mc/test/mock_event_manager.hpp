@@ -12,8 +12,9 @@ namespace platform_mc
 class MockEventManager : public EventManager
 {
   public:
-    MockEventManager(TerminusManager& terminusManager, TerminiMapper& termini) :
-        EventManager(terminusManager, termini) {};
+    MockEventManager(TerminusManager& terminusManager, TerminiMapper& termini,
+                     SensorManager* sensorManager = nullptr) :
+        EventManager(terminusManager, termini, sensorManager) {};
 
     MOCK_METHOD(int, processCperEvent,
                 (pldm_tid_t tid, uint16_t eventId, const uint8_t* eventData,
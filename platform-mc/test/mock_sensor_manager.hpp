@@ -12,10 +12,16 @@ namespace platform_mc
 class MockSensorManager : public SensorManager
 {
   public:
-    MockSensorManager(sdeventplus::Event& event,
-                      TerminusManager& terminusManager, TerminiMapper& termini,
-                      Manager* manager) :
-        SensorManager(event, terminusManager, termini, manager) {};
+    MockSensorManager(
+        sdeventplus::Event& event, TerminusManager& terminusManager,
+        TerminiMapper& termini, Manager* manager,
+        std::shared_ptr<SensorHistoryRegion> historyRegion = nullptr) :
+        SensorManager(event, terminusManager, termini, manager,
+                      std::move(historyRegion)) {};
+
+    using SensorManager::checkSensorEvents;
+    using SensorManager::livenessTime;
+    using SensorManager::updateReadings;
 
     MOCK_METHOD(void, doSensorPolling, (pldm_tid_t tid), (override));
 };
@@ -2,7 +2,11 @@
 
 #include "platform-mc/terminus_manager.hpp"
 
+#include <deque>
+#include <functional>
 #include <queue>
+#include <utility>
+#include <vector>
 
 #include <gmock/gmock.h>
 
@@ -70,5 +74,64 @@ class MockTerminusManager : public TerminusManager
     std::queue<size_t> responseLens;
 };
 
+/** @class InterleavedTerminusManager
+ *
+ *  The requests of the discovered endpoints wait their turn in a run loop,
+ *  all the requests in flight are answered in turn so that the discovery of
+ *  the endpoints and the queries of their types interleave.
+ */
+class InterleavedTerminusManager : public TerminusManager
+{
+  public:
+    using Responder = std::function<std::vector<uint8_t>(
+        mctp_eid_t eid, const pldm_msg* request)>;
+
+    InterleavedTerminusManager(
+        sdeventplus::Event& event, RequesterHandler& handler,
+        pldm::InstanceIdDb& instanceIdDb, TerminiMapper& termini,
+        Responder responder) :
+        TerminusManager(event, handler, instanceIdDb, termini, nullptr,
+                        pldm::BmcMctpEid),
+        responder(std::move(responder))
+    {
+        discoveryConcurrency = 2;
+    }
+
+    exec::task<int> sendRecvPldmMsgOverMctp(
+        mctp_eid_t eid, Request& request, const pldm_msg** responseMsg,
+        size_t* responseLen) override
+    {
+        co_await stdexec::schedule(runLoop.get_scheduler());
+
+        requests.emplace_back(eid, request);
+        auto& response = responses.emplace_back(
+            responder(eid, new (request.data()) pldm_msg));
+        if (response.size() <= sizeof(pldm_msg_hdr) ||
+            responseMsg == nullptr || responseLen == nullptr)
+        {
+            co_return PLDM_ERROR;
+        }
+
+        *responseMsg = new (response.data()) pldm_msg;
+        *responseLen = response.size() - sizeof(pldm_msg_hdr);
+        co_return PLDM_SUCCESS;
+    }
+
+    /** @brief Answer the requests in turn until none is in flight */
+    void run()
+    {
+        runLoop.finish();
+        runLoop.run();
+    }
+
+    /** @brief The requests in the order they were answered */
+    std::vector<std::pair<mctp_eid_t, Request>> requests;
+
+  private:
+    Responder responder;
+    stdexec::run_loop runLoop;
+    std::deque<std::vector<uint8_t>> responses;
+};
+
 } // namespace platform_mc
 } // namespace pldm
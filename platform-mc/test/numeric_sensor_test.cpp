@@ -270,3 +270,25 @@ TEST(NumericSensor, checkThreshold)
                                      hysteresis);
     EXPECT_EQ(false, lowAlarm);
 }
+
+TEST(NumericSensor, thresholdsChanged)
+{
+    auto& bus = pldm::utils::DBusHandler::getBus();
+    std::string path{"/xyz/openbmc_project/sensors/temperature/threshold1"};
+    pldm::platform_mc::ThresholdWarningIntf warningIntf(
+        bus, path.c_str(),
+        pldm::platform_mc::ThresholdWarningIntf::action::defer_emit);
+    pldm::platform_mc::ThresholdCriticalIntf criticalIntf(
+        bus, path.c_str(),
+        pldm::platform_mc::ThresholdCriticalIntf::action::defer_emit);
+    EXPECT_FALSE(warningIntf.thresholdsChanged);
+    EXPECT_FALSE(criticalIntf.thresholdsChanged);
+
+    // The D-Bus property setters go through the overridden setters
+    warningIntf.warningHigh(90.0);
+    EXPECT_TRUE(warningIntf.thresholdsChanged);
+    EXPECT_EQ(warningIntf.warningHigh(), 90.0);
+    criticalIntf.criticalLow(-5.0);
+    EXPECT_TRUE(criticalIntf.thresholdsChanged);
+    EXPECT_EQ(criticalIntf.criticalLow(), -5.0);
+}
@@ -0,0 +1,99 @@
+#include "platform-mc/pdr_store.hpp"
+#include "platform-mc/terminus.hpp"
+#include "platform-mc/test/pdr_store_test.hpp"
+#include "platform-mc/test/utils_test.hpp"
+
+#include <libpldm/platform.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+TEST(PdrStoreTest, benchmarkTerminusScale)
+{
+    // A terminus exposing 2000 numeric sensors with their auxiliary names
+    constexpr size_t numSensors = 2000;
+    std::vector<std::vector<uint8_t>> fetched;
+    fetched.reserve(2 * numSensors);
+    for (uint32_t i = 0; i < numSensors; ++i)
+    {
+        fetched.emplace_back(makePdr(2 * i + 1, PLDM_NUMERIC_SENSOR_PDR, 93));
+        fetched.emplace_back(
+            makePdr(2 * i + 2, PLDM_SENSOR_AUXILIARY_NAMES_PDR, 37));
+    }
+
+    // Per record allocations and the parsed PDRs kept for the daemon life
+    struct
+    {
+        std::vector<std::vector<uint8_t>> pdrs;
+        std::vector<std::shared_ptr<pldm_numeric_sensor_value_pdr>>
+            numericSensorPdrs;
+        std::vector<std::shared_ptr<SensorAuxiliaryNames>>
+            sensorAuxiliaryNamesTbl;
+    } perRecord;
+
+    auto start = utils::heapInUse();
+    for (SensorId id = 0; const auto& pdr : fetched)
+    {
+        perRecord.pdrs.emplace_back(pdr);
+        if (pdr[5] == PLDM_NUMERIC_SENSOR_PDR)
+        {
+            perRecord.numericSensorPdrs.emplace_back(
+                std::make_shared<pldm_numeric_sensor_value_pdr>());
+            continue;
+        }
+        std::vector<std::vector<std::pair<NameLanguageTag, SensorName>>>
+            names{{{"en", "Sensor_" + std::to_string(id)}}};
+        perRecord.sensorAuxiliaryNamesTbl.emplace_back(
+            std::make_shared<SensorAuxiliaryNames>(id++, 1, std::move(names)));
+    }
+    auto perRecordUsage = utils::heapInUse() - start;
+
+    // Arena store and the positions of the records to parse on request
+    struct
+    {
+        PdrStore pdrs;
+        std::vector<size_t> numericSensorPdrs;
+        std::unordered_map<SensorId, size_t> sensorAuxiliaryNamesPdrs;
+    } arena;
+
+    start = utils::heapInUse();
+    for (const auto& pdr : fetched)
+    {
+        arena.pdrs.add(pdr);
+    }
+    arena.pdrs.shrinkToFit();
+    for (auto position : arena.pdrs.findByType(PLDM_NUMERIC_SENSOR_PDR))
+    {
+        arena.numericSensorPdrs.emplace_back(position);
+    }
+    SensorId id = 0;
+    for (auto position :
+         arena.pdrs.findByType(PLDM_SENSOR_AUXILIARY_NAMES_PDR))
+    {
+        arena.sensorAuxiliaryNamesPdrs.try_emplace(id++, position);
+    }
+    auto arenaUsage = utils::heapInUse() - start;
+
+    ASSERT_EQ(arena.pdrs.size(), fetched.size());
+    for (size_t i = 0; i < fetched.size(); ++i)
+    {
+        ASSERT_TRUE(std::ranges::equal(arena.pdrs[i], perRecord.pdrs[i]));
+        ASSERT_EQ(arena.pdrs.findByHandle(i + 1), i);
+    }
+    EXPECT_EQ(arena.numericSensorPdrs.size(), numSensors);
+    EXPECT_EQ(arena.sensorAuxiliaryNamesPdrs.size(), numSensors);
+    EXPECT_LT(arenaUsage, perRecordUsage);
+
+    RecordProperty("records", static_cast<int>(fetched.size()));
+    RecordProperty("perRecordBytes", static_cast<int>(perRecordUsage));
+    RecordProperty("arenaBytes", static_cast<int>(arenaUsage));
+    RecordProperty("savedBytes",
+                   static_cast<int>(perRecordUsage - arenaUsage));
+    RecordProperty("storeBytes", static_cast<int>(arena.pdrs.memoryUsage()));
+}
@@ -0,0 +1,64 @@
+#include "platform-mc/pdr_store.hpp"
+#include "platform-mc/test/pdr_store_test.hpp"
+
+#include <libpldm/platform.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+TEST(PdrStoreTest, addAndFind)
+{
+    PdrStore store;
+    EXPECT_TRUE(store.empty());
+    EXPECT_EQ(store.findByHandle(1), std::nullopt);
+    EXPECT_TRUE(store.findByType(PLDM_NUMERIC_SENSOR_PDR).empty());
+
+    auto pdr1 = makePdr(1, PLDM_NUMERIC_SENSOR_PDR, 93);
+    auto pdr2 = makePdr(2, PLDM_SENSOR_AUXILIARY_NAMES_PDR, 37);
+    auto pdr3 = makePdr(3, PLDM_NUMERIC_SENSOR_PDR, 101);
+    store.add(pdr1);
+    store.add(pdr2);
+    store.add(pdr3);
+
+    ASSERT_EQ(store.size(), 3);
+    EXPECT_TRUE(std::ranges::equal(store[0], pdr1));
+    EXPECT_TRUE(std::ranges::equal(store[1], pdr2));
+    EXPECT_TRUE(std::ranges::equal(store[2], pdr3));
+
+    EXPECT_EQ(store.findByHandle(2), 1);
+    EXPECT_EQ(store.findByHandle(4), std::nullopt);
+    EXPECT_EQ(store.findByType(PLDM_NUMERIC_SENSOR_PDR),
+              (std::vector<uint32_t>{0, 2}));
+    EXPECT_EQ(store.findByType(PLDM_SENSOR_AUXILIARY_NAMES_PDR),
+              (std::vector<uint32_t>{1}));
+
+    size_t count = 0;
+    for (auto record : store)
+    {
+        // Records start at an aligned offset in the slab
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(record.data()) %
+                      PdrStore::recordAlignment,
+                  0);
+        ++count;
+    }
+    EXPECT_EQ(count, 3);
+
+    store.clear();
+    EXPECT_TRUE(store.empty());
+    EXPECT_EQ(store.findByHandle(1), std::nullopt);
+    EXPECT_TRUE(store.findByType(PLDM_NUMERIC_SENSOR_PDR).empty());
+}
+
+TEST(PdrStoreTest, shortRecord)
+{
+    PdrStore store;
+    std::vector<uint8_t> data{0x1, 0x2};
+    store.add(data);
+
+    ASSERT_EQ(store.size(), 1);
+    EXPECT_TRUE(std::ranges::equal(store[0], data));
+    EXPECT_EQ(store.findByHandle(0x0201), std::nullopt);
+}
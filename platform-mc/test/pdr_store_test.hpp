@@ -0,0 +1,26 @@
+#pragma once
+
+#include <endian.h>
+#include <libpldm/platform.h>
+
+#include <cstring>
+#include <vector>
+
+/** @brief Build a PDR of the given type and total length */
+inline std::vector<uint8_t> makePdr(uint32_t recordHandle, uint8_t type,
+                                    size_t length)
+{
+    std::vector<uint8_t> pdr(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        pdr[i] = static_cast<uint8_t>(recordHandle + i);
+    }
+
+    pldm_pdr_hdr hdr{};
+    hdr.record_handle = htole32(recordHandle);
+    hdr.version = 1;
+    hdr.type = type;
+    hdr.length = htole16(static_cast<uint16_t>(length - sizeof(hdr)));
+    std::memcpy(pdr.data(), &hdr, sizeof(hdr));
+    return pdr;
+}
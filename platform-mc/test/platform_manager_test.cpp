@@ -7,6 +7,9 @@
 #include <sdeventplus/event.hpp>
 
 #include <bitset>
+#include <filesystem>
+#include <ranges>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -527,3 +530,382 @@ TEST_F(PlatformManagerTest, negativeInitTerminusTest2)
     EXPECT_EQ(0, terminus->pdrs.size());
     EXPECT_EQ(0, terminus->numericSensors.size());
 }
+
+namespace
+{
+
+constexpr auto snapshotUUID = "f72d6f90-5675-11ed-9b6a-0242ac120002";
+
+/** @brief Numeric sensor PDR of sensor 1, record handle 0 */
+const std::vector<uint8_t> numericSensorPdr{
+        0x0, 0x0, 0x0,
+        0x0,                     // record handle
+        0x1,                     // PDRHeaderVersion
+        PLDM_NUMERIC_SENSOR_PDR, // PDRType
+        0x0,
+        0x0,                     // recordChangeNumber
+        PLDM_PDR_NUMERIC_SENSOR_PDR_FIXED_LENGTH +
+            PLDM_PDR_NUMERIC_SENSOR_PDR_VARIED_SENSOR_DATA_SIZE_MIN_LENGTH +
+            PLDM_PDR_NUMERIC_SENSOR_PDR_VARIED_RANGE_FIELD_MIN_LENGTH,
+        0,                             // dataLength
+        0,
+        0,                             // PLDMTerminusHandle
+        0x1,
+        0x0,                           // sensorID=1
+        120,
+        0,                             // entityType=Power Supply(120)
+        1,
+        0,                             // entityInstanceNumber
+        0x1,
+        0x0,                           // containerID=1
+        PLDM_NO_INIT,                  // sensorInit
+        false,                         // sensorAuxiliaryNamesPDR
+        PLDM_SENSOR_UNIT_DEGRESS_C,    // baseUint(2)=degrees C
+        1,                             // unitModifier = 1
+        0,                             // rateUnit
+        0,                             // baseOEMUnitHandle
+        0,                             // auxUnit
+        0,                             // auxUnitModifier
+        0,                             // auxRateUnit
+        0,                             // rel
+        0,                             // auxOEMUnitHandle
+        true,                          // isLinear
+        PLDM_SENSOR_DATA_SIZE_UINT8,   // sensorDataSize
+        0, 0, 0xc0,
+        0x3f,                          // resolution=1.5
+        0, 0, 0x80,
+        0x3f,                          // offset=1.0
+        0,
+        0,                             // accuracy
+        0,                             // plusTolerance
+        0,                             // minusTolerance
+        2,                             // hysteresis
+        0,                             // supportedThresholds
+        0,                             // thresholdAndHysteresisVolatility
+        0, 0, 0x80,
+        0x3f,                          // stateTransistionInterval=1.0
+        0, 0, 0x80,
+        0x3f,                          // updateInverval=1.0
+        255,                           // maxReadable
+        0,                             // minReadable
+        PLDM_RANGE_FIELD_FORMAT_UINT8, // rangeFieldFormat
+        0,                             // rangeFieldsupport
+        0,                             // nominalValue
+        0,                             // normalMax
+        0,                             // normalMin
+        0,                             // warningHigh
+        0,                             // warningLow
+        0,                             // criticalHigh
+        0,                             // criticalLow
+        0,                             // fatalHigh
+        0                              // fatalLow
+};
+
+/** @brief Entity auxiliary names PDR naming the terminus "S0", record
+ *         handle 1
+ */
+const std::vector<uint8_t> terminusNamePdr{
+        0x1, 0x0, 0x0,
+        0x0,                             // record handle
+        0x1,                             // PDRHeaderVersion
+        PLDM_ENTITY_AUXILIARY_NAMES_PDR, // PDRType
+        0x1,
+        0x0,                             // recordChangeNumber
+        0x11,
+        0,                               // dataLength
+        /* Entity Auxiliary Names PDR Data*/
+        3,
+        0x80, // entityType system software
+        0x1,
+        0x0,  // Entity instance number =1
+        0,
+        0,    // Overall system
+        0,    // shared Name Count one name only
+        01,   // nameStringCount
+        0x65, 0x6e, 0x00,
+        0x00, // Language Tag "en"
+        0x53, 0x00, 0x30, 0x00,
+        0x00  // Entity Name "S0"
+};
+
+void appendLe32(std::vector<uint8_t>& buffer, uint32_t value)
+{
+    for (size_t i = 0; i < sizeof(value); ++i)
+    {
+        buffer.emplace_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+std::vector<uint8_t> makeGetPDRRepositoryInfoResp(
+    const pldm::platform_mc::PdrRepositoryInfo& info)
+{
+    std::vector<uint8_t> resp{0x0, 0x02, 0x50, PLDM_SUCCESS, PLDM_AVAILABLE};
+    resp.insert(resp.end(), info.updateTime.begin(), info.updateTime.end());
+    resp.insert(resp.end(), PLDM_TIMESTAMP104_SIZE, 0); // OEMUpdateTime
+    appendLe32(resp, info.recordCount);
+    appendLe32(resp, info.repositorySize);
+    appendLe32(resp, info.largestRecordSize);
+    resp.emplace_back(0); // dataTransferHandleTimeout
+    return resp;
+}
+
+std::vector<uint8_t> makeGetPDRResp(uint32_t nextRecordHandle,
+                                    const std::vector<uint8_t>& pdr)
+{
+    std::vector<uint8_t> resp{0x0, 0x02, 0x51, PLDM_SUCCESS};
+    appendLe32(resp, nextRecordHandle);
+    appendLe32(resp, 0); // nextDataTransferHandle
+    resp.emplace_back(PLDM_PLATFORM_TRANSFER_START_AND_END);
+    resp.emplace_back(static_cast<uint8_t>(pdr.size()));
+    resp.emplace_back(static_cast<uint8_t>(pdr.size() >> 8));
+    resp.insert(resp.end(), pdr.begin(), pdr.end());
+    return resp;
+}
+
+std::vector<uint8_t> makeGetFRURecordTableMetadataResp(
+    const std::vector<uint8_t>& table, uint16_t totalRecords)
+{
+    std::vector<uint8_t> resp{0x0, PLDM_FRU, PLDM_GET_FRU_RECORD_TABLE_METADATA,
+                              PLDM_SUCCESS};
+    resp.emplace_back(1);           // FRUDataMajorVersion
+    resp.emplace_back(0);           // FRUDataMinorVersion
+    appendLe32(resp, 256);          // FRUTableMaximumSize
+    appendLe32(resp, table.size()); // FRUTableLength
+    for (int i = 0; i < 2; ++i)
+    {
+        // Total number of record set identifiers, then of records
+        resp.emplace_back(static_cast<uint8_t>(totalRecords));
+        resp.emplace_back(static_cast<uint8_t>(totalRecords >> 8));
+    }
+    appendLe32(resp, 0); // FRUTableIntegrityChecksum
+    return resp;
+}
+
+std::vector<uint8_t> makeGetFRURecordTableResp(
+    const std::vector<uint8_t>& table)
+{
+    std::vector<uint8_t> resp{0x0, PLDM_FRU, PLDM_GET_FRU_RECORD_TABLE,
+                              PLDM_SUCCESS};
+    appendLe32(resp, 0); // nextDataTransferHandle
+    resp.emplace_back(PLDM_PLATFORM_TRANSFER_START_AND_END);
+    resp.insert(resp.end(), table.begin(), table.end());
+    return resp;
+}
+
+} // namespace
+
+class PlatformManagerSnapshotTest : public PlatformManagerTest
+{
+  protected:
+    PlatformManagerSnapshotTest() :
+        snapshotDir(std::filesystem::temp_directory_path() /
+                    "platform_manager_snapshot_test"),
+        snapshotCache(snapshotDir),
+        snapshotPlatformManager(mockTerminusManager, termini, nullptr,
+                                snapshotDir)
+    {
+        std::filesystem::remove_all(snapshotDir);
+
+        repositoryInfo.updateTime[0] = 0x12;
+        repositoryInfo.recordCount = 2;
+        repositoryInfo.repositorySize = 256;
+        repositoryInfo.largestRecordSize = 59;
+    }
+
+    ~PlatformManagerSnapshotTest() override
+    {
+        std::filesystem::remove_all(snapshotDir);
+    }
+
+    std::shared_ptr<pldm::platform_mc::Terminus> addTerminus(
+        bool withFru = false)
+    {
+        auto tid = mockTerminusManager
+                       .mapTid(pldm::MctpInfo(10, snapshotUUID, "", 1))
+                       .value();
+        uint64_t types = 1 << PLDM_BASE | 1 << PLDM_PLATFORM;
+        if (withFru)
+        {
+            types |= 1 << PLDM_FRU;
+        }
+        auto terminus =
+            std::make_shared<pldm::platform_mc::Terminus>(tid, types, event);
+        termini[tid] = terminus;
+
+        auto size = PLDM_MAX_TYPES * (PLDM_MAX_CMDS_PER_TYPE / 8);
+        std::vector<uint8_t> pldmCmds(size);
+        for (uint8_t cmd : {PLDM_GET_PDR, PLDM_GET_PDR_REPOSITORY_INFO})
+        {
+            auto idx = PLDM_PLATFORM * (PLDM_MAX_CMDS_PER_TYPE / 8) + (cmd / 8);
+            pldmCmds[idx] = pldmCmds[idx] | (1 << (cmd % 8));
+        }
+        if (withFru)
+        {
+            for (uint8_t cmd : {PLDM_GET_FRU_RECORD_TABLE_METADATA,
+                                PLDM_GET_FRU_RECORD_TABLE})
+            {
+                auto idx = PLDM_FRU * (PLDM_MAX_CMDS_PER_TYPE / 8) + (cmd / 8);
+                pldmCmds[idx] = pldmCmds[idx] | (1 << (cmd % 8));
+            }
+        }
+        terminus->setSupportedCommands(pldmCmds);
+        return terminus;
+    }
+
+    void enqueue(std::vector<uint8_t>& resp)
+    {
+        EXPECT_EQ(mockTerminusManager.enqueueResponse(
+                      new (resp.data()) pldm_msg, resp.size()),
+                  PLDM_SUCCESS);
+    }
+
+    std::filesystem::path snapshotDir;
+    pldm::platform_mc::TerminusSnapshotCache snapshotCache;
+    pldm::platform_mc::PlatformManager snapshotPlatformManager;
+    pldm::platform_mc::PdrRepositoryInfo repositoryInfo{};
+};
+
+TEST_F(PlatformManagerSnapshotTest, downloadAndSaveSnapshot)
+{
+    auto terminus = addTerminus();
+    auto infoResp = makeGetPDRRepositoryInfoResp(repositoryInfo);
+    auto pdrResp = makeGetPDRResp(1, numericSensorPdr);
+    auto nameResp = makeGetPDRResp(0, terminusNamePdr);
+    enqueue(infoResp);
+    enqueue(pdrResp);
+    enqueue(nameResp);
+
+    stdexec::sync_wait(snapshotPlatformManager.initTerminus());
+    EXPECT_TRUE(terminus->initialized);
+    EXPECT_EQ(2, terminus->pdrs.size());
+
+    // The downloaded PDRs are saved with the repository info
+    pldm::platform_mc::PdrRepositoryInfo savedInfo{};
+    pldm::platform_mc::PdrStore savedPdrs;
+    std::vector<uint8_t> savedFru;
+    ASSERT_TRUE(
+        snapshotCache.load(snapshotUUID, savedInfo, savedPdrs, savedFru));
+    EXPECT_EQ(savedInfo, repositoryInfo);
+    ASSERT_EQ(2, savedPdrs.size());
+    EXPECT_TRUE(std::ranges::equal(savedPdrs[0], numericSensorPdr));
+    EXPECT_TRUE(std::ranges::equal(savedPdrs[1], terminusNamePdr));
+}
+
+TEST_F(PlatformManagerSnapshotTest, noSnapshotOnFruError)
+{
+    auto terminus = addTerminus(true);
+    std::vector<uint8_t> fruResp{0x0, PLDM_FRU,
+                                 PLDM_GET_FRU_RECORD_TABLE_METADATA,
+                                 PLDM_ERROR};
+    auto infoResp = makeGetPDRRepositoryInfoResp(repositoryInfo);
+    auto pdrResp = makeGetPDRResp(1, numericSensorPdr);
+    auto nameResp = makeGetPDRResp(0, terminusNamePdr);
+    enqueue(fruResp);
+    enqueue(infoResp);
+    enqueue(pdrResp);
+    enqueue(nameResp);
+
+    stdexec::sync_wait(snapshotPlatformManager.initTerminus());
+    EXPECT_TRUE(terminus->initialized);
+    EXPECT_EQ(2, terminus->pdrs.size());
+
+    // The PDRs are used but not saved without the FRU data, the next start
+    // downloads them again
+    pldm::platform_mc::PdrRepositoryInfo savedInfo{};
+    pldm::platform_mc::PdrStore savedPdrs;
+    std::vector<uint8_t> savedFru;
+    EXPECT_FALSE(
+        snapshotCache.load(snapshotUUID, savedInfo, savedPdrs, savedFru));
+}
+
+TEST_F(PlatformManagerSnapshotTest, fruRecordTableLength)
+{
+    auto terminus = addTerminus(true);
+    // A General FRU record ending with a 4 bytes Model field
+    std::vector<uint8_t> fruTable{
+        0x1, 0x0,                     // recordSetIdentifier
+        PLDM_FRU_RECORD_TYPE_GENERAL, // recordType
+        1,                            // numberOfFields
+        PLDM_FRU_ENCODING_ASCII,      // encodingType
+        PLDM_FRU_FIELD_TYPE_MODEL,    // fieldType
+        4,                            // fieldLength
+        'M', 'o', 'd', 'l'};
+    auto metadataResp = makeGetFRURecordTableMetadataResp(fruTable, 1);
+    auto tableResp = makeGetFRURecordTableResp(fruTable);
+    auto infoResp = makeGetPDRRepositoryInfoResp(repositoryInfo);
+    auto pdrResp = makeGetPDRResp(1, numericSensorPdr);
+    auto nameResp = makeGetPDRResp(0, terminusNamePdr);
+    enqueue(metadataResp);
+    enqueue(tableResp);
+    enqueue(infoResp);
+    enqueue(pdrResp);
+    enqueue(nameResp);
+
+    stdexec::sync_wait(snapshotPlatformManager.initTerminus());
+    EXPECT_TRUE(terminus->initialized);
+    EXPECT_TRUE(mockTerminusManager.responseMsgs.empty());
+
+    // The record table is received up to its last byte
+    pldm::platform_mc::PdrRepositoryInfo savedInfo{};
+    pldm::platform_mc::PdrStore savedPdrs;
+    std::vector<uint8_t> savedFru;
+    ASSERT_TRUE(
+        snapshotCache.load(snapshotUUID, savedInfo, savedPdrs, savedFru));
+    EXPECT_EQ(savedFru, fruTable);
+}
+
+TEST_F(PlatformManagerSnapshotTest, restoreFromSnapshot)
+{
+    pldm::platform_mc::PdrStore pdrs;
+    pdrs.add(numericSensorPdr);
+    pdrs.add(terminusNamePdr);
+    ASSERT_TRUE(snapshotCache.save(snapshotUUID, repositoryInfo, pdrs, {}));
+
+    // Only the repository info is requested, to check the snapshot
+    auto terminus = addTerminus();
+    auto infoResp = makeGetPDRRepositoryInfoResp(repositoryInfo);
+    enqueue(infoResp);
+
+    stdexec::sync_wait(snapshotPlatformManager.initTerminus());
+    EXPECT_TRUE(terminus->initialized);
+    EXPECT_TRUE(mockTerminusManager.responseMsgs.empty());
+    EXPECT_EQ(2, terminus->pdrs.size());
+    utils::runEventLoopForSeconds(event, 1);
+    EXPECT_EQ(1, terminus->numericSensors.size());
+    EXPECT_EQ("S0", terminus->getTerminusName().value());
+}
+
+TEST_F(PlatformManagerSnapshotTest, staleSnapshot)
+{
+    // The snapshot was taken before the numeric sensor was added
+    auto staleInfo = repositoryInfo;
+    staleInfo.recordCount = 1;
+    pldm::platform_mc::PdrStore pdrs;
+    pdrs.add(terminusNamePdr);
+    ASSERT_TRUE(snapshotCache.save(snapshotUUID, staleInfo, pdrs, {}));
+
+    auto terminus = addTerminus();
+    auto checkResp = makeGetPDRRepositoryInfoResp(repositoryInfo);
+    auto infoResp = makeGetPDRRepositoryInfoResp(repositoryInfo);
+    auto pdrResp = makeGetPDRResp(1, numericSensorPdr);
+    auto nameResp = makeGetPDRResp(0, terminusNamePdr);
+    enqueue(checkResp);
+    enqueue(infoResp);
+    enqueue(pdrResp);
+    enqueue(nameResp);
+
+    stdexec::sync_wait(snapshotPlatformManager.initTerminus());
+    EXPECT_TRUE(mockTerminusManager.responseMsgs.empty());
+    EXPECT_EQ(2, terminus->pdrs.size());
+    utils::runEventLoopForSeconds(event, 1);
+    EXPECT_EQ(1, terminus->numericSensors.size());
+
+    // The snapshot is replaced by the downloaded PDRs
+    pldm::platform_mc::PdrRepositoryInfo savedInfo{};
+    pldm::platform_mc::PdrStore savedPdrs;
+    std::vector<uint8_t> savedFru;
+    ASSERT_TRUE(
+        snapshotCache.load(snapshotUUID, savedInfo, savedPdrs, savedFru));
+    EXPECT_EQ(savedInfo, repositoryInfo);
+    EXPECT_EQ(2, savedPdrs.size());
+}
@@ -0,0 +1,98 @@
+#include "platform-mc/sensor_conversion.hpp"
+#include "platform-mc/test/sensor_conversion_test.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+TEST(SensorConversionTest, benchmarkTenThousandSensors)
+{
+    constexpr size_t numSensors = 10000;
+    constexpr size_t numPolls = 50;
+
+    SensorConversionTable table;
+    std::vector<SensorConversion> conversions;
+    for (size_t i = 0; i < numSensors; ++i)
+    {
+        conversions.emplace_back(makeConversion(i));
+        table.add(static_cast<uint16_t>(i), conversions.back());
+    }
+    std::vector<uint32_t> indexes(numSensors);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    std::vector<double> raw(numSensors);
+    for (size_t i = 0; i < numSensors; ++i)
+    {
+        raw[i] = static_cast<double>((i * 37) % 200) - 20;
+    }
+
+    // One sensor at a time, as the conversion and the threshold checks of
+    // NumericSensor::updateReading
+    std::vector<double> scalarValues(numSensors);
+    std::vector<uint8_t> scalarConditions(numSensors);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t poll = 0; poll < numPolls; ++poll)
+    {
+        for (size_t i = 0; i < numSensors; ++i)
+        {
+            const auto& conversion = conversions[i];
+            double value = raw[i];
+            if (std::isfinite(conversion.resolution))
+            {
+                value *= conversion.resolution;
+            }
+            if (std::isfinite(conversion.offset))
+            {
+                value += conversion.offset;
+            }
+            if (std::isfinite(value))
+            {
+                value *= conversion.multiplier;
+            }
+            scalarValues[i] = value;
+            scalarConditions[i] = evaluateThresholds(value, conversion);
+        }
+    }
+    auto scalarTime = std::chrono::steady_clock::now() - start;
+
+    std::vector<double> values(numSensors);
+    std::vector<uint8_t> conditions(numSensors);
+    start = std::chrono::steady_clock::now();
+    for (size_t poll = 0; poll < numPolls; ++poll)
+    {
+        table.convert(indexes, raw, values, conditions);
+    }
+    auto batchTime = std::chrono::steady_clock::now() - start;
+
+    std::vector<double> allValues(numSensors);
+    std::vector<uint8_t> allConditions(numSensors);
+    start = std::chrono::steady_clock::now();
+    for (size_t poll = 0; poll < numPolls; ++poll)
+    {
+        table.convertAll(raw, allValues, allConditions);
+    }
+    auto contiguousTime = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(allValues, values);
+    EXPECT_EQ(allConditions, conditions);
+
+    for (size_t i = 0; i < numSensors; ++i)
+    {
+        ASSERT_DOUBLE_EQ(values[i], scalarValues[i]);
+        ASSERT_EQ(conditions[i], scalarConditions[i]);
+    }
+
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    auto perPoll = [&](auto time) {
+        return static_cast<int>(duration_cast<nanoseconds>(time).count() /
+                                numPolls);
+    };
+    RecordProperty("sensors", static_cast<int>(numSensors));
+    RecordProperty("scalarNsPerPoll", perPoll(scalarTime));
+    RecordProperty("batchNsPerPoll", perPoll(batchTime));
+    RecordProperty("contiguousNsPerPoll", perPoll(contiguousTime));
+}
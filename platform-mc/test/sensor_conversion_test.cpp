@@ -0,0 +1,135 @@
+#include "platform-mc/sensor_conversion.hpp"
+#include "platform-mc/test/sensor_conversion_test.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+namespace
+{
+
+/** @brief Alarm state per reading as NumericSensor::checkThreshold */
+bool checkThreshold(bool alarm, bool direction, double value, double threshold,
+                    double hyst)
+{
+    if (direction)
+    {
+        if (value >= threshold)
+        {
+            return true;
+        }
+        if (value < (threshold - hyst))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if (value <= threshold)
+        {
+            return true;
+        }
+        if (value > (threshold + hyst))
+        {
+            return false;
+        }
+    }
+    return alarm;
+}
+
+} // namespace
+
+TEST(SensorConversionTest, convertMatchesScalar)
+{
+    SensorConversionTable table;
+    std::vector<SensorConversion> conversions;
+    for (uint16_t i = 0; i < 64; ++i)
+    {
+        conversions.emplace_back(makeConversion(i));
+        EXPECT_EQ(table.add(i + 100, conversions.back()), i);
+    }
+    // Factors not finite are skipped as by NumericSensor::conversionFormula
+    conversions[5].resolution = quietNaN;
+    conversions[6].offset = std::numeric_limits<double>::infinity();
+    table.update(5, conversions[5]);
+    table.update(6, conversions[6]);
+    ASSERT_EQ(table.size(), 64);
+    EXPECT_EQ(table.sensorId(3), 103);
+
+    std::vector<uint32_t> indexes{63, 0, 5, 6, 17, 17, 42};
+    std::vector<double> raw{120, -40, 33, 7, quietNaN, 250, 19};
+    std::vector<double> values(indexes.size());
+    std::vector<uint8_t> conditions(indexes.size());
+    table.convert(indexes, raw, values, conditions);
+
+    for (size_t i = 0; i < indexes.size(); ++i)
+    {
+        const auto& conversion = conversions[indexes[i]];
+        double expected = raw[i];
+        if (std::isfinite(conversion.resolution))
+        {
+            expected *= conversion.resolution;
+        }
+        if (std::isfinite(conversion.offset))
+        {
+            expected += conversion.offset;
+        }
+        expected *= conversion.multiplier;
+
+        if (std::isnan(expected))
+        {
+            EXPECT_TRUE(std::isnan(values[i]));
+            EXPECT_EQ(conditions[i], 0);
+            continue;
+        }
+        EXPECT_DOUBLE_EQ(values[i], expected);
+        EXPECT_EQ(conditions[i], evaluateThresholds(values[i], conversion));
+    }
+}
+
+TEST(SensorConversionTest, thresholdHysteresis)
+{
+    SensorConversion conversion{};
+    conversion.hysteresis = 2;
+    conversion.warningHigh = 40;
+    conversion.warningLow = 30;
+
+    SensorConversionTable table;
+    table.add(1, conversion);
+
+    // Successive readings of the sensor
+    std::vector<double> raw{35, 40, 45, 38, 35, 30, 25, 32, 35};
+    std::vector<uint32_t> indexes(raw.size(), 0);
+    std::vector<double> values(raw.size());
+    std::vector<uint8_t> conditions(raw.size());
+    table.convert(indexes, raw, values, conditions);
+
+    bool highAlarm = false;
+    bool lowAlarm = false;
+    bool expectedHigh = false;
+    bool expectedLow = false;
+    for (size_t i = 0; i < raw.size(); ++i)
+    {
+        EXPECT_EQ(conditions[i], evaluateThresholds(values[i], conversion));
+        highAlarm = nextAlarmState(highAlarm, conditions[i], warningHighAssert,
+                                   warningHighDeassert);
+        lowAlarm = nextAlarmState(lowAlarm, conditions[i], warningLowAssert,
+                                  warningLowDeassert);
+        expectedHigh = checkThreshold(expectedHigh, true, raw[i], 40, 2);
+        expectedLow = checkThreshold(expectedLow, false, raw[i], 30, 2);
+        EXPECT_EQ(highAlarm, expectedHigh);
+        EXPECT_EQ(lowAlarm, expectedLow);
+    }
+
+    // No condition is ever set for the missing critical thresholds
+    for (auto bits : conditions)
+    {
+        EXPECT_EQ(bits & (criticalHighAssert | criticalHighDeassert |
+                          criticalLowAssert | criticalLowDeassert),
+                  0);
+    }
+}
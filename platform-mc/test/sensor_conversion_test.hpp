@@ -0,0 +1,23 @@
+#pragma once
+
+#include "platform-mc/sensor_conversion.hpp"
+
+#include <cmath>
+#include <limits>
+
+constexpr double quietNaN = std::numeric_limits<double>::quiet_NaN();
+
+/** @brief The conversion of the i-th sensor of a synthetic terminus */
+inline pldm::platform_mc::SensorConversion makeConversion(size_t i)
+{
+    pldm::platform_mc::SensorConversion conversion{};
+    conversion.resolution = 0.5 + (i % 7) * 0.25;
+    conversion.offset = static_cast<double>(i % 5) - 2;
+    conversion.multiplier = std::pow(10, static_cast<int>(i % 3) - 1);
+    conversion.hysteresis = i % 4;
+    conversion.warningHigh = 80;
+    conversion.warningLow = 10;
+    conversion.criticalHigh = (i % 2) ? 95 : quietNaN;
+    conversion.criticalLow = (i % 3) ? 0 : quietNaN;
+    return conversion;
+}
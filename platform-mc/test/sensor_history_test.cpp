@@ -0,0 +1,155 @@
+#include "platform-mc/sensor_history.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+TEST(SensorHistoryTest, ringBuffer)
+{
+    auto region = SensorHistoryRegion::create({}, 2, 4);
+    ASSERT_NE(region, nullptr);
+    auto history = region->allocate(1, 10);
+    ASSERT_NE(history, nullptr);
+    EXPECT_EQ(history->capacity(), 4);
+    EXPECT_EQ(history->size(), 0);
+
+    for (uint64_t i = 1; i <= 6; ++i)
+    {
+        history->push(i * 1000, i * 1.5);
+    }
+    history->push(7000, std::numeric_limits<double>::quiet_NaN());
+    EXPECT_EQ(history->size(), 4);
+
+    // The oldest readings are overwritten, the rest is in order
+    SensorSamples samples;
+    history->read(0, samples);
+    EXPECT_EQ(samples.tid, 1);
+    EXPECT_EQ(samples.sensorId, 10);
+    EXPECT_EQ(samples.timestamps,
+              (std::vector<uint64_t>{4000, 5000, 6000, 7000}));
+    ASSERT_EQ(samples.values.size(), 4);
+    EXPECT_EQ(samples.values[0], 6.0);
+    EXPECT_EQ(samples.values[2], 9.0);
+    EXPECT_TRUE(std::isnan(samples.values[3]));
+
+    history->read(5000, samples);
+    EXPECT_EQ(samples.timestamps, (std::vector<uint64_t>{6000, 7000}));
+    EXPECT_EQ(samples.values.size(), 2);
+}
+
+TEST(SensorHistoryTest, slots)
+{
+    auto region = SensorHistoryRegion::create({}, 2, 8);
+    ASSERT_NE(region, nullptr);
+    EXPECT_EQ(SensorHistoryRegion::create({}, 0, 8), nullptr);
+
+    auto history1 = region->allocate(1, 10);
+    auto history2 = region->allocate(2, 20);
+    ASSERT_NE(history1, nullptr);
+    ASSERT_NE(history2, nullptr);
+    EXPECT_EQ(region->allocate(3, 30), nullptr);
+    history1->push(100, 1.0);
+    history2->push(100, 2.0);
+    history2->push(200, 3.0);
+
+    auto histories = region->read({}, 0);
+    ASSERT_EQ(histories.size(), 2);
+    EXPECT_EQ(histories[0].tid, 1);
+    EXPECT_EQ(histories[0].values, std::vector<double>{1.0});
+    EXPECT_EQ(histories[1].tid, 2);
+    EXPECT_EQ(histories[1].values, (std::vector<double>{2.0, 3.0}));
+
+    histories = region->read({{2, 20}, {5, 50}}, 100);
+    ASSERT_EQ(histories.size(), 1);
+    EXPECT_EQ(histories[0].sensorId, 20);
+    EXPECT_EQ(histories[0].values, std::vector<double>{3.0});
+
+    // A released slot is reused empty
+    history1.reset();
+    EXPECT_EQ(region->read({}, 0).size(), 1);
+    auto history3 = region->allocate(3, 30);
+    ASSERT_NE(history3, nullptr);
+    EXPECT_EQ(history3->size(), 0);
+    histories = region->read({{3, 30}}, 0);
+    ASSERT_EQ(histories.size(), 1);
+    EXPECT_TRUE(histories[0].timestamps.empty());
+}
+
+TEST(SensorHistoryTest, sharedMemoryReader)
+{
+    const std::string shmName = "/pldm-sensor-history-test";
+    {
+        auto region = SensorHistoryRegion::create(shmName, 4, 16);
+        ASSERT_NE(region, nullptr);
+        auto history = region->allocate(9, 90);
+        ASSERT_NE(history, nullptr);
+        history->push(1000, 42.0);
+        history->push(2000, 43.0);
+
+        SensorHistoryReader reader(shmName);
+        ASSERT_TRUE(reader.isOpen());
+        auto histories = reader.read({}, 0);
+        ASSERT_EQ(histories.size(), 1);
+        EXPECT_EQ(histories[0].tid, 9);
+        EXPECT_EQ(histories[0].sensorId, 90);
+        EXPECT_EQ(histories[0].timestamps,
+                  (std::vector<uint64_t>{1000, 2000}));
+        EXPECT_EQ(histories[0].values, (std::vector<double>{42.0, 43.0}));
+
+        // The reader sees the new readings
+        history->push(3000, 44.0);
+        histories = reader.read({{9, 90}}, 2000);
+        ASSERT_EQ(histories.size(), 1);
+        EXPECT_EQ(histories[0].values, std::vector<double>{44.0});
+    }
+
+    // The shared memory object is removed with the region
+    SensorHistoryReader reader(shmName);
+    EXPECT_FALSE(reader.isOpen());
+    EXPECT_TRUE(reader.read({}, 0).empty());
+}
+
+TEST(SensorHistoryTest, slotStuckInWrite)
+{
+    const std::string shmName = "/pldm-sensor-history-stuck-test";
+    auto region = SensorHistoryRegion::create(shmName, 4, 16);
+    ASSERT_NE(region, nullptr);
+    auto history = region->allocate(9, 90);
+    ASSERT_NE(history, nullptr);
+    history->push(1000, 42.0);
+
+    // A writer which died in the middle of an update leaves the sequence of
+    // its slots odd, the slots follow the header on a cache line
+    auto fd = shm_open(shmName.c_str(), O_RDWR, 0);
+    ASSERT_GE(fd, 0);
+    struct stat st{};
+    ASSERT_EQ(fstat(fd, &st), 0);
+    auto base = static_cast<uint8_t*>(
+        mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+    close(fd);
+    ASSERT_NE(base, MAP_FAILED);
+    auto header = reinterpret_cast<SensorHistoryHeader*>(base);
+    constexpr size_t slotsOffset = 64;
+    for (uint32_t slot = 0; slot < header->slotCount; ++slot)
+    {
+        auto slotHeader = reinterpret_cast<SensorHistorySlot*>(
+            base + slotsOffset + slot * header->slotSize);
+        slotHeader->sequence.fetch_add(1);
+    }
+
+    // The reader gives up on the slot instead of spinning forever
+    SensorHistoryReader reader(shmName);
+    ASSERT_TRUE(reader.isOpen());
+    EXPECT_TRUE(reader.read({}, 0).empty());
+    EXPECT_TRUE(region->read({{9, 90}}, 0).empty());
+    munmap(base, st.st_size);
+}
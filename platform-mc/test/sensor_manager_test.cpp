@@ -136,8 +136,8 @@ TEST_F(SensorManagerTest, sensorPollingTest)
     uint64_t seconds = 10;
     pldm_tid_t tid = 1;
     termini[tid] = std::make_shared<pldm::platform_mc::Terminus>(tid, 0, event);
-    termini[tid]->pdrs.push_back(pdr1);
-    termini[tid]->pdrs.push_back(pdr2);
+    termini[tid]->pdrs.add(pdr1);
+    termini[tid]->pdrs.add(pdr2);
     termini[tid]->parseTerminusPDRs();
 
     uint64_t t0, t1;
@@ -158,3 +158,74 @@ TEST_F(SensorManagerTest, sensorPollingTest)
 
     sensorManager.stopPolling(tid);
 }
+
+TEST_F(SensorManagerTest, checkSensorEventsTest)
+{
+    pldm_tid_t tid = 1;
+    termini[tid] = std::make_shared<pldm::platform_mc::Terminus>(tid, 0, event);
+    termini[tid]->pdrs.add(pdr1);
+    termini[tid]->pdrs.add(pdr2);
+    termini[tid]->parseTerminusPDRs();
+    utils::runEventLoopForSeconds(event, 1);
+    ASSERT_EQ(1, termini[tid]->numericSensors.size());
+    auto& sensor = *termini[tid]->numericSensors[0];
+    sensorManager.livenessTime = 60000;
+
+    // The events of the sensor are enabled and match its state
+    sensor.eventDriven = true;
+    sensor.eventState = PLDM_SENSOR_NORMAL;
+    sensorManager.checkSensorEvents(sensor, PLDM_SENSOR_ENABLED,
+                                    PLDM_EVENTS_ENABLED, PLDM_SENSOR_NORMAL);
+    EXPECT_TRUE(sensor.eventMessageEnabled);
+    EXPECT_TRUE(sensor.eventDriven);
+
+    // The state changed without an event
+    sensorManager.checkSensorEvents(sensor, PLDM_SENSOR_ENABLED,
+                                    PLDM_EVENTS_ENABLED,
+                                    PLDM_SENSOR_UPPERWARNING);
+    EXPECT_FALSE(sensor.eventDriven);
+
+    // The events are disabled
+    sensor.eventDriven = true;
+    sensorManager.checkSensorEvents(sensor, PLDM_SENSOR_ENABLED,
+                                    PLDM_NO_EVENT_GENERATION,
+                                    PLDM_SENSOR_NORMAL);
+    EXPECT_FALSE(sensor.eventMessageEnabled);
+    EXPECT_FALSE(sensor.eventDriven);
+
+    // The sensor is disabled
+    sensor.eventDriven = true;
+    sensorManager.checkSensorEvents(sensor, PLDM_SENSOR_DISABLED,
+                                    PLDM_EVENTS_ENABLED, PLDM_SENSOR_NORMAL);
+    EXPECT_FALSE(sensor.eventDriven);
+
+    // A liveness interval of 0 polls every sensor at its update interval
+    sensorManager.livenessTime = 0;
+    sensorManager.checkSensorEvents(sensor, PLDM_SENSOR_ENABLED,
+                                    PLDM_EVENTS_ENABLED, PLDM_SENSOR_NORMAL);
+    EXPECT_FALSE(sensor.eventMessageEnabled);
+}
+
+TEST_F(SensorManagerTest, batchTimeStampTest)
+{
+    pldm_tid_t tid = 1;
+    termini[tid] = std::make_shared<pldm::platform_mc::Terminus>(tid, 0, event);
+    termini[tid]->pdrs.add(pdr1);
+    termini[tid]->pdrs.add(pdr2);
+    termini[tid]->parseTerminusPDRs();
+    utils::runEventLoopForSeconds(event, 1);
+    ASSERT_EQ(1, termini[tid]->numericSensors.size());
+    auto sensor = termini[tid]->numericSensors[0];
+
+    // A batched reading leaves the sensor due until it is published
+    pldm::platform_mc::SensorReadingBatch batch;
+    batch.sensors.emplace_back(sensor);
+    batch.raw.emplace_back(40);
+    batch.timeStamps.emplace_back(1234);
+    EXPECT_EQ(0, sensor->timeStamp);
+
+    sensorManager.updateReadings(*termini[tid], batch);
+    EXPECT_EQ(1234, sensor->timeStamp);
+    EXPECT_TRUE(batch.sensors.empty());
+    EXPECT_TRUE(batch.timeStamps.empty());
+}
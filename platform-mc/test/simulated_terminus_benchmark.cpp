@@ -0,0 +1,85 @@
+#include "platform-mc/test/simulated_terminus_test.hpp"
+
+#include <libpldm/platform.h>
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+
+#include <gtest/gtest.h>
+
+TEST_F(SimulatedTerminusTest, benchmarkPlatform)
+{
+    constexpr uint16_t sensors = 32;
+    constexpr size_t eventsPerTerminus = 64;
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    for (size_t count : {1, 16, 64})
+    {
+        TerminusSpec spec{};
+        spec.sensors = sensors;
+        // The sensors are read on every polling round
+        spec.interval = 0.001;
+        spec.fru = 2;
+        SimulatedPlatform platform(event, dir, count, spec);
+
+        // Discovery, from the new endpoints to their event receiver set
+        auto start = Clock::now();
+        ASSERT_TRUE(platform.discover());
+        auto discoveryTime = Clock::now() - start;
+
+        // Poll cycle, the time to read every sensor once more once the first
+        // polling round is done
+        auto allSensors = sensors * count;
+        auto readings = &SimulatedTerminus::Counters::sensorReadings;
+        ASSERT_TRUE(runUntil(event, [&] {
+            return platform.total(readings) >= allSensors;
+        }));
+        auto firstReadings = platform.total(readings);
+        start = Clock::now();
+        ASSERT_TRUE(runUntil(event, [&] {
+            return platform.total(readings) >= firstReadings + allSensors;
+        }));
+        auto pollCycleTime = Clock::now() - start;
+
+        // Event throughput, the queued events polled with the sensor polling
+        // stopped
+        size_t handled = 0;
+        platform.manager.registerPolledEventHandler(
+            PLDM_SENSOR_EVENT,
+            {[&handled](pldm_tid_t, uint16_t, const uint8_t*, size_t) {
+                handled++;
+                return PLDM_SUCCESS;
+            }});
+        for (auto& loopbackTerminus : platform.termini)
+        {
+            auto& terminus = loopbackTerminus->getTerminus();
+            platform.manager.stopSensorPolling(terminus.getTid());
+            terminus.queueEvents(eventsPerTerminus);
+        }
+        exec::async_scope scope;
+        size_t completed = 0;
+        start = Clock::now();
+        for (auto& terminus : platform.termini)
+        {
+            scope.spawn(platform.manager.pollForPlatformEvent(
+                            terminus->getTerminus().getTid(), 0, 0) |
+                            stdexec::then([&completed](int) { completed++; }),
+                        exec::default_task_context<void>(
+                            exec::inline_scheduler{}));
+        }
+        ASSERT_TRUE(runUntil(event, [&] { return completed == count; }));
+        auto eventTime = Clock::now() - start;
+        EXPECT_EQ(handled, eventsPerTerminus * count);
+
+        auto us = [](auto time) {
+            return static_cast<int>(duration_cast<microseconds>(time).count());
+        };
+        RecordProperty(std::format("discoveryUs{}", count), us(discoveryTime));
+        RecordProperty(std::format("pollCycleUs{}", count), us(pollCycleTime));
+        RecordProperty(
+            std::format("eventsPerSecond{}", count),
+            static_cast<int>(handled * 1000000 / std::max(us(eventTime), 1)));
+    }
+}
@@ -0,0 +1,76 @@
+#include "platform-mc/test/simulated_terminus_test.hpp"
+
+#include <libpldm/platform.h>
+
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST_F(SimulatedTerminusTest, parseSpec)
+{
+    auto spec = parseTerminusSpec(
+        "name=Gpu,sensors=256,interval=0.5,fru=2,readings=random,events=4");
+    ASSERT_TRUE(spec);
+    EXPECT_EQ(spec->name, "Gpu");
+    EXPECT_EQ(spec->sensors, 256);
+    EXPECT_FLOAT_EQ(spec->interval, 0.5);
+    EXPECT_EQ(spec->fru, 2);
+    EXPECT_EQ(spec->readings, ReadingGenerator::random);
+    EXPECT_EQ(spec->events, 4);
+
+    spec = parseTerminusSpec("");
+    ASSERT_TRUE(spec);
+    EXPECT_EQ(spec->sensors, TerminusSpec{}.sensors);
+
+    EXPECT_FALSE(parseTerminusSpec("sensors"));
+    EXPECT_FALSE(parseTerminusSpec("sensors=65535"));
+    EXPECT_FALSE(parseTerminusSpec("interval=0"));
+    EXPECT_FALSE(parseTerminusSpec("readings=triangle"));
+    EXPECT_FALSE(parseTerminusSpec("colour=blue"));
+}
+
+TEST_F(SimulatedTerminusTest, discoverAndPoll)
+{
+    TerminusSpec spec{};
+    spec.sensors = 4;
+    spec.interval = 0.001;
+    // A FRU record table of several parts
+    spec.fru = 40;
+    SimulatedPlatform platform(event, dir, 1, spec);
+    auto& terminus = platform.termini.front()->getTerminus();
+
+    ASSERT_TRUE(platform.discover());
+    const auto& counters = terminus.getCounters();
+    EXPECT_NE(terminus.getTid(), PLDM_TID_UNASSIGNED);
+    EXPECT_EQ(counters.pdrs, spec.sensors + 1);
+    EXPECT_GT(counters.fruParts, 1);
+    EXPECT_EQ(counters.eventReceiverConfigs, 1);
+    EXPECT_EQ(counters.unsupported, 0);
+
+    // Every sensor is read
+    EXPECT_TRUE(runUntil(event, [&counters, &spec] {
+        return counters.sensorReadings >= spec.sensors;
+    }));
+
+    // The queued events are polled, handed over and acknowledged
+    std::vector<uint16_t> eventIds;
+    platform.manager.registerPolledEventHandler(
+        PLDM_SENSOR_EVENT,
+        {[&eventIds](pldm_tid_t, uint16_t eventId, const uint8_t*, size_t) {
+            eventIds.push_back(eventId);
+            return PLDM_SUCCESS;
+        }});
+    terminus.queueEvents(8);
+    exec::async_scope scope;
+    std::optional<int> rc;
+    scope.spawn(platform.manager.pollForPlatformEvent(terminus.getTid(), 0, 0) |
+                    stdexec::then([&rc](int result) { rc = result; }),
+                exec::default_task_context<void>(exec::inline_scheduler{}));
+    ASSERT_TRUE(runUntil(event, [&rc] { return rc.has_value(); }));
+    EXPECT_EQ(*rc, PLDM_SUCCESS);
+    EXPECT_EQ(eventIds, (std::vector<uint16_t>{1, 2, 3, 4, 5, 6, 7, 8}));
+    EXPECT_EQ(terminus.getQueuedEvents(), 0);
+    EXPECT_EQ(counters.eventsPolled, 8);
+    EXPECT_EQ(counters.eventsAcknowledged, 8);
+}
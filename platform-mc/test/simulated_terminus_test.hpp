@@ -0,0 +1,164 @@
+#pragma once
+
+#include "common/instance_id.hpp"
+#include "common/transport.hpp"
+#include "common/types.hpp"
+#include "platform-mc/manager.hpp"
+#include "test/test_instance_id.hpp"
+#include "utilities/loadgen/simulated_terminus.hpp"
+
+#include <libpldm/base.h>
+#include <libpldm/platform.h>
+#include <stdlib.h>
+#include <systemd/sd-event.h>
+
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/io.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace fs = std::filesystem;
+using namespace pldm::loadgen;
+using Clock = std::chrono::steady_clock;
+
+/** @brief The EID of the first simulated terminus */
+constexpr uint8_t firstEid = 9;
+
+/** @brief Run the event loop until a condition is met or the timeout expires
+ *
+ *  @return true if the condition is met
+ */
+inline bool runUntil(sdeventplus::Event& event,
+                     const std::function<bool()>& done,
+                     std::chrono::seconds timeout = std::chrono::seconds(60))
+{
+    auto deadline = Clock::now() + timeout;
+    while (!done())
+    {
+        if (Clock::now() >= deadline)
+        {
+            return false;
+        }
+        sd_event_run(event.get(), 10000);
+    }
+    return true;
+}
+
+/** @brief platform-mc managing simulated termini on the loopback transport */
+class SimulatedPlatform
+{
+  public:
+    SimulatedPlatform(sdeventplus::Event& event, const fs::path& dir,
+                      size_t count, const TerminusSpec& spec) :
+        event(event), transport(dir, pldm::BmcMctpEid),
+        reqHandler(&transport, event, instanceIdDb, false),
+        manager(event, reqHandler, instanceIdDb),
+        io(event, transport.getEventSource(), EPOLLIN,
+           [this](sdeventplus::source::IO&, int, uint32_t revents) {
+               if (revents & EPOLLIN)
+               {
+                   receive();
+               }
+           })
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint8_t eid = firstEid + i;
+            termini.emplace_back(
+                std::make_unique<LoopbackTerminus>(event, dir, eid, spec));
+            mctpInfos.emplace_back(eid, "", "", 0);
+        }
+    }
+
+    ~SimulatedPlatform()
+    {
+        manager.handleRemovedMctpEndpoints(mctpInfos);
+        // Let the stopped tasks wind down
+        for (int i = 0; i < 100 && sd_event_run(event.get(), 0) > 0; ++i)
+        {}
+    }
+
+    /** @brief Discover the termini and wait for the end of their
+     *         initialization, their event receiver being set last
+     */
+    bool discover()
+    {
+        manager.handleMctpEndpoints(mctpInfos);
+        return runUntil(event, [this] {
+            return std::ranges::all_of(termini, [](const auto& terminus) {
+                return terminus->getTerminus()
+                           .getCounters()
+                           .eventReceiverConfigs;
+            });
+        });
+    }
+
+    /** @brief The total of a counter of the termini */
+    uint64_t total(uint64_t SimulatedTerminus::Counters::* counter)
+    {
+        uint64_t sum = 0;
+        for (const auto& terminus : termini)
+        {
+            sum += terminus->getTerminus().getCounters().*counter;
+        }
+        return sum;
+    }
+
+    sdeventplus::Event& event;
+    PldmTransport transport;
+    TestInstanceIdDb instanceIdDb;
+    pldm::requester::Handler<pldm::requester::Request> reqHandler;
+    pldm::platform_mc::Manager manager;
+    sdeventplus::source::IO io;
+    std::vector<std::unique_ptr<LoopbackTerminus>> termini;
+    pldm::MctpInfos mctpInfos;
+
+  private:
+    /** @brief Pass the responses of the termini to the requester handler */
+    void receive()
+    {
+        pldm_tid_t eid = 0;
+        void* rx = nullptr;
+        size_t len = 0;
+        while (transport.recvMsg(eid, rx, len) == PLDM_REQUESTER_SUCCESS)
+        {
+            auto msg = static_cast<const pldm_msg*>(rx);
+            if (len >= sizeof(pldm_msg_hdr) && !msg->hdr.request)
+            {
+                reqHandler.handleResponse(eid, msg->hdr.instance_id,
+                                          msg->hdr.type, msg->hdr.command, msg,
+                                          len - sizeof(pldm_msg_hdr));
+            }
+            free(rx);
+            rx = nullptr;
+        }
+    }
+};
+
+class SimulatedTerminusTest : public testing::Test
+{
+  protected:
+    SimulatedTerminusTest() : event(sdeventplus::Event::get_default()) {}
+
+    void SetUp() override
+    {
+        char tmpdir[] = "/tmp/pldm_simulated.XXXXXX";
+        dir = fs::path(mkdtemp(tmpdir));
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(dir);
+    }
+
+    sdeventplus::Event event;
+    fs::path dir;
+};
@@ -0,0 +1,62 @@
+#include "platform-mc/numeric_sensor.hpp"
+#include "platform-mc/terminus.hpp"
+#include "platform-mc/test/terminus_test.hpp"
+#include "platform-mc/test/utils_test.hpp"
+
+#include <libpldm/entity.h>
+#include <systemd/sd-event.h>
+
+#include <chrono>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+TEST(TerminusTest, benchmarkSensorCreation)
+{
+    constexpr uint16_t numSensors = 1000;
+    auto event = sdeventplus::Event::get_default();
+
+    auto createSensors = [&](pldm_tid_t tid, size_t batchSize) {
+        auto start = utils::heapInUse();
+        auto t1 = pldm::platform_mc::Terminus(
+            tid, 1 << PLDM_BASE | 1 << PLDM_PLATFORM, event);
+        t1.sensorCreationBatchSize = batchSize;
+        t1.pdrs.add(makeTerminusNamePdr('0' + tid));
+        for (uint16_t id = 1; id <= numSensors; ++id)
+        {
+            t1.pdrs.add(makeNumericSensorPdr(
+                id,
+                (id % 4) ? PLDM_SENSOR_UNIT_WATTS : PLDM_SENSOR_UNIT_DEGRESS_C,
+                (id % 4) ? 0 : 0x1b));
+        }
+
+        using namespace std::chrono;
+        auto begin = steady_clock::now();
+        t1.parseTerminusPDRs();
+        size_t iterations = 0;
+        while (t1.numericSensors.size() < numSensors &&
+               iterations < numSensors)
+        {
+            sd_event_run(event.get(), 0);
+            ++iterations;
+        }
+        auto elapsed = duration_cast<microseconds>(steady_clock::now() - begin);
+        EXPECT_EQ(numSensors, t1.numericSensors.size());
+
+        return std::make_tuple(iterations, elapsed.count(),
+                               utils::heapInUse() - start);
+    };
+
+    auto [oneIterations, oneUs, oneBytes] = createSensors(2, 1);
+    auto [batchIterations, batchUs, batchBytes] =
+        createSensors(3, SENSOR_CREATION_BATCH_SIZE);
+
+    EXPECT_LE(batchIterations, oneIterations);
+    RecordProperty("sensors", static_cast<int>(numSensors));
+    RecordProperty("perSensorIterations", static_cast<int>(oneIterations));
+    RecordProperty("perSensorUs", static_cast<int>(oneUs));
+    RecordProperty("perSensorHeapBytes", static_cast<int>(oneBytes));
+    RecordProperty("batchIterations", static_cast<int>(batchIterations));
+    RecordProperty("batchUs", static_cast<int>(batchUs));
+    RecordProperty("batchHeapBytes", static_cast<int>(batchBytes));
+}
@@ -245,6 +245,285 @@ TEST_F(TerminusManagerTest, negativeDiscoverMctpTerminusTest)
     EXPECT_EQ(0, termini.size());
 }
 
+TEST_F(TerminusManagerTest, discoverWithFailedEndpointTest)
+{
+    const size_t getTidRespLen = PLDM_GET_TID_RESP_BYTES;
+    const size_t setTidRespLen = PLDM_SET_TID_RESP_BYTES;
+    const size_t getPldmTypesRespLen = PLDM_GET_TYPES_RESP_BYTES;
+
+    // The first endpoint returns the reserved tid
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getTidRespLen> getTidResp0{
+        0x00, 0x02, 0x02, 0x00, PLDM_TID_RESERVED};
+    auto rc = mockTerminusManager.enqueueResponse(
+        new (getTidResp0.data()) pldm_msg, sizeof(getTidResp0));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    // The second endpoint is discovered still
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getTidRespLen> getTidResp1{
+        0x00, 0x02, 0x02, 0x00, 0x00};
+    rc = mockTerminusManager.enqueueResponse(new (getTidResp1.data()) pldm_msg,
+                                             sizeof(getTidResp1));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + setTidRespLen> setTidResp1{
+        0x00, 0x02, 0x01, 0x00};
+    rc = mockTerminusManager.enqueueResponse(new (setTidResp1.data()) pldm_msg,
+                                             sizeof(setTidResp1));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getPldmTypesRespLen>
+        getPldmTypesResp1{0x00, 0x02, 0x04, 0x00, 0x01, 0x00,
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    rc = mockTerminusManager.enqueueResponse(
+        new (getPldmTypesResp1.data()) pldm_msg, sizeof(getPldmTypesResp1));
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    pldm::MctpInfos mctpInfos{};
+    mctpInfos.emplace_back(pldm::MctpInfo(12, "", "", 1));
+    mctpInfos.emplace_back(pldm::MctpInfo(13, "", "", 1));
+    mockTerminusManager.discoverMctpTerminus(mctpInfos);
+    EXPECT_EQ(1, termini.size());
+    EXPECT_EQ(std::nullopt,
+              mockTerminusManager.toTid(pldm::MctpInfo(12, "", "", 1)));
+    EXPECT_NE(std::nullopt,
+              mockTerminusManager.toTid(pldm::MctpInfo(13, "", "", 1)));
+
+    mockTerminusManager.removeMctpTerminus(mctpInfos);
+    EXPECT_EQ(0, termini.size());
+}
+
+TEST_F(TerminusManagerTest, discoverTidCollisionTest)
+{
+    // Both endpoints report the TID 5
+    std::vector<uint8_t> setTids;
+    pldm::platform_mc::InterleavedTerminusManager interleavedTerminusManager(
+        event, reqHandler, instanceIdDb, termini,
+        [&setTids](mctp_eid_t, const pldm_msg* request) {
+            switch (request->hdr.command)
+            {
+                case PLDM_GET_TID:
+                    return std::vector<uint8_t>{0x00, 0x02, 0x02, 0x00, 0x05};
+                case PLDM_SET_TID:
+                    setTids.push_back(request->payload[0]);
+                    return std::vector<uint8_t>{0x00, 0x02, 0x01, 0x00};
+                case PLDM_GET_PLDM_TYPES:
+                    return std::vector<uint8_t>{0x00, 0x02, 0x04, 0x00,
+                                                0x00, 0x00, 0x00, 0x00,
+                                                0x00, 0x00, 0x00, 0x00};
+                default:
+                    return std::vector<uint8_t>{};
+            }
+        });
+
+    pldm::MctpInfos mctpInfos{};
+    mctpInfos.emplace_back(pldm::MctpInfo(12, "", "", 1));
+    mctpInfos.emplace_back(pldm::MctpInfo(13, "", "", 1));
+    interleavedTerminusManager.discoverMctpTerminus(mctpInfos);
+    interleavedTerminusManager.run();
+
+    // Both endpoints are in flight before either terminus is added
+    const auto& requests = interleavedTerminusManager.requests;
+    ASSERT_GE(requests.size(), 2u);
+    EXPECT_EQ(12, requests[0].first);
+    EXPECT_EQ(13, requests[1].first);
+
+    // The first endpoint keeps its TID, the second is assigned another one
+    EXPECT_EQ(2, termini.size());
+    auto tid0 = interleavedTerminusManager.toTid(mctpInfos[0]);
+    auto tid1 = interleavedTerminusManager.toTid(mctpInfos[1]);
+    ASSERT_NE(std::nullopt, tid0);
+    ASSERT_NE(std::nullopt, tid1);
+    EXPECT_EQ(5, *tid0);
+    EXPECT_NE(5, *tid1);
+    EXPECT_EQ(std::vector<uint8_t>{*tid1}, setTids);
+    EXPECT_TRUE(termini.contains(*tid0));
+    EXPECT_TRUE(termini.contains(*tid1));
+
+    interleavedTerminusManager.removeMctpTerminus(mctpInfos);
+    EXPECT_EQ(0, termini.size());
+}
+
+TEST_F(TerminusManagerTest, discoverInterleavedTypeQueriesTest)
+{
+    // Each endpoint supports the base, platform and FRU types, the commands
+    // of a type are reported depending on the endpoint and the type
+    auto commandsOf = [](mctp_eid_t eid, uint8_t type) -> uint8_t {
+        return (1 << (type % 8)) | (eid == 12 ? 0x80 : 0x40);
+    };
+    pldm::platform_mc::InterleavedTerminusManager interleavedTerminusManager(
+        event, reqHandler, instanceIdDb, termini,
+        [&commandsOf](mctp_eid_t eid, const pldm_msg* request) {
+            std::vector<uint8_t> response{0x00, 0x00, request->hdr.command,
+                                          PLDM_SUCCESS};
+            switch (request->hdr.command)
+            {
+                case PLDM_GET_TID:
+                    response.push_back(0x00);
+                    break;
+                case PLDM_SET_TID:
+                    break;
+                case PLDM_GET_PLDM_TYPES:
+                    response.resize(sizeof(pldm_msg_hdr) +
+                                    PLDM_GET_TYPES_RESP_BYTES);
+                    response[4] = (1 << PLDM_BASE) | (1 << PLDM_PLATFORM) |
+                                  (1 << PLDM_FRU);
+                    break;
+                case PLDM_GET_PLDM_VERSION:
+                    // transfer handle, flag, version and CRC
+                    response.insert(response.end(),
+                                    {0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf0,
+                                     0xf1, 0xf1, 0xba, 0xbe, 0x9d, 0x53});
+                    break;
+                case PLDM_GET_PLDM_COMMANDS:
+                    response.resize(sizeof(pldm_msg_hdr) +
+                                    PLDM_GET_COMMANDS_RESP_BYTES);
+                    response[4] = commandsOf(eid, request->payload[0]);
+                    break;
+                default:
+                    return std::vector<uint8_t>{};
+            }
+            return response;
+        });
+
+    pldm::MctpInfos mctpInfos{};
+    mctpInfos.emplace_back(pldm::MctpInfo(12, "", "", 1));
+    mctpInfos.emplace_back(pldm::MctpInfo(13, "", "", 1));
+    interleavedTerminusManager.discoverMctpTerminus(mctpInfos);
+    interleavedTerminusManager.run();
+    ASSERT_EQ(2, termini.size());
+
+    // The versions of all the types of an endpoint are asked before any of
+    // their commands
+    std::vector<uint8_t> commands;
+    for (const auto& [eid, request] : interleavedTerminusManager.requests)
+    {
+        if (eid == 12)
+        {
+            commands.push_back(
+                reinterpret_cast<const pldm_msg*>(request.data())->hdr.command);
+        }
+    }
+    EXPECT_EQ((std::vector<uint8_t>{PLDM_GET_TID, PLDM_SET_TID,
+                                    PLDM_GET_PLDM_TYPES, PLDM_GET_PLDM_VERSION,
+                                    PLDM_GET_PLDM_VERSION, PLDM_GET_PLDM_VERSION,
+                                    PLDM_GET_PLDM_COMMANDS,
+                                    PLDM_GET_PLDM_COMMANDS,
+                                    PLDM_GET_PLDM_COMMANDS}),
+              commands);
+
+    // Each type of each endpoint has the commands of its own response
+    for (const auto& mctpInfo : mctpInfos)
+    {
+        auto eid = std::get<0>(mctpInfo);
+        auto tid = interleavedTerminusManager.toTid(mctpInfo);
+        ASSERT_NE(std::nullopt, tid);
+        auto& terminus = termini.at(*tid);
+        for (uint8_t type : {PLDM_BASE, PLDM_PLATFORM, PLDM_FRU})
+        {
+            auto supported = commandsOf(eid, type);
+            for (uint8_t command = 0; command < 8; command++)
+            {
+                EXPECT_EQ(bool(supported & (1 << command)),
+                          terminus->doesSupportCommand(type, command))
+                    << "EID " << int(eid) << " type " << int(type)
+                    << " command " << int(command);
+            }
+        }
+    }
+
+    interleavedTerminusManager.removeMctpTerminus(mctpInfos);
+    EXPECT_EQ(0, termini.size());
+}
+
+TEST_F(TerminusManagerTest, rediscoverCachedCapabilitiesTest)
+{
+    const size_t getTidRespLen = PLDM_GET_TID_RESP_BYTES;
+    const size_t setTidRespLen = PLDM_SET_TID_RESP_BYTES;
+    const size_t getPldmTypesRespLen = PLDM_GET_TYPES_RESP_BYTES;
+    const size_t getPldmCommandRespLen = PLDM_GET_COMMANDS_RESP_BYTES;
+    const size_t getPldmVersionRespLen =
+        PLDM_GET_VERSION_RESP_BYTES + sizeof(uint32_t);
+
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getTidRespLen> getTidResp{
+        0x00, 0x02, 0x02, 0x00, 0x00};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + setTidRespLen> setTidResp{
+        0x00, 0x02, 0x01, 0x00};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getPldmTypesRespLen>
+        getPldmTypesResp{0x00, 0x02, 0x04, 0x00, 0x01, 0x00,
+                         0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getPldmVersionRespLen>
+        getPldmVersionBaseResp{0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+                               0x00, 0x00, 0x05, 0x00, 0xf0, 0xf1,
+                               0xf1, 0xba, 0xbe, 0x9d, 0x53};
+    uint8_t byte0 = (1 << (PLDM_SET_TID % 8)) + (1 << (PLDM_GET_TID % 8));
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + getPldmCommandRespLen>
+        getPldmCommandBaseResp{
+            0x00, 0x02, 0x05, 0x00, byte0, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00};
+
+    auto enqueueDiscovery = [&]() {
+        mockTerminusManager.enqueueResponse(new (getTidResp.data()) pldm_msg,
+                                            sizeof(getTidResp));
+        mockTerminusManager.enqueueResponse(new (setTidResp.data()) pldm_msg,
+                                            sizeof(setTidResp));
+        mockTerminusManager.enqueueResponse(
+            new (getPldmTypesResp.data()) pldm_msg, sizeof(getPldmTypesResp));
+    };
+
+    // The first discovery queries the version and commands of each type
+    enqueueDiscovery();
+    mockTerminusManager.enqueueResponse(
+        new (getPldmVersionBaseResp.data()) pldm_msg,
+        sizeof(getPldmVersionBaseResp));
+    mockTerminusManager.enqueueResponse(
+        new (getPldmCommandBaseResp.data()) pldm_msg,
+        sizeof(getPldmCommandBaseResp));
+
+    pldm::MctpInfos mctpInfos{};
+    mctpInfos.emplace_back(
+        pldm::MctpInfo(12, "f72d6f90-5675-11ed-9b6a-0242ac120002", "", 1));
+    mockTerminusManager.discoverMctpTerminus(mctpInfos);
+    ASSERT_EQ(1, termini.size());
+    EXPECT_TRUE(mockTerminusManager.responseMsgs.empty());
+    mockTerminusManager.removeMctpTerminus(mctpInfos);
+    EXPECT_EQ(0, termini.size());
+
+    // Discovered again, the terminus is asked its types and their versions
+    enqueueDiscovery();
+    mockTerminusManager.enqueueResponse(
+        new (getPldmVersionBaseResp.data()) pldm_msg,
+        sizeof(getPldmVersionBaseResp));
+    mockTerminusManager.discoverMctpTerminus(mctpInfos);
+    ASSERT_EQ(1, termini.size());
+    EXPECT_TRUE(mockTerminusManager.responseMsgs.empty());
+    auto terminus = termini.begin()->second;
+    EXPECT_TRUE(terminus->doesSupportCommand(PLDM_BASE, PLDM_GET_TID));
+    EXPECT_FALSE(
+        terminus->doesSupportCommand(PLDM_BASE, PLDM_GET_PLDM_COMMANDS));
+    mockTerminusManager.removeMctpTerminus(mctpInfos);
+
+    // A new firmware reports another version, the commands are queried
+    // again
+    auto newVersionResp = getPldmVersionBaseResp;
+    newVersionResp[12] = 0xf2;
+    byte0 |= 1 << (PLDM_GET_PLDM_COMMANDS % 8);
+    getPldmCommandBaseResp[4] = byte0;
+    enqueueDiscovery();
+    mockTerminusManager.enqueueResponse(new (newVersionResp.data()) pldm_msg,
+                                        sizeof(newVersionResp));
+    mockTerminusManager.enqueueResponse(new (newVersionResp.data()) pldm_msg,
+                                        sizeof(newVersionResp));
+    mockTerminusManager.enqueueResponse(
+        new (getPldmCommandBaseResp.data()) pldm_msg,
+        sizeof(getPldmCommandBaseResp));
+    mockTerminusManager.discoverMctpTerminus(mctpInfos);
+    ASSERT_EQ(1, termini.size());
+    EXPECT_TRUE(mockTerminusManager.responseMsgs.empty());
+    terminus = termini.begin()->second;
+    EXPECT_TRUE(
+        terminus->doesSupportCommand(PLDM_BASE, PLDM_GET_PLDM_COMMANDS));
+}
+
 TEST_F(TerminusManagerTest, doesSupportTypeTest)
 {
     const size_t getTidRespLen = PLDM_GET_TID_RESP_BYTES;
@@ -0,0 +1,228 @@
+#include "platform-mc/pdr_store.hpp"
+#include "platform-mc/terminus_snapshot.hpp"
+
+#include <endian.h>
+#include <libpldm/platform.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::platform_mc;
+
+namespace
+{
+
+constexpr auto uuid = "f72d6f90-5675-11ed-9b6a-0242ac120002";
+
+std::vector<uint8_t> makePdr(uint32_t recordHandle, uint8_t type,
+                             size_t length)
+{
+    std::vector<uint8_t> pdr(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        pdr[i] = static_cast<uint8_t>(recordHandle * 3 + i);
+    }
+
+    pldm_pdr_hdr hdr{};
+    hdr.record_handle = htole32(recordHandle);
+    hdr.version = 1;
+    hdr.type = type;
+    hdr.length = htole16(static_cast<uint16_t>(length - sizeof(hdr)));
+    std::memcpy(pdr.data(), &hdr, sizeof(hdr));
+    return pdr;
+}
+
+} // namespace
+
+class TerminusSnapshotTest : public testing::Test
+{
+  protected:
+    TerminusSnapshotTest() :
+        cacheDir(std::filesystem::temp_directory_path() /
+                 "terminus_snapshot_test"),
+        cache(cacheDir), path(cacheDir / (std::string(uuid) + ".snapshot"))
+    {
+        std::filesystem::remove_all(cacheDir);
+
+        info.updateTime[0] = 0x24;
+        info.recordCount = 3;
+        info.repositorySize = 1100;
+        info.largestRecordSize = 1000;
+        pdrs.add(makePdr(1, PLDM_NUMERIC_SENSOR_PDR, 60));
+        pdrs.add(makePdr(2, PLDM_ENTITY_AUXILIARY_NAMES_PDR, 40));
+        pdrs.add(makePdr(3, PLDM_COMPACT_NUMERIC_SENSOR_PDR, 1000));
+        fruData = {0x1, 0x0, 0x1, 0x1, 0x2, 0x2, 0x41, 0x42};
+    }
+
+    ~TerminusSnapshotTest() override
+    {
+        std::filesystem::remove_all(cacheDir);
+    }
+
+    std::filesystem::path cacheDir;
+    TerminusSnapshotCache cache;
+    std::filesystem::path path;
+    PdrRepositoryInfo info{};
+    PdrStore pdrs;
+    std::vector<uint8_t> fruData;
+};
+
+TEST_F(TerminusSnapshotTest, saveAndLoad)
+{
+    ASSERT_TRUE(cache.save(uuid, info, pdrs, fruData));
+    EXPECT_TRUE(std::filesystem::exists(path));
+
+    PdrRepositoryInfo loadedInfo{};
+    PdrStore loadedPdrs;
+    std::vector<uint8_t> loadedFru;
+    ASSERT_TRUE(cache.load(uuid, loadedInfo, loadedPdrs, loadedFru));
+    EXPECT_EQ(loadedInfo, info);
+    EXPECT_EQ(loadedFru, fruData);
+    ASSERT_EQ(loadedPdrs.size(), pdrs.size());
+    for (size_t i = 0; i < pdrs.size(); ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal(loadedPdrs[i], pdrs[i]));
+    }
+
+    // The indexes are rebuilt from the loaded records
+    EXPECT_EQ(loadedPdrs.findByHandle(3), 2);
+    EXPECT_EQ(loadedPdrs.findByType(PLDM_NUMERIC_SENSOR_PDR).size(), 1);
+
+    // A new snapshot replaces the previous one
+    info.recordCount = 1;
+    pdrs.clear();
+    pdrs.add(makePdr(7, PLDM_NUMERIC_SENSOR_PDR, 60));
+    ASSERT_TRUE(cache.save(uuid, info, pdrs, {}));
+    ASSERT_TRUE(cache.load(uuid, loadedInfo, loadedPdrs, loadedFru));
+    EXPECT_EQ(loadedInfo.recordCount, 1);
+    EXPECT_EQ(loadedPdrs.size(), 1);
+    EXPECT_TRUE(loadedFru.empty());
+
+    cache.remove(uuid);
+    EXPECT_FALSE(std::filesystem::exists(path));
+    EXPECT_FALSE(cache.load(uuid, loadedInfo, loadedPdrs, loadedFru));
+}
+
+TEST_F(TerminusSnapshotTest, corruptSnapshots)
+{
+    ASSERT_TRUE(cache.save(uuid, info, pdrs, fruData));
+    std::vector<uint8_t> image;
+    {
+        std::ifstream file(path, std::ios::binary);
+        image.assign(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+    }
+    auto write = [this](const std::vector<uint8_t>& data) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    };
+
+    PdrRepositoryInfo loadedInfo{};
+    PdrStore loadedPdrs;
+    loadedPdrs.add(makePdr(9, PLDM_NUMERIC_SENSOR_PDR, 60));
+    std::vector<uint8_t> loadedFru;
+
+    // A flipped bit fails the checksum
+    auto flipped = image;
+    flipped[image.size() / 2] ^= 0x10;
+    write(flipped);
+    EXPECT_FALSE(cache.load(uuid, loadedInfo, loadedPdrs, loadedFru));
+
+    // Truncated files
+    write({image.begin(), image.begin() + 20});
+    EXPECT_FALSE(cache.load(uuid, loadedInfo, loadedPdrs, loadedFru));
+    write({image.begin(), image.begin() + 4});
+    EXPECT_FALSE(cache.load(uuid, loadedInfo, loadedPdrs, loadedFru));
+
+    // The outputs are kept on failure
+    EXPECT_EQ(loadedPdrs.size(), 1);
+
+    write(image);
+    EXPECT_TRUE(cache.load(uuid, loadedInfo, loadedPdrs, loadedFru));
+    EXPECT_EQ(loadedPdrs.size(), 3);
+}
+
+TEST_F(TerminusSnapshotTest, unusableUUIDs)
+{
+    PdrRepositoryInfo loadedInfo{};
+    PdrStore loadedPdrs;
+    std::vector<uint8_t> loadedFru;
+
+    for (auto badUUID : {"", "00000000-0000-0000-0000-000000000000",
+                         "../../etc/passwd", "f72d6f90/5675"})
+    {
+        EXPECT_FALSE(cache.save(badUUID, info, pdrs, fruData));
+        EXPECT_FALSE(cache.load(badUUID, loadedInfo, loadedPdrs, loadedFru));
+    }
+    EXPECT_FALSE(std::filesystem::exists(cacheDir));
+
+    // An empty directory disables the cache
+    TerminusSnapshotCache disabled({});
+    EXPECT_FALSE(disabled.save(uuid, info, pdrs, fruData));
+}
+
+TEST_F(TerminusSnapshotTest, capabilities)
+{
+    TerminusCapabilities capabilities{};
+    capabilities.supportedTypes = (1 << PLDM_BASE) | (1 << PLDM_PLATFORM);
+    capabilities.typeVersions[PLDM_BASE] = {0x00, 0xf0, 0xf1, 0xf1};
+    capabilities.typeVersions[PLDM_PLATFORM] = {0x00, 0xf0, 0xf2, 0xf1};
+    capabilities.supportedCmds.resize(PLDM_MAX_TYPES *
+                                      (PLDM_MAX_CMDS_PER_TYPE / 8));
+    capabilities.supportedCmds[0] = 0x3c;
+    capabilities.supportedCmds[PLDM_PLATFORM * 32 + 10] = 0x03;
+
+    TerminusCapabilityCache capabilityCache(cacheDir);
+    EXPECT_FALSE(capabilityCache.find(uuid, capabilities.supportedTypes));
+    ASSERT_TRUE(capabilityCache.store(uuid, capabilities));
+
+    auto found = capabilityCache.find(uuid, capabilities.supportedTypes);
+    ASSERT_TRUE(found);
+    EXPECT_EQ(found->supportedCmds, capabilities.supportedCmds);
+
+    // The terminus reports other types
+    EXPECT_FALSE(capabilityCache.find(uuid, 1 << PLDM_BASE));
+
+    // The capabilities are kept across restarts
+    TerminusCapabilityCache restarted(cacheDir);
+    found = restarted.find(uuid, capabilities.supportedTypes);
+    ASSERT_TRUE(found);
+    EXPECT_EQ(found->supportedTypes, capabilities.supportedTypes);
+    EXPECT_EQ(found->supportedCmds, capabilities.supportedCmds);
+    ASSERT_EQ(found->typeVersions.size(), 2);
+    EXPECT_EQ(found->typeVersions[PLDM_PLATFORM].minor, 0xf2);
+
+    // A corrupted file is ignored
+    auto capabilityPath = cacheDir / (std::string(uuid) + ".capabilities");
+    ASSERT_TRUE(std::filesystem::exists(capabilityPath));
+    {
+        std::fstream file(capabilityPath,
+                          std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(20);
+        file.put(0x55);
+    }
+    TerminusCapabilityCache corrupted(cacheDir);
+    EXPECT_FALSE(corrupted.find(uuid, capabilities.supportedTypes));
+
+    // Stale capabilities are removed from memory and file
+    ASSERT_TRUE(capabilityCache.store(uuid, capabilities));
+    capabilityCache.remove(uuid);
+    EXPECT_FALSE(capabilityCache.find(uuid, capabilities.supportedTypes));
+    EXPECT_FALSE(std::filesystem::exists(capabilityPath));
+
+    // Without a directory the capabilities are kept in memory only
+    TerminusCapabilityCache memoryOnly({});
+    ASSERT_TRUE(memoryOnly.store(uuid, capabilities));
+    EXPECT_TRUE(memoryOnly.find(uuid, capabilities.supportedTypes));
+
+    // The endpoints without a usable UUID are not cached
+    EXPECT_FALSE(memoryOnly.store("", capabilities));
+    EXPECT_FALSE(memoryOnly.store("00000000-0000-0000-0000-000000000000",
+                                  capabilities));
+}
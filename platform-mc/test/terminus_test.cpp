@@ -1,7 +1,12 @@
 #include "platform-mc/numeric_sensor.hpp"
 #include "platform-mc/terminus.hpp"
+#include "platform-mc/test/terminus_test.hpp"
 
 #include <libpldm/entity.h>
+#include <systemd/sd-event.h>
+
+#include <cmath>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -90,8 +95,8 @@ TEST(TerminusTest, parseSensorAuxiliaryNamesPDRTest)
         0x00  // Entity Name "S0"
     };
 
-    t1.pdrs.emplace_back(pdr1);
-    t1.pdrs.emplace_back(pdr2);
+    t1.pdrs.add(pdr1);
+    t1.pdrs.add(pdr2);
     t1.parseTerminusPDRs();
 
     auto sensorAuxNames = t1.getSensorAuxiliaryNames(0);
@@ -206,8 +211,8 @@ TEST(TerminusTest, parseSensorAuxiliaryMultiNamesPDRTest)
         0x00  // Entity Name "S0"
     };
 
-    t1.pdrs.emplace_back(pdr1);
-    t1.pdrs.emplace_back(pdr2);
+    t1.pdrs.add(pdr1);
+    t1.pdrs.add(pdr2);
     t1.parseTerminusPDRs();
 
     auto sensorAuxNames = t1.getSensorAuxiliaryNames(0);
@@ -327,8 +332,8 @@ TEST(TerminusTest, parseSensorAuxiliaryNamesMultiSensorsPDRTest)
         0x00  // Entity Name "S0"
     };
 
-    t1.pdrs.emplace_back(pdr1);
-    t1.pdrs.emplace_back(pdr2);
+    t1.pdrs.add(pdr1);
+    t1.pdrs.add(pdr2);
     t1.parseTerminusPDRs();
 
     auto sensorAuxNames = t1.getSensorAuxiliaryNames(0);
@@ -382,9 +387,68 @@ TEST(TerminusTest, parsePDRTestNoSensorPDR)
         0x00  // Entity Name "S0"
     };
 
-    t1.pdrs.emplace_back(pdr1);
+    t1.pdrs.add(pdr1);
     t1.parseTerminusPDRs();
 
     auto sensorAuxNames = t1.getSensorAuxiliaryNames(1);
     EXPECT_EQ(nullptr, sensorAuxNames);
 }
+
+TEST(TerminusTest, createSensorsInBatches)
+{
+    constexpr uint16_t numSensors = 64;
+    auto event = sdeventplus::Event::get_default();
+    auto t1 = pldm::platform_mc::Terminus(
+        1, 1 << PLDM_BASE | 1 << PLDM_PLATFORM, event);
+    t1.sensorCreationBatchSize = 16;
+
+    t1.pdrs.add(makeTerminusNamePdr('1'));
+    for (uint16_t id = 1; id <= numSensors; ++id)
+    {
+        // Power sensors without thresholds interleaved with temperature
+        // sensors with warning and critical thresholds
+        if (id % 2)
+        {
+            t1.pdrs.add(makeNumericSensorPdr(id, PLDM_SENSOR_UNIT_WATTS, 0));
+        }
+        else
+        {
+            t1.pdrs.add(
+                makeNumericSensorPdr(id, PLDM_SENSOR_UNIT_DEGRESS_C, 0x1b));
+        }
+    }
+    t1.parseTerminusPDRs();
+
+    // The sensor objects are created from the event loop
+    EXPECT_EQ(0, t1.numericSensors.size());
+    for (size_t batch = 1; batch <= numSensors / 16; ++batch)
+    {
+        sd_event_run(event.get(), 0);
+        EXPECT_EQ(batch * 16, t1.numericSensors.size());
+    }
+    ASSERT_EQ(numSensors, t1.numericSensors.size());
+
+    // Temperature sensors are created first
+    for (size_t i = 0; i < numSensors; ++i)
+    {
+        const auto& sensor = t1.numericSensors[i];
+        if (i < numSensors / 2)
+        {
+            EXPECT_EQ(pldm::platform_mc::SensorUnit::DegreesC,
+                      sensor->sensorUnit);
+            EXPECT_EQ(0, sensor->sensorId % 2);
+            EXPECT_EQ(45, sensor->getThresholdUpperWarning());
+            EXPECT_EQ(60, sensor->getThresholdUpperCritical());
+        }
+        else
+        {
+            EXPECT_EQ(pldm::platform_mc::SensorUnit::Watts,
+                      sensor->sensorUnit);
+            EXPECT_EQ(1, sensor->sensorId % 2);
+            // No threshold interface without supported thresholds
+            EXPECT_TRUE(std::isnan(sensor->getThresholdUpperWarning()));
+            EXPECT_TRUE(std::isnan(sensor->getThresholdUpperCritical()));
+        }
+        EXPECT_EQ(sensor, t1.getSensorObject(sensor->sensorId));
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <libpldm/entity.h>
+#include <libpldm/platform.h>
+
+#include <vector>
+
+/** @brief Build an Entity Auxiliary Names PDR naming the terminus "S<id>" */
+inline std::vector<uint8_t> makeTerminusNamePdr(char id)
+{
+    return {
+        0x1, 0x0, 0x0,
+        0x0,                             // record handle
+        0x1,                             // PDRHeaderVersion
+        PLDM_ENTITY_AUXILIARY_NAMES_PDR, // PDRType
+        0x1,
+        0x0,                             // recordChangeNumber
+        0x11,
+        0,                               // dataLength
+        /* Entity Auxiliary Names PDR Data*/
+        3,
+        0x80, // entityType system software
+        0x1,
+        0x0,  // Entity instance number =1
+        0,
+        0,    // Overall system
+        0,    // shared Name Count one name only
+        01,   // nameStringCount
+        0x65, 0x6e, 0x00,
+        0x00, // Language Tag "en"
+        0x53, 0x00, static_cast<uint8_t>(id), 0x00,
+        0x00  // Entity Name "S<id>"
+    };
+}
+
+/** @brief Build a Numeric Sensor PDR */
+inline std::vector<uint8_t> makeNumericSensorPdr(
+    uint16_t sensorId, uint8_t baseUnit, uint8_t supportedThresholds)
+{
+    return {
+        static_cast<uint8_t>(sensorId + 1),
+        static_cast<uint8_t>((sensorId + 1) >> 8),
+        0x0,
+        0x0,                     // record handle
+        0x1,                     // PDRHeaderVersion
+        PLDM_NUMERIC_SENSOR_PDR, // PDRType
+        0x0,
+        0x0,                     // recordChangeNumber
+        PLDM_PDR_NUMERIC_SENSOR_PDR_MIN_LENGTH,
+        0,                       // dataLength
+        0,
+        0,                       // PLDMTerminusHandle
+        static_cast<uint8_t>(sensorId),
+        static_cast<uint8_t>(sensorId >> 8), // sensorID
+        PLDM_ENTITY_POWER_SUPPLY,
+        0,                                   // entityType=Power Supply(120)
+        1,
+        0,                                   // entityInstanceNumber
+        1,
+        0,                                   // containerID=1
+        PLDM_NO_INIT,                        // sensorInit
+        false,                               // sensorAuxiliaryNamesPDR
+        baseUnit,                            // baseUint
+        0,                                   // unitModifier = 0
+        0,                                   // rateUnit
+        0,                                   // baseOEMUnitHandle
+        0,                                   // auxUnit
+        0,                                   // auxUnitModifier
+        0,                                   // auxRateUnit
+        0,                                   // rel
+        0,                                   // auxOEMUnitHandle
+        true,                                // isLinear
+        PLDM_SENSOR_DATA_SIZE_UINT8,         // sensorDataSize
+        0,
+        0,
+        0x80,
+        0x3f, // resolution=1.0
+        0,
+        0,
+        0,
+        0,    // offset=0
+        0,
+        0,    // accuracy
+        0,    // plusTolerance
+        0,    // minusTolerance
+        2,    // hysteresis = 2
+        supportedThresholds, // supportedThresholds
+        0,    // thresholdAndHysteresisVolatility
+        0,
+        0,
+        0x80,
+        0x3f, // stateTransistionInterval=1.0
+        0,
+        0,
+        0x80,
+        0x3f,                          // updateInverval=1.0
+        255,                           // maxReadable
+        0,                             // minReadable
+        PLDM_RANGE_FIELD_FORMAT_UINT8, // rangeFieldFormat
+        0x18,                          // rangeFieldsupport
+        0,                             // nominalValue
+        0,                             // normalMax
+        0,                             // normalMin
+        45,                            // warningHigh
+        20,                            // warningLow
+        60,                            // criticalHigh
+        10,                            // criticalLow
+        0,                             // fatalHigh
+        0                              // fatalLow
+    };
+}
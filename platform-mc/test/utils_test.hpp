@@ -1,3 +1,4 @@
+#include <malloc.h>
 #include <systemd/sd-event.h>
 
 #include <sdeventplus/event.hpp>
@@ -21,4 +22,13 @@ void runEventLoopForSeconds(sdeventplus::Event& event, uint64_t sec)
         elapsed = t1 - t0;
     } while (elapsed < usec);
 }
+
+/** @brief Heap memory in use, including the mmap()ed chunks, as reported by
+ *         the allocator
+ */
+size_t heapInUse()
+{
+    auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
 } // namespace utils
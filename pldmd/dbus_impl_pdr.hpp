@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/state_pdr_index.hpp"
 #include "xyz/openbmc_project/PLDM/PDR/server.hpp"
 
 #include <libpldm/pdr.h>
@@ -36,10 +37,12 @@ class Pdr : public PdrIntf
     /** @brief Constructor to put object onto bus at a dbus path.
      *  @param[in] bus - Bus to attach to.
      *  @param[in] path - Path to attach at.
-     *  @param[in] repo - pointer to BMC's primary PDR repo
+     *  @param[in] statePdrIndex - index of the state sensor and effecter PDRs
+     *                            of BMC's primary PDR repo
      */
-    Pdr(sdbusplus::bus_t& bus, const std::string& path, const pldm_pdr* repo) :
-        PdrIntf(bus, path.c_str()), pdrRepo(repo) {};
+    Pdr(sdbusplus::bus_t& bus, const std::string& path,
+        pldm::utils::StatePdrIndex& statePdrIndex) :
+        PdrIntf(bus, path.c_str()), statePdrIndex(statePdrIndex) {};
 
     /** @brief Implementation for PdrIntf.FindStateEffecterPDR
      *  @param[in] tid - PLDM terminus ID.
@@ -58,8 +61,8 @@ class Pdr : public PdrIntf
         uint8_t tid, uint16_t entityID, uint16_t stateSetId) override;
 
   private:
-    /** @brief pointer to BMC's primary PDR repo */
-    const pldm_pdr* pdrRepo;
+    /** @brief index of the state PDRs of BMC's primary PDR repo */
+    pldm::utils::StatePdrIndex& statePdrIndex;
 };
 
 } // namespace dbus_api
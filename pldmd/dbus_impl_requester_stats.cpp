@@ -0,0 +1,86 @@
+#include "dbus_impl_requester_stats.hpp"
+
+#include <sdbusplus/exception.hpp>
+#include <sdbusplus/message.hpp>
+
+namespace pldm
+{
+namespace dbus_api
+{
+
+const sdbusplus::vtable_t RequesterStatsIntf::vtable[] = {
+    sdbusplus::vtable::start(),
+    sdbusplus::vtable::method("GetRequestStats", "", "a(syyytttttatttatttat)",
+                              RequesterStatsIntf::getRequestStats),
+    sdbusplus::vtable::method("GetAndResetRequestStats", "",
+                              "a(syyytttttatttatttat)",
+                              RequesterStatsIntf::getAndResetRequestStats),
+    sdbusplus::vtable::method("ResetRequestStats", "", "",
+                              RequesterStatsIntf::resetRequestStats),
+    sdbusplus::vtable::end()};
+
+RequesterStatsIntf::RequesterStatsIntf(sdbusplus::bus_t& bus,
+                                       const std::string& path,
+                                       pldm::requester::RequestStats& stats) :
+    stats(stats), serverInterface(bus, path.c_str(), interface, vtable, this)
+{}
+
+int RequesterStatsIntf::getRequestStats(sd_bus_message* msg, void* context,
+                                        sd_bus_error* error)
+{
+    auto self = static_cast<RequesterStatsIntf*>(context);
+    return self->replyRequestStats(msg, error, false);
+}
+
+int RequesterStatsIntf::getAndResetRequestStats(
+    sd_bus_message* msg, void* context, sd_bus_error* error)
+{
+    auto self = static_cast<RequesterStatsIntf*>(context);
+    return self->replyRequestStats(msg, error, true);
+}
+
+int RequesterStatsIntf::replyRequestStats(sd_bus_message* msg,
+                                          sd_bus_error* error, bool reset)
+{
+    try
+    {
+        auto m = sdbusplus::message_t(msg);
+        auto reply = m.new_method_return();
+        reply.append(stats.getRecords());
+        // pldmd runs a single event loop, no request is recorded between
+        // the records and the reset
+        if (reset)
+        {
+            stats.reset();
+        }
+        reply.method_return();
+    }
+    catch (const sdbusplus::exception_t& e)
+    {
+        return sd_bus_error_set(error, e.name(), e.description());
+    }
+
+    return 1;
+}
+
+int RequesterStatsIntf::resetRequestStats(sd_bus_message* msg, void* context,
+                                          sd_bus_error* error)
+{
+    auto self = static_cast<RequesterStatsIntf*>(context);
+    try
+    {
+        auto m = sdbusplus::message_t(msg);
+        self->stats.reset();
+        auto reply = m.new_method_return();
+        reply.method_return();
+    }
+    catch (const sdbusplus::exception_t& e)
+    {
+        return sd_bus_error_set(error, e.name(), e.description());
+    }
+
+    return 1;
+}
+
+} // namespace dbus_api
+} // namespace pldm
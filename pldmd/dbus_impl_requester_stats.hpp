@@ -0,0 +1,79 @@
+#pragma once
+
+#include "requester/request_stats.hpp"
+
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/server/interface.hpp>
+#include <sdbusplus/vtable.hpp>
+
+#include <string>
+
+namespace pldm
+{
+namespace dbus_api
+{
+
+/** @class RequesterStatsIntf
+ *  @brief D-Bus interface exporting the latency histograms and counters of
+ *         the PLDM requests sent by pldmd.
+ *  @details org.openbmc.pldm.RequesterStats is private to pldm, it is not
+ *           defined in phosphor-dbus-interfaces and may change with pldmd.
+ *           GetRequestStats() -> a(syyytttttatttatttat) returns the metrics
+ *           per EID, per PLDM type and per PLDM command, see
+ *           pldm::requester::RequestStats::Record.
+ *           GetAndResetRequestStats() returns them and clears them in the
+ *           same call, so that no request is lost between the two.
+ *           ResetRequestStats() clears them.
+ */
+class RequesterStatsIntf
+{
+  public:
+    RequesterStatsIntf() = delete;
+    RequesterStatsIntf(const RequesterStatsIntf&) = delete;
+    RequesterStatsIntf& operator=(const RequesterStatsIntf&) = delete;
+    RequesterStatsIntf(RequesterStatsIntf&&) = delete;
+    RequesterStatsIntf& operator=(RequesterStatsIntf&&) = delete;
+    virtual ~RequesterStatsIntf() = default;
+
+    /** @brief Constructor to put object onto bus at a dbus path.
+     *  @param[in] bus - Bus to attach to.
+     *  @param[in] path - Path to attach at.
+     *  @param[in] stats - the metrics of the requester handler
+     */
+    RequesterStatsIntf(sdbusplus::bus_t& bus, const std::string& path,
+                       pldm::requester::RequestStats& stats);
+
+    static constexpr auto interface = "org.openbmc.pldm.RequesterStats";
+
+  private:
+    /** @brief Handler of the GetRequestStats method */
+    static int getRequestStats(sd_bus_message* msg, void* context,
+                               sd_bus_error* error);
+
+    /** @brief Handler of the GetAndResetRequestStats method */
+    static int getAndResetRequestStats(sd_bus_message* msg, void* context,
+                                       sd_bus_error* error);
+
+    /** @brief Reply the metrics to a method call
+     *  @param[in] msg - the method call
+     *  @param[in] error - the error of the method call
+     *  @param[in] reset - clear the metrics once they are in the reply
+     */
+    int replyRequestStats(sd_bus_message* msg, sd_bus_error* error,
+                          bool reset);
+
+    /** @brief Handler of the ResetRequestStats method */
+    static int resetRequestStats(sd_bus_message* msg, void* context,
+                                 sd_bus_error* error);
+
+    static const sdbusplus::vtable_t vtable[];
+
+    /** @brief The metrics of the requester handler */
+    pldm::requester::RequestStats& stats;
+
+    /** @brief The registered interface */
+    sdbusplus::server::interface_t serverInterface;
+};
+
+} // namespace dbus_api
+} // namespace pldm
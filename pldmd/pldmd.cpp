@@ -3,6 +3,7 @@
 #include "common/instance_id.hpp"
 #include "common/transport.hpp"
 #include "common/utils.hpp"
+#include "dbus_impl_requester_stats.hpp"
 #include "fw-update/manager.hpp"
 #include "invoker.hpp"
 #include "platform-mc/dbus_to_terminus_effecters.hpp"
@@ -169,32 +170,53 @@ void optionUsage(void)
     info("Usage: pldmd [options]");
     info("Options:");
     info(" [--verbose] - would enable verbosity");
+    info(
+        " [--loopback <dir>] - use the loopback transport with the endpoint sockets in <dir> instead of MCTP");
 }
 
 int main(int argc, char** argv)
 {
     bool verbose = false;
+    std::string loopbackDir;
     static struct option long_options[] = {
-        {"verbose", no_argument, nullptr, 'v'}, {nullptr, 0, nullptr, 0}};
+        {"verbose", no_argument, nullptr, 'v'},
+        {"loopback", required_argument, nullptr, 'l'},
+        {nullptr, 0, nullptr, 0}};
 
-    auto argflag = getopt_long(argc, argv, "v", long_options, nullptr);
-    switch (argflag)
+    int argflag = 0;
+    while ((argflag = getopt_long(argc, argv, "vl:", long_options, nullptr)) !=
+           -1)
     {
-        case 'v':
-            verbose = true;
-            break;
-        case -1:
-            break;
-        default:
-            optionUsage();
-            exit(EXIT_FAILURE);
+        switch (argflag)
+        {
+            case 'v':
+                verbose = true;
+                break;
+            case 'l':
+                loopbackDir = optarg;
+                break;
+            default:
+                optionUsage();
+                exit(EXIT_FAILURE);
+        }
     }
     // Setup PLDM requester transport
     auto hostEID = pldm::utils::readHostEID();
     /* To maintain current behaviour until we have the infrastructure to find
      * and use the correct TIDs */
     pldm_tid_t TID = hostEID;
-    PldmTransport pldmTransport{};
+    std::unique_ptr<TransportBackend> transportBackend;
+    if (loopbackDir.empty())
+    {
+        transportBackend = std::make_unique<MctpTransport>();
+    }
+    else
+    {
+        transportBackend =
+            std::make_unique<LoopbackTransport>(loopbackDir, pldm::BmcMctpEid);
+    }
+    auto pldmTransport =
+        std::make_unique<PldmTransport>(std::move(transportBackend));
     auto event = Event::get_default();
     auto& bus = pldm::utils::DBusHandler::getBus();
     sdbusplus::server::manager_t objManager(bus,
@@ -207,8 +229,10 @@ int main(int argc, char** argv)
         bus, "/xyz/openbmc_project/inventory");
 
     Invoker invoker{};
-    requester::Handler<requester::Request> reqHandler(&pldmTransport, event,
-                                                      instanceIdDb, verbose);
+    requester::Handler<requester::Request> reqHandler(
+        pldmTransport.get(), event, instanceIdDb, verbose);
+    dbus_api::RequesterStatsIntf dbusImplRequesterStats(
+        bus, "/xyz/openbmc_project/pldm", reqHandler.getStats());
 
     std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)> pdrRepo(
         pldm_pdr_init(), pldm_pdr_destroy);
@@ -224,9 +248,9 @@ int main(int argc, char** argv)
     std::unique_ptr<pldm::host_effecters::HostEffecterParser>
         hostEffecterParser =
             std::make_unique<pldm::host_effecters::HostEffecterParser>(
-                &instanceIdDb, pldmTransport.getEventSource(), pdrRepo.get(),
+                &instanceIdDb, pldmTransport->getEventSource(), pdrRepo.get(),
                 &dbusHandler, HOST_JSONS_DIR, &reqHandler,
-                platformManager.get());
+                platformManager.get(), event);
 #ifdef LIBPLDMRESPONDER
     using namespace pldm::state_sensor;
     dbus_api::Host dbusImplHost(bus, "/xyz/openbmc_project/pldm");
@@ -248,6 +272,8 @@ int main(int argc, char** argv)
         throw std::runtime_error(
             "Failed to instantiate BMC PDR entity association tree");
     }
+    pldm::utils::EntityTreeIndex entityTreeIndex(entityTree.get());
+    pldm::utils::StatePdrIndex statePdrIndex(pdrRepo.get());
     std::shared_ptr<HostPDRHandler> hostPDRHandler;
     std::unique_ptr<DbusToPLDMEvent> dbusToPLDMEventHandler;
     std::unique_ptr<platform_config::Handler> platformConfigHandler{};
@@ -257,21 +283,22 @@ int main(int argc, char** argv)
     if (hostEID)
     {
         hostPDRHandler = std::make_shared<HostPDRHandler>(
-            pldmTransport.getEventSource(), hostEID, event, pdrRepo.get(),
+            pldmTransport->getEventSource(), hostEID, event, pdrRepo.get(),
             EVENTS_JSONS_DIR, entityTree.get(), bmcEntityTree.get(),
-            instanceIdDb, &reqHandler);
+            entityTreeIndex, statePdrIndex, instanceIdDb, &reqHandler);
 
         // HostFirmware interface needs access to hostPDR to know if host
         // is running
         dbusImplHost.setHostPdrObj(hostPDRHandler);
 
         dbusToPLDMEventHandler = std::make_unique<DbusToPLDMEvent>(
-            pldmTransport.getEventSource(), hostEID, instanceIdDb, &reqHandler);
+            pldmTransport->getEventSource(), hostEID, instanceIdDb, &reqHandler,
+            event);
     }
 
     auto fruHandler = std::make_unique<fru::Handler>(
         FRU_JSONS_DIR, FRU_MASTER_JSON, pdrRepo.get(), entityTree.get(),
-        bmcEntityTree.get());
+        bmcEntityTree.get(), entityTreeIndex);
 
     // FRU table is built lazily when a FRU command or Get PDR command is
     // handled. To enable building FRU table, the FRU handler is passed to the
@@ -304,17 +331,17 @@ int main(int argc, char** argv)
         &dbusHandler, hostEID, &instanceIdDb, PDR_JSONS_DIR, pdrRepo.get(),
         hostPDRHandler.get(), dbusToPLDMEventHandler.get(), fruHandler.get(),
         platformConfigHandler.get(), &reqHandler, event, true,
-        addOnEventHandlers);
+        addOnEventHandlers, &statePdrIndex);
 
     auto biosHandler = std::make_unique<bios::Handler>(
-        pldmTransport.getEventSource(), hostEID, &instanceIdDb, &reqHandler,
+        pldmTransport->getEventSource(), hostEID, &instanceIdDb, &reqHandler,
         platformConfigHandler.get(), requestPLDMServiceName);
 
     auto baseHandler = std::make_unique<base::Handler>(event);
 
 #ifdef OEM_AMPERE
     pldm::oem_ampere::OemAMPERE oemAMPERE(
-        &dbusHandler, pldmTransport.getEventSource(), pdrRepo.get(),
+        &dbusHandler, pldmTransport->getEventSource(), pdrRepo.get(),
         instanceIdDb, event, invoker, hostPDRHandler.get(),
         platformHandler.get(), fruHandler.get(), baseHandler.get(),
         biosHandler.get(), platformManager.get(), &reqHandler);
@@ -322,7 +349,7 @@ int main(int argc, char** argv)
 
 #ifdef OEM_IBM
     pldm::oem_ibm::OemIBM oemIBM(
-        &dbusHandler, pldmTransport.getEventSource(), hostEID, pdrRepo.get(),
+        &dbusHandler, pldmTransport->getEventSource(), hostEID, pdrRepo.get(),
         instanceIdDb, event, invoker, hostPDRHandler.get(),
         platformHandler.get(), fruHandler.get(), baseHandler.get(),
         &reqHandler);
@@ -333,7 +360,7 @@ int main(int argc, char** argv)
     invoker.registerHandler(PLDM_FRU, std::move(fruHandler));
     invoker.registerHandler(PLDM_BASE, std::move(baseHandler));
 
-    dbus_api::Pdr dbusImplPdr(bus, "/xyz/openbmc_project/pldm", pdrRepo.get());
+    dbus_api::Pdr dbusImplPdr(bus, "/xyz/openbmc_project/pldm", statePdrIndex);
     sdbusplus::xyz::openbmc_project::PLDM::server::Event dbusImplEvent(
         bus, "/xyz/openbmc_project/pldm");
 
@@ -345,6 +372,19 @@ int main(int argc, char** argv)
         std::make_unique<MctpDiscovery>(
             bus, std::initializer_list<MctpDiscoveryHandlerIntf*>{
                      fwManager.get(), platformManager.get()});
+    /* The endpoints of a transport not discovered on D-Bus, as the simulated
+     * termini bound before pldmd is started on the loopback transport */
+    if (auto eids = pldmTransport->getEndpoints(); !eids.empty())
+    {
+        MctpInfos transportInfos;
+        for (auto eid : eids)
+        {
+            transportInfos.emplace_back(eid, "", "", 0);
+        }
+        info("Found {COUNT} endpoints on the transport", "COUNT",
+             transportInfos.size());
+        mctpDiscoveryHandler->handleMctpEndpoints(transportInfos);
+    }
     auto callback = [verbose, &invoker, &reqHandler, &fwManager, &pldmTransport,
                      TID](IO& io, int fd, uint32_t revents) mutable {
         if (!(revents & EPOLLIN))
@@ -359,7 +399,7 @@ int main(int argc, char** argv)
         int returnCode = 0;
         void* requestMsg;
         size_t recvDataLength;
-        returnCode = pldmTransport.recvMsg(TID, requestMsg, recvDataLength);
+        returnCode = pldmTransport->recvMsg(TID, requestMsg, recvDataLength);
 
         if (returnCode == PLDM_REQUESTER_SUCCESS)
         {
@@ -382,7 +422,7 @@ int main(int argc, char** argv)
                     printBuffer(Tx, *response);
                 }
 
-                returnCode = pldmTransport.sendMsg(TID, (*response).data(),
+                returnCode = pldmTransport->sendMsg(TID, (*response).data(),
                                                    (*response).size());
                 if (returnCode != PLDM_REQUESTER_SUCCESS)
                 {
@@ -427,7 +467,7 @@ int main(int argc, char** argv)
               PLDMService, "ERROR", e);
     }
 #endif
-    IO io(event, pldmTransport.getEventSource(), EPOLLIN, std::move(callback));
+    IO io(event, pldmTransport->getEventSource(), EPOLLIN, std::move(callback));
 #ifdef LIBPLDMRESPONDER
     if (hostPDRHandler)
     {
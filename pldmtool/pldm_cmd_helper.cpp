@@ -12,7 +12,11 @@
 #include <sdbusplus/server.hpp>
 #include <xyz/openbmc_project/Logging/Entry/server.hpp>
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
 #include <exception>
+#include <map>
 
 using namespace pldm::utils;
 
@@ -64,7 +68,7 @@ int CommandInterface::pldmSendRecv(std::vector<uint8_t>& requestMsg,
     }
 
     auto tid = mctp_eid;
-    PldmTransport pldmTransport{};
+    auto& pldmTransport = getTransport();
     uint8_t retry = 0;
     int rc = PLDM_ERROR;
 
@@ -103,5 +107,186 @@ int CommandInterface::pldmSendRecv(std::vector<uint8_t>& requestMsg,
 
     return rc;
 }
+
+PldmTransport& CommandInterface::getTransport()
+{
+    if (!transport)
+    {
+        transport = std::make_unique<PldmTransport>();
+    }
+    return *transport;
+}
+
+size_t CommandInterface::pldmSendRecvWindow(size_t count, size_t window,
+                                            const RequestEncoder& encode,
+                                            const ResponseHandler& handle)
+{
+    using Clock = std::chrono::steady_clock;
+    struct Request
+    {
+        size_t index;
+        std::vector<uint8_t> requestMsg;
+        Clock::time_point sent;
+        uint8_t retries;
+    };
+
+    const auto timeout = std::chrono::milliseconds(RESPONSE_TIME_OUT);
+    auto& pldmTransport = getTransport();
+    std::map<uint8_t, Request> inFlight;
+    size_t next = 0;
+    size_t failures = 0;
+    window = std::max<size_t>(window, 1);
+
+    auto send = [&](Request& request) {
+        if (pldmVerbose)
+        {
+            std::cout << "pldmtool: ";
+            printBuffer(Tx, request.requestMsg);
+        }
+        request.sent = Clock::now();
+        return pldmTransport.sendMsg(mctp_eid, request.requestMsg.data(),
+                                     request.requestMsg.size());
+    };
+
+    auto drop = [&](std::map<uint8_t, Request>::iterator request) {
+        instanceIdDb.free(mctp_eid, request->first);
+        inFlight.erase(request);
+        failures++;
+    };
+
+    while (next < count || !inFlight.empty())
+    {
+        // Fill the window
+        while (next < count && inFlight.size() < window)
+        {
+            uint8_t id = 0;
+            try
+            {
+                id = instanceIdDb.next(mctp_eid);
+            }
+            catch (const std::exception& e)
+            {
+                if (!inFlight.empty())
+                {
+                    // Wait for a response to release an instance ID
+                    break;
+                }
+                std::cerr << "Failed to allocate an instance ID: " << e.what()
+                          << "\n";
+                return failures + count - next;
+            }
+
+            Request request{next++, {}, {}, 0};
+            auto rc = encode(request.index, id, request.requestMsg);
+            if (rc != PLDM_SUCCESS)
+            {
+                instanceIdDb.free(mctp_eid, id);
+                std::cerr << "Failed to encode request message for "
+                          << pldmType << ":" << commandName << " rc = " << rc
+                          << "\n";
+                failures++;
+                continue;
+            }
+
+            auto sent = inFlight.emplace(id, std::move(request)).first;
+            rc = send(sent->second);
+            if (rc != PLDM_REQUESTER_SUCCESS)
+            {
+                std::cerr << "pldm_send_msg error rc " << rc << "\n";
+                drop(sent);
+            }
+        }
+
+        if (inFlight.empty())
+        {
+            continue;
+        }
+
+        // Wait for a response until the oldest request times out
+        auto oldest = Clock::time_point::max();
+        for (const auto& [id, request] : inFlight)
+        {
+            oldest = std::min(oldest, request.sent);
+        }
+        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+            oldest + timeout - Clock::now());
+        pollfd pfd{pldmTransport.getEventSource(), POLLIN, 0};
+        auto rc = poll(&pfd, 1, std::max<int>(wait.count(), 0));
+        if (rc < 0 && errno != EINTR)
+        {
+            std::cerr << "poll error: " << strerror(errno) << "\n";
+            while (!inFlight.empty())
+            {
+                drop(inFlight.begin());
+            }
+            return failures + count - next;
+        }
+
+        if (rc > 0)
+        {
+            pldm_tid_t tid = 0;
+            void* rx = nullptr;
+            size_t rxLen = 0;
+            if (pldmTransport.recvMsg(tid, rx, rxLen) ==
+                PLDM_REQUESTER_SUCCESS)
+            {
+                std::vector<uint8_t> responseMsg(
+                    static_cast<uint8_t*>(rx),
+                    static_cast<uint8_t*>(rx) + rxLen);
+                free(rx);
+
+                auto hdr =
+                    reinterpret_cast<const pldm_msg_hdr*>(responseMsg.data());
+                auto request =
+                    rxLen >= sizeof(pldm_msg_hdr) && tid == mctp_eid &&
+                            !hdr->request
+                        ? inFlight.find(hdr->instance_id)
+                        : inFlight.end();
+                if (request != inFlight.end())
+                {
+                    auto reqHdr = reinterpret_cast<const pldm_msg_hdr*>(
+                        request->second.requestMsg.data());
+                    if (hdr->type == reqHdr->type &&
+                        hdr->command == reqHdr->command)
+                    {
+                        if (pldmVerbose)
+                        {
+                            std::cout << "pldmtool: ";
+                            printBuffer(Rx, responseMsg);
+                        }
+                        handle(request->second.index,
+                               reinterpret_cast<pldm_msg*>(responseMsg.data()),
+                               rxLen - sizeof(pldm_msg_hdr));
+                        instanceIdDb.free(mctp_eid, request->first);
+                        inFlight.erase(request);
+                    }
+                }
+            }
+        }
+
+        // Send the timed out requests again or give up on them
+        auto now = Clock::now();
+        for (auto request = inFlight.begin(); request != inFlight.end();)
+        {
+            auto current = request++;
+            if (now - current->second.sent < timeout)
+            {
+                continue;
+            }
+            if (current->second.retries < numRetries &&
+                send(current->second) == PLDM_REQUESTER_SUCCESS)
+            {
+                current->second.retries++;
+                continue;
+            }
+            std::cerr << "No response to request " << current->second.index
+                      << " after " << unsigned(current->second.retries)
+                      << " retries\n";
+            drop(current);
+        }
+    }
+
+    return failures;
+}
 } // namespace helper
 } // namespace pldmtool
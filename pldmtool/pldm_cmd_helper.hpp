@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/instance_id.hpp"
+#include "common/transport.hpp"
 #include "common/utils.hpp"
 
 #include <err.h>
@@ -16,8 +17,10 @@
 #include <nlohmann/json.hpp>
 
 #include <cstring>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <utility>
 
 namespace pldmtool
@@ -60,6 +63,19 @@ static inline void DisplayInJson(const ordered_json& data)
     std::cout << data.dump(4) << std::endl;
 }
 
+/** @brief Display in JSON Lines format, one compact JSON object per line.
+ *         The output is not flushed so that bulk commands can stream large
+ *         numbers of records.
+ *
+ *  @param[in]  data - data to print in json
+ *
+ *  @return - None
+ */
+static inline void DisplayInJsonLine(const ordered_json& data)
+{
+    std::cout << data.dump() << '\n';
+}
+
 /** @brief MCTP socket read/receive
  *
  *  @param[in]  requestMsg - Request message to compare against loopback
@@ -100,6 +116,32 @@ class CommandInterface
     int pldmSendRecv(std::vector<uint8_t>& requestMsg,
                      std::vector<uint8_t>& responseMsg);
 
+    /** @brief Encode the request at index with the given instance ID */
+    using RequestEncoder = std::function<int(
+        size_t index, uint8_t instanceId, std::vector<uint8_t>& requestMsg)>;
+
+    /** @brief Handle the response to the request at index */
+    using ResponseHandler = std::function<void(
+        size_t index, pldm_msg* responsePtr, size_t payloadLength)>;
+
+    /** @brief Exchange a number of independent requests with the endpoint,
+     *         keeping up to window of them in flight on the same transport.
+     *         Each request has its own instance ID, the responses are
+     *         matched by instance ID and may be handled out of order.
+     *         Requests without a response are sent again up to the retry
+     *         count.
+     *
+     *  @param[in] count - number of requests
+     *  @param[in] window - maximum number of requests in flight
+     *  @param[in] encode - encodes the request at an index
+     *  @param[in] handle - handles the response to the request at an index
+     *
+     *  @return the number of requests without a response
+     */
+    size_t pldmSendRecvWindow(size_t count, size_t window,
+                              const RequestEncoder& encode,
+                              const ResponseHandler& handle);
+
     /**
      * @brief get MCTP endpoint ID
      *
@@ -131,10 +173,16 @@ class CommandInterface
     }
 
   private:
+    /** @brief Get the transport, it is opened by the first exchange and
+     *         reused by the following ones
+     */
+    PldmTransport& getTransport();
+
     const std::string pldmType;
     const std::string commandName;
     uint8_t mctp_eid;
     bool pldmVerbose;
+    std::unique_ptr<PldmTransport> transport;
 
   protected:
     uint8_t instanceId;
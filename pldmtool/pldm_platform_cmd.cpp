@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <ranges>
+#include <set>
 
 #ifdef OEM_IBM
 #include "oem/ibm/oem_ibm_state_set.hpp"
@@ -120,6 +121,10 @@ class GetPDR : public CommandInterface
                                  "retrieve all PDRs from a PDR repository");
 
         pdrOptionGroup->require_option(1);
+
+        app->add_flag("-l, --json-lines", jsonLines,
+                      "print each PDR as one JSON line instead of a JSON "
+                      "array, for bulk retrieval with --all or --type");
     }
 
     void parseGetPDROptions()
@@ -135,7 +140,10 @@ class GetPDR : public CommandInterface
     void getPDRs()
     {
         // start the array
-        std::cout << "[";
+        if (!jsonLines)
+        {
+            std::cout << "[";
+        }
 
         recordHandle = 0;
         do
@@ -144,7 +152,10 @@ class GetPDR : public CommandInterface
         } while (recordHandle != 0);
 
         // close the array
-        std::cout << "]\n";
+        if (!jsonLines)
+        {
+            std::cout << "]\n";
+        }
 
         if (handleFound)
         {
@@ -173,7 +184,10 @@ class GetPDR : public CommandInterface
             }
 
             // start the array
-            std::cout << "[\n";
+            if (!jsonLines)
+            {
+                std::cout << "[\n";
+            }
 
             // Retrieve all PDR records starting from the first
             recordHandle = 0;
@@ -203,7 +217,7 @@ class GetPDR : public CommandInterface
                 }
                 prevRecordHandle = recordHandle;
 
-                if (recordHandle != 0)
+                if (recordHandle != 0 && !jsonLines)
                 {
                     // close the array
                     std::cout << ",";
@@ -211,7 +225,11 @@ class GetPDR : public CommandInterface
             } while (recordHandle != 0);
 
             // close the array
-            std::cout << "]\n";
+            if (!jsonLines)
+            {
+                std::cout << "]\n";
+            }
+            std::cout.flush();
         }
         else
         {
@@ -1577,7 +1595,14 @@ class GetPDR : public CommandInterface
             default:
                 break;
         }
-        pldmtool::helper::DisplayInJson(output);
+        if (jsonLines)
+        {
+            pldmtool::helper::DisplayInJsonLine(output);
+        }
+        else
+        {
+            pldmtool::helper::DisplayInJson(output);
+        }
     }
 
   private:
@@ -1595,6 +1620,7 @@ class GetPDR : public CommandInterface
     uint16_t recordChangeNumber;
     std::vector<uint8_t> recordData;
     bool nextPartRequired;
+    bool jsonLines = false;
 };
 
 class SetStateEffecter : public CommandInterface
@@ -1881,14 +1907,61 @@ class GetSensorReading : public CommandInterface
     explicit GetSensorReading(const char* type, const char* name,
                               CLI::App* app) : CommandInterface(type, name, app)
     {
-        app->add_option(
-               "-i, --sensor_id", sensorId,
-               "Sensor ID that is used to identify and access the sensor")
-            ->required();
+        auto sensorOptionGroup = app->add_option_group(
+            "Required Option",
+            "Read a numeric sensor or all the numeric sensors in the PDRs");
+        sensorOptionGroup->add_option(
+            "-i, --sensor_id", sensorId,
+            "Sensor ID that is used to identify and access the sensor");
+        sensorOptionGroup->add_flag(
+            "-a, --all", allSensors,
+            "read all the numeric sensors found in the PDR repository, "
+            "one JSON line per sensor");
+        sensorOptionGroup->require_option(1);
         app->add_option("-r, --rearm", rearm,
                         "Manually re-arm EventState after "
                         "responding to this request")
             ->required();
+        app->add_option("-w, --window", window,
+                        "Number of sensor readings in flight with --all")
+            ->check(CLI::Range(1, 16));
+    }
+
+    void exec() override
+    {
+        if (!allSensors)
+        {
+            CommandInterface::exec();
+            return;
+        }
+
+        auto sensorIds = getNumericSensorIds();
+        auto failures = pldmSendRecvWindow(
+            sensorIds.size(), window,
+            [this, &sensorIds](size_t index, uint8_t instanceId,
+                               std::vector<uint8_t>& requestMsg) {
+                requestMsg.resize(
+                    sizeof(pldm_msg_hdr) + PLDM_GET_SENSOR_READING_REQ_BYTES);
+                auto request = new (requestMsg.data()) pldm_msg;
+                return encode_get_sensor_reading_req(
+                    instanceId, sensorIds[index], rearm, request);
+            },
+            [this, &sensorIds](size_t index, pldm_msg* responsePtr,
+                               size_t payloadLength) {
+                ordered_json output;
+                output["sensorID"] = sensorIds[index];
+                if (parseReading(responsePtr, payloadLength, output))
+                {
+                    pldmtool::helper::DisplayInJsonLine(output);
+                }
+            });
+        std::cout.flush();
+
+        if (failures)
+        {
+            std::cerr << "Failed to read " << failures << " of "
+                      << sensorIds.size() << " numeric sensors\n";
+        }
     }
 
     std::pair<int, std::vector<uint8_t>> createRequestMsg() override
@@ -1904,6 +1977,149 @@ class GetSensorReading : public CommandInterface
     }
 
     void parseResponseMsg(pldm_msg* responsePtr, size_t payloadLength) override
+    {
+        ordered_json output;
+        if (parseReading(responsePtr, payloadLength, output))
+        {
+            pldmtool::helper::DisplayInJson(output);
+        }
+    }
+
+  private:
+    /** @brief Walk the PDR repository of the endpoint and collect the IDs of
+     *         the numeric and compact numeric sensors
+     *
+     *  @return the sensor IDs in PDR repository order
+     */
+    std::vector<uint16_t> getNumericSensorIds()
+    {
+        std::vector<uint16_t> sensorIds;
+        std::vector<uint8_t> recordData;
+        std::vector<uint8_t> respRecordData(UINT16_MAX);
+        std::set<uint32_t> recordsSeen;
+        uint32_t recordHandle = 0;
+        uint32_t dataTransferHandle = 0;
+        uint8_t operationFlag = PLDM_GET_FIRSTPART;
+        uint16_t recordChangeNumber = 0;
+
+        while (true)
+        {
+            std::vector<uint8_t> requestMsg(
+                sizeof(pldm_msg_hdr) + PLDM_GET_PDR_REQ_BYTES);
+            auto request = new (requestMsg.data()) pldm_msg;
+            std::vector<uint8_t> responseMsg;
+
+            instanceId = instanceIdDb.next(getMCTPEID());
+            auto rc = encode_get_pdr_req(
+                instanceId, recordHandle, dataTransferHandle, operationFlag,
+                UINT16_MAX, recordChangeNumber, request,
+                PLDM_GET_PDR_REQ_BYTES);
+            if (rc == PLDM_SUCCESS)
+            {
+                rc = pldmSendRecv(requestMsg, responseMsg);
+            }
+            instanceIdDb.free(getMCTPEID(), instanceId);
+            if (rc != PLDM_SUCCESS)
+            {
+                std::cerr << "Failed to get PDR " << recordHandle
+                          << ", rc=" << rc << "\n";
+                break;
+            }
+
+            uint8_t completionCode = 0;
+            uint32_t nextRecordHndl = 0;
+            uint32_t nextDataTransferHndl = 0;
+            uint8_t transferFlag = 0;
+            uint16_t respCnt = 0;
+            uint8_t transferCRC = 0;
+            rc = decode_get_pdr_resp(
+                reinterpret_cast<pldm_msg*>(responseMsg.data()),
+                responseMsg.size() - sizeof(pldm_msg_hdr), &completionCode,
+                &nextRecordHndl, &nextDataTransferHndl, &transferFlag,
+                &respCnt, respRecordData.data(), respRecordData.size(),
+                &transferCRC);
+            if (rc != PLDM_SUCCESS || completionCode != PLDM_SUCCESS)
+            {
+                std::cerr << "Response Message Error: "
+                          << "rc=" << rc << ",cc=" << (int)completionCode
+                          << std::endl;
+                break;
+            }
+            recordData.insert(recordData.end(), respRecordData.begin(),
+                              respRecordData.begin() + respCnt);
+
+            if (transferFlag != PLDM_PLATFORM_TRANSFER_END &&
+                transferFlag != PLDM_PLATFORM_TRANSFER_START_AND_END)
+            {
+                auto pdrHdr =
+                    reinterpret_cast<const pldm_pdr_hdr*>(recordData.data());
+                dataTransferHandle = nextDataTransferHndl;
+                recordChangeNumber = pdrHdr->record_change_num;
+                operationFlag = PLDM_GET_NEXTPART;
+                continue;
+            }
+
+            addNumericSensorId(recordData, sensorIds);
+            recordData.clear();
+            dataTransferHandle = 0;
+            recordChangeNumber = 0;
+            operationFlag = PLDM_GET_FIRSTPART;
+
+            recordHandle = nextRecordHndl;
+            if (recordHandle == 0)
+            {
+                break;
+            }
+            if (!recordsSeen.emplace(recordHandle).second)
+            {
+                std::cerr << "Record handle " << recordHandle
+                          << " has multiple references\n";
+                break;
+            }
+        }
+
+        return sensorIds;
+    }
+
+    /** @brief Add the sensor ID of a numeric or compact numeric sensor PDR
+     *
+     *  @param[in] pdr - the PDR
+     *  @param[out] sensorIds - the sensor IDs
+     */
+    static void addNumericSensorId(const std::vector<uint8_t>& pdr,
+                                   std::vector<uint16_t>& sensorIds)
+    {
+        if (pdr.size() < sizeof(pldm_pdr_hdr))
+        {
+            return;
+        }
+
+        auto pdrHdr = reinterpret_cast<const pldm_pdr_hdr*>(pdr.data());
+        if (pdrHdr->type == PLDM_NUMERIC_SENSOR_PDR)
+        {
+            pldm_numeric_sensor_value_pdr sensorPdr{};
+            if (decode_numeric_sensor_pdr_data(pdr.data(), pdr.size(),
+                                               &sensorPdr) == PLDM_SUCCESS)
+            {
+                sensorIds.emplace_back(sensorPdr.sensor_id);
+            }
+        }
+        else if (pdrHdr->type == PLDM_COMPACT_NUMERIC_SENSOR_PDR &&
+                 pdr.size() >= sizeof(pldm_compact_numeric_sensor_pdr))
+        {
+            auto sensorPdr =
+                reinterpret_cast<const pldm_compact_numeric_sensor_pdr*>(
+                    pdr.data());
+            sensorIds.emplace_back(sensorPdr->sensor_id);
+        }
+    }
+
+    /** @brief Decode a GetSensorReading response into output
+     *
+     *  @return true if the response is decoded
+     */
+    bool parseReading(pldm_msg* responsePtr, size_t payloadLength,
+                      ordered_json& output)
     {
         uint8_t completionCode = 0;
         uint8_t sensorDataSize = 0;
@@ -1926,10 +2142,9 @@ class GetSensorReading : public CommandInterface
             std::cerr << "Response Message Error: "
                       << "rc=" << rc << ",cc=" << (int)completionCode
                       << std::endl;
-            return;
+            return false;
         }
 
-        ordered_json output;
         output["sensorDataSize"] =
             getSensorState(sensorDataSize, &sensorDataSz);
         output["sensorOperationalState"] =
@@ -1987,12 +2202,13 @@ class GetSensorReading : public CommandInterface
             }
         }
 
-        pldmtool::helper::DisplayInJson(output);
+        return true;
     }
 
-  private:
     uint16_t sensorId;
     uint8_t rearm;
+    bool allSensors = false;
+    size_t window = 8;
 
     const std::map<uint8_t, std::string> sensorDataSz = {
         {PLDM_SENSOR_DATA_SIZE_UINT8, "uint8"},
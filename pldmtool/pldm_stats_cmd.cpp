@@ -0,0 +1,218 @@
+#include "pldm_stats_cmd.hpp"
+
+#include "common/utils.hpp"
+#include "pldm_cmd_helper.hpp"
+#include "requester/request_stats.hpp"
+
+#include <sdbusplus/exception.hpp>
+
+#include <algorithm>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pldmtool
+{
+
+namespace stats
+{
+
+namespace
+{
+
+using namespace pldmtool::helper;
+using pldm::requester::bucketUpperBound;
+using pldm::requester::RequestStats;
+
+constexpr auto pldmService = "xyz.openbmc_project.PLDM";
+constexpr auto pldmPath = "/xyz/openbmc_project/pldm";
+constexpr auto statsInterface = "org.openbmc.pldm.RequesterStats";
+
+/** @brief The largest value a histogram bucket holds, the percentiles are
+ *         reported as the bound of their bucket
+ */
+uint64_t bucketMax(size_t bucket, size_t buckets, uint64_t max)
+{
+    if (!bucket)
+    {
+        return 0;
+    }
+    if (bucket == buckets - 1)
+    {
+        return max;
+    }
+    return std::min(bucketUpperBound(bucket) - 1, max);
+}
+
+/** @brief The bucket bound of a percentile of a histogram */
+uint64_t percentile(const std::vector<uint64_t>& buckets, uint64_t count,
+                    uint64_t max, double rank)
+{
+    auto target = std::max<uint64_t>(1, static_cast<uint64_t>(count * rank));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i)
+    {
+        seen += buckets[i];
+        if (seen >= target)
+        {
+            return bucketMax(i, buckets.size(), max);
+        }
+    }
+    return max;
+}
+
+/** @brief The summary of a latency histogram in usec */
+ordered_json latency(const std::vector<uint64_t>& buckets, uint64_t sum,
+                     uint64_t max)
+{
+    uint64_t count = 0;
+    for (auto bucket : buckets)
+    {
+        count += bucket;
+    }
+
+    ordered_json data;
+    data["Count"] = count;
+    if (count)
+    {
+        data["Mean"] = sum / count;
+        data["P50"] = percentile(buckets, count, max, 0.5);
+        data["P90"] = percentile(buckets, count, max, 0.9);
+        data["P99"] = percentile(buckets, count, max, 0.99);
+        data["Max"] = max;
+    }
+    return data;
+}
+
+/** @brief The non empty buckets of the retry histogram, keyed by range */
+ordered_json retries(const std::vector<uint64_t>& buckets)
+{
+    ordered_json data = ordered_json::object();
+    for (size_t i = 0; i < buckets.size(); ++i)
+    {
+        if (!buckets[i])
+        {
+            continue;
+        }
+        std::string range;
+        if (i == buckets.size() - 1)
+        {
+            range = std::format("{}+", bucketUpperBound(i - 1));
+        }
+        else if (i < 2)
+        {
+            range = std::to_string(i);
+        }
+        else
+        {
+            range = std::format("{}-{}", bucketUpperBound(i - 1),
+                                bucketUpperBound(i) - 1);
+        }
+        data[range] = buckets[i];
+    }
+    return data;
+}
+
+} // namespace
+
+class GetRequestStats
+{
+  public:
+    ~GetRequestStats() = default;
+    GetRequestStats() = delete;
+    GetRequestStats(const GetRequestStats&) = delete;
+    GetRequestStats(GetRequestStats&&) = default;
+    GetRequestStats& operator=(const GetRequestStats&) = delete;
+    GetRequestStats& operator=(GetRequestStats&&) = delete;
+
+    explicit GetRequestStats(CLI::App* app)
+    {
+        app->add_option("-d,--dimension", dimension,
+                        "only show the metrics per eid, type or command")
+            ->check(CLI::IsMember({"eid", "type", "command"}));
+        app->add_flag("-r,--reset", reset,
+                      "clear the metrics once they are shown");
+        app->callback([&]() { exec(); });
+    }
+
+    void exec()
+    {
+        try
+        {
+            auto& bus = pldm::utils::DBusHandler::getBus();
+            // The metrics are cleared by the call reading them, so that no
+            // request is lost between the two
+            auto method = bus.new_method_call(
+                pldmService, pldmPath, statsInterface,
+                reset ? "GetAndResetRequestStats" : "GetRequestStats");
+            auto reply = bus.call(method, pldm::utils::dbusTimeout);
+            std::vector<RequestStats::Record> records{};
+            reply.read(records);
+
+            ordered_json data = ordered_json::array();
+            for (const auto& [recordDimension, eid, type, command, requests,
+                              responses, timeouts, sendFailures, drops,
+                              queueWait, queueWaitSum, queueWaitMax, rtt,
+                              rttSum, rttMax, retryBuckets] : records)
+            {
+                if (!dimension.empty() && dimension != recordDimension)
+                {
+                    continue;
+                }
+
+                ordered_json entry;
+                entry["Dimension"] = recordDimension;
+                if (recordDimension == "eid")
+                {
+                    entry["EID"] = eid;
+                }
+                else
+                {
+                    entry["PLDMType"] = type;
+                    if (recordDimension == "command")
+                    {
+                        entry["Command"] = command;
+                    }
+                }
+                entry["Requests"] = requests;
+                entry["Responses"] = responses;
+                entry["Timeouts"] = timeouts;
+                entry["SendFailures"] = sendFailures;
+                entry["Drops"] = drops;
+                entry["QueueWaitUs"] =
+                    latency(queueWait, queueWaitSum, queueWaitMax);
+                entry["RoundTripUs"] = latency(rtt, rttSum, rttMax);
+                entry["Retries"] = retries(retryBuckets);
+                data.emplace_back(std::move(entry));
+            }
+            DisplayInJson(data);
+        }
+        catch (const sdbusplus::exception_t& e)
+        {
+            std::cerr << "Failed to get the request stats of pldmd, ERROR="
+                      << e.what() << "\n";
+        }
+    }
+
+  private:
+    std::string dimension;
+    bool reset = false;
+};
+
+namespace
+{
+std::vector<std::unique_ptr<GetRequestStats>> commands;
+}
+
+void registerCommand(CLI::App& app)
+{
+    auto stats = app.add_subcommand(
+        "stats", "show the latency and counters of the requests of pldmd");
+    commands.push_back(std::make_unique<GetRequestStats>(stats));
+}
+
+} // namespace stats
+
+} // namespace pldmtool
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <CLI/CLI.hpp>
+
+namespace pldmtool
+{
+
+namespace stats
+{
+
+void registerCommand(CLI::App& app);
+
+} // namespace stats
+
+} // namespace pldmtool
@@ -4,6 +4,7 @@
 #include "common/transport.hpp"
 #include "common/types.hpp"
 #include "request.hpp"
+#include "request_stats.hpp"
 
 #include <libpldm/base.h>
 #include <sys/socket.h>
@@ -87,6 +88,8 @@ struct RegisteredRequest
     RequestKey key;                  //!< Responder MCTP endpoint ID
     std::vector<uint8_t> reqMsg;     //!< Request messages queue
     ResponseHandler responseHandler; //!< Waiting for response flag
+    std::chrono::steady_clock::time_point queuedAt =
+        std::chrono::steady_clock::now(); //!< Time the request is queued
 };
 
 /** @struct EndpointMessageQueue
@@ -161,6 +164,7 @@ class Handler
                 "EID", key.eid, "INSTANCEID", key.instanceId);
             auto& [request, responseHandler,
                    timerInstance] = this->handlers[key];
+            stats->timedOut(key.eid, key.type, key.command);
             request->stop();
             auto rc = timerInstance->stop();
             if (rc)
@@ -214,9 +218,11 @@ class Handler
             event.get(), std::bind(&Handler::instanceIdExpiryCallBack, this,
                                    requestMsg->key));
 
+        const auto& key = requestMsg->key;
         auto rc = request->start();
         if (rc)
         {
+            stats->sendFailed(key.eid, key.type, key.command);
             instanceIdDb.free(requestMsg->key.eid, requestMsg->key.instanceId);
             error(
                 "Failure to send the PLDM request message for polling endpoint queue, response code '{RC}'",
@@ -224,6 +230,9 @@ class Handler
             endpointMessageQueues[eid]->activeRequest = false;
             return rc;
         }
+        stats->sent(key.eid, key.type, key.command,
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        request->getStartTime() - requestMsg->queuedAt));
 
         try
         {
@@ -382,6 +391,11 @@ class Handler
         if (handlers.contains(key) && !removeRequestContainer.contains(key))
         {
             auto& [request, responseHandler, timerInstance] = handlers[key];
+            stats->completed(
+                eid, type, command,
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - request->getStartTime()),
+                request->getRetries());
             request->stop();
             auto rc = timerInstance->stop();
             if (rc)
@@ -403,7 +417,9 @@ class Handler
             // Got a response for a PLDM request message not registered with the
             // request handler, so freeing up the instance ID, this can be other
             // OpenBMC applications relying on PLDM D-Bus apis like
-            // openpower-occ-control and softoff
+            // openpower-occ-control and softoff, or a late response to a
+            // request whose instance ID expired
+            stats->dropped(eid, type, command);
             instanceIdDb.free(key.eid, key.instanceId);
         }
     }
@@ -417,6 +433,12 @@ class Handler
     stdexec::sender_of<stdexec::set_value_t(SendRecvCoResp)> auto sendRecvMsg(
         mctp_eid_t eid, pldm::Request&& request);
 
+    /** @brief The latency histograms and counters of the requests */
+    RequestStats& getStats()
+    {
+        return *stats;
+    }
+
   private:
     PldmTransport* pldmTransport; //!< PLDM transport object
     sdeventplus::Event& event; //!< reference to PLDM daemon's main event loop
@@ -450,6 +472,11 @@ class Handler
                        RequestKeyHasher>
         removeRequestContainer;
 
+    /** @brief Latency histograms and counters of the requests, allocated once
+     *         as the tables are large
+     */
+    std::unique_ptr<RequestStats> stats = std::make_unique<RequestStats>();
+
     /** @brief Remove request entry for which the instance ID expired
      *
      *  @param[in] key - key for the Request
@@ -58,6 +58,8 @@ class RequestRetryTimer
      */
     int start()
     {
+        startTime = std::chrono::steady_clock::now();
+        retries = 0;
         auto rc = send();
         if (rc)
         {
@@ -93,12 +95,27 @@ class RequestRetryTimer
         }
     }
 
+    /** @brief The time of the first transmission of the request */
+    std::chrono::steady_clock::time_point getStartTime() const
+    {
+        return startTime;
+    }
+
+    /** @brief The number of retransmissions of the request */
+    uint8_t getRetries() const
+    {
+        return retries;
+    }
+
   protected:
     sdeventplus::Event& event; //!< reference to PLDM daemon's main event loop
     uint8_t numRetries;        //!< number of request retries
     std::chrono::milliseconds
         timeout;            //!< time to wait between each retry in milliseconds
     sdbusplus::Timer timer; //!< manages starting timers and handling timeouts
+    std::chrono::steady_clock::time_point
+        startTime;          //!< time of the first transmission
+    uint8_t retries = 0;    //!< number of retransmissions
 
     /** @brief Sends the PLDM request message
      *
@@ -111,6 +128,7 @@ class RequestRetryTimer
     {
         if (numRetries--)
         {
+            retries++;
             send();
         }
         else
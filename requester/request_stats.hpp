@@ -0,0 +1,333 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace pldm
+{
+namespace requester
+{
+
+/** @struct Histogram
+ *
+ *  A histogram of power of two buckets. Bucket 0 counts the zero values and
+ *  bucket i the values in [2^(i-1), 2^i), the last bucket also counts the
+ *  values above its range. Recording a value is a few integer operations.
+ *
+ * @tparam Buckets - number of buckets
+ */
+template <size_t Buckets>
+struct Histogram
+{
+    std::array<uint64_t, Buckets> buckets{}; //!< count of values per bucket
+    uint64_t sum = 0;                        //!< sum of the values
+    uint64_t max = 0;                        //!< largest value
+
+    /** @brief Record a value
+     *
+     *  @param[in] value - the value
+     */
+    void record(uint64_t value)
+    {
+        auto bucket =
+            std::min<size_t>(std::bit_width(value), buckets.size() - 1);
+        buckets[bucket]++;
+        sum += value;
+        max = std::max(max, value);
+    }
+
+    /** @brief The number of values recorded */
+    uint64_t count() const
+    {
+        uint64_t total = 0;
+        for (auto bucket : buckets)
+        {
+            total += bucket;
+        }
+        return total;
+    }
+};
+
+/** @brief The exclusive upper bound of a histogram bucket, but for the last
+ *         bucket which has none
+ *
+ *  @param[in] bucket - the bucket index
+ */
+constexpr uint64_t bucketUpperBound(size_t bucket)
+{
+    return uint64_t(1) << bucket;
+}
+
+/** @class RequestStats
+ *
+ *  The latency histograms and counters of the PLDM requests of the requester
+ *  Handler, kept per MCTP endpoint, per PLDM type and per PLDM command. The
+ *  queue wait is the time a request waits in its endpoint queue, the round
+ *  trip time is the time from the first transmission of the request to its
+ *  response, retries included.
+ *
+ *  pldmd runs a single event loop so the counters are plain integers. The
+ *  tables are sized up front and recording never allocates, the first
+ *  commandSlots distinct (type, command) pairs get their own entry and the
+ *  others share one.
+ */
+class RequestStats
+{
+  public:
+    static constexpr size_t latencyBuckets = 24; //!< up to 2^23 usec, ~8s
+    static constexpr size_t retryBuckets = 6;    //!< 0, 1, 2-3, ... 16+
+    static constexpr size_t typeSlots = 64;      //!< PLDM types
+    static constexpr size_t commandSlots = 128;  //!< (type, command) pairs
+
+    using LatencyHistogram = Histogram<latencyBuckets>;
+    using RetryHistogram = Histogram<retryBuckets>;
+
+    /** @struct Metrics
+     *
+     *  The metrics of the requests sharing an EID, a type or a command
+     */
+    struct Metrics
+    {
+        uint64_t requests = 0;      //!< requests sent
+        uint64_t responses = 0;     //!< responses matching a request
+        uint64_t timeouts = 0;      //!< instance ID expiries
+        uint64_t sendFailures = 0;  //!< requests failing to be sent
+        uint64_t drops = 0;         //!< responses matching no request
+        LatencyHistogram queueWait; //!< endpoint queue wait in usec
+        LatencyHistogram rtt;       //!< round trip time in usec
+        RetryHistogram retries;     //!< retries of the completed requests
+
+        /** @brief Whether anything was recorded */
+        bool empty() const
+        {
+            return !requests && !sendFailures && !drops;
+        }
+    };
+
+    /** @brief The D-Bus representation of the metrics of an EID, a type or a
+     *         command: the dimension ("eid", "type" or "command"), EID, type,
+     *         command, the counters requests, responses, timeouts,
+     *         sendFailures and drops, the queue wait buckets, sum and max, the
+     *         round trip time buckets, sum and max and the retry buckets. The
+     *         keys not part of the dimension are 0.
+     */
+    using Record =
+        std::tuple<std::string, uint8_t, uint8_t, uint8_t, uint64_t, uint64_t,
+                   uint64_t, uint64_t, uint64_t, std::vector<uint64_t>,
+                   uint64_t, uint64_t, std::vector<uint64_t>, uint64_t,
+                   uint64_t, std::vector<uint64_t>>;
+
+    /** @brief A request is sent
+     *
+     *  @param[in] eid - MCTP endpoint ID
+     *  @param[in] type - PLDM type
+     *  @param[in] command - PLDM command
+     *  @param[in] queueWait - time spent in the endpoint queue
+     */
+    void sent(uint8_t eid, uint8_t type, uint8_t command,
+              std::chrono::microseconds queueWait)
+    {
+        update(eid, type, command, [&queueWait](Metrics& metrics) {
+            metrics.requests++;
+            metrics.queueWait.record(queueWait.count());
+        });
+    }
+
+    /** @brief A request gets its response
+     *
+     *  @param[in] eid - MCTP endpoint ID
+     *  @param[in] type - PLDM type
+     *  @param[in] command - PLDM command
+     *  @param[in] rtt - time from the first transmission to the response
+     *  @param[in] retries - number of retransmissions
+     */
+    void completed(uint8_t eid, uint8_t type, uint8_t command,
+                   std::chrono::microseconds rtt, uint8_t retries)
+    {
+        update(eid, type, command, [&rtt, retries](Metrics& metrics) {
+            metrics.responses++;
+            metrics.rtt.record(rtt.count());
+            metrics.retries.record(retries);
+        });
+    }
+
+    /** @brief The instance ID of a request expires before its response */
+    void timedOut(uint8_t eid, uint8_t type, uint8_t command)
+    {
+        update(eid, type, command,
+               [](Metrics& metrics) { metrics.timeouts++; });
+    }
+
+    /** @brief A request fails to be sent */
+    void sendFailed(uint8_t eid, uint8_t type, uint8_t command)
+    {
+        update(eid, type, command,
+               [](Metrics& metrics) { metrics.sendFailures++; });
+    }
+
+    /** @brief A response matches no outstanding request */
+    void dropped(uint8_t eid, uint8_t type, uint8_t command)
+    {
+        update(eid, type, command, [](Metrics& metrics) { metrics.drops++; });
+    }
+
+    /** @brief The metrics of an endpoint */
+    const Metrics& getEid(uint8_t eid) const
+    {
+        return eids[eid];
+    }
+
+    /** @brief The metrics of a PLDM type */
+    const Metrics& getType(uint8_t type) const
+    {
+        return types[type % typeSlots];
+    }
+
+    /** @brief The metrics of a PLDM command
+     *
+     *  @return nullptr if the command has no entry of its own
+     */
+    const Metrics* getCommand(uint8_t type, uint8_t command) const
+    {
+        auto slot = findSlot(type, command);
+        if (slot == commandSlots || !commands[slot].used)
+        {
+            return nullptr;
+        }
+        return &commands[slot].metrics;
+    }
+
+    /** @brief The metrics of the commands without an entry of their own */
+    const Metrics& getOtherCommands() const
+    {
+        return otherCommands;
+    }
+
+    /** @brief The D-Bus records of the non empty metrics, per EID, then per
+     *         type, then per command. The commands without an entry of their
+     *         own are reported as type 0xFF command 0xFF.
+     */
+    std::vector<Record> getRecords() const
+    {
+        std::vector<Record> records{};
+        for (size_t eid = 0; eid < eids.size(); ++eid)
+        {
+            addRecord(records, "eid", eid, 0, 0, eids[eid]);
+        }
+        for (size_t type = 0; type < types.size(); ++type)
+        {
+            addRecord(records, "type", 0, type, 0, types[type]);
+        }
+        for (const auto& slot : commands)
+        {
+            if (slot.used)
+            {
+                addRecord(records, "command", 0, slot.key >> 8,
+                          slot.key & 0xFF, slot.metrics);
+            }
+        }
+        addRecord(records, "command", 0, 0xFF, 0xFF, otherCommands);
+        return records;
+    }
+
+    /** @brief Clear the metrics */
+    void reset()
+    {
+        eids.fill({});
+        types.fill({});
+        commands.fill({});
+        otherCommands = {};
+    }
+
+  private:
+    /** @struct CommandSlot
+     *
+     *  An entry of the open addressed command table
+     */
+    struct CommandSlot
+    {
+        bool used = false; //!< the slot holds a command
+        uint16_t key = 0;  //!< type << 8 | command
+        Metrics metrics;   //!< metrics of the command
+    };
+
+    /** @brief Apply an update to the EID, type and command metrics */
+    template <typename Update>
+    void update(uint8_t eid, uint8_t type, uint8_t command, Update&& apply)
+    {
+        apply(eids[eid]);
+        apply(types[type % typeSlots]);
+        apply(commandMetrics(type, command));
+    }
+
+    /** @brief Find the slot of a command, the table is probed linearly and
+     *         its slots are only freed by reset()
+     *
+     *  @return the slot of the command, else the free slot to take, else
+     *          commandSlots when the table is full
+     */
+    size_t findSlot(uint8_t type, uint8_t command) const
+    {
+        uint16_t key = type << 8 | command;
+        size_t hash = (type * 31u + command) % commandSlots;
+        for (size_t i = 0; i < commandSlots; ++i)
+        {
+            auto slot = (hash + i) % commandSlots;
+            if (!commands[slot].used || commands[slot].key == key)
+            {
+                return slot;
+            }
+        }
+        return commandSlots;
+    }
+
+    /** @brief The metrics of a command, taking a free slot if needed */
+    Metrics& commandMetrics(uint8_t type, uint8_t command)
+    {
+        auto slot = findSlot(type, command);
+        if (slot == commandSlots)
+        {
+            return otherCommands;
+        }
+        commands[slot].used = true;
+        commands[slot].key = type << 8 | command;
+        return commands[slot].metrics;
+    }
+
+    /** @brief Append the D-Bus record of non empty metrics */
+    static void addRecord(std::vector<Record>& records, const char* dimension,
+                          uint8_t eid, uint8_t type, uint8_t command,
+                          const Metrics& metrics)
+    {
+        if (metrics.empty())
+        {
+            return;
+        }
+        records.emplace_back(
+            dimension, eid, type, command, metrics.requests, metrics.responses,
+            metrics.timeouts, metrics.sendFailures, metrics.drops,
+            std::vector<uint64_t>(metrics.queueWait.buckets.begin(),
+                                  metrics.queueWait.buckets.end()),
+            metrics.queueWait.sum, metrics.queueWait.max,
+            std::vector<uint64_t>(metrics.rtt.buckets.begin(),
+                                  metrics.rtt.buckets.end()),
+            metrics.rtt.sum, metrics.rtt.max,
+            std::vector<uint64_t>(metrics.retries.buckets.begin(),
+                                  metrics.retries.buckets.end()));
+    }
+
+    std::array<Metrics, 256> eids{};                //!< metrics per EID
+    std::array<Metrics, typeSlots> types{};         //!< metrics per type
+    std::array<CommandSlot, commandSlots> commands; //!< metrics per command
+    Metrics otherCommands{}; //!< commands without a slot of their own
+};
+
+} // namespace requester
+} // namespace pldm
@@ -6,6 +6,7 @@
 #include "test/test_instance_id.hpp"
 
 #include <libpldm/base.h>
+#include <libpldm/platform.h>
 #include <libpldm/transport.h>
 
 #include <sdbusplus/async.hpp>
@@ -294,3 +295,49 @@ TEST_F(HandlerTest, asyncRequestResponseByCoroutine)
 
     stdexec::sync_wait(scope.on_empty());
 }
+
+TEST_F(HandlerTest, requestStats)
+{
+    Handler<NiceMock<MockRequest>> reqHandler(
+        pldmTransport, event, instanceIdDb, false, seconds(1), 2,
+        milliseconds(100));
+    pldm::Response response(sizeof(pldm_msg_hdr) + sizeof(uint8_t));
+    auto responsePtr = reinterpret_cast<const pldm_msg*>(response.data());
+
+    // The second request waits in the endpoint queue for the first response
+    auto instanceId = instanceIdDb.next(eid);
+    auto instanceId2 = instanceIdDb.next(eid);
+    EXPECT_EQ(reqHandler.registerRequest(
+                  eid, instanceId, PLDM_PLATFORM, PLDM_GET_SENSOR_READING,
+                  pldm::Request{},
+                  std::bind_front(&HandlerTest::pldmResponseCallBack, this)),
+              PLDM_SUCCESS);
+    EXPECT_EQ(reqHandler.registerRequest(
+                  eid, instanceId2, PLDM_BASE, PLDM_GET_TID, pldm::Request{},
+                  std::bind_front(&HandlerTest::pldmResponseCallBack, this)),
+              PLDM_SUCCESS);
+    const auto& stats = reqHandler.getStats();
+    EXPECT_EQ(stats.getEid(eid).requests, 1);
+
+    reqHandler.handleResponse(eid, instanceId, PLDM_PLATFORM,
+                              PLDM_GET_SENSOR_READING, responsePtr,
+                              response.size());
+    reqHandler.handleResponse(eid, instanceId2, PLDM_BASE, PLDM_GET_TID,
+                              responsePtr, response.size());
+    // Nothing waits for this response
+    reqHandler.handleResponse(eid, instanceId2, PLDM_BASE, PLDM_GET_TID,
+                              responsePtr, response.size());
+    EXPECT_EQ(callbackCount, 2);
+
+    const auto& metrics = stats.getEid(eid);
+    EXPECT_EQ(metrics.requests, 2);
+    EXPECT_EQ(metrics.responses, 2);
+    EXPECT_EQ(metrics.drops, 1);
+    EXPECT_EQ(metrics.timeouts, 0);
+    EXPECT_EQ(metrics.queueWait.count(), 2);
+    EXPECT_EQ(metrics.rtt.count(), 2);
+    EXPECT_EQ(metrics.retries.buckets[0], 2);
+    EXPECT_EQ(stats.getType(PLDM_PLATFORM).responses, 1);
+    ASSERT_NE(stats.getCommand(PLDM_BASE, PLDM_GET_TID), nullptr);
+    EXPECT_EQ(stats.getCommand(PLDM_BASE, PLDM_GET_TID)->drops, 1);
+}
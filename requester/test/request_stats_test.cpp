@@ -0,0 +1,104 @@
+#include "requester/request_stats.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using namespace pldm::requester;
+using namespace std::chrono;
+
+TEST(Histogram, buckets)
+{
+    Histogram<6> histogram{};
+    for (uint64_t value : {0, 1, 2, 3, 4, 7, 8, 31, 32, 1000})
+    {
+        histogram.record(value);
+    }
+
+    // 0 | 1 | 2-3 | 4-7 | 8-15 | 16+
+    EXPECT_EQ(histogram.buckets[0], 1);
+    EXPECT_EQ(histogram.buckets[1], 1);
+    EXPECT_EQ(histogram.buckets[2], 2);
+    EXPECT_EQ(histogram.buckets[3], 2);
+    EXPECT_EQ(histogram.buckets[4], 1);
+    EXPECT_EQ(histogram.buckets[5], 3);
+    EXPECT_EQ(histogram.count(), 10);
+    EXPECT_EQ(histogram.sum, 1088);
+    EXPECT_EQ(histogram.max, 1000);
+    EXPECT_EQ(bucketUpperBound(3), 8);
+}
+
+TEST(RequestStats, dimensions)
+{
+    auto stats = std::make_unique<RequestStats>();
+    stats->sent(9, 2, 0x11, microseconds(5));
+    stats->completed(9, 2, 0x11, microseconds(300), 0);
+    stats->sent(9, 2, 0x0a, microseconds(0));
+    stats->completed(9, 2, 0x0a, microseconds(1500), 2);
+    stats->sent(10, 0, 0x02, microseconds(20));
+    stats->timedOut(10, 0, 0x02);
+    stats->sendFailed(10, 0, 0x02);
+    stats->dropped(11, 2, 0x11);
+
+    const auto& eid9 = stats->getEid(9);
+    EXPECT_EQ(eid9.requests, 2);
+    EXPECT_EQ(eid9.responses, 2);
+    EXPECT_EQ(eid9.rtt.sum, 1800);
+    EXPECT_EQ(eid9.rtt.max, 1500);
+    EXPECT_EQ(eid9.retries.buckets[0], 1);
+    EXPECT_EQ(eid9.retries.buckets[2], 1);
+    EXPECT_EQ(eid9.queueWait.buckets[0], 1);
+    EXPECT_EQ(eid9.queueWait.buckets[3], 1);
+
+    const auto& eid10 = stats->getEid(10);
+    EXPECT_EQ(eid10.requests, 1);
+    EXPECT_EQ(eid10.responses, 0);
+    EXPECT_EQ(eid10.timeouts, 1);
+    EXPECT_EQ(eid10.sendFailures, 1);
+    EXPECT_EQ(stats->getEid(11).drops, 1);
+
+    const auto& platform = stats->getType(2);
+    EXPECT_EQ(platform.requests, 2);
+    EXPECT_EQ(platform.drops, 1);
+    EXPECT_EQ(stats->getType(0).timeouts, 1);
+
+    auto readSensor = stats->getCommand(2, 0x11);
+    ASSERT_NE(readSensor, nullptr);
+    EXPECT_EQ(readSensor->requests, 1);
+    EXPECT_EQ(readSensor->drops, 1);
+    EXPECT_EQ(stats->getCommand(2, 0x12), nullptr);
+
+    // 3 EIDs, 2 types and 3 commands
+    auto records = stats->getRecords();
+    ASSERT_EQ(records.size(), 8);
+    const auto& [dimension, eid, type, command, requests, responses, timeouts,
+                 sendFailures, drops, queueWait, queueWaitSum, queueWaitMax,
+                 rtt, rttSum, rttMax, retries] = records.front();
+    EXPECT_EQ(dimension, "eid");
+    EXPECT_EQ(eid, 9);
+    EXPECT_EQ(requests, 2);
+    EXPECT_EQ(queueWait.size(), RequestStats::latencyBuckets);
+    EXPECT_EQ(rttSum, 1800);
+    EXPECT_EQ(retries.size(), RequestStats::retryBuckets);
+    EXPECT_EQ(std::get<0>(records.back()), "command");
+
+    stats->reset();
+    EXPECT_TRUE(stats->getRecords().empty());
+    EXPECT_EQ(stats->getCommand(2, 0x11), nullptr);
+}
+
+TEST(RequestStats, commandOverflow)
+{
+    auto stats = std::make_unique<RequestStats>();
+    for (size_t i = 0; i < RequestStats::commandSlots + 10; ++i)
+    {
+        stats->sent(9, i >> 8, i & 0xff, microseconds(1));
+    }
+
+    EXPECT_NE(stats->getCommand(0, 0), nullptr);
+    EXPECT_EQ(stats->getCommand(0, RequestStats::commandSlots), nullptr);
+    EXPECT_EQ(stats->getOtherCommands().requests, 10);
+    EXPECT_EQ(stats->getEid(9).requests, RequestStats::commandSlots + 10);
+}
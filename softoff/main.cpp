@@ -20,7 +20,11 @@ int main()
     // Attach the bus to sd_event to service user requests
     bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
 
-    pldm::SoftPowerOff softPower(bus, event.get(), instanceIdDb);
+    pldm::SoftPowerOff softPower(bus, event, instanceIdDb);
+
+    // Look up the softoff PDRs, send the gracefully shutdown request to the
+    // host and wait the host gracefully shutdown, all from the event loop.
+    auto rc = softPower.run();
 
     if (softPower.isError())
     {
@@ -29,16 +33,14 @@ int main()
         return -1;
     }
 
-    if (softPower.isCompleted())
+    if (softPower.isCompleted() && !softPower.isReceiveResponse())
     {
         error(
             "Remote terminus current state is not Running, exiting pldm-softpoweroff app");
         return 0;
     }
 
-    // Send the gracefully shutdown request to the host and
-    // wait the host gracefully shutdown.
-    if (softPower.hostSoftOff(event))
+    if (rc)
     {
         error(
             "Failure in sending soft off request to the remote terminus. Exiting pldm-softpoweroff app");
@@ -15,7 +15,7 @@
 #include <sdeventplus/source/io.hpp>
 #include <sdeventplus/source/time.hpp>
 
-#include <array>
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 
@@ -37,9 +37,13 @@ pldm::pdr::TerminusID TID = 0;
 
 namespace sdbusRule = sdbusplus::bus::match::rules;
 
-SoftPowerOff::SoftPowerOff(sdbusplus::bus_t& bus, sd_event* event,
+SoftPowerOff::SoftPowerOff(sdbusplus::bus_t& bus, sdeventplus::Event& event,
                            pldm::InstanceIdDb& instanceIdDb) :
-    bus(bus), timer(event), instanceIdDb(instanceIdDb)
+    bus(bus), event(event), timer(event.get(), [this]() {
+        endPhase(phaseTimes.shutdown);
+        finish(PLDM_SUCCESS);
+    }),
+    instanceIdDb(instanceIdDb)
 {
     auto jsonData = parseConfig();
 
@@ -49,36 +53,143 @@ SoftPowerOff::SoftPowerOff(sdbusplus::bus_t& bus, sd_event* event,
         return;
     }
 
+    const std::vector<Json> emptyJsonList{};
+    auto configEntries = jsonData.value("entries", emptyJsonList);
+    for (const auto& entry : configEntries)
+    {
+        entries.emplace_back(SoftOffEntry{
+            entry.value("tid", pldm::pdr::TerminusID{}),
+            entry.value("entityType", pldm::pdr::EntityType{}),
+            entry.value("stateSetId", pldm::pdr::StateSetId{}),
+            {},
+            {}});
+    }
+}
+
+int SoftPowerOff::run()
+{
+    phaseStart = std::chrono::steady_clock::now();
+
+    // The PDR lookups are answered while the host state is read
+    auto rc = findSoftOffPDRs();
     getHostState();
     if (hasError || completed)
     {
-        return;
+        return PLDM_SUCCESS;
     }
-    const std::vector<Json> emptyJsonList{};
-    auto entries = jsonData.value("entries", emptyJsonList);
-    for (const auto& entry : entries)
+    if (rc != PLDM_SUCCESS)
+    {
+        hasError = true;
+        return PLDM_SUCCESS;
+    }
+
+    try
+    {
+        return event.loop();
+    }
+    catch (const sdeventplus::SdEventError& e)
+    {
+        error(
+            "Failed to process request while remote terminus soft off, error - {ERROR}",
+            "ERROR", e);
+        return PLDM_ERROR;
+    }
+}
+
+int SoftPowerOff::findSoftOffPDRs()
+{
+    if (entries.empty())
     {
-        TID = entry.value("tid", 0);
-        pldm::pdr::EntityType entityType = entry.value("entityType", 0);
-        pldm::pdr::StateSetId stateSetId = entry.value("stateSetId", 0);
+        error("No softoff entries in the softoff config JSON file");
+        return PLDM_ERROR;
+    }
 
-        bool effecterFound = getEffecterID(entityType, stateSetId);
-        if (effecterFound)
+    try
+    {
+        for (auto& entry : entries)
         {
-            auto rc = getSensorInfo(entityType, stateSetId);
-            if (rc != PLDM_SUCCESS)
+            findPDRs("FindStateEffecterPDR", entry, entry.effecterPDRs);
+            findPDRs("FindStateSensorPDR", entry, entry.sensorPDRs);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        error("Failed to look up softPowerOff PDRs, error - {ERROR}", "ERROR",
+              e);
+        pdrLookups.clear();
+        pendingLookups = 0;
+        return PLDM_ERROR;
+    }
+
+    return PLDM_SUCCESS;
+}
+
+void SoftPowerOff::findPDRs(const char* method, const SoftOffEntry& entry,
+                            std::vector<std::vector<uint8_t>>& pdrs)
+{
+    auto request = bus.new_method_call(
+        "xyz.openbmc_project.PLDM", "/xyz/openbmc_project/pldm",
+        "xyz.openbmc_project.PLDM.PDR", method);
+    request.append(entry.tid, entry.entityType, entry.stateSetId);
+    pdrLookups.emplace_back(bus.call_async(
+        request,
+        [this, method, &pdrs](sdbusplus::message_t reply) {
+            try
             {
-                error("Failed to get Sensor PDRs, response code '{RC}'", "RC",
-                      lg2::hex, rc);
-                hasError = true;
-                return;
+                if (reply.is_method_error())
+                {
+                    error("Failed to call {METHOD}, error - {ERROR}", "METHOD",
+                          method, "ERROR", reply.get_error()->message);
+                }
+                else
+                {
+                    reply.read(pdrs);
+                }
             }
-            break;
-        }
-        else
-        {
-            continue;
-        }
+            catch (const sdbusplus::exception_t& e)
+            {
+                error("Failed to read the {METHOD} reply, error - {ERROR}",
+                      "METHOD", method, "ERROR", e);
+            }
+
+            if (--pendingLookups == 0)
+            {
+                softOffPDRsFound();
+            }
+        },
+        dbusTimeout));
+    pendingLookups++;
+}
+
+void SoftPowerOff::softOffPDRsFound()
+{
+    // The entries are in their order of preference
+    auto entry = std::ranges::find_if(entries, [](const auto& entry) {
+        return !entry.effecterPDRs.empty();
+    });
+    if (entry == entries.end())
+    {
+        error("No softPowerOff effecter PDR has been found");
+        hasError = true;
+        finish(PLDM_ERROR);
+        return;
+    }
+
+    TID = entry->tid;
+    for (auto& rep : entry->effecterPDRs)
+    {
+        auto softoffPdr = new (rep.data()) pldm_state_effecter_pdr;
+        effecterID = softoffPdr->effecter_id;
+    }
+
+    auto rc = getSensorInfo(entry->sensorPDRs);
+    if (rc != PLDM_SUCCESS)
+    {
+        error("Failed to get Sensor PDRs, response code '{RC}'", "RC",
+              lg2::hex, rc);
+        hasError = true;
+        finish(PLDM_ERROR);
+        return;
     }
 
     // Matches on the pldm StateSensorEvent signal
@@ -89,6 +200,15 @@ SoftPowerOff::SoftPowerOff(sdbusplus::bus_t& bus, sd_event* event,
             sdbusRule::interface("xyz.openbmc_project.PLDM.Event"),
         std::bind(std::mem_fn(&SoftPowerOff::hostSoftOffComplete), this,
                   std::placeholders::_1));
+
+    endPhase(phaseTimes.discovery);
+
+    // Send the gracefully shutdown request to the host, the loop runs until
+    // the host gracefully shutdown
+    if (hostSoftOff() != PLDM_SUCCESS)
+    {
+        finish(PLDM_ERROR);
+    }
 }
 
 int SoftPowerOff::getHostState()
@@ -148,6 +268,8 @@ void SoftPowerOff::hostSoftOffComplete(sdbusplus::message_t& msg)
 
         // This marks the completion of pldm soft power off.
         completed = true;
+        endPhase(phaseTimes.shutdown);
+        finish(PLDM_SUCCESS);
     }
 }
 
@@ -168,120 +290,60 @@ Json SoftPowerOff::parseConfig()
     return Json::parse(jsonFile);
 }
 
-bool SoftPowerOff::getEffecterID(pldm::pdr::EntityType& entityType,
-                                 pldm::pdr::StateSetId& stateSetId)
+int SoftPowerOff::getSensorInfo(std::vector<std::vector<uint8_t>>& pdrs)
 {
-    auto& bus = pldm::utils::DBusHandler::getBus();
-    try
-    {
-        std::vector<std::vector<uint8_t>> response{};
-        auto method = bus.new_method_call(
-            "xyz.openbmc_project.PLDM", "/xyz/openbmc_project/pldm",
-            "xyz.openbmc_project.PLDM.PDR", "FindStateEffecterPDR");
-        method.append(TID, entityType, stateSetId);
-        auto responseMsg = bus.call(method, dbusTimeout);
-
-        responseMsg.read(response);
-        if (response.size())
-        {
-            for (auto& rep : response)
-            {
-                auto softoffPdr = new (rep.data()) pldm_state_effecter_pdr;
-                effecterID = softoffPdr->effecter_id;
-            }
-        }
-        else
-        {
-            return false;
-        }
-    }
-    catch (const sdbusplus::exception_t& e)
+    if (pdrs.size() == 0)
     {
-        error("Failed to get softPowerOff PDR, error - {ERROR}", "ERROR", e);
-        return false;
+        error("No sensor PDR has been found that matches the criteria");
+        return PLDM_ERROR;
     }
-    return true;
-}
 
-int SoftPowerOff::getSensorInfo(pldm::pdr::EntityType& entityType,
-                                pldm::pdr::StateSetId& stateSetId)
-{
-    try
+    pldm_state_sensor_pdr* pdr = nullptr;
+    for (auto& rep : pdrs)
     {
-        auto& bus = pldm::utils::DBusHandler::getBus();
-        std::vector<std::vector<uint8_t>> Response{};
-        auto method = bus.new_method_call(
-            "xyz.openbmc_project.PLDM", "/xyz/openbmc_project/pldm",
-            "xyz.openbmc_project.PLDM.PDR", "FindStateSensorPDR");
-        method.append(TID, entityType, stateSetId);
-
-        auto ResponseMsg = bus.call(method, dbusTimeout);
-
-        ResponseMsg.read(Response);
-
-        if (Response.size() == 0)
+        pdr = new (rep.data()) pldm_state_sensor_pdr;
+        if (!pdr)
         {
-            error("No sensor PDR has been found that matches the criteria");
+            error("Failed to get state sensor PDR.");
             return PLDM_ERROR;
         }
+    }
 
-        pldm_state_sensor_pdr* pdr = nullptr;
-        for (auto& rep : Response)
-        {
-            pdr = new (rep.data()) pldm_state_sensor_pdr;
-            if (!pdr)
-            {
-                error("Failed to get state sensor PDR.");
-                return PLDM_ERROR;
-            }
-        }
+    sensorID = pdr->sensor_id;
 
-        sensorID = pdr->sensor_id;
+    auto compositeSensorCount = pdr->composite_sensor_count;
+    auto possibleStatesStart = pdr->possible_states;
 
-        auto compositeSensorCount = pdr->composite_sensor_count;
-        auto possibleStatesStart = pdr->possible_states;
+    for (auto offset = 0; offset < compositeSensorCount; offset++)
+    {
+        auto possibleStates = new (possibleStatesStart)
+            state_sensor_possible_states;
+        auto setId = possibleStates->state_set_id;
+        auto possibleStateSize = possibleStates->possible_states_size;
 
-        for (auto offset = 0; offset < compositeSensorCount; offset++)
+        if (setId == PLDM_STATE_SET_SW_TERMINATION_STATUS)
         {
-            auto possibleStates = new (possibleStatesStart)
-                state_sensor_possible_states;
-            auto setId = possibleStates->state_set_id;
-            auto possibleStateSize = possibleStates->possible_states_size;
-
-            if (setId == PLDM_STATE_SET_SW_TERMINATION_STATUS)
-            {
-                sensorOffset = offset;
-                break;
-            }
-            possibleStatesStart +=
-                possibleStateSize + sizeof(setId) + sizeof(possibleStateSize);
+            sensorOffset = offset;
+            break;
         }
-    }
-    catch (const sdbusplus::exception_t& e)
-    {
-        error("Failed to get state sensor PDR during soft-off, error - {ERROR}",
-              "ERROR", e);
-        return PLDM_ERROR;
+        possibleStatesStart +=
+            possibleStateSize + sizeof(setId) + sizeof(possibleStateSize);
     }
 
     return PLDM_SUCCESS;
 }
 
-int SoftPowerOff::hostSoftOff(sdeventplus::Event& event)
+int SoftPowerOff::hostSoftOff()
 {
     constexpr uint8_t effecterCount = 1;
-    PldmTransport pldmTransport{};
-    uint8_t instanceID;
     uint8_t mctpEID;
 
     mctpEID = pldm::utils::readHostEID();
     // TODO: fix mapping to work around OpenBMC ecosystem deficiencies
-    pldm_tid_t pldmTID = static_cast<pldm_tid_t>(mctpEID);
+    pldmTID = static_cast<pldm_tid_t>(mctpEID);
 
-    std::array<uint8_t,
-               sizeof(pldm_msg_hdr) + sizeof(effecterID) +
-                   sizeof(effecterCount) + sizeof(set_effecter_state_field)>
-        requestMsg{};
+    requestMsg.resize(sizeof(pldm_msg_hdr) + sizeof(effecterID) +
+                      sizeof(effecterCount) + sizeof(set_effecter_state_field));
     auto request = new (requestMsg.data()) pldm_msg;
     set_effecter_state_field stateField{
         PLDM_REQUEST_SET, PLDM_SW_TERM_GRACEFUL_SHUTDOWN_REQUESTED};
@@ -298,126 +360,129 @@ int SoftPowerOff::hostSoftOff(sdeventplus::Event& event)
     }
 
     // Add a timer to the event loop, default 30s.
-    auto timerCallback = [=, this](Timer& /*source*/,
-                                   Timer::TimePoint /*time*/) mutable {
+    auto timerCallback = [this](Timer& /*source*/,
+                                Timer::TimePoint /*time*/) {
         if (!responseReceived)
         {
             instanceIdDb.free(pldmTID, instanceID);
             error(
                 "PLDM soft off failed, can't get the response for the PLDM request msg. Time out! Exit the pldm-softpoweroff");
-            exit(-1);
+            endPhase(phaseTimes.request);
+            finish(PLDM_ERROR);
         }
         return;
     };
-    Timer time(event, (Clock(event).now() + std::chrono::seconds{30}),
-               std::chrono::seconds{1}, std::move(timerCallback));
+    responseTimer = std::make_unique<Timer>(
+        event, (Clock(event).now() + std::chrono::seconds{30}),
+        std::chrono::seconds{1}, std::move(timerCallback));
 
     // Add a callback to handle EPOLLIN on fd
-    auto callback = [=, &pldmTransport,
-                     this](IO& io, int fd, uint32_t revents) mutable {
-        if (fd != pldmTransport.getEventSource())
-        {
-            return;
-        }
+    pldmTransport = std::make_unique<PldmTransport>();
+    responseIO = std::make_unique<IO>(
+        event, pldmTransport->getEventSource(), EPOLLIN,
+        [this](IO& io, int /*fd*/, uint32_t revents) {
+            processResponse(io, revents);
+        });
 
-        if (!(revents & EPOLLIN))
-        {
-            return;
-        }
+    // Asynchronously send the PLDM request
+    rc = pldmTransport->sendMsg(pldmTID, requestMsg.data(),
+                                requestMsg.size());
+    if (0 > rc)
+    {
+        instanceIdDb.free(pldmTID, instanceID);
+        error(
+            "Failed to send message/receive response, response code '{RC}' and error - {ERROR}",
+            "RC", rc, "ERROR", errno);
+        return PLDM_ERROR;
+    }
 
-        void* responseMsg = nullptr;
-        size_t responseMsgSize{};
-        pldm_tid_t srcTID = pldmTID;
+    return PLDM_SUCCESS;
+}
 
-        auto rc = pldmTransport.recvMsg(pldmTID, responseMsg, responseMsgSize);
-        if (rc)
-        {
-            error(
-                "Failed to receive pldm data during soft-off, response code '{RC}'",
-                "RC", rc);
-            return;
-        }
+void SoftPowerOff::processResponse(IO& io, uint32_t revents)
+{
+    if (!(revents & EPOLLIN))
+    {
+        return;
+    }
 
-        std::unique_ptr<void, decltype(std::free)*> responseMsgPtr{
-            responseMsg, std::free};
+    void* responseMsg = nullptr;
+    size_t responseMsgSize{};
+    pldm_tid_t srcTID = pldmTID;
 
-        // We've got the response meant for the PLDM request msg that was
-        // sent out
-        io.set_enabled(Enabled::Off);
-        auto response = new (responseMsgPtr.get()) pldm_msg;
+    auto rc = pldmTransport->recvMsg(srcTID, responseMsg, responseMsgSize);
+    if (rc)
+    {
+        error(
+            "Failed to receive pldm data during soft-off, response code '{RC}'",
+            "RC", rc);
+        return;
+    }
 
-        if (srcTID != pldmTID ||
-            !pldm_msg_hdr_correlate_response(&request->hdr, &response->hdr))
-        {
-            /* This isn't the response we were looking for */
-            return;
-        }
+    std::unique_ptr<void, decltype(std::free)*> responseMsgPtr{responseMsg,
+                                                               std::free};
 
-        /* We have the right response, release the instance ID and process */
-        io.set_enabled(Enabled::Off);
-        instanceIdDb.free(pldmTID, instanceID);
+    auto request = new (requestMsg.data()) pldm_msg;
+    auto response = new (responseMsgPtr.get()) pldm_msg;
+    if (srcTID != pldmTID ||
+        !pldm_msg_hdr_correlate_response(&request->hdr, &response->hdr))
+    {
+        /* This isn't the response we were looking for */
+        return;
+    }
 
-        if (response->payload[0] != PLDM_SUCCESS)
-        {
-            error("Getting the wrong response, response code '{RC}'", "RC",
-                  response->payload[0]);
-            exit(-1);
-        }
+    /* We have the right response, release the instance ID and process */
+    io.set_enabled(Enabled::Off);
+    instanceIdDb.free(pldmTID, instanceID);
 
-        responseReceived = true;
+    if (response->payload[0] != PLDM_SUCCESS)
+    {
+        error("Getting the wrong response, response code '{RC}'", "RC",
+              response->payload[0]);
+        finish(PLDM_ERROR);
+        return;
+    }
 
-        // Start Timer
-        using namespace std::chrono;
-        auto timeMicroseconds =
-            duration_cast<microseconds>(seconds(SOFTOFF_TIMEOUT_SECONDS));
+    responseReceived = true;
+    endPhase(phaseTimes.request);
 
-        auto ret = startTimer(timeMicroseconds);
-        if (ret < 0)
-        {
-            error(
-                "Failure to start remote terminus soft off wait timer, Exit the pldm-softpoweroff with response code:{NUM}",
-                "NUM", ret);
-            exit(-1);
-        }
-        else
-        {
-            error(
-                "Timer started waiting for remote terminus soft off, timeout in sec '{TIMEOUT_SEC}'",
-                "TIMEOUT_SEC", SOFTOFF_TIMEOUT_SECONDS);
-        }
-        return;
-    };
-    IO io(event, pldmTransport.getEventSource(), EPOLLIN, std::move(callback));
+    // Start Timer
+    using namespace std::chrono;
+    auto timeMicroseconds =
+        duration_cast<microseconds>(seconds(SOFTOFF_TIMEOUT_SECONDS));
 
-    // Asynchronously send the PLDM request
-    rc = pldmTransport.sendMsg(pldmTID, requestMsg.data(), requestMsg.size());
-    if (0 > rc)
+    auto ret = startTimer(timeMicroseconds);
+    if (ret < 0)
     {
-        instanceIdDb.free(pldmTID, instanceID);
         error(
-            "Failed to send message/receive response, response code '{RC}' and error - {ERROR}",
-            "RC", rc, "ERROR", errno);
-        return PLDM_ERROR;
+            "Failure to start remote terminus soft off wait timer, Exit the pldm-softpoweroff with response code:{NUM}",
+            "NUM", ret);
+        finish(PLDM_ERROR);
     }
-
-    // Time out or soft off complete
-    while (!isCompleted() && !isTimerExpired())
+    else
     {
-        try
-        {
-            event.run(std::nullopt);
-        }
-        catch (const sdeventplus::SdEventError& e)
-        {
-            instanceIdDb.free(pldmTID, instanceID);
-            error(
-                "Failed to process request while remote terminus soft off, error - {ERROR}",
-                "ERROR", e);
-            return PLDM_ERROR;
-        }
+        error(
+            "Timer started waiting for remote terminus soft off, timeout in sec '{TIMEOUT_SEC}'",
+            "TIMEOUT_SEC", SOFTOFF_TIMEOUT_SECONDS);
     }
+}
 
-    return PLDM_SUCCESS;
+void SoftPowerOff::endPhase(std::chrono::milliseconds& phase)
+{
+    auto now = std::chrono::steady_clock::now();
+    phase =
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - phaseStart);
+    phaseStart = now;
+}
+
+void SoftPowerOff::finish(int rc)
+{
+    info(
+        "Soft off took {DISCOVERY_MS} ms to discover the PDRs, {REQUEST_MS} ms for the request and {SHUTDOWN_MS} ms for the host shutdown",
+        "DISCOVERY_MS", phaseTimes.discovery.count(), "REQUEST_MS",
+        phaseTimes.request.count(), "SHUTDOWN_MS",
+        phaseTimes.shutdown.count());
+    event.exit(rc);
 }
 
 int SoftPowerOff::startTimer(const std::chrono::microseconds& usec)
@@ -9,7 +9,14 @@
 #include <sdbusplus/server.hpp>
 #include <sdbusplus/server/object.hpp>
 #include <sdbusplus/timer.hpp>
+#include <sdeventplus/clock.hpp>
 #include <sdeventplus/event.hpp>
+#include <sdeventplus/source/io.hpp>
+#include <sdeventplus/source/time.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
 
 namespace pldm
 {
@@ -17,17 +24,33 @@ using Json = nlohmann::json;
 
 /** @class SoftPowerOff
  *  @brief Responsible for coordinating Host SoftPowerOff operation
+ *
+ *  The soft off runs from the event loop: the effecter and sensor PDRs of
+ *  all the configured entries are looked up with concurrent D-Bus calls,
+ *  the graceful shutdown request is sent once they are known and the loop
+ *  exits when the host reports the shutdown completion or a timer expires.
  */
 class SoftPowerOff
 {
   public:
+    /** @brief Time spent in each phase of the soft off */
+    struct PhaseTimes
+    {
+        /** @brief Host state and PDR lookup */
+        std::chrono::milliseconds discovery{};
+        /** @brief From sending the request to its response */
+        std::chrono::milliseconds request{};
+        /** @brief From the response to the shutdown completion */
+        std::chrono::milliseconds shutdown{};
+    };
+
     /** @brief Constructs SoftPowerOff object.
      *
      *  @param[in] bus       - system D-Bus handler
      *  @param[in] event     - sd_event handler
      *  @param[in] instanceDb - pldm instance database
      */
-    SoftPowerOff(sdbusplus::bus_t& bus, sd_event* event,
+    SoftPowerOff(sdbusplus::bus_t& bus, sdeventplus::Event& event,
                  InstanceIdDb& instanceIdDb);
 
     /** @brief Is the pldm-softpoweroff has error.
@@ -60,16 +83,33 @@ class SoftPowerOff
         return responseReceived;
     }
 
-    /** @brief Send PLDM Set State Effecter States command and
-     * wait the host gracefully shutdown.
-     *
-     *  @param[in] event - The event loop.
+    /** @brief Get the time spent in each phase of the soft off
+     */
+    inline const PhaseTimes& getPhaseTimes() const
+    {
+        return phaseTimes;
+    }
+
+    /** @brief Look up the softoff PDRs, send PLDM Set State Effecter States
+     *  command and wait the host gracefully shutdown.
      *
-     *  @return PLDM_SUCCESS or PLDM_ERROR.
+     *  @return PLDM_SUCCESS or PLDM_ERROR if the request failed.
      */
-    int hostSoftOff(sdeventplus::Event& event);
+    int run();
 
   private:
+    /** @brief A softoff effecter candidate from the config Json file and
+     *         the PDRs found for it.
+     */
+    struct SoftOffEntry
+    {
+        pldm::pdr::TerminusID tid;
+        pldm::pdr::EntityType entityType;
+        pldm::pdr::StateSetId stateSetId;
+        std::vector<std::vector<uint8_t>> effecterPDRs;
+        std::vector<std::vector<uint8_t>> sensorPDRs;
+    };
+
     /** @brief Getting the host current state.
      */
     int getHostState();
@@ -102,39 +142,74 @@ class SoftPowerOff
      */
     int startTimer(const std::chrono::microseconds& usec);
 
-    /** @brief Get effecterID from PDRs.
+    /** @brief Start the PDR lookups of all the softoff entries, the lookups
+     *         run concurrently and softOffPDRsFound() is called once all of
+     *         them have replied.
      *
-     *  @param[in] entityType - entity type of the entity hosting
-     *                              hosting softoff PDR
-     *  @param[in] stateSetId - state set ID of the softoff PDR
+     *  @return PLDM_SUCCESS or PLDM_ERROR if a lookup could not be started
+     */
+    int findSoftOffPDRs();
+
+    /** @brief Start an asynchronous PDR lookup on the pldm D-Bus PDR
+     *         interface.
      *
-     *  @return true or false
+     *  @param[in] method - FindStateEffecterPDR or FindStateSensorPDR
+     *  @param[in] entry - softoff entry to look up
+     *  @param[out] pdrs - PDRs from the reply
+     */
+    void findPDRs(const char* method, const SoftOffEntry& entry,
+                  std::vector<std::vector<uint8_t>>& pdrs);
+
+    /** @brief Pick the first configured entry having a softoff effecter and
+     *         send the soft off request.
      */
-    bool getEffecterID(pldm::pdr::EntityType& entityType,
-                       pldm::pdr::StateSetId& stateSetId);
+    void softOffPDRsFound();
 
     /** @brief Get VMM/SystemFirmware Sensor info from PDRs.
      *
-     *  @param[in] entityType - entity type of the entity hosting
-     *                              hosting softoff PDR
-     *  @param[in] stateSetId - state set ID of the softoff PDR
+     *  @param[in] pdrs - state sensor PDRs of the softoff entry
      *
      *  @return PLDM_SUCCESS or PLDM_ERROR
      */
-    int getSensorInfo(pldm::pdr::EntityType& entityType,
-                      pldm::pdr::StateSetId& stateSetId);
+    int getSensorInfo(std::vector<std::vector<uint8_t>>& pdrs);
+
+    /** @brief Send PLDM Set State Effecter States command, the response is
+     *         handled from the event loop.
+     *
+     *  @return PLDM_SUCCESS or PLDM_ERROR.
+     */
+    int hostSoftOff();
+
+    /** @brief Handle the response to the soft off request.
+     *
+     *  @param[in] io - the transport event source
+     *  @param[in] revents - the received events
+     */
+    void processResponse(sdeventplus::source::IO& io, uint32_t revents);
+
+    /** @brief End the current phase of the soft off.
+     *
+     *  @param[out] phase - time spent in the phase
+     */
+    void endPhase(std::chrono::milliseconds& phase);
+
+    /** @brief Stop the event loop and log the time spent in each phase.
+     *
+     *  @param[in] rc - exit code of the event loop
+     */
+    void finish(int rc);
 
     /** @brief effecterID
      */
-    uint16_t effecterID;
+    uint16_t effecterID = 0;
 
     /** @brief sensorID.
      */
-    pldm::pdr::SensorID sensorID;
+    pldm::pdr::SensorID sensorID = 0;
 
     /** @brief sensorOffset.
      */
-    pldm::pdr::SensorOffset sensorOffset;
+    pldm::pdr::SensorOffset sensorOffset = 0;
 
     /** @brief Failed to send host soft off command flag.
      */
@@ -151,6 +226,9 @@ class SoftPowerOff
     /* @brief sdbusplus handle */
     sdbusplus::bus_t& bus;
 
+    /** @brief The event loop the soft off runs from */
+    sdeventplus::Event event;
+
     /** @brief Reference to Timer object */
     sdbusplus::Timer timer;
 
@@ -163,6 +241,41 @@ class SoftPowerOff
     /** @brief Reference to the instance database
      */
     InstanceIdDb& instanceIdDb;
+
+    /** @brief The softoff entries of the config Json file, in their order
+     *         of preference
+     */
+    std::vector<SoftOffEntry> entries;
+
+    /** @brief The outstanding PDR lookups */
+    std::vector<sdbusplus::slot_t> pdrLookups;
+
+    /** @brief Number of PDR lookups not replied yet */
+    size_t pendingLookups = 0;
+
+    /** @brief Transport of the soft off request */
+    std::unique_ptr<PldmTransport> pldmTransport;
+
+    /** @brief Event source of the soft off response */
+    std::unique_ptr<sdeventplus::source::IO> responseIO;
+
+    /** @brief Timeout of the soft off response */
+    std::unique_ptr<
+        sdeventplus::source::Time<sdeventplus::ClockId::RealTime>>
+        responseTimer;
+
+    /** @brief The soft off request */
+    std::vector<uint8_t> requestMsg;
+
+    /** @brief TID and instance ID of the soft off request */
+    pldm_tid_t pldmTID = 0;
+    uint8_t instanceID = 0;
+
+    /** @brief Start time of the current phase */
+    std::chrono::steady_clock::time_point phaseStart;
+
+    /** @brief Time spent in each phase */
+    PhaseTimes phaseTimes{};
 };
 
 } // namespace pldm
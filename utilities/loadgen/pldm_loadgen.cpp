@@ -0,0 +1,474 @@
+#include "common/transport.hpp"
+#include "simulated_terminus.hpp"
+
+#include <libpldm/base.h>
+
+#include <CLI/CLI.hpp>
+#include <phosphor-logging/lg2.hpp>
+#include <sdeventplus/clock.hpp>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/io.hpp>
+#include <sdeventplus/utility/timer.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace sdeventplus;
+using namespace sdeventplus::source;
+using namespace pldm::loadgen;
+PHOSPHOR_LOG2_USING;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+using Timer = sdeventplus::utility::Timer<ClockId::Monotonic>;
+
+/** @brief The EID of pldmd on the loopback transport */
+constexpr pldm_tid_t pldmdEid = 8;
+
+/** @brief The time an event is waited for a response before it is counted
+ *         as timed out
+ */
+constexpr auto eventResponseTimeout = std::chrono::seconds(5);
+
+/** @brief The model of the link between pldmd and the simulated termini */
+struct LinkModel
+{
+    std::chrono::microseconds latency{0};
+    std::chrono::microseconds jitter{0};
+    double loss = 0;
+    /* Bytes per second of each endpoint, 0 is unlimited */
+    uint64_t bandwidth = 0;
+};
+
+/** @brief A simulated terminus bound on the loopback transport */
+struct Endpoint
+{
+    Endpoint(const std::filesystem::path& dir, uint8_t eid,
+             const TerminusSpec& spec) :
+        transport(dir, eid), terminus(eid, spec)
+    {}
+
+    LoopbackTransport transport;
+    SimulatedTerminus terminus;
+    std::unique_ptr<IO> io;
+
+    /* The time the link of the endpoint is free to send the next message */
+    Clock::time_point linkFree{};
+
+    /* The events sent to pldmd waiting for a response, by instance ID */
+    std::map<uint8_t, Clock::time_point> pendingEvents;
+    uint8_t nextInstanceId = 0;
+    uint16_t nextEventSensor = 0;
+    double eventCredit = 0;
+};
+
+/** @brief A message crossing the link, sent when its delivery time is up */
+struct Delivery
+{
+    Clock::time_point time;
+    uint64_t seq;
+    size_t endpoint;
+    /* true for a message from pldmd to the endpoint, false for a message from
+     * the endpoint to pldmd */
+    bool inbound;
+    std::vector<uint8_t> msg;
+
+    bool operator>(const Delivery& other) const
+    {
+        return std::tie(time, seq) > std::tie(other.time, other.seq);
+    }
+};
+
+/** @brief The counters of a report interval */
+struct Stats
+{
+    uint64_t requests = 0;
+    uint64_t sensorReadings = 0;
+    uint64_t eventsSent = 0;
+    uint64_t eventsAnswered = 0;
+    uint64_t eventTimeouts = 0;
+    uint64_t dropped = 0;
+    std::vector<uint32_t> eventRtts;
+};
+
+class LoadGenerator
+{
+  public:
+    LoadGenerator(Event& event, const std::filesystem::path& dir,
+                  uint8_t firstEid, size_t terminiCount,
+                  const TerminusSpec& spec, const LinkModel& link,
+                  double eventRate, std::chrono::seconds reportInterval,
+                  unsigned seed) :
+        link(link), eventRate(eventRate), random(seed),
+        deliveryTimer(event, [this](Timer&) { deliver(); }, std::nullopt,
+                      std::chrono::microseconds(1)),
+        eventTimer(event, [this](Timer&) { sendEvents(); },
+                   std::chrono::milliseconds(10)),
+        reportTimer(event, [this](Timer&) { report(); }, reportInterval)
+    {
+        endpoints.reserve(terminiCount);
+        for (size_t i = 0; i < terminiCount; ++i)
+        {
+            auto& endpoint = endpoints.emplace_back(std::make_unique<Endpoint>(
+                dir, firstEid + i, spec));
+            endpoint->io = std::make_unique<IO>(
+                event, endpoint->transport.getEventSource(), EPOLLIN,
+                [this, i](IO&, int, uint32_t revents) {
+                    if (revents & EPOLLIN)
+                    {
+                        receive(i);
+                    }
+                });
+        }
+        deliveryTimer.setEnabled(false);
+        eventTimer.setEnabled(eventRate > 0);
+        lastReport = Clock::now();
+        lastEvents = lastReport;
+    }
+
+  private:
+    /** @brief Receive the messages of pldmd to an endpoint */
+    void receive(size_t index)
+    {
+        auto& endpoint = *endpoints[index];
+        pldm_tid_t tid = 0;
+        void* rx = nullptr;
+        size_t len = 0;
+        while (endpoint.transport.recvMsg(tid, rx, len) ==
+               PLDM_REQUESTER_SUCCESS)
+        {
+            auto msg = static_cast<const uint8_t*>(rx);
+            if (tid == pldmdEid)
+            {
+                schedule(index, true, std::vector<uint8_t>(msg, msg + len));
+            }
+            free(rx);
+            rx = nullptr;
+        }
+    }
+
+    /** @brief Queue a message on the link of an endpoint
+     *
+     *  The message is lost with the loss probability of the link, otherwise
+     *  it is delivered after the latency and the jitter of the link, once the
+     *  link carried the messages before it at the link bandwidth. As on an
+     *  SMBus link, both directions share the bandwidth.
+     */
+    void schedule(size_t index, bool inbound, std::vector<uint8_t>&& msg)
+    {
+        if (link.loss > 0 && lossDistribution(random) < link.loss)
+        {
+            stats.dropped++;
+            return;
+        }
+
+        auto now = Clock::now();
+        auto delay = link.latency;
+        if (link.jitter.count())
+        {
+            std::uniform_int_distribution<int64_t> jitter(
+                -link.jitter.count(), link.jitter.count());
+            delay = std::max(delay + std::chrono::microseconds(jitter(random)),
+                             std::chrono::microseconds(0));
+        }
+
+        auto time = now + delay;
+        if (link.bandwidth)
+        {
+            auto& endpoint = *endpoints[index];
+            auto start = std::max(now, endpoint.linkFree);
+            endpoint.linkFree =
+                start + std::chrono::microseconds(msg.size() * 1000000 /
+                                                  link.bandwidth);
+            time = endpoint.linkFree + delay;
+        }
+
+        deliveries.push_back({time, nextSeq++, index, inbound, std::move(msg)});
+        std::ranges::push_heap(deliveries, std::greater<>{});
+        armDeliveryTimer();
+    }
+
+    void armDeliveryTimer()
+    {
+        if (deliveries.empty())
+        {
+            deliveryTimer.setEnabled(false);
+            return;
+        }
+        auto remaining = deliveries.front().time - Clock::now();
+        deliveryTimer.restartOnce(std::max(
+            std::chrono::duration_cast<Timer::Duration>(remaining),
+            Timer::Duration(0)));
+    }
+
+    /** @brief Deliver the messages whose delivery time is up */
+    void deliver()
+    {
+        auto now = Clock::now();
+        while (!deliveries.empty() && deliveries.front().time <= now)
+        {
+            std::ranges::pop_heap(deliveries, std::greater<>{});
+            auto delivery = std::move(deliveries.back());
+            deliveries.pop_back();
+            if (delivery.inbound)
+            {
+                handleMessage(delivery.endpoint, delivery.msg);
+            }
+            else
+            {
+                auto& endpoint = *endpoints[delivery.endpoint];
+                auto rc = endpoint.transport.sendMsg(
+                    pldmdEid, delivery.msg.data(), delivery.msg.size());
+                if (rc != PLDM_REQUESTER_SUCCESS)
+                {
+                    stats.dropped++;
+                }
+            }
+        }
+        armDeliveryTimer();
+    }
+
+    /** @brief Handle a message from pldmd delivered to an endpoint */
+    void handleMessage(size_t index, const std::vector<uint8_t>& msg)
+    {
+        if (msg.size() < sizeof(pldm_msg_hdr))
+        {
+            return;
+        }
+        auto& endpoint = *endpoints[index];
+        auto pldmMsg = reinterpret_cast<const pldm_msg*>(msg.data());
+
+        if (!pldmMsg->hdr.request)
+        {
+            auto it = endpoint.pendingEvents.find(pldmMsg->hdr.instance_id);
+            if (it != endpoint.pendingEvents.end())
+            {
+                auto rtt = std::chrono::duration_cast<std::chrono::microseconds>(
+                    Clock::now() - it->second);
+                stats.eventRtts.push_back(rtt.count());
+                stats.eventsAnswered++;
+                endpoint.pendingEvents.erase(it);
+            }
+            return;
+        }
+
+        stats.requests++;
+        auto readings = endpoint.terminus.getCounters().sensorReadings;
+        auto response = endpoint.terminus.handleRequest(pldmMsg, msg.size());
+        stats.sensorReadings +=
+            endpoint.terminus.getCounters().sensorReadings - readings;
+        if (response)
+        {
+            schedule(index, false, std::move(*response));
+        }
+    }
+
+    /** @brief Send the numericSensorState events due at the event rate */
+    void sendEvents()
+    {
+        auto now = Clock::now();
+        std::chrono::duration<double> elapsed = now - lastEvents;
+        lastEvents = now;
+
+        for (size_t i = 0; i < endpoints.size(); ++i)
+        {
+            auto& endpoint = *endpoints[i];
+            std::erase_if(endpoint.pendingEvents, [this, now](const auto& e) {
+                if (now - e.second < eventResponseTimeout)
+                {
+                    return false;
+                }
+                stats.eventTimeouts++;
+                return true;
+            });
+
+            // Events are only sent once pldmd assigned the terminus TID
+            auto sensorCount = endpoint.terminus.getSensorCount();
+            if (endpoint.terminus.getTid() == PLDM_TID_UNASSIGNED ||
+                !sensorCount)
+            {
+                continue;
+            }
+
+            endpoint.eventCredit += eventRate * elapsed.count();
+            while (endpoint.eventCredit >= 1)
+            {
+                endpoint.eventCredit -= 1;
+                auto instanceId = endpoint.nextInstanceId;
+                endpoint.nextInstanceId = (instanceId + 1) % 32;
+                if (endpoint.pendingEvents.contains(instanceId))
+                {
+                    // The instance ID is still in use, skip the event
+                    continue;
+                }
+
+                auto msg = endpoint.terminus.encodeSensorEvent(
+                    instanceId, endpoint.nextEventSensor);
+                endpoint.nextEventSensor =
+                    (endpoint.nextEventSensor + 1) % sensorCount;
+                endpoint.pendingEvents[instanceId] = now;
+                stats.eventsSent++;
+                schedule(i, false, std::move(msg));
+            }
+        }
+    }
+
+    /** @brief Print the counters of the report interval */
+    void report()
+    {
+        auto now = Clock::now();
+        std::chrono::duration<double> interval = now - lastReport;
+        lastReport = now;
+
+        size_t sensors = 0;
+        size_t discovered = 0;
+        for (const auto& endpoint : endpoints)
+        {
+            sensors += endpoint->terminus.getSensorCount();
+            if (endpoint->terminus.getTid() != PLDM_TID_UNASSIGNED)
+            {
+                discovered++;
+            }
+        }
+
+        auto seconds = interval.count();
+        auto readingRate = stats.sensorReadings / seconds;
+        std::cout << "termini " << discovered << "/" << endpoints.size()
+                  << " requests/s " << stats.requests / seconds
+                  << " readings/s " << readingRate;
+        if (readingRate > 0)
+        {
+            // The mean time between two readings of a sensor
+            std::cout << " refresh-ms " << sensors * 1000 / readingRate;
+        }
+        std::cout << " events/s " << stats.eventsSent / seconds
+                  << " answered " << stats.eventsAnswered << " timeouts "
+                  << stats.eventTimeouts << " dropped " << stats.dropped;
+
+        auto& rtts = stats.eventRtts;
+        if (!rtts.empty())
+        {
+            auto percentile = [&rtts](double p) {
+                auto nth = rtts.begin() + static_cast<size_t>(
+                                              p * (rtts.size() - 1));
+                std::nth_element(rtts.begin(), nth, rtts.end());
+                return *nth;
+            };
+            std::cout << " event-rtt-us p50 " << percentile(0.5) << " p99 "
+                      << percentile(0.99) << " max "
+                      << *std::max_element(rtts.begin(), rtts.end());
+        }
+        std::cout << std::endl;
+
+        stats = Stats{};
+    }
+
+    LinkModel link;
+    double eventRate;
+    std::mt19937 random;
+    std::uniform_real_distribution<double> lossDistribution{0, 1};
+
+    std::vector<std::unique_ptr<Endpoint>> endpoints;
+    /* The messages crossing the links, a min heap of their delivery time */
+    std::vector<Delivery> deliveries;
+    uint64_t nextSeq = 0;
+
+    Timer deliveryTimer;
+    Timer eventTimer;
+    Timer reportTimer;
+    Clock::time_point lastReport;
+    Clock::time_point lastEvents;
+    Stats stats;
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    CLI::App app{
+        "Serve simulated PLDM termini to pldmd on the loopback transport"};
+    std::string dir{};
+    app.add_option("-d,--dir", dir,
+                   "Loopback transport directory, as given to pldmd --loopback")
+        ->required();
+    size_t termini = 1;
+    app.add_option("-t,--termini", termini, "Number of simulated termini")
+        ->check(CLI::Range(1, 246));
+    std::string spec{};
+    app.add_option("-s,--spec", spec,
+                   "Spec of each terminus, as key=value pairs among name, "
+                   "sensors, interval, fru, readings and events");
+    uint8_t firstEid = 9;
+    app.add_option("-e,--first-eid", firstEid, "EID of the first terminus")
+        ->check(CLI::Range(9, 254));
+    int64_t latency = 0;
+    app.add_option("--latency-us", latency,
+                   "One way latency of the link in microseconds")
+        ->check(CLI::NonNegativeNumber);
+    int64_t jitter = 0;
+    app.add_option("--jitter-us", jitter,
+                   "Maximum jitter of the link latency in microseconds")
+        ->check(CLI::NonNegativeNumber);
+    double loss = 0;
+    app.add_option("--loss", loss, "Probability a message is lost")
+        ->check(CLI::Range(0.0, 1.0));
+    uint64_t bandwidth = 0;
+    app.add_option("--bandwidth", bandwidth,
+                   "Bytes per second of the link of each terminus, 0 is "
+                   "unlimited");
+    double eventRate = 0;
+    app.add_option("--event-rate", eventRate,
+                   "Sensor events per second sent by each terminus")
+        ->check(CLI::NonNegativeNumber);
+    unsigned reportInterval = 10;
+    app.add_option("-r,--report-interval", reportInterval,
+                   "Report interval in seconds")
+        ->check(CLI::Range(1u, 3600u));
+    unsigned seed = 1;
+    app.add_option("--seed", seed, "Seed of the link loss and jitter");
+    CLI11_PARSE(app, argc, argv);
+
+    if (firstEid + termini - 1 > 254)
+    {
+        error("The EIDs of the termini exceed 254");
+        return EXIT_FAILURE;
+    }
+
+    auto terminusSpec = parseTerminusSpec(spec);
+    if (!terminusSpec)
+    {
+        error("Invalid terminus spec '{SPEC}'", "SPEC", spec);
+        return EXIT_FAILURE;
+    }
+
+    LinkModel link{std::chrono::microseconds(latency),
+                   std::chrono::microseconds(jitter), loss, bandwidth};
+
+    auto event = Event::get_default();
+    try
+    {
+        LoadGenerator loadGenerator(
+            event, dir, firstEid, termini, *terminusSpec, link, eventRate,
+            std::chrono::seconds(reportInterval), seed);
+        info("Serving {COUNT} simulated termini in '{DIR}'", "COUNT", termini,
+             "DIR", dir);
+        return event.loop();
+    }
+    catch (const std::exception& e)
+    {
+        error("Failed to serve the simulated termini, error - {ERROR}",
+              "ERROR", e);
+        return EXIT_FAILURE;
+    }
+}
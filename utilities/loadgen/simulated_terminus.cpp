@@ -0,0 +1,809 @@
+#include "simulated_terminus.hpp"
+
+#include <libpldm/entity.h>
+#include <libpldm/fru.h>
+#include <libpldm/platform.h>
+#include <libpldm/utils.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <ranges>
+#include <string_view>
+
+namespace pldm
+{
+namespace loadgen
+{
+
+namespace
+{
+
+constexpr uint16_t minReading = 20;
+constexpr uint16_t maxReading = 80;
+
+/** @brief The size of the parts of the FRU record table, below the receive
+ *         buffer of platform-mc
+ */
+constexpr size_t fruTablePartSize = 512;
+
+/** @brief Parse a number of a terminus spec */
+template <typename T>
+bool parseNumber(std::string_view value, T& number)
+{
+    auto end = value.data() + value.size();
+    auto [ptr, ec] = std::from_chars(value.data(), end, number);
+    return ec == std::errc() && ptr == end;
+}
+
+void appendLE(std::vector<uint8_t>& data, uint32_t value, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        data.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void appendFloat(std::vector<uint8_t>& data, float value)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    appendLE(data, bits, sizeof(bits));
+}
+
+/** @brief Start a PDR with its common header, the data length is set by
+ *         finishPdr()
+ */
+std::vector<uint8_t> startPdr(uint32_t recordHandle, uint8_t type)
+{
+    std::vector<uint8_t> pdr;
+    appendLE(pdr, recordHandle, sizeof(uint32_t));
+    pdr.push_back(1); // PDRHeaderVersion
+    pdr.push_back(type);
+    appendLE(pdr, 0, sizeof(uint16_t)); // recordChangeNumber
+    appendLE(pdr, 0, sizeof(uint16_t)); // dataLength
+    return pdr;
+}
+
+void finishPdr(std::vector<uint8_t>& pdr)
+{
+    auto dataLength = pdr.size() - sizeof(pldm_pdr_hdr);
+    pdr[8] = static_cast<uint8_t>(dataLength);
+    pdr[9] = static_cast<uint8_t>(dataLength >> 8);
+}
+
+/** @brief The Entity Auxiliary Names PDR of the overall system container,
+ *         naming the terminus
+ */
+std::vector<uint8_t> makeTerminusNamePdr(uint32_t recordHandle,
+                                         std::string_view name)
+{
+    auto pdr = startPdr(recordHandle, PLDM_ENTITY_AUXILIARY_NAMES_PDR);
+    appendLE(pdr, PLDM_ENTITY_SYSTEM_CHASSIS, sizeof(uint16_t));
+    appendLE(pdr, 1, sizeof(uint16_t)); // entityInstanceNumber
+    appendLE(pdr, PLDM_PLATFORM_ENTITY_SYSTEM_CONTAINER_ID, sizeof(uint16_t));
+    pdr.push_back(0); // sharedNameCount
+    pdr.push_back(1); // nameStringCount
+    for (auto c : std::string_view("en"))
+    {
+        pdr.push_back(c);
+    }
+    pdr.push_back(0);
+    // The names are UTF-16BE
+    for (auto c : name)
+    {
+        pdr.push_back(0);
+        pdr.push_back(c);
+    }
+    pdr.push_back(0);
+    pdr.push_back(0);
+    finishPdr(pdr);
+    return pdr;
+}
+
+/** @brief A UINT16 temperature Numeric Sensor PDR */
+std::vector<uint8_t> makeNumericSensorPdr(uint32_t recordHandle,
+                                          uint16_t sensorId,
+                                          float updateInterval)
+{
+    auto pdr = startPdr(recordHandle, PLDM_NUMERIC_SENSOR_PDR);
+    appendLE(pdr, 0, sizeof(uint16_t)); // PLDMTerminusHandle
+    appendLE(pdr, sensorId, sizeof(uint16_t));
+    appendLE(pdr, PLDM_ENTITY_SYSTEM_CHASSIS, sizeof(uint16_t));
+    appendLE(pdr, sensorId, sizeof(uint16_t)); // entityInstanceNumber
+    appendLE(pdr, 1, sizeof(uint16_t));        // containerID
+    pdr.push_back(PLDM_NO_INIT);               // sensorInit
+    pdr.push_back(false);                      // sensorAuxiliaryNamesPDR
+    pdr.push_back(PLDM_SENSOR_UNIT_DEGRESS_C); // baseUnit
+    pdr.push_back(0);                          // unitModifier
+    pdr.push_back(0);                          // rateUnit
+    pdr.push_back(0);                          // baseOEMUnitHandle
+    pdr.push_back(0);                          // auxUnit
+    pdr.push_back(0);                          // auxUnitModifier
+    pdr.push_back(0);                          // auxRateUnit
+    pdr.push_back(0);                          // rel
+    pdr.push_back(0);                          // auxOEMUnitHandle
+    pdr.push_back(true);                       // isLinear
+    pdr.push_back(PLDM_SENSOR_DATA_SIZE_UINT16);
+    appendFloat(pdr, 1.0);                     // resolution
+    appendFloat(pdr, 0.0);                     // offset
+    appendLE(pdr, 0, sizeof(uint16_t));        // accuracy
+    pdr.push_back(0);                          // plusTolerance
+    pdr.push_back(0);                          // minusTolerance
+    appendLE(pdr, 0, sizeof(uint16_t));        // hysteresis
+    pdr.push_back(0);                          // supportedThresholds
+    pdr.push_back(0);                          // volatility
+    appendFloat(pdr, 1.0);                     // stateTransitionInterval
+    appendFloat(pdr, updateInterval);          // updateInterval
+    appendLE(pdr, maxReading, sizeof(uint16_t)); // maxReadable
+    appendLE(pdr, minReading, sizeof(uint16_t)); // minReadable
+    pdr.push_back(PLDM_RANGE_FIELD_FORMAT_UINT8);
+    pdr.push_back(0); // rangeFieldSupport
+    // nominalValue, normalMax, normalMin, warningHigh, warningLow,
+    // criticalHigh, criticalLow, fatalHigh, fatalLow
+    pdr.insert(pdr.end(), 9, 0);
+    finishPdr(pdr);
+    return pdr;
+}
+
+/** @brief Append a General FRU record of ASCII fields to a FRU record
+ *         table
+ */
+void appendFruRecord(std::vector<uint8_t>& table, uint16_t recordSetId,
+                     const std::string& terminusName)
+{
+    auto recordSet = std::to_string(recordSetId);
+    std::array<std::pair<uint8_t, std::string>, 4> fields{{
+        {PLDM_FRU_FIELD_TYPE_MANUFAC, "OpenBMC"},
+        {PLDM_FRU_FIELD_TYPE_NAME, terminusName},
+        {PLDM_FRU_FIELD_TYPE_PN, "SIM-" + recordSet},
+        {PLDM_FRU_FIELD_TYPE_SN, terminusName + "-" + recordSet},
+    }};
+    appendLE(table, recordSetId, sizeof(uint16_t));
+    table.push_back(PLDM_FRU_RECORD_TYPE_GENERAL);
+    table.push_back(fields.size());
+    table.push_back(PLDM_FRU_ENCODING_ASCII);
+    for (const auto& [type, value] : fields)
+    {
+        table.push_back(type);
+        table.push_back(value.size());
+        table.insert(table.end(), value.begin(), value.end());
+    }
+}
+
+std::vector<uint8_t> ccOnlyResponse(const pldm_msg* request, uint8_t cc)
+{
+    std::vector<uint8_t> response(sizeof(pldm_msg_hdr) + sizeof(cc), 0);
+    auto responsePtr = new (response.data()) pldm_msg;
+    encode_cc_only_resp(request->hdr.instance_id, request->hdr.type,
+                        request->hdr.command, cc, responsePtr);
+    return response;
+}
+
+} // namespace
+
+std::optional<TerminusSpec> parseTerminusSpec(std::string_view spec)
+{
+    TerminusSpec terminusSpec{};
+    for (auto item : std::views::split(spec, ','))
+    {
+        std::string_view pair(item.begin(), item.end());
+        if (pair.empty())
+        {
+            continue;
+        }
+        auto pos = pair.find('=');
+        if (pos == std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+        auto key = pair.substr(0, pos);
+        auto value = pair.substr(pos + 1);
+
+        bool valid = false;
+        if (key == "name")
+        {
+            terminusSpec.name = value;
+            valid = !value.empty();
+        }
+        else if (key == "sensors")
+        {
+            // The sensor ID 0xFFFF is kept out of the range of the IDs
+            valid = parseNumber(value, terminusSpec.sensors) &&
+                    terminusSpec.sensors < UINT16_MAX;
+        }
+        else if (key == "interval")
+        {
+            valid = parseNumber(value, terminusSpec.interval) &&
+                    terminusSpec.interval > 0;
+        }
+        else if (key == "fru")
+        {
+            valid = parseNumber(value, terminusSpec.fru);
+        }
+        else if (key == "events")
+        {
+            valid = parseNumber(value, terminusSpec.events);
+        }
+        else if (key == "readings")
+        {
+            valid = true;
+            if (value == "constant")
+            {
+                terminusSpec.readings = ReadingGenerator::constant;
+            }
+            else if (value == "sawtooth")
+            {
+                terminusSpec.readings = ReadingGenerator::sawtooth;
+            }
+            else if (value == "random")
+            {
+                terminusSpec.readings = ReadingGenerator::random;
+            }
+            else
+            {
+                valid = false;
+            }
+        }
+
+        if (!valid)
+        {
+            return std::nullopt;
+        }
+    }
+    return terminusSpec;
+}
+
+SimulatedTerminus::SimulatedTerminus(uint8_t eid, const TerminusSpec& spec) :
+    eid(eid), generator(spec.readings), random(eid), readings(spec.sensors),
+    fruRecords(spec.fru)
+{
+    auto name = spec.name + std::to_string(eid);
+    pdrs.reserve(spec.sensors + 1);
+    pdrs.emplace_back(makeTerminusNamePdr(1, name));
+    for (uint16_t i = 0; i < spec.sensors; ++i)
+    {
+        pdrs.emplace_back(makeNumericSensorPdr(i + 2, i + 1, spec.interval));
+        readings[i] = minReading + i % (maxReading - minReading);
+    }
+    for (const auto& pdr : pdrs)
+    {
+        largestPdrSize = std::max(largestPdrSize, pdr.size());
+    }
+
+    // Each record is in a record set of its own
+    for (uint16_t i = 0; i < fruRecords; ++i)
+    {
+        appendFruRecord(fruTable, i + 1, name);
+    }
+
+    queueEvents(spec.events);
+}
+
+std::optional<std::vector<uint8_t>> SimulatedTerminus::handleRequest(
+    const pldm_msg* request, size_t len)
+{
+    if (len < sizeof(pldm_msg_hdr) || !request->hdr.request)
+    {
+        return std::nullopt;
+    }
+    counters.requests++;
+
+    auto payloadLength = len - sizeof(pldm_msg_hdr);
+    switch (request->hdr.type)
+    {
+        case PLDM_BASE:
+            return handleBase(request, payloadLength);
+        case PLDM_PLATFORM:
+            return handlePlatform(request, payloadLength);
+        case PLDM_FRU:
+            if (!fruTable.empty())
+            {
+                return handleFru(request, payloadLength);
+            }
+            break;
+        default:
+            break;
+    }
+    counters.unsupported++;
+    return ccOnlyResponse(request, PLDM_ERROR_INVALID_PLDM_TYPE);
+}
+
+std::vector<uint8_t> SimulatedTerminus::handleBase(const pldm_msg* request,
+                                                   size_t payloadLength)
+{
+    auto instanceId = request->hdr.instance_id;
+    switch (request->hdr.command)
+    {
+        case PLDM_GET_TID:
+        {
+            std::vector<uint8_t> response(
+                sizeof(pldm_msg_hdr) + PLDM_GET_TID_RESP_BYTES, 0);
+            auto responsePtr = new (response.data()) pldm_msg;
+            encode_get_tid_resp(instanceId, PLDM_SUCCESS, tid, responsePtr);
+            return response;
+        }
+        case PLDM_SET_TID:
+        {
+            if (payloadLength != sizeof(pldm_tid_t) ||
+                request->payload[0] == PLDM_TID_UNASSIGNED ||
+                request->payload[0] == PLDM_TID_RESERVED)
+            {
+                return ccOnlyResponse(request, PLDM_ERROR_INVALID_DATA);
+            }
+            tid = request->payload[0];
+            return ccOnlyResponse(request, PLDM_SUCCESS);
+        }
+        case PLDM_GET_PLDM_TYPES:
+        {
+            std::array<bitfield8_t, 8> types{};
+            types[0].byte = (1 << PLDM_BASE) | (1 << PLDM_PLATFORM);
+            if (!fruTable.empty())
+            {
+                types[0].byte |= 1 << PLDM_FRU;
+            }
+            std::vector<uint8_t> response(
+                sizeof(pldm_msg_hdr) + PLDM_GET_TYPES_RESP_BYTES, 0);
+            auto responsePtr = new (response.data()) pldm_msg;
+            encode_get_types_resp(instanceId, PLDM_SUCCESS, types.data(),
+                                  responsePtr);
+            return response;
+        }
+        case PLDM_GET_PLDM_VERSION:
+        {
+            uint32_t transferHandle = 0;
+            uint8_t transferFlag = 0;
+            uint8_t type = 0;
+            auto rc = decode_get_version_req(request, payloadLength,
+                                             &transferHandle, &transferFlag,
+                                             &type);
+            if (rc != PLDM_SUCCESS)
+            {
+                return ccOnlyResponse(request, rc);
+            }
+            ver32_t version{};
+            if (type == PLDM_BASE || (type == PLDM_FRU && !fruTable.empty()))
+            {
+                version = {0x00, 0xf0, 0xf0, 0xf1};
+            }
+            else if (type == PLDM_PLATFORM)
+            {
+                version = {0x00, 0xf0, 0xf2, 0xf1};
+            }
+            else
+            {
+                return ccOnlyResponse(request, PLDM_ERROR_INVALID_PLDM_TYPE);
+            }
+            std::vector<uint8_t> response(
+                sizeof(pldm_msg_hdr) + PLDM_GET_VERSION_RESP_BYTES, 0);
+            auto responsePtr = new (response.data()) pldm_msg;
+            encode_get_version_resp(instanceId, PLDM_SUCCESS, 0,
+                                    PLDM_START_AND_END, &version,
+                                    sizeof(pldm_version), responsePtr);
+            return response;
+        }
+        case PLDM_GET_PLDM_COMMANDS:
+        {
+            uint8_t type = 0;
+            ver32_t version{};
+            auto rc = decode_get_commands_req(request, payloadLength, &type,
+                                              &version);
+            if (rc != PLDM_SUCCESS)
+            {
+                return ccOnlyResponse(request, rc);
+            }
+            std::array<bitfield8_t, 32> cmds{};
+            auto setCommand = [&cmds](uint8_t cmd) {
+                cmds[cmd / 8].byte |= 1 << (cmd % 8);
+            };
+            if (type == PLDM_BASE)
+            {
+                setCommand(PLDM_GET_TID);
+                setCommand(PLDM_SET_TID);
+                setCommand(PLDM_GET_PLDM_VERSION);
+                setCommand(PLDM_GET_PLDM_TYPES);
+                setCommand(PLDM_GET_PLDM_COMMANDS);
+            }
+            else if (type == PLDM_PLATFORM)
+            {
+                setCommand(PLDM_SET_EVENT_RECEIVER);
+                setCommand(PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE);
+                setCommand(PLDM_GET_SENSOR_READING);
+                setCommand(PLDM_GET_PDR_REPOSITORY_INFO);
+                setCommand(PLDM_GET_PDR);
+            }
+            else if (type == PLDM_FRU && !fruTable.empty())
+            {
+                setCommand(PLDM_GET_FRU_RECORD_TABLE_METADATA);
+                setCommand(PLDM_GET_FRU_RECORD_TABLE);
+            }
+            else
+            {
+                return ccOnlyResponse(request, PLDM_ERROR_INVALID_PLDM_TYPE);
+            }
+            std::vector<uint8_t> response(
+                sizeof(pldm_msg_hdr) + PLDM_GET_COMMANDS_RESP_BYTES, 0);
+            auto responsePtr = new (response.data()) pldm_msg;
+            encode_get_commands_resp(instanceId, PLDM_SUCCESS, cmds.data(),
+                                     responsePtr);
+            return response;
+        }
+        default:
+            counters.unsupported++;
+            return ccOnlyResponse(request, PLDM_ERROR_UNSUPPORTED_PLDM_CMD);
+    }
+}
+
+std::vector<uint8_t> SimulatedTerminus::handlePlatform(const pldm_msg* request,
+                                                       size_t payloadLength)
+{
+    switch (request->hdr.command)
+    {
+        case PLDM_GET_PDR:
+            return getPDR(request, payloadLength);
+        case PLDM_GET_PDR_REPOSITORY_INFO:
+            return getPDRRepositoryInfo(request);
+        case PLDM_GET_SENSOR_READING:
+            return getSensorReading(request, payloadLength);
+        case PLDM_SET_EVENT_RECEIVER:
+            // The events are only polled, the receiver is accepted as is
+            counters.eventReceiverConfigs++;
+            return ccOnlyResponse(request, PLDM_SUCCESS);
+        case PLDM_POLL_FOR_PLATFORM_EVENT_MESSAGE:
+            return pollForPlatformEventMessage(request, payloadLength);
+        default:
+            counters.unsupported++;
+            return ccOnlyResponse(request, PLDM_ERROR_UNSUPPORTED_PLDM_CMD);
+    }
+}
+
+std::vector<uint8_t> SimulatedTerminus::handleFru(const pldm_msg* request,
+                                                  size_t payloadLength)
+{
+    switch (request->hdr.command)
+    {
+        case PLDM_GET_FRU_RECORD_TABLE_METADATA:
+        {
+            std::vector<uint8_t> response(
+                sizeof(pldm_msg_hdr) +
+                    PLDM_GET_FRU_RECORD_TABLE_METADATA_RESP_BYTES,
+                0);
+            auto responsePtr = new (response.data()) pldm_msg;
+            auto rc = encode_get_fru_record_table_metadata_resp(
+                request->hdr.instance_id, PLDM_SUCCESS, 1, 0, fruTable.size(),
+                fruTable.size(), fruRecords, fruRecords,
+                pldm_edac_crc32(fruTable.data(), fruTable.size()),
+                responsePtr);
+            if (rc != PLDM_SUCCESS)
+            {
+                return ccOnlyResponse(request, rc);
+            }
+            return response;
+        }
+        case PLDM_GET_FRU_RECORD_TABLE:
+            return getFRURecordTable(request, payloadLength);
+        default:
+            counters.unsupported++;
+            return ccOnlyResponse(request, PLDM_ERROR_UNSUPPORTED_PLDM_CMD);
+    }
+}
+
+std::vector<uint8_t> SimulatedTerminus::getPDR(const pldm_msg* request,
+                                               size_t payloadLength)
+{
+    uint32_t recordHandle = 0;
+    uint32_t dataTransferHandle = 0;
+    uint8_t transferOpFlag = 0;
+    uint16_t reqSizeBytes = 0;
+    uint16_t recordChangeNum = 0;
+    auto rc = decode_get_pdr_req(request, payloadLength, &recordHandle,
+                                 &dataTransferHandle, &transferOpFlag,
+                                 &reqSizeBytes, &recordChangeNum);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+
+    // Record handle 0 is the first record
+    size_t index = recordHandle ? recordHandle - 1 : 0;
+    if (index >= pdrs.size())
+    {
+        return ccOnlyResponse(request, PLDM_PLATFORM_INVALID_RECORD_HANDLE);
+    }
+    const auto& pdr = pdrs[index];
+    // The PDRs are sent in a single part
+    if (transferOpFlag != PLDM_GET_FIRSTPART || reqSizeBytes < pdr.size())
+    {
+        return ccOnlyResponse(request,
+                              PLDM_PLATFORM_INVALID_TRANSFER_OPERATION_FLAG);
+    }
+    counters.pdrs++;
+
+    uint32_t nextRecordHandle = index + 1 < pdrs.size() ? index + 2 : 0;
+    std::vector<uint8_t> response(
+        sizeof(pldm_msg_hdr) + PLDM_GET_PDR_MIN_RESP_BYTES + pdr.size(), 0);
+    auto responsePtr = new (response.data()) pldm_msg;
+    rc = encode_get_pdr_resp(request->hdr.instance_id, PLDM_SUCCESS,
+                             nextRecordHandle, 0, PLDM_START_AND_END,
+                             pdr.size(), pdr.data(), 0, responsePtr);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+    return response;
+}
+
+std::vector<uint8_t> SimulatedTerminus::getPDRRepositoryInfo(
+    const pldm_msg* request)
+{
+    size_t repositorySize = 0;
+    for (const auto& pdr : pdrs)
+    {
+        repositorySize += pdr.size();
+    }
+
+    // The repository never changes, its update time is left zero
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime{};
+    std::vector<uint8_t> response(
+        sizeof(pldm_msg_hdr) + PLDM_GET_PDR_REPOSITORY_INFO_RESP_BYTES, 0);
+    auto responsePtr = new (response.data()) pldm_msg;
+    auto rc = encode_get_pdr_repository_info_resp(
+        request->hdr.instance_id, PLDM_SUCCESS, PLDM_AVAILABLE,
+        updateTime.data(), updateTime.data(), pdrs.size(), repositorySize,
+        largestPdrSize, 0, responsePtr);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+    return response;
+}
+
+std::vector<uint8_t> SimulatedTerminus::getSensorReading(
+    const pldm_msg* request, size_t payloadLength)
+{
+    uint16_t sensorId = 0;
+    bool8_t rearm = 0;
+    auto rc = decode_get_sensor_reading_req(request, payloadLength, &sensorId,
+                                            &rearm);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+    if (sensorId == 0 || sensorId > readings.size())
+    {
+        return ccOnlyResponse(request, PLDM_PLATFORM_INVALID_SENSOR_ID);
+    }
+    counters.sensorReadings++;
+
+    auto reading = nextReading(sensorId - 1);
+    std::array<uint8_t, sizeof(reading)> presentReading{
+        static_cast<uint8_t>(reading), static_cast<uint8_t>(reading >> 8)};
+    std::vector<uint8_t> response(sizeof(pldm_msg_hdr) +
+                                      PLDM_GET_SENSOR_READING_MIN_RESP_BYTES +
+                                      presentReading.size() - 1,
+                                  0);
+    auto responsePtr = new (response.data()) pldm_msg;
+    rc = encode_get_sensor_reading_resp(
+        request->hdr.instance_id, PLDM_SUCCESS, PLDM_SENSOR_DATA_SIZE_UINT16,
+        PLDM_SENSOR_ENABLED, PLDM_NO_EVENT_GENERATION, PLDM_SENSOR_NORMAL,
+        PLDM_SENSOR_NORMAL, PLDM_SENSOR_NORMAL, presentReading.data(),
+        responsePtr, response.size() - sizeof(pldm_msg_hdr));
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+    return response;
+}
+
+std::vector<uint8_t> SimulatedTerminus::pollForPlatformEventMessage(
+    const pldm_msg* request, size_t payloadLength)
+{
+    uint8_t formatVersion = 0;
+    uint8_t transferOpFlag = 0;
+    uint32_t dataTransferHandle = 0;
+    uint16_t eventIdToAcknowledge = 0;
+    auto rc = decode_poll_for_platform_event_message_req(
+        request, payloadLength, &formatVersion, &transferOpFlag,
+        &dataTransferHandle, &eventIdToAcknowledge);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+
+    auto response = ccOnlyResponse(request, PLDM_SUCCESS);
+    response.push_back(tid);
+    if (transferOpFlag == PLDM_ACKNOWLEDGEMENT_ONLY)
+    {
+        // Only the event sent last can be acknowledged
+        if (events.empty() || events.front().id != eventIdToAcknowledge)
+        {
+            return ccOnlyResponse(request, PLDM_ERROR_INVALID_DATA);
+        }
+        events.pop_front();
+        counters.eventsAcknowledged++;
+        appendLE(response, PLDM_PLATFORM_EVENT_ID_ACK, sizeof(uint16_t));
+        return response;
+    }
+
+    // The events are sent in a single part
+    if (transferOpFlag != PLDM_GET_FIRSTPART)
+    {
+        return ccOnlyResponse(request,
+                              PLDM_PLATFORM_INVALID_TRANSFER_OPERATION_FLAG);
+    }
+    if (events.empty())
+    {
+        appendLE(response, PLDM_PLATFORM_EVENT_ID_NONE, sizeof(uint16_t));
+        return response;
+    }
+    counters.eventsPolled++;
+
+    const auto& event = events.front();
+    appendLE(response, event.id, sizeof(uint16_t));
+    appendLE(response, 0, sizeof(uint32_t)); // nextDataTransferHandle
+    response.push_back(PLDM_PLATFORM_TRANSFER_START_AND_END);
+    response.push_back(event.eventClass);
+    appendLE(response, event.data.size(), sizeof(uint32_t));
+    response.insert(response.end(), event.data.begin(), event.data.end());
+    return response;
+}
+
+std::vector<uint8_t> SimulatedTerminus::getFRURecordTable(
+    const pldm_msg* request, size_t payloadLength)
+{
+    uint32_t dataTransferHandle = 0;
+    uint8_t transferOpFlag = 0;
+    auto rc = decode_get_fru_record_table_req(
+        request, payloadLength, &dataTransferHandle, &transferOpFlag);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+
+    // The data transfer handle of a part is its offset in the table
+    size_t offset = 0;
+    if (transferOpFlag == PLDM_GET_NEXTPART)
+    {
+        offset = dataTransferHandle;
+    }
+    else if (transferOpFlag != PLDM_GET_FIRSTPART)
+    {
+        return ccOnlyResponse(request, PLDM_ERROR_INVALID_DATA);
+    }
+    if (offset >= fruTable.size())
+    {
+        return ccOnlyResponse(request, PLDM_ERROR_INVALID_DATA);
+    }
+    counters.fruParts++;
+
+    auto size = std::min(fruTablePartSize, fruTable.size() - offset);
+    auto end = offset + size;
+    bool last = end == fruTable.size();
+    uint8_t transferFlag = 0;
+    if (!offset)
+    {
+        transferFlag = last ? PLDM_START_AND_END : PLDM_START;
+    }
+    else
+    {
+        transferFlag = last ? PLDM_END : PLDM_MIDDLE;
+    }
+
+    constexpr auto hdrSize =
+        sizeof(pldm_msg_hdr) + PLDM_GET_FRU_RECORD_TABLE_MIN_RESP_BYTES;
+    std::vector<uint8_t> response(hdrSize + size, 0);
+    auto responsePtr = new (response.data()) pldm_msg;
+    rc = encode_get_fru_record_table_resp(request->hdr.instance_id,
+                                          PLDM_SUCCESS, last ? 0 : end,
+                                          transferFlag, responsePtr);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+    std::copy_n(fruTable.begin() + offset, size, response.begin() + hdrSize);
+    return response;
+}
+
+std::vector<uint8_t> SimulatedTerminus::sensorEventData(uint16_t sensorIndex)
+{
+    auto reading = nextReading(sensorIndex);
+    std::vector<uint8_t> eventData;
+    appendLE(eventData, sensorIndex + 1, sizeof(uint16_t)); // sensorID
+    eventData.push_back(PLDM_NUMERIC_SENSOR_STATE);
+    eventData.push_back(PLDM_SENSOR_NORMAL); // eventState
+    eventData.push_back(PLDM_SENSOR_NORMAL); // previousEventState
+    eventData.push_back(PLDM_SENSOR_DATA_SIZE_UINT16);
+    appendLE(eventData, reading, sizeof(reading));
+    return eventData;
+}
+
+std::vector<uint8_t> SimulatedTerminus::encodeSensorEvent(uint8_t instanceId,
+                                                          uint16_t sensorIndex)
+{
+    auto eventData = sensorEventData(sensorIndex);
+    std::vector<uint8_t> request(sizeof(pldm_msg_hdr) +
+                                     PLDM_PLATFORM_EVENT_MESSAGE_MIN_REQ_BYTES +
+                                     eventData.size(),
+                                 0);
+    auto requestPtr = new (request.data()) pldm_msg;
+    encode_platform_event_message_req(
+        instanceId, 1, tid, PLDM_SENSOR_EVENT, eventData.data(),
+        eventData.size(), requestPtr,
+        eventData.size() + PLDM_PLATFORM_EVENT_MESSAGE_MIN_REQ_BYTES);
+    return request;
+}
+
+void SimulatedTerminus::queueSensorEvent(uint16_t sensorIndex)
+{
+    events.push_back({nextEventId, PLDM_SENSOR_EVENT,
+                      sensorEventData(sensorIndex)});
+    // The event IDs 0x0000 and 0xFFFF are reserved
+    nextEventId = nextEventId + 1 < UINT16_MAX ? nextEventId + 1 : 1;
+}
+
+void SimulatedTerminus::queueEvents(size_t count)
+{
+    if (readings.empty())
+    {
+        return;
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        queueSensorEvent(nextEventSensor);
+        nextEventSensor = (nextEventSensor + 1) % readings.size();
+    }
+}
+
+uint16_t SimulatedTerminus::nextReading(uint16_t sensorIndex)
+{
+    auto& reading = readings[sensorIndex];
+    switch (generator)
+    {
+        case ReadingGenerator::constant:
+            break;
+        case ReadingGenerator::sawtooth:
+            reading = reading + 1 < maxReading ? reading + 1 : minReading;
+            break;
+        case ReadingGenerator::random:
+            reading = std::uniform_int_distribution<uint16_t>(
+                minReading, maxReading)(random);
+            break;
+    }
+    return reading;
+}
+
+LoopbackTerminus::LoopbackTerminus(sdeventplus::Event& event,
+                                   const std::filesystem::path& dir,
+                                   uint8_t eid, const TerminusSpec& spec) :
+    transport(dir, eid), terminus(eid, spec),
+    io(event, transport.getEventSource(), EPOLLIN,
+       [this](sdeventplus::source::IO&, int, uint32_t revents) {
+           if (revents & EPOLLIN)
+           {
+               receive();
+           }
+       })
+{}
+
+void LoopbackTerminus::receive()
+{
+    pldm_tid_t requester = 0;
+    void* rx = nullptr;
+    size_t len = 0;
+    while (transport.recvMsg(requester, rx, len) == PLDM_REQUESTER_SUCCESS)
+    {
+        auto response =
+            terminus.handleRequest(static_cast<const pldm_msg*>(rx), len);
+        free(rx);
+        rx = nullptr;
+        if (response)
+        {
+            transport.sendMsg(requester, response->data(), response->size());
+        }
+    }
+}
+
+} // namespace loadgen
+} // namespace pldm
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "common/transport.hpp"
+
+#include <libpldm/base.h>
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/source/io.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace pldm
+{
+namespace loadgen
+{
+
+/** @brief The way the readings of the numeric sensors change */
+enum class ReadingGenerator
+{
+    constant, //!< The readings never change
+    sawtooth, //!< The readings ramp up by one on every read and wrap around
+    random,   //!< The readings are uniformly distributed over the range
+};
+
+/** @brief The description of a simulated terminus
+ *
+ *  A spec is written as comma separated key=value pairs, e.g.
+ *  "name=Gpu,sensors=256,interval=0.5,fru=2,readings=random,events=16".
+ *  The keys left out keep their default value.
+ */
+struct TerminusSpec
+{
+    /** @brief The prefix of the terminus name, the EID is appended to it */
+    std::string name = "Sim";
+    /** @brief The number of numeric sensors */
+    uint16_t sensors = 100;
+    /** @brief The update interval of the sensors in seconds */
+    float interval = 1.0;
+    /** @brief The number of records of the FRU record table, 0 disables the
+     *         FRU commands
+     */
+    uint16_t fru = 0;
+    /** @brief The generator of the sensor readings */
+    ReadingGenerator readings = ReadingGenerator::sawtooth;
+    /** @brief The number of sensor events queued for
+     *         PollForPlatformEventMessage at start
+     */
+    uint16_t events = 0;
+};
+
+/** @brief Parse a terminus spec
+ *
+ *  @param[in] spec - The comma separated key=value pairs of the spec
+ *
+ *  @return The terminus spec, std::nullopt if the spec is not valid
+ */
+std::optional<TerminusSpec> parseTerminusSpec(std::string_view spec);
+
+/** @class SimulatedTerminus
+ *
+ *  A PLDM terminus answering the commands platform-mc sends to discover a
+ *  terminus, to poll its sensors and to poll its events. The terminus reports
+ *  a name through an Entity Auxiliary Names PDR, a number of UINT16
+ *  temperature numeric sensors, an optional FRU record table and a queue of
+ *  events drained by PollForPlatformEventMessage.
+ */
+class SimulatedTerminus
+{
+  public:
+    /** @brief The counters of the requests answered by the terminus */
+    struct Counters
+    {
+        uint64_t requests = 0;
+        uint64_t pdrs = 0;
+        uint64_t sensorReadings = 0;
+        uint64_t fruParts = 0;
+        uint64_t eventReceiverConfigs = 0;
+        uint64_t eventsPolled = 0;
+        uint64_t eventsAcknowledged = 0;
+        uint64_t unsupported = 0;
+    };
+
+    /** @brief Constructor
+     *
+     *  @param[in] eid - The EID of the terminus
+     *  @param[in] spec - The description of the terminus
+     */
+    SimulatedTerminus(uint8_t eid, const TerminusSpec& spec);
+
+    /** @brief Handle a request to the terminus
+     *
+     *  @param[in] request - The request message
+     *  @param[in] len - The length of the request message
+     *
+     *  @return The response message, std::nullopt if the message is not a
+     *          request
+     */
+    std::optional<std::vector<uint8_t>> handleRequest(const pldm_msg* request,
+                                                      size_t len);
+
+    /** @brief Encode a PlatformEventMessage request carrying a
+     *         numericSensorState sensor event of a sensor
+     *
+     *  @param[in] instanceId - The instance ID of the request
+     *  @param[in] sensorIndex - The index of the sensor
+     *
+     *  @return The request message
+     */
+    std::vector<uint8_t> encodeSensorEvent(uint8_t instanceId,
+                                           uint16_t sensorIndex);
+
+    /** @brief Queue a numericSensorState sensor event of a sensor for
+     *         PollForPlatformEventMessage
+     *
+     *  @param[in] sensorIndex - The index of the sensor
+     */
+    void queueSensorEvent(uint16_t sensorIndex);
+
+    /** @brief Queue sensor events of the sensors in turn
+     *
+     *  @param[in] count - The number of events
+     */
+    void queueEvents(size_t count);
+
+    /** @brief The number of events not acknowledged yet */
+    size_t getQueuedEvents() const
+    {
+        return events.size();
+    }
+
+    /** @brief The EID of the terminus */
+    uint8_t getEid() const
+    {
+        return eid;
+    }
+
+    /** @brief The TID of the terminus, assigned by SetTID */
+    pldm_tid_t getTid() const
+    {
+        return tid;
+    }
+
+    /** @brief The number of numeric sensors of the terminus */
+    uint16_t getSensorCount() const
+    {
+        return static_cast<uint16_t>(readings.size());
+    }
+
+    /** @brief The counters of the requests answered by the terminus */
+    const Counters& getCounters() const
+    {
+        return counters;
+    }
+
+  private:
+    /** @brief An event waiting to be polled and acknowledged */
+    struct Event
+    {
+        uint16_t id;
+        uint8_t eventClass;
+        std::vector<uint8_t> data;
+    };
+
+    /** @brief Handle the PLDM base commands */
+    std::vector<uint8_t> handleBase(const pldm_msg* request,
+                                    size_t payloadLength);
+
+    /** @brief Handle the PLDM platform commands */
+    std::vector<uint8_t> handlePlatform(const pldm_msg* request,
+                                        size_t payloadLength);
+
+    /** @brief Handle the PLDM FRU commands */
+    std::vector<uint8_t> handleFru(const pldm_msg* request,
+                                   size_t payloadLength);
+
+    /** @brief GetPDR handler */
+    std::vector<uint8_t> getPDR(const pldm_msg* request, size_t payloadLength);
+
+    /** @brief GetPDRRepositoryInfo handler */
+    std::vector<uint8_t> getPDRRepositoryInfo(const pldm_msg* request);
+
+    /** @brief GetSensorReading handler */
+    std::vector<uint8_t> getSensorReading(const pldm_msg* request,
+                                          size_t payloadLength);
+
+    /** @brief PollForPlatformEventMessage handler */
+    std::vector<uint8_t> pollForPlatformEventMessage(const pldm_msg* request,
+                                                     size_t payloadLength);
+
+    /** @brief GetFRURecordTable handler */
+    std::vector<uint8_t> getFRURecordTable(const pldm_msg* request,
+                                           size_t payloadLength);
+
+    /** @brief The numericSensorState sensor event data of a sensor */
+    std::vector<uint8_t> sensorEventData(uint16_t sensorIndex);
+
+    /** @brief The next reading of a sensor from the reading generator */
+    uint16_t nextReading(uint16_t sensorIndex);
+
+    /** @brief The EID of the terminus */
+    uint8_t eid;
+
+    /** @brief The TID of the terminus */
+    pldm_tid_t tid = PLDM_TID_UNASSIGNED;
+
+    /** @brief The generator of the sensor readings */
+    ReadingGenerator generator;
+
+    /** @brief The source of the random readings, seeded by the EID */
+    std::minstd_rand random;
+
+    /** @brief The PDRs of the terminus, the record handle is the index + 1 */
+    std::vector<std::vector<uint8_t>> pdrs;
+
+    /** @brief The size of the largest PDR */
+    size_t largestPdrSize = 0;
+
+    /** @brief The last reading of each sensor */
+    std::vector<uint16_t> readings;
+
+    /** @brief The FRU record table, empty when FRU is not supported */
+    std::vector<uint8_t> fruTable;
+
+    /** @brief The number of records of the FRU record table */
+    uint16_t fruRecords = 0;
+
+    /** @brief The events waiting for PollForPlatformEventMessage */
+    std::deque<Event> events;
+
+    /** @brief The ID of the next queued event */
+    uint16_t nextEventId = 1;
+
+    /** @brief The sensor of the next event queued by queueEvents() */
+    uint16_t nextEventSensor = 0;
+
+    /** @brief The counters of the requests answered by the terminus */
+    Counters counters;
+};
+
+/** @class LoopbackTerminus
+ *
+ *  A simulated terminus bound on the loopback transport, answering the
+ *  requests it receives from the event loop right away. A requester Handler
+ *  on the same loopback directory talks to it as to an MCTP endpoint.
+ */
+class LoopbackTerminus
+{
+  public:
+    /** @brief Constructor
+     *
+     *  @param[in] event - The event loop receiving the requests
+     *  @param[in] dir - The loopback transport directory
+     *  @param[in] eid - The EID of the terminus
+     *  @param[in] spec - The description of the terminus
+     */
+    LoopbackTerminus(sdeventplus::Event& event,
+                     const std::filesystem::path& dir, uint8_t eid,
+                     const TerminusSpec& spec);
+
+    /** @brief The simulated terminus */
+    SimulatedTerminus& getTerminus()
+    {
+        return terminus;
+    }
+
+  private:
+    /** @brief Receive and answer the pending requests */
+    void receive();
+
+    LoopbackTransport transport;
+    SimulatedTerminus terminus;
+    sdeventplus::source::IO io;
+};
+
+} // namespace loadgen
+} // namespace pldm